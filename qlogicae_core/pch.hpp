@@ -61,9 +61,13 @@
 #include <rocksdb/options.h>
 #include <rocksdb/iterator.h>
 #include <rocksdb/listener.h>
+#include <rocksdb/perf_level.h>
+#include <rocksdb/statistics.h>
 #include <rocksdb/convenience.h>
+#include <rocksdb/perf_context.h>
 #include <rocksdb/write_batch.h>
 #include <rocksdb/filter_policy.h>
+#include <rocksdb/sst_file_writer.h>
 #include <rocksdb/compaction_filter.h>
 #include <rocksdb/utilities/checkpoint.h>
 #include <rocksdb/utilities/backup_engine.h>
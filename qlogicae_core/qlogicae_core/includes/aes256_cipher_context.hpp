@@ -0,0 +1,54 @@
+#pragma once
+
+#include "result.hpp"
+
+#include <sodium.h>
+
+namespace QLogicaeCore
+{
+    class AES256CipherContext
+    {
+    public:
+        AES256CipherContext();
+
+        ~AES256CipherContext();
+
+        explicit AES256CipherContext(
+            const unsigned char* key
+        );
+
+        AES256CipherContext(
+            const AES256CipherContext& instance
+        ) = delete;
+
+        AES256CipherContext(
+            AES256CipherContext&& instance
+        ) noexcept = delete;
+
+        AES256CipherContext& operator = (
+            AES256CipherContext&& instance
+        ) = delete;
+
+        AES256CipherContext& operator = (
+            const AES256CipherContext& instance
+        ) = delete;
+
+        bool setup(
+            const unsigned char* key
+        );
+
+        void setup(
+            Result<void>& result,
+            const unsigned char* key
+        );
+
+        bool is_ready() const;
+
+        const crypto_aead_aes256gcm_state& get_state() const;
+
+    private:
+        bool _is_ready;
+
+        crypto_aead_aes256gcm_state _state;
+    };
+}
@@ -46,9 +46,13 @@
 #include "../includes/supported_qlogicae_ide.hpp"
 #include "../includes/outlier_removal_options.hpp"
 #include "../includes/cryptographer_properties.hpp"
+#include "../includes/validation_kernels.hpp"
+#include "../includes/validation_matchers.hpp"
 #include "../includes/validation_password_rules.hpp"
+#include "../includes/validation_predicate.hpp"
 #include "../includes/windows_registry_root_path.hpp"
 #include "../includes/jsonwebtoken_reverse_input.hpp"
+#include "../includes/jsonwebtoken_verified_token.hpp"
 #include "../includes/string_memory_pool_snapshot.hpp"
 #include "../includes/jsonwebtoken_reverse_result.hpp"
 #include "../includes/supported_qlogicae_installer.hpp"
@@ -74,6 +78,7 @@
 #include "../includes/file_uri_io.hpp"
 #include "../includes/xml_file_io.hpp"
 #include "../includes/toml_file_io.hpp"
+#include "../includes/json_file_io_document.hpp"
 #include "../includes/json_file_io.hpp"
 #include "../includes/text_file_io.hpp"
 #include "../includes/binary_file_io.hpp"
@@ -106,12 +111,30 @@
 #include "../includes/bcrypt_hash_cryptographer.hpp"
 #include "../includes/sha256_hash_cryptographer.hpp"
 #include "../includes/jsonwebtoken_cryptographer.hpp"
+#include "../includes/aes256_cipher_context.hpp"
 #include "../includes/aes256_cipher_cryptographer.hpp"
 #include "../includes/argon2id_hash_cryptographer.hpp"
 #include "../includes/aes256_signature_cryptographer.hpp"
 #include "../includes/xchacha20_poly1305_cipher_cryptographer.hpp"
+#include "../includes/cipher_stream_chunk.hpp"
+#include "../includes/cipher_stream_queue.hpp"
+#include "../includes/cipher_file_stream.hpp"
+#include "../includes/cipher_batch.hpp"
+#include "../includes/cipher_batch_runner.hpp"
+#include "../includes/password_hash_calibration.hpp"
+#include "../includes/password_hash_calibrator.hpp"
+#include "../includes/password_hash_executor_configurations.hpp"
+#include "../includes/password_hash_executor.hpp"
+#include "../includes/sha256_kernel.hpp"
+#include "../includes/sha256_kernels.hpp"
+#include "../includes/sha256_hash_context.hpp"
 
 // Mathematics
+#include "../includes/statistician_digest_centroid.hpp"
+#include "../includes/statistician_digest.hpp"
+#include "../includes/statistician_accumulator.hpp"
+#include "../includes/statistician_kernels.hpp"
+#include "../includes/statistician_strided_span.hpp"
 #include "../includes/statistician.hpp"
 
 // Networks
@@ -124,6 +147,7 @@
 #include "../includes/windows_registry.hpp"
 
 // Miscellaneous
+#include "../includes/xoshiro256_plus_plus.hpp"
 #include "../includes/generator.hpp"
 #include "../includes/validators.hpp"
 #include "../includes/temperature.hpp"
@@ -137,8 +161,10 @@
 #include "../includes/sqlite.hpp"
 #include "../includes/sqlite_backend.hpp"
 #include "../includes/sqlite_exception.hpp"
+#include "../includes/sqlite_configurations.hpp"
 #include "../includes/sqlite_statement_data.hpp"
 #include "../includes/sqlite_row.hpp"
+#include "../includes/sqlite_row_cursor.hpp"
 #include "../includes/sqlite_database.hpp"
 #include "../includes/sqlite_statement.hpp"
 #include "../includes/sqlite_transaction.hpp"
@@ -147,10 +173,42 @@
 #include "../includes/gmail_mailer.hpp"
 
 // RocksDB
+#include "../includes/rocksdb_statistics.hpp"
+#include "../includes/rocksdb_perf_context.hpp"
+#include "../includes/rocksdb_event_listener.hpp"
+#include "../includes/rocksdb_bulk_load_configurations.hpp"
 #include "../includes/rocksdb_database.hpp"
 
+// Concurrent Cache
+#include "../includes/concurrent_cache_entry.hpp"
+#include "../includes/concurrent_cache_shard.hpp"
+#include "../includes/concurrent_cache_statistics.hpp"
+#include "../includes/concurrent_cache_eviction_policy.hpp"
+#include "../includes/concurrent_cache_configurations.hpp"
+#include "../includes/concurrent_cache.hpp"
+
+// Tiered Cache
+#include "../includes/tiered_cache_write_policy.hpp"
+#include "../includes/tiered_cache_statistics.hpp"
+#include "../includes/tiered_cache_configurations.hpp"
+#include "../includes/tiered_cache.hpp"
+
+// Unicode Kernels
+#include "../includes/cpu_features.hpp"
+#include "../includes/unicode_kernels.hpp"
+#include "../includes/encoding_kernels.hpp"
+
 // Boost Interprocess Cache
+#include "../includes/boost_interprocess_cache_bucket_state.hpp"
+#include "../includes/boost_interprocess_cache_bucket.hpp"
+#include "../includes/boost_interprocess_cache_retired_buffer.hpp"
+#include "../includes/boost_interprocess_cache_reader_slot.hpp"
 #include "../includes/boost_interprocess_cache_shared_data.hpp"
+#include "../includes/boost_interprocess_cache_read_guard.hpp"
+#include "../includes/boost_interprocess_cache_mapping.hpp"
+#include "../includes/boost_interprocess_cache_control_data.hpp"
+#include "../includes/boost_interprocess_cache_store_status.hpp"
+#include "../includes/boost_interprocess_cache_configurations.hpp"
 #include "../includes/boost_interprocess_cache.hpp"
 
 // QLogicae Application
@@ -3,6 +3,7 @@
 #include "result.hpp"
 #include "logger.hpp"
 #include "utilities.hpp"
+#include "tiered_cache.hpp"
 #include "rocksdb_database.hpp"
 #include "application_utilities.hpp"
 #include "abstract_application.hpp"
@@ -11,7 +12,7 @@ namespace QLogicaeCore
 {
     struct ApplicationCacheConfigurations
     {
-
+        TieredCacheConfigurations tiered_cache_configurations;
     };
 
     class ApplicationCache :
@@ -508,6 +509,13 @@ namespace QLogicaeCore
         ) = delete;
 
         ApplicationCacheConfigurations _configurations;
+
+        std::unique_ptr<TieredCache> _tiered_cache;
+
+        std::string _get_key(
+            const std::string& cache_name,
+            const std::string& key_path
+        );
     };
 
     inline static ApplicationCache& QLOGICAE_APPLICATION_CACHE =
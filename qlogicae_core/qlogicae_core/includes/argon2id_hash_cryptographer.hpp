@@ -6,6 +6,10 @@
 #include "generator.hpp"
 #include "cryptographer.hpp"
 #include "cryptographer_properties.hpp"
+#include "password_hash_executor.hpp"
+#include "password_hash_calibrator.hpp"
+
+#include <chrono>
 
 namespace QLogicaeCore
 {
@@ -152,6 +156,17 @@ namespace QLogicaeCore
             const std::string& text
         );
 
+        CryptographerProperties calibrate(
+            const std::chrono::milliseconds& target_latency,
+            const std::size_t& memory_limit_in_bytes
+        );
+
+        void calibrate(
+            Result<CryptographerProperties>& result,
+            const std::chrono::milliseconds& target_latency,
+            const std::size_t& memory_limit_in_bytes
+        );
+
         static Argon2idHashCryptographer& get_instance();
 
         static void get_instance(
@@ -160,6 +175,10 @@ namespace QLogicaeCore
 
     protected:
         CryptographerProperties _cryptographer_properties;
+
+        CryptographerProperties _get_cryptographer_properties();
+
+        std::size_t _get_hash_memory_in_bytes();
     };
 
     inline static Argon2idHashCryptographer& ARGON2ID_HASH_CRYPTOGRAPHER =
@@ -5,6 +5,11 @@
 #include "encoder.hpp"
 #include "generator.hpp"
 #include "cryptographer.hpp"
+#include "cryptographer_properties.hpp"
+#include "password_hash_executor.hpp"
+#include "password_hash_calibrator.hpp"
+
+#include <chrono>
 
 namespace QLogicaeCore
 {
@@ -14,6 +19,11 @@ namespace QLogicaeCore
     public:
         BcryptHashCryptographer();
 
+        BcryptHashCryptographer(
+            const CryptographerProperties&
+                cryptographer_properties
+        );
+
         ~BcryptHashCryptographer() = default;
 
         BcryptHashCryptographer(
@@ -41,6 +51,15 @@ namespace QLogicaeCore
         void setup(
             Result<void>& result
         );
+
+        bool setup(
+            const CryptographerProperties& properties
+        );
+
+        void setup(
+            Result<void>& result,
+            const CryptographerProperties& properties
+        );
         
         std::future<bool> setup_async();
 
@@ -118,11 +137,29 @@ namespace QLogicaeCore
             const std::string& key
         );
 
+        CryptographerProperties calibrate(
+            const std::chrono::milliseconds& target_latency,
+            const std::size_t& memory_limit_in_bytes
+        );
+
+        void calibrate(
+            Result<CryptographerProperties>& result,
+            const std::chrono::milliseconds& target_latency,
+            const std::size_t& memory_limit_in_bytes
+        );
+
         static BcryptHashCryptographer& get_instance();
 
         static void get_instance(
             Result<BcryptHashCryptographer*>& result
         );
+
+    protected:
+        CryptographerProperties _cryptographer_properties;
+
+        CryptographerProperties _get_cryptographer_properties();
+
+        std::size_t _get_hash_memory_in_bytes();
     };
 
     inline static BcryptHashCryptographer& BCRYPT_HASH_CRYPTOGRAPHER =
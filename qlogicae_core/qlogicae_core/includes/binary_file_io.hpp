@@ -1,6 +1,7 @@
 #pragma once
 
 #include "result.hpp"
+#include "encoder.hpp"
 #include "utilities.hpp"
 #include "file_mode.hpp"
 #include "abstract_file_io.hpp"
@@ -9,7 +10,9 @@
 #include <fast_io_device.h>                
 #include <fast_io_legacy.h>
 
+#include <span>
 #include <string>
+#include <memory>
 #include <cstdint>
 #include <fstream>
 #include <optional>
@@ -77,6 +80,17 @@ namespace QLogicaeCore
             const std::span<const std::byte>& content
         );
 
+        std::size_t get_size();
+
+        std::size_t read_block(
+            const std::uint64_t& offset,
+            std::span<std::byte> buffer
+        );
+
+        bool write_block(
+            const std::span<const std::byte>& content
+        );
+
         std::future<bool> open_async(
             const FileMode& file_mode
         );
@@ -126,6 +140,21 @@ namespace QLogicaeCore
             const std::span<const std::byte>& content
         );
 
+        void get_size(
+            Result<std::size_t>& result
+        );
+
+        void read_block(
+            Result<std::size_t>& result,
+            const std::uint64_t& offset,
+            std::span<std::byte> buffer
+        );
+
+        void write_block(
+            Result<bool>& result,
+            const std::span<const std::byte>& content
+        );
+
         void open_async(
             Result<std::future<bool>>& result,
             const FileMode& file_mode
@@ -167,6 +196,8 @@ namespace QLogicaeCore
         std::optional<fast_io::obuf_file> _append_file;
 
         std::optional<fast_io::native_file_loader> _read_file;
+
+        std::shared_ptr<void> _read_block_handle;
     };
 }
 
@@ -3,49 +3,40 @@
 #include "result.hpp"
 #include "utilities.hpp"
 #include "byte_size.hpp"
+#include "boost_interprocess_cache_mapping.hpp"
+#include "boost_interprocess_cache_read_guard.hpp"
+#include "boost_interprocess_cache_reader_slot.hpp"
 #include "boost_interprocess_cache_shared_data.hpp"
+#include "boost_interprocess_cache_control_data.hpp"
+#include "boost_interprocess_cache_store_status.hpp"
+#include "boost_interprocess_cache_configurations.hpp"
 
-#include <boost/interprocess/containers/map.hpp>
-#include <boost/interprocess/containers/string.hpp>
-#include <boost/interprocess/containers/vector.hpp>
 #include <boost/interprocess/managed_mapped_file.hpp>
 #include <boost/interprocess/allocators/allocator.hpp>
 #include <boost/interprocess/managed_shared_memory.hpp>
+#include <boost/interprocess/sync/file_lock.hpp>
+#include <boost/interprocess/sync/scoped_lock.hpp>
 
+#include <span>
+#include <mutex>
+#include <atomic>
+#include <chrono>
 #include <string>
+#include <cstdint>
 #include <vector>
 #include <future>
 #include <memory>
+#include <optional>
 #include <utility>
 #include <functional>
+#include <string_view>
 #include <unordered_map>
 
 namespace QLogicaeCore
-{    
-    using segment_t =
-        boost::interprocess::managed_shared_memory;
-    
-    using manager_t =
-        segment_t::segment_manager;
-    
-    using char_allocator_t =
-        boost::interprocess::allocator<
-            char, manager_t
-        >;
-    
-    using string_t =
-        boost::interprocess::basic_string<
-            char, std::char_traits<char>, char_allocator_t
-        >;
-    
-    using value_allocator_t =
-        boost::interprocess::allocator<
-            std::pair<const string_t, string_t>, manager_t
-        >;
-
-    using map_t =
-        boost::interprocess::map<
-            string_t, string_t, std::less<string_t>, value_allocator_t
+{
+    using writer_lock_t =
+        boost::interprocess::scoped_lock<
+            boost::interprocess::interprocess_mutex
         >;
 
     class BoostInterprocessCache
@@ -56,16 +47,31 @@ namespace QLogicaeCore
             const BytesSize& size = BytesSize::KB_4
         );
 
+        explicit BoostInterprocessCache(
+            const BoostInterprocessCacheConfigurations& configurations
+        );
+
+        ~BoostInterprocessCache();
+
         void setup(
             Result<void>& result,
             const std::string& name = UTILITIES.DEFAULT_BOOST_INTERPROCESS_CACHE,
             const BytesSize& size = BytesSize::KB_4
         );
 
+        void setup(
+            Result<void>& result,
+            const BoostInterprocessCacheConfigurations& configurations
+        );
+
         void clear(
             Result<void>& result
         );
-        
+
+        void flush(
+            Result<void>& result
+        );
+
         bool is_key_found(
             const char* key
         );
@@ -75,16 +81,39 @@ namespace QLogicaeCore
             Result<void>& result
         );
 
+        void remove_expired(
+            Result<std::size_t>& result
+        );
+
         void read(
             const char* key,
             Result<const char*>& result
         );
-        
+
         void write(
             const char* key,
             const char* value, Result<void>& result
         );
 
+        void write(
+            const char* key,
+            const char* value,
+            const std::chrono::milliseconds& time_to_live,
+            Result<void>& result
+        );
+
+        void read_view(
+            const std::string_view key,
+            BoostInterprocessCacheReadGuard& guard,
+            Result<std::string_view>& result
+        );
+
+        void copy_into(
+            const std::string_view key,
+            std::span<char> buffer,
+            Result<std::size_t>& result
+        );
+
         void remove_batch(
             const std::vector<const char*>& keys,
             Result<void>& result
@@ -100,10 +129,17 @@ namespace QLogicaeCore
             std::unordered_map<const char*, const char*>& out,
             Result<void>& result
         );
-        
+
+        void read_batch(
+            const std::vector<std::string_view>& keys,
+            std::span<char> buffer,
+            std::vector<std::optional<std::string_view>>& out,
+            Result<std::size_t>& result
+        );
+
         std::future<void> write_async(
             const char* key,
-            const char* value, 
+            const char* value,
             Result<void>& result
         );
 
@@ -111,39 +147,222 @@ namespace QLogicaeCore
             const char* key,
             Result<const char*>& result
         );
-        
+
+        std::future<void> read_view_async(
+            const std::string_view key,
+            BoostInterprocessCacheReadGuard& guard,
+            Result<std::string_view>& result
+        );
+
+        std::future<void> copy_into_async(
+            const std::string_view key,
+            std::span<char> buffer,
+            Result<std::size_t>& result
+        );
+
         std::future<bool> is_key_found_async(
             const char* key
         );
-        
+
         std::future<void> remove_async(
             const char* key,
             Result<void>& result
         );
-        
+
         std::future<void> clear_async(
             Result<void>& result
         );
-        
+
         std::future<void> write_batch_async(
             const std::unordered_map<const char*, const char*>& items,
             Result<void>& result
         );
-        
+
         std::future<void> read_batch_async(
             const std::vector<const char*>& keys,
             std::unordered_map<const char*, const char*>& out,
             Result<void>& result
         );
-        
+
         std::future<void> remove_batch_async(
             const std::vector<const char*>& keys,
             Result<void>& result
         );
-    
+
+        uint64_t get_entry_count();
+
+        uint64_t get_bucket_count();
+
+        uint64_t get_generation();
+
+        std::size_t get_segment_size();
+
     private:
-        segment_t _segment;
+        BoostInterprocessCacheConfigurations _configurations;
+
+        std::unique_ptr<segment_t> _control_segment;
+
+        std::unique_ptr<mapped_file_t> _control_file;
+
+        boost::interprocess::file_lock _file_lock;
+
+        bool _is_file_locked = false;
+
+        BoostInterprocessCacheControlData* _control = nullptr;
+
+        std::mutex _mapping_mutex;
+
+        std::atomic<std::shared_ptr<BoostInterprocessCacheMapping>> _mapping;
+
+        void _attach(
+            const BoostInterprocessCacheConfigurations& configurations
+        );
+
+        void _detach();
+
+        void _recover();
 
-        BoostInterprocessCacheSharedData* _data = nullptr;
+        bool _flush(
+            BoostInterprocessCacheMapping& mapping
+        );
+
+        std::shared_ptr<BoostInterprocessCacheMapping> _get_mapping();
+
+        std::unique_ptr<BoostInterprocessCacheMapping> _open_mapping(
+            const uint64_t generation
+        );
+
+        std::unique_ptr<BoostInterprocessCacheMapping> _create_mapping(
+            const uint64_t generation,
+            const std::size_t size_in_bytes
+        );
+
+        void _publish_mapping(
+            std::shared_ptr<BoostInterprocessCacheMapping> mapping
+        );
+
+        std::string _get_segment_name(
+            const uint64_t generation
+        );
+
+        std::string _get_base_name();
+
+        void _remove_segment(
+            const std::string& name
+        );
+
+        writer_lock_t _lock_writer(
+            std::shared_ptr<BoostInterprocessCacheMapping>& mapping
+        );
+
+        bool _find(
+            BoostInterprocessCacheMapping& mapping,
+            const std::string_view key,
+            const char** value_pointer = nullptr,
+            std::size_t* value_size = nullptr,
+            char* buffer = nullptr,
+            const std::size_t buffer_capacity = 0,
+            const bool is_external_copied = true,
+            bool* is_copied = nullptr
+        );
+
+        BoostInterprocessCacheBucket* _find_slot(
+            BoostInterprocessCacheMapping& mapping,
+            const std::string_view key,
+            const uint64_t hash,
+            bool& is_found
+        );
+
+        BoostInterprocessCacheStoreStatus _store(
+            BoostInterprocessCacheMapping& mapping,
+            const std::string_view key,
+            const std::string_view value,
+            const uint64_t expiration_time
+        );
+
+        BoostInterprocessCacheStoreStatus _store_entry(
+            BoostInterprocessCacheMapping& mapping,
+            const std::string_view key,
+            const std::string_view value,
+            const uint64_t expiration_time
+        );
+
+        bool _make_room(
+            BoostInterprocessCacheMapping& mapping,
+            const std::size_t required_size
+        );
+
+        bool _rebuild(
+            BoostInterprocessCacheMapping& mapping,
+            const std::size_t size_in_bytes
+        );
+
+        uint64_t _evict(
+            BoostInterprocessCacheMapping& mapping,
+            const uint64_t count
+        );
+
+        bool _erase(
+            BoostInterprocessCacheMapping& mapping,
+            const std::string_view key
+        );
+
+        bool _erase_bucket(
+            BoostInterprocessCacheMapping& mapping,
+            BoostInterprocessCacheBucket& bucket
+        );
+
+        BoostInterprocessCacheReaderSlot* _acquire_reader_slot(
+            BoostInterprocessCacheMapping& mapping,
+            uint64_t& owner
+        );
+
+        void _release_abandoned_reader_slots(
+            BoostInterprocessCacheMapping& mapping
+        );
+
+        bool _has_retired_capacity(
+            BoostInterprocessCacheMapping& mapping
+        );
+
+        void _retire(
+            BoostInterprocessCacheMapping& mapping,
+            const uint64_t handle
+        );
+
+        void _reclaim(
+            BoostInterprocessCacheMapping& mapping
+        );
+
+        const char* _get_bucket_data(
+            BoostInterprocessCacheMapping& mapping,
+            const BoostInterprocessCacheBucket& bucket,
+            const std::size_t size
+        );
+
+        uint64_t _get_expiration_time(
+            const std::chrono::milliseconds& time_to_live
+        );
+
+        static bool _is_expired(
+            const uint64_t expiration_time,
+            const uint64_t current_time
+        );
+
+        static uint64_t _get_current_time();
+
+        static uint64_t _get_reader_owner();
+
+        static bool _is_reader_owner_alive(
+            const uint64_t owner
+        );
+
+        static uint64_t _get_bucket_count(
+            const std::size_t size_in_bytes
+        );
+
+        static uint64_t _hash(
+            const std::string_view key
+        );
     };
 }
@@ -0,0 +1,34 @@
+#pragma once
+
+#include "boost_interprocess_cache_bucket_state.hpp"
+
+#include <atomic>
+#include <cstdint>
+
+namespace QLogicaeCore
+{
+    struct BoostInterprocessCacheBucket
+    {
+        static constexpr uint32_t INLINE_CAPACITY = 64;
+
+        std::atomic<uint64_t> sequence { 0 };
+
+        std::atomic<uint32_t> state {
+            static_cast<uint32_t>(BoostInterprocessCacheBucketState::EMPTY)
+        };
+
+        std::atomic<uint32_t> key_size { 0 };
+
+        std::atomic<uint32_t> value_size { 0 };
+
+        std::atomic<uint64_t> hash { 0 };
+
+        std::atomic<uint64_t> external_handle { 0 };
+
+        std::atomic<uint64_t> expiration_time { 0 };
+
+        std::atomic<uint32_t> is_referenced { 0 };
+
+        char inline_data[INLINE_CAPACITY] = {};
+    };
+}
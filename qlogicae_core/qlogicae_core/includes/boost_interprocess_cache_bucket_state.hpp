@@ -0,0 +1,16 @@
+#pragma once
+
+#include <cstdint>
+
+namespace QLogicaeCore
+{
+    enum class BoostInterprocessCacheBucketState :
+        uint32_t
+    {
+        EMPTY,
+
+        OCCUPIED,
+
+        DELETED
+    };
+}
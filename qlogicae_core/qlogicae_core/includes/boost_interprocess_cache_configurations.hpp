@@ -0,0 +1,35 @@
+#pragma once
+
+#include "utilities.hpp"
+#include "byte_size.hpp"
+
+#include <string>
+#include <cstdint>
+
+namespace QLogicaeCore
+{
+    struct BoostInterprocessCacheConfigurations
+    {
+        std::string name = UTILITIES.DEFAULT_BOOST_INTERPROCESS_CACHE;
+
+        BytesSize size = BytesSize::KB_4;
+
+        std::size_t maximum_size_in_bytes = 0;
+
+        double growth_factor = 2.0;
+
+        double maximum_load_factor = 0.75;
+
+        uint64_t maximum_entry_count = 0;
+
+        uint64_t default_time_to_live_in_milliseconds = 0;
+
+        uint64_t reader_lease_in_milliseconds = 0;
+
+        bool is_eviction_enabled = true;
+
+        bool is_persistent = false;
+
+        std::string file_path = "";
+    };
+}
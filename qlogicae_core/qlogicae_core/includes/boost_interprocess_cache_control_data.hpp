@@ -0,0 +1,18 @@
+#pragma once
+
+#include <boost/interprocess/sync/interprocess_mutex.hpp>
+
+#include <atomic>
+#include <cstdint>
+
+namespace QLogicaeCore
+{
+    struct BoostInterprocessCacheControlData
+    {
+        boost::interprocess::interprocess_mutex _mutex;
+
+        std::atomic<uint64_t> generation { 0 };
+
+        bool is_clean = false;
+    };
+}
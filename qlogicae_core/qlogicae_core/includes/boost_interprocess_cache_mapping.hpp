@@ -0,0 +1,26 @@
+#pragma once
+
+#include "boost_interprocess_cache_shared_data.hpp"
+
+#include <memory>
+#include <cstdint>
+
+namespace QLogicaeCore
+{
+    struct BoostInterprocessCacheMapping
+    {
+        std::unique_ptr<segment_t> segment;
+
+        std::unique_ptr<mapped_file_t> file;
+
+        manager_t* manager = nullptr;
+
+        BoostInterprocessCacheSharedData* data = nullptr;
+
+        uint64_t generation = 0;
+
+        char* address = nullptr;
+
+        std::size_t size = 0;
+    };
+}
@@ -0,0 +1,63 @@
+#pragma once
+
+#include "boost_interprocess_cache_bucket.hpp"
+#include "boost_interprocess_cache_mapping.hpp"
+#include "boost_interprocess_cache_reader_slot.hpp"
+
+#include <atomic>
+#include <memory>
+#include <string>
+#include <cstdint>
+#include <string_view>
+
+namespace QLogicaeCore
+{
+    class BoostInterprocessCacheReadGuard
+    {
+    public:
+        BoostInterprocessCacheReadGuard() = default;
+
+        ~BoostInterprocessCacheReadGuard();
+
+        BoostInterprocessCacheReadGuard(
+            const BoostInterprocessCacheReadGuard&
+        ) = delete;
+
+        BoostInterprocessCacheReadGuard(
+            BoostInterprocessCacheReadGuard&& other
+        ) noexcept;
+
+        BoostInterprocessCacheReadGuard& operator=(
+            const BoostInterprocessCacheReadGuard&
+        ) = delete;
+
+        BoostInterprocessCacheReadGuard& operator=(
+            BoostInterprocessCacheReadGuard&& other
+        ) noexcept;
+
+        bool is_active() const;
+
+        std::string_view get_value() const;
+
+        void release();
+
+    protected:
+        std::shared_ptr<BoostInterprocessCacheMapping> _mapping;
+
+        BoostInterprocessCacheReaderSlot* _reader_slot = nullptr;
+
+        uint64_t _reader_owner = 0;
+
+        std::string_view _value;
+
+        std::string _buffer;
+
+        char _inline_buffer[BoostInterprocessCacheBucket::INLINE_CAPACITY] = {};
+
+        void _move_from(
+            BoostInterprocessCacheReadGuard& other
+        );
+
+        friend class BoostInterprocessCache;
+    };
+}
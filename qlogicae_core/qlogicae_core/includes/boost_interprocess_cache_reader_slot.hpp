@@ -0,0 +1,18 @@
+#pragma once
+
+#include <atomic>
+#include <cstdint>
+
+namespace QLogicaeCore
+{
+    struct BoostInterprocessCacheReaderSlot
+    {
+        static constexpr uint64_t RELEASING_OWNER = UINT64_MAX;
+
+        std::atomic<uint64_t> owner { 0 };
+
+        std::atomic<uint64_t> epoch { 0 };
+
+        std::atomic<uint64_t> lease_time { 0 };
+    };
+}
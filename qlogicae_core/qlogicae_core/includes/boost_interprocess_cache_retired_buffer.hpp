@@ -0,0 +1,13 @@
+#pragma once
+
+#include <cstdint>
+
+namespace QLogicaeCore
+{
+    struct BoostInterprocessCacheRetiredBuffer
+    {
+        uint64_t handle = 0;
+
+        uint64_t epoch = 0;
+    };
+}
@@ -1,44 +1,65 @@
 #pragma once
 
-#include <boost/interprocess/containers/map.hpp>
-#include <boost/interprocess/containers/string.hpp>
+#include "boost_interprocess_cache_bucket.hpp"
+#include "boost_interprocess_cache_reader_slot.hpp"
+#include "boost_interprocess_cache_retired_buffer.hpp"
+
+#include <boost/interprocess/offset_ptr.hpp>
 #include <boost/interprocess/allocators/allocator.hpp>
+#include <boost/interprocess/managed_mapped_file.hpp>
 #include <boost/interprocess/managed_shared_memory.hpp>
+#include <boost/interprocess/sync/interprocess_mutex.hpp>
+
+#include <atomic>
+#include <cstdint>
 
 namespace QLogicaeCore
 {
     using segment_t =
         boost::interprocess::managed_shared_memory;
     
+    using mapped_file_t =
+        boost::interprocess::managed_mapped_file;
+
     using manager_t =
         segment_t::segment_manager;
     
     using char_allocator_t =
         boost::interprocess::allocator<char, manager_t>;
-    
-    using string_t =
-        boost::interprocess::basic_string<
-            char, std::char_traits<char>, char_allocator_t
-        >;
-    
-    using value_allocator_t =
-        boost::interprocess::allocator<
-            std::pair<const string_t, string_t>, manager_t
-        >;
-    
-    using map_t =
-        boost::interprocess::map<
-            string_t, string_t, std::less<string_t>, value_allocator_t
-        >;
 
     struct BoostInterprocessCacheSharedData
     {
+        static constexpr uint32_t READER_SLOT_COUNT = 32;
+
         boost::interprocess::interprocess_mutex _mutex;
 
-        map_t map;
+        std::atomic<uint64_t> entry_count { 0 };
+
+        std::atomic<uint64_t> tombstone_count { 0 };
+
+        uint64_t bucket_count = 0;
+
+        uint64_t clock_hand = 0;
+
+        std::atomic<bool> is_retired { false };
+
+        boost::interprocess::offset_ptr<BoostInterprocessCacheBucket> buckets;
+
+        std::atomic<uint64_t> epoch { 1 };
+
+        BoostInterprocessCacheReaderSlot reader_slots[READER_SLOT_COUNT];
+
+        uint64_t retired_count = 0;
+
+        uint64_t retired_capacity = 0;
+
+        boost::interprocess::offset_ptr<
+            BoostInterprocessCacheRetiredBuffer
+        > retired_buffers;
 
         BoostInterprocessCacheSharedData(
-            const value_allocator_t& alloc
+            manager_t* manager,
+            const uint64_t bucket_count
         );
     };
-}
\ No newline at end of file
+}
@@ -0,0 +1,18 @@
+#pragma once
+
+#include <cstdint>
+
+namespace QLogicaeCore
+{
+    enum class BoostInterprocessCacheStoreStatus :
+        uint8_t
+    {
+        STORED,
+
+        REJECTED,
+
+        FULL,
+
+        RETRY
+    };
+}
@@ -0,0 +1,25 @@
+#pragma once
+
+#include <boost/dynamic_bitset.hpp>
+
+#include <string>
+#include <vector>
+#include <string_view>
+
+namespace QLogicaeCore
+{
+    struct CipherBatch
+    {
+        std::string arena;
+
+        std::vector<std::size_t> offsets;
+
+        std::vector<std::size_t> sizes;
+
+        boost::dynamic_bitset<> flags;
+
+        std::string_view get_value(
+            const std::size_t& index
+        ) const;
+    };
+}
@@ -0,0 +1,33 @@
+#pragma once
+
+#include "result.hpp"
+#include "utilities.hpp"
+#include "thread_pool.hpp"
+#include "cipher_batch.hpp"
+
+#include <span>
+#include <optional>
+#include <functional>
+
+namespace QLogicaeCore
+{
+    using cipher_batch_capacity_t =
+        std::function<std::size_t(const std::size_t& index)>;
+
+    using cipher_batch_transform_t =
+        std::function<std::optional<std::size_t>(
+            const std::size_t& index,
+            std::span<char> output
+        )>;
+
+    class CipherBatchRunner
+    {
+    public:
+        static void run(
+            Result<CipherBatch>& result,
+            const std::size_t& count,
+            const cipher_batch_capacity_t& get_capacity,
+            const cipher_batch_transform_t& transform
+        );
+    };
+}
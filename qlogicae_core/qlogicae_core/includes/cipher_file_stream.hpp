@@ -0,0 +1,40 @@
+#pragma once
+
+#include "result.hpp"
+#include "utilities.hpp"
+#include "binary_file_io.hpp"
+#include "cipher_stream_chunk.hpp"
+#include "cipher_stream_queue.hpp"
+
+#include <span>
+#include <atomic>
+#include <string>
+#include <thread>
+#include <cstdint>
+#include <functional>
+
+namespace QLogicaeCore
+{
+    using cipher_stream_transform_t =
+        std::function<bool(CipherStreamChunk& chunk)>;
+
+    class CipherFileStream
+    {
+    public:
+        static void run(
+            Result<std::uint64_t>& result,
+            const std::string& input_path,
+            const std::string& output_path,
+            const std::uint64_t& input_offset,
+            const std::size_t& chunk_size,
+            std::span<const unsigned char> header,
+            const cipher_stream_transform_t& transform
+        );
+
+        static void read_header(
+            Result<void>& result,
+            const std::string& input_path,
+            std::span<unsigned char> header
+        );
+    };
+}
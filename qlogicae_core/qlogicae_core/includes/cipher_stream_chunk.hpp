@@ -0,0 +1,16 @@
+#pragma once
+
+#include <vector>
+#include <cstdint>
+
+namespace QLogicaeCore
+{
+    struct CipherStreamChunk
+    {
+        std::uint64_t index = 0;
+
+        bool is_final = false;
+
+        std::vector<unsigned char> data;
+    };
+}
@@ -0,0 +1,59 @@
+#pragma once
+
+#include "cipher_stream_chunk.hpp"
+
+#include <deque>
+#include <mutex>
+#include <condition_variable>
+
+namespace QLogicaeCore
+{
+    class CipherStreamQueue
+    {
+    public:
+        explicit CipherStreamQueue(
+            const std::size_t capacity
+        );
+
+        ~CipherStreamQueue();
+
+        CipherStreamQueue(
+            const CipherStreamQueue& instance
+        ) = delete;
+
+        CipherStreamQueue(
+            CipherStreamQueue&& instance
+        ) noexcept = delete;
+
+        CipherStreamQueue& operator = (
+            CipherStreamQueue&& instance
+        ) = delete;
+
+        CipherStreamQueue& operator = (
+            const CipherStreamQueue& instance
+        ) = delete;
+
+        bool push(
+            CipherStreamChunk&& chunk
+        );
+
+        bool pop(
+            CipherStreamChunk& chunk
+        );
+
+        void close();
+
+    protected:
+        std::size_t _capacity;
+
+        bool _is_closed;
+
+        std::deque<CipherStreamChunk> _chunks;
+
+        std::mutex _mutex;
+
+        std::condition_variable _push_signal;
+
+        std::condition_variable _pop_signal;
+    };
+}
@@ -0,0 +1,1019 @@
+#pragma once
+
+#include "result.hpp"
+#include "concurrent_cache_entry.hpp"
+#include "concurrent_cache_shard.hpp"
+#include "concurrent_cache_statistics.hpp"
+#include "concurrent_cache_configurations.hpp"
+#include "concurrent_cache_eviction_policy.hpp"
+
+#include <bit>
+#include <mutex>
+#include <chrono>
+#include <memory>
+#include <future>
+#include <cstdint>
+#include <cstddef>
+#include <utility>
+#include <iterator>
+#include <optional>
+#include <algorithm>
+#include <exception>
+#include <functional>
+#include <shared_mutex>
+
+namespace QLogicaeCore
+{
+    template <
+        typename KeyType,
+        typename ValueType,
+        typename HashType = std::hash<KeyType>
+    >
+    class ConcurrentCache
+    {
+    public:
+        using weigher_t =
+            std::function<std::size_t(const KeyType&, const ValueType&)>;
+
+        explicit ConcurrentCache(
+            const ConcurrentCacheConfigurations& configurations = {},
+            const weigher_t& weigher = {}
+        );
+
+        ~ConcurrentCache() = default;
+
+        ConcurrentCache(
+            const ConcurrentCache& instance
+        ) = delete;
+
+        ConcurrentCache(
+            ConcurrentCache&& instance
+        ) noexcept = delete;
+
+        ConcurrentCache& operator = (
+            ConcurrentCache&& instance
+        ) = delete;
+
+        ConcurrentCache& operator = (
+            const ConcurrentCache& instance
+        ) = delete;
+
+        bool get(
+            const KeyType& key,
+            ValueType& value
+        );
+
+        std::optional<ValueType> get(
+            const KeyType& key
+        );
+
+        void get(
+            Result<ValueType>& result,
+            const KeyType& key
+        );
+
+        bool put(
+            const KeyType& key,
+            ValueType value
+        );
+
+        bool put(
+            const KeyType& key,
+            ValueType value,
+            const std::chrono::milliseconds& time_to_live
+        );
+
+        void put(
+            Result<void>& result,
+            const KeyType& key,
+            ValueType value
+        );
+
+        template <typename LoaderType>
+        std::optional<ValueType> get_or_load(
+            const KeyType& key,
+            LoaderType&& loader
+        );
+
+        bool remove(
+            const KeyType& key
+        );
+
+        bool is_key_found(
+            const KeyType& key
+        );
+
+        std::size_t remove_expired();
+
+        void clear();
+
+        std::size_t get_size();
+
+        std::size_t get_weight();
+
+        std::size_t get_maximum_weight();
+
+        std::size_t get_shard_count();
+
+        ConcurrentCacheStatistics get_statistics();
+
+        void reset_statistics();
+
+    private:
+        using shard_t = ConcurrentCacheShard<KeyType, ValueType, HashType>;
+
+        using entry_t = typename shard_t::entry_t;
+
+        using queue_t = typename shard_t::queue_t;
+
+        using queue_iterator_t = typename queue_t::iterator;
+
+        ConcurrentCacheConfigurations _configurations;
+
+        weigher_t _weigher;
+
+        HashType _hasher;
+
+        std::size_t _shard_count = 1;
+
+        std::size_t _shard_capacity = 1;
+
+        std::size_t _small_capacity = 1;
+
+        std::size_t _ghost_capacity = 1;
+
+        std::unique_ptr<shard_t[]> _shards;
+
+        shard_t& _get_shard(
+            const std::size_t hash
+        );
+
+        bool _get_recent(
+            shard_t& shard,
+            const KeyType& key,
+            ValueType& value
+        );
+
+        bool _store(
+            shard_t& shard,
+            const KeyType& key,
+            const std::size_t hash,
+            ValueType value,
+            const uint64_t expiration_time
+        );
+
+        void _invalidate_loader(
+            shard_t& shard,
+            const KeyType& key
+        );
+
+        void _evict(
+            shard_t& shard
+        );
+
+        void _evict_small(
+            shard_t& shard
+        );
+
+        void _evict_main(
+            shard_t& shard
+        );
+
+        void _erase(
+            shard_t& shard,
+            queue_iterator_t iterator
+        );
+
+        void _add_ghost(
+            shard_t& shard,
+            const std::size_t hash
+        );
+
+        bool _remove_ghost(
+            shard_t& shard,
+            const std::size_t hash
+        );
+
+        bool _is_reinserted();
+
+        std::size_t _get_weight(
+            const KeyType& key,
+            const ValueType& value
+        );
+
+        uint64_t _get_expiration_time(
+            const std::chrono::milliseconds& time_to_live
+        );
+
+        static uint64_t _get_current_time();
+
+        static bool _is_expired(
+            const uint64_t expiration_time
+        );
+    };
+
+    template <typename KeyType, typename ValueType, typename HashType>
+    ConcurrentCache<KeyType, ValueType, HashType>::ConcurrentCache(
+        const ConcurrentCacheConfigurations& configurations,
+        const weigher_t& weigher
+    ) :
+        _configurations(configurations),
+        _weigher(weigher)
+    {
+        const std::size_t maximum_weight =
+            std::max<std::size_t>(1, configurations.maximum_weight);
+
+        _shard_count = std::bit_floor(
+            std::clamp<std::size_t>(
+                configurations.shard_count, 1, maximum_weight
+            )
+        );
+        _shard_capacity = std::max<std::size_t>(
+            1, maximum_weight / _shard_count
+        );
+        _small_capacity = std::max<std::size_t>(
+            1,
+            static_cast<std::size_t>(
+                _shard_capacity *
+                std::clamp(configurations.small_queue_ratio, 0.0, 1.0)
+            )
+        );
+        _ghost_capacity = std::max<std::size_t>(
+            1,
+            static_cast<std::size_t>(
+                _shard_capacity *
+                std::max(configurations.ghost_queue_ratio, 0.0)
+            )
+        );
+        _shards = std::make_unique<shard_t[]>(_shard_count);
+    }
+
+    template <typename KeyType, typename ValueType, typename HashType>
+    bool ConcurrentCache<KeyType, ValueType, HashType>::get(
+        const KeyType& key,
+        ValueType& value
+    )
+    {
+        shard_t& shard = _get_shard(_hasher(key));
+        bool is_expired = false;
+
+        if (_configurations.eviction_policy ==
+            ConcurrentCacheEvictionPolicy::LRU)
+        {
+            return _get_recent(shard, key, value);
+        }
+
+        {
+            std::shared_lock lock(shard.mutex);
+
+            auto iterator = shard.index.find(key);
+            if (iterator != shard.index.end())
+            {
+                entry_t& entry = *iterator->second;
+                if (!_is_expired(entry.expiration_time))
+                {
+                    const uint8_t frequency =
+                        entry.frequency.load(std::memory_order_relaxed);
+                    if (frequency < 3)
+                    {
+                        entry.frequency.store(
+                            frequency + 1, std::memory_order_relaxed
+                        );
+                    }
+
+                    value = entry.value;
+                    shard.hit_count.fetch_add(1, std::memory_order_relaxed);
+
+                    return true;
+                }
+
+                is_expired = true;
+            }
+        }
+
+        shard.miss_count.fetch_add(1, std::memory_order_relaxed);
+
+        if (is_expired)
+        {
+            std::unique_lock lock(shard.mutex);
+
+            auto iterator = shard.index.find(key);
+            if (iterator != shard.index.end() &&
+                _is_expired(iterator->second->expiration_time))
+            {
+                _erase(shard, iterator->second);
+                shard.expiration_count.fetch_add(
+                    1, std::memory_order_relaxed
+                );
+            }
+        }
+
+        return false;
+    }
+
+    template <typename KeyType, typename ValueType, typename HashType>
+    std::optional<ValueType> ConcurrentCache<KeyType, ValueType, HashType>::get(
+        const KeyType& key
+    )
+    {
+        ValueType value;
+        if (!get(key, value))
+        {
+            return std::nullopt;
+        }
+
+        return value;
+    }
+
+    template <typename KeyType, typename ValueType, typename HashType>
+    void ConcurrentCache<KeyType, ValueType, HashType>::get(
+        Result<ValueType>& result,
+        const KeyType& key
+    )
+    {
+        ValueType value;
+        if (!get(key, value))
+        {
+            return result.set_to_bad_status_without_value();
+        }
+
+        result.set_to_good_status_with_value(
+            std::move(value)
+        );
+    }
+
+    template <typename KeyType, typename ValueType, typename HashType>
+    bool ConcurrentCache<KeyType, ValueType, HashType>::put(
+        const KeyType& key,
+        ValueType value
+    )
+    {
+        return put(
+            key,
+            std::move(value),
+            std::chrono::milliseconds(
+                _configurations.default_time_to_live_in_milliseconds
+            )
+        );
+    }
+
+    template <typename KeyType, typename ValueType, typename HashType>
+    bool ConcurrentCache<KeyType, ValueType, HashType>::put(
+        const KeyType& key,
+        ValueType value,
+        const std::chrono::milliseconds& time_to_live
+    )
+    {
+        const std::size_t hash = _hasher(key);
+        shard_t& shard = _get_shard(hash);
+
+        _invalidate_loader(shard, key);
+
+        std::unique_lock lock(shard.mutex);
+
+        return _store(
+            shard,
+            key,
+            hash,
+            std::move(value),
+            _get_expiration_time(time_to_live)
+        );
+    }
+
+    template <typename KeyType, typename ValueType, typename HashType>
+    void ConcurrentCache<KeyType, ValueType, HashType>::put(
+        Result<void>& result,
+        const KeyType& key,
+        ValueType value
+    )
+    {
+        if (!put(key, std::move(value)))
+        {
+            return result.set_to_bad_status_without_value();
+        }
+
+        result.set_to_good_status_without_value();
+    }
+
+    template <typename KeyType, typename ValueType, typename HashType>
+    template <typename LoaderType>
+    std::optional<ValueType> ConcurrentCache<KeyType, ValueType, HashType>::get_or_load(
+        const KeyType& key,
+        LoaderType&& loader
+    )
+    {
+        ValueType value;
+        if (get(key, value))
+        {
+            return value;
+        }
+
+        const std::size_t hash = _hasher(key);
+        shard_t& shard = _get_shard(hash);
+        std::promise<std::optional<ValueType>> promise;
+
+        {
+            std::unique_lock lock(shard.loader_mutex);
+
+            auto iterator = shard.loaders.find(key);
+            if (iterator != shard.loaders.end())
+            {
+                std::shared_future<std::optional<ValueType>> future =
+                    iterator->second.future;
+                shard.coalesced_load_count.fetch_add(
+                    1, std::memory_order_relaxed
+                );
+                lock.unlock();
+
+                return future.get();
+            }
+
+            shard.loaders.emplace(
+                key,
+                ConcurrentCacheLoader<KeyType, ValueType>
+                {
+                    promise.get_future().share(),
+                    false
+                }
+            );
+        }
+
+        shard.load_count.fetch_add(1, std::memory_order_relaxed);
+
+        std::optional<ValueType> loaded_value;
+        try
+        {
+            loaded_value = loader();
+        }
+        catch (...)
+        {
+            {
+                std::unique_lock lock(shard.loader_mutex);
+
+                shard.loaders.erase(key);
+            }
+
+            promise.set_exception(std::current_exception());
+
+            throw;
+        }
+
+        {
+            std::unique_lock lock(shard.loader_mutex);
+
+            auto iterator = shard.loaders.find(key);
+            if (iterator != shard.loaders.end())
+            {
+                if (loaded_value.has_value() &&
+                    !iterator->second.is_invalidated)
+                {
+                    std::unique_lock shard_lock(shard.mutex);
+
+                    _store(
+                        shard,
+                        key,
+                        hash,
+                        *loaded_value,
+                        _get_expiration_time(
+                            std::chrono::milliseconds(
+                                _configurations.default_time_to_live_in_milliseconds
+                            )
+                        )
+                    );
+                }
+
+                shard.loaders.erase(iterator);
+            }
+        }
+
+        promise.set_value(loaded_value);
+
+        return loaded_value;
+    }
+
+    template <typename KeyType, typename ValueType, typename HashType>
+    bool ConcurrentCache<KeyType, ValueType, HashType>::remove(
+        const KeyType& key
+    )
+    {
+        shard_t& shard = _get_shard(_hasher(key));
+
+        _invalidate_loader(shard, key);
+
+        std::unique_lock lock(shard.mutex);
+
+        auto iterator = shard.index.find(key);
+        if (iterator == shard.index.end())
+        {
+            return false;
+        }
+
+        _erase(shard, iterator->second);
+
+        return true;
+    }
+
+    template <typename KeyType, typename ValueType, typename HashType>
+    bool ConcurrentCache<KeyType, ValueType, HashType>::is_key_found(
+        const KeyType& key
+    )
+    {
+        shard_t& shard = _get_shard(_hasher(key));
+
+        std::shared_lock lock(shard.mutex);
+
+        auto iterator = shard.index.find(key);
+
+        return iterator != shard.index.end() &&
+            !_is_expired(iterator->second->expiration_time);
+    }
+
+    template <typename KeyType, typename ValueType, typename HashType>
+    std::size_t ConcurrentCache<KeyType, ValueType, HashType>::remove_expired()
+    {
+        std::size_t count = 0;
+
+        for (std::size_t index = 0; index < _shard_count; ++index)
+        {
+            shard_t& shard = _shards[index];
+
+            std::unique_lock lock(shard.mutex);
+
+            for (queue_t* queue : { &shard.small_queue, &shard.main_queue })
+            {
+                for (auto iterator = queue->begin(); iterator != queue->end();)
+                {
+                    auto current = iterator++;
+                    if (_is_expired(current->expiration_time))
+                    {
+                        _erase(shard, current);
+                        shard.expiration_count.fetch_add(
+                            1, std::memory_order_relaxed
+                        );
+                        ++count;
+                    }
+                }
+            }
+        }
+
+        return count;
+    }
+
+    template <typename KeyType, typename ValueType, typename HashType>
+    void ConcurrentCache<KeyType, ValueType, HashType>::clear()
+    {
+        for (std::size_t index = 0; index < _shard_count; ++index)
+        {
+            shard_t& shard = _shards[index];
+
+            {
+                std::unique_lock lock(shard.loader_mutex);
+
+                for (auto& [key, loader] : shard.loaders)
+                {
+                    loader.is_invalidated = true;
+                }
+            }
+
+            std::unique_lock lock(shard.mutex);
+
+            shard.index.clear();
+            shard.small_queue.clear();
+            shard.main_queue.clear();
+            shard.ghost_queue.clear();
+            shard.ghost_index.clear();
+            shard.small_weight = 0;
+            shard.main_weight = 0;
+        }
+    }
+
+    template <typename KeyType, typename ValueType, typename HashType>
+    std::size_t ConcurrentCache<KeyType, ValueType, HashType>::get_size()
+    {
+        std::size_t size = 0;
+
+        for (std::size_t index = 0; index < _shard_count; ++index)
+        {
+            std::shared_lock lock(_shards[index].mutex);
+
+            size += _shards[index].index.size();
+        }
+
+        return size;
+    }
+
+    template <typename KeyType, typename ValueType, typename HashType>
+    std::size_t ConcurrentCache<KeyType, ValueType, HashType>::get_weight()
+    {
+        std::size_t weight = 0;
+
+        for (std::size_t index = 0; index < _shard_count; ++index)
+        {
+            std::shared_lock lock(_shards[index].mutex);
+
+            weight += _shards[index].small_weight +
+                _shards[index].main_weight;
+        }
+
+        return weight;
+    }
+
+    template <typename KeyType, typename ValueType, typename HashType>
+    std::size_t ConcurrentCache<KeyType, ValueType, HashType>::get_maximum_weight()
+    {
+        return _shard_capacity * _shard_count;
+    }
+
+    template <typename KeyType, typename ValueType, typename HashType>
+    std::size_t ConcurrentCache<KeyType, ValueType, HashType>::get_shard_count()
+    {
+        return _shard_count;
+    }
+
+    template <typename KeyType, typename ValueType, typename HashType>
+    ConcurrentCacheStatistics ConcurrentCache<KeyType, ValueType, HashType>::get_statistics()
+    {
+        ConcurrentCacheStatistics statistics;
+
+        for (std::size_t index = 0; index < _shard_count; ++index)
+        {
+            shard_t& shard = _shards[index];
+
+            statistics.hit_count +=
+                shard.hit_count.load(std::memory_order_relaxed);
+            statistics.miss_count +=
+                shard.miss_count.load(std::memory_order_relaxed);
+            statistics.insertion_count +=
+                shard.insertion_count.load(std::memory_order_relaxed);
+            statistics.rejection_count +=
+                shard.rejection_count.load(std::memory_order_relaxed);
+            statistics.eviction_count +=
+                shard.eviction_count.load(std::memory_order_relaxed);
+            statistics.expiration_count +=
+                shard.expiration_count.load(std::memory_order_relaxed);
+            statistics.load_count +=
+                shard.load_count.load(std::memory_order_relaxed);
+            statistics.coalesced_load_count +=
+                shard.coalesced_load_count.load(std::memory_order_relaxed);
+
+            std::shared_lock lock(shard.mutex);
+
+            statistics.entry_count += shard.index.size();
+            statistics.weight += shard.small_weight + shard.main_weight;
+        }
+
+        const uint64_t request_count =
+            statistics.hit_count + statistics.miss_count;
+        if (request_count != 0)
+        {
+            statistics.hit_ratio =
+                static_cast<double>(statistics.hit_count) /
+                static_cast<double>(request_count);
+        }
+
+        return statistics;
+    }
+
+    template <typename KeyType, typename ValueType, typename HashType>
+    void ConcurrentCache<KeyType, ValueType, HashType>::reset_statistics()
+    {
+        for (std::size_t index = 0; index < _shard_count; ++index)
+        {
+            shard_t& shard = _shards[index];
+
+            shard.hit_count.store(0, std::memory_order_relaxed);
+            shard.miss_count.store(0, std::memory_order_relaxed);
+            shard.insertion_count.store(0, std::memory_order_relaxed);
+            shard.rejection_count.store(0, std::memory_order_relaxed);
+            shard.eviction_count.store(0, std::memory_order_relaxed);
+            shard.expiration_count.store(0, std::memory_order_relaxed);
+            shard.load_count.store(0, std::memory_order_relaxed);
+            shard.coalesced_load_count.store(0, std::memory_order_relaxed);
+        }
+    }
+
+    template <typename KeyType, typename ValueType, typename HashType>
+    typename ConcurrentCache<KeyType, ValueType, HashType>::shard_t&
+        ConcurrentCache<KeyType, ValueType, HashType>::_get_shard(
+            const std::size_t hash
+        )
+    {
+        const uint64_t mixed_hash =
+            static_cast<uint64_t>(hash) * 0x9E3779B97F4A7C15ull;
+
+        return _shards[
+            static_cast<std::size_t>(mixed_hash >> 32) & (_shard_count - 1)
+        ];
+    }
+
+    template <typename KeyType, typename ValueType, typename HashType>
+    bool ConcurrentCache<KeyType, ValueType, HashType>::_get_recent(
+        shard_t& shard,
+        const KeyType& key,
+        ValueType& value
+    )
+    {
+        std::unique_lock lock(shard.mutex);
+
+        auto iterator = shard.index.find(key);
+        if (iterator == shard.index.end())
+        {
+            shard.miss_count.fetch_add(1, std::memory_order_relaxed);
+
+            return false;
+        }
+
+        if (_is_expired(iterator->second->expiration_time))
+        {
+            _erase(shard, iterator->second);
+            shard.expiration_count.fetch_add(1, std::memory_order_relaxed);
+            shard.miss_count.fetch_add(1, std::memory_order_relaxed);
+
+            return false;
+        }
+
+        shard.main_queue.splice(
+            shard.main_queue.begin(), shard.main_queue, iterator->second
+        );
+        value = iterator->second->value;
+        shard.hit_count.fetch_add(1, std::memory_order_relaxed);
+
+        return true;
+    }
+
+    template <typename KeyType, typename ValueType, typename HashType>
+    bool ConcurrentCache<KeyType, ValueType, HashType>::_store(
+        shard_t& shard,
+        const KeyType& key,
+        const std::size_t hash,
+        ValueType value,
+        const uint64_t expiration_time
+    )
+    {
+        const std::size_t weight = _get_weight(key, value);
+        auto iterator = shard.index.find(key);
+
+        if (weight > _shard_capacity)
+        {
+            if (iterator != shard.index.end())
+            {
+                _erase(shard, iterator->second);
+            }
+
+            shard.rejection_count.fetch_add(1, std::memory_order_relaxed);
+
+            return false;
+        }
+
+        if (iterator != shard.index.end())
+        {
+            entry_t& entry = *iterator->second;
+            std::size_t& queue_weight = entry.is_main ?
+                shard.main_weight : shard.small_weight;
+
+            queue_weight = queue_weight - entry.weight + weight;
+            entry.value = std::move(value);
+            entry.weight = weight;
+            entry.expiration_time = expiration_time;
+
+            if (_configurations.eviction_policy ==
+                ConcurrentCacheEvictionPolicy::LRU)
+            {
+                shard.main_queue.splice(
+                    shard.main_queue.begin(),
+                    shard.main_queue,
+                    iterator->second
+                );
+            }
+        }
+        else
+        {
+            const bool is_main =
+                _configurations.eviction_policy !=
+                    ConcurrentCacheEvictionPolicy::S3_FIFO ||
+                _remove_ghost(shard, hash);
+            queue_t& queue = is_main ?
+                shard.main_queue : shard.small_queue;
+
+            queue.emplace_front(key, std::move(value), weight, expiration_time);
+            queue.front().is_main = is_main;
+            shard.index.emplace(key, queue.begin());
+            (is_main ? shard.main_weight : shard.small_weight) += weight;
+        }
+
+        shard.insertion_count.fetch_add(1, std::memory_order_relaxed);
+
+        while (shard.small_weight + shard.main_weight > _shard_capacity)
+        {
+            _evict(shard);
+        }
+
+        return true;
+    }
+
+    template <typename KeyType, typename ValueType, typename HashType>
+    void ConcurrentCache<KeyType, ValueType, HashType>::_invalidate_loader(
+        shard_t& shard,
+        const KeyType& key
+    )
+    {
+        std::unique_lock lock(shard.loader_mutex);
+
+        if (shard.loaders.empty())
+        {
+            return;
+        }
+
+        auto iterator = shard.loaders.find(key);
+        if (iterator != shard.loaders.end())
+        {
+            iterator->second.is_invalidated = true;
+        }
+    }
+
+    template <typename KeyType, typename ValueType, typename HashType>
+    void ConcurrentCache<KeyType, ValueType, HashType>::_evict(
+        shard_t& shard
+    )
+    {
+        if (!shard.small_queue.empty() &&
+            (shard.small_weight > _small_capacity || shard.main_queue.empty()))
+        {
+            return _evict_small(shard);
+        }
+
+        _evict_main(shard);
+    }
+
+    template <typename KeyType, typename ValueType, typename HashType>
+    void ConcurrentCache<KeyType, ValueType, HashType>::_evict_small(
+        shard_t& shard
+    )
+    {
+        auto iterator = std::prev(shard.small_queue.end());
+        const bool is_expired = _is_expired(iterator->expiration_time);
+
+        if (!is_expired &&
+            iterator->frequency.load(std::memory_order_relaxed) > 1)
+        {
+            iterator->frequency.store(0, std::memory_order_relaxed);
+            iterator->is_main = true;
+            shard.small_weight -= iterator->weight;
+            shard.main_weight += iterator->weight;
+            shard.main_queue.splice(
+                shard.main_queue.begin(), shard.small_queue, iterator
+            );
+
+            return;
+        }
+
+        if (is_expired)
+        {
+            shard.expiration_count.fetch_add(1, std::memory_order_relaxed);
+        }
+        else
+        {
+            _add_ghost(shard, _hasher(iterator->key));
+            shard.eviction_count.fetch_add(1, std::memory_order_relaxed);
+        }
+
+        _erase(shard, iterator);
+    }
+
+    template <typename KeyType, typename ValueType, typename HashType>
+    void ConcurrentCache<KeyType, ValueType, HashType>::_evict_main(
+        shard_t& shard
+    )
+    {
+        auto iterator = std::prev(shard.main_queue.end());
+        const bool is_expired = _is_expired(iterator->expiration_time);
+        const uint8_t frequency =
+            iterator->frequency.load(std::memory_order_relaxed);
+
+        if (!is_expired && frequency > 0 && _is_reinserted())
+        {
+            iterator->frequency.store(
+                _configurations.eviction_policy ==
+                    ConcurrentCacheEvictionPolicy::CLOCK ?
+                    uint8_t(0) : static_cast<uint8_t>(frequency - 1),
+                std::memory_order_relaxed
+            );
+            shard.main_queue.splice(
+                shard.main_queue.begin(), shard.main_queue, iterator
+            );
+
+            return;
+        }
+
+        (is_expired ? shard.expiration_count : shard.eviction_count)
+            .fetch_add(1, std::memory_order_relaxed);
+
+        _erase(shard, iterator);
+    }
+
+    template <typename KeyType, typename ValueType, typename HashType>
+    void ConcurrentCache<KeyType, ValueType, HashType>::_erase(
+        shard_t& shard,
+        queue_iterator_t iterator
+    )
+    {
+        if (iterator->is_main)
+        {
+            shard.main_weight -= iterator->weight;
+            shard.index.erase(iterator->key);
+            shard.main_queue.erase(iterator);
+
+            return;
+        }
+
+        shard.small_weight -= iterator->weight;
+        shard.index.erase(iterator->key);
+        shard.small_queue.erase(iterator);
+    }
+
+    template <typename KeyType, typename ValueType, typename HashType>
+    void ConcurrentCache<KeyType, ValueType, HashType>::_add_ghost(
+        shard_t& shard,
+        const std::size_t hash
+    )
+    {
+        shard.ghost_queue.push_back(hash);
+        ++shard.ghost_index[hash];
+
+        while (shard.ghost_queue.size() > _ghost_capacity)
+        {
+            auto iterator = shard.ghost_index.find(shard.ghost_queue.front());
+            if (iterator != shard.ghost_index.end() && --iterator->second == 0)
+            {
+                shard.ghost_index.erase(iterator);
+            }
+
+            shard.ghost_queue.pop_front();
+        }
+    }
+
+    template <typename KeyType, typename ValueType, typename HashType>
+    bool ConcurrentCache<KeyType, ValueType, HashType>::_remove_ghost(
+        shard_t& shard,
+        const std::size_t hash
+    )
+    {
+        return shard.ghost_index.erase(hash) != 0;
+    }
+
+    template <typename KeyType, typename ValueType, typename HashType>
+    bool ConcurrentCache<KeyType, ValueType, HashType>::_is_reinserted()
+    {
+        return _configurations.eviction_policy ==
+            ConcurrentCacheEvictionPolicy::S3_FIFO ||
+            _configurations.eviction_policy ==
+            ConcurrentCacheEvictionPolicy::CLOCK;
+    }
+
+    template <typename KeyType, typename ValueType, typename HashType>
+    std::size_t ConcurrentCache<KeyType, ValueType, HashType>::_get_weight(
+        const KeyType& key,
+        const ValueType& value
+    )
+    {
+        if (!_weigher)
+        {
+            return 1;
+        }
+
+        return std::max<std::size_t>(1, _weigher(key, value));
+    }
+
+    template <typename KeyType, typename ValueType, typename HashType>
+    uint64_t ConcurrentCache<KeyType, ValueType, HashType>::_get_expiration_time(
+        const std::chrono::milliseconds& time_to_live
+    )
+    {
+        if (time_to_live.count() <= 0)
+        {
+            return 0;
+        }
+
+        return _get_current_time() +
+            static_cast<uint64_t>(time_to_live.count());
+    }
+
+    template <typename KeyType, typename ValueType, typename HashType>
+    uint64_t ConcurrentCache<KeyType, ValueType, HashType>::_get_current_time()
+    {
+        return static_cast<uint64_t>(
+            std::chrono::duration_cast<std::chrono::milliseconds>(
+                std::chrono::steady_clock::now().time_since_epoch()
+            ).count()
+        ) + 1;
+    }
+
+    template <typename KeyType, typename ValueType, typename HashType>
+    bool ConcurrentCache<KeyType, ValueType, HashType>::_is_expired(
+        const uint64_t expiration_time
+    )
+    {
+        return expiration_time != 0 &&
+            expiration_time <= _get_current_time();
+    }
+}
@@ -0,0 +1,25 @@
+#pragma once
+
+#include "concurrent_cache_eviction_policy.hpp"
+
+#include <cstdint>
+#include <cstddef>
+
+namespace QLogicaeCore
+{
+    struct ConcurrentCacheConfigurations
+    {
+        std::size_t shard_count = 16;
+
+        std::size_t maximum_weight = 4096;
+
+        uint64_t default_time_to_live_in_milliseconds = 0;
+
+        double small_queue_ratio = 0.1;
+
+        double ghost_queue_ratio = 1.0;
+
+        ConcurrentCacheEvictionPolicy eviction_policy =
+            ConcurrentCacheEvictionPolicy::S3_FIFO;
+    };
+}
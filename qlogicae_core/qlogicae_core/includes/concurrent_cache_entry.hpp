@@ -0,0 +1,39 @@
+#pragma once
+
+#include <atomic>
+#include <cstdint>
+#include <cstddef>
+#include <utility>
+
+namespace QLogicaeCore
+{
+    template <typename KeyType, typename ValueType>
+    struct ConcurrentCacheEntry
+    {
+        ConcurrentCacheEntry(
+            const KeyType& key,
+            ValueType value,
+            const std::size_t weight,
+            const uint64_t expiration_time
+        ) :
+            key(key),
+            value(std::move(value)),
+            weight(weight),
+            expiration_time(expiration_time)
+        {
+
+        }
+
+        KeyType key;
+
+        ValueType value;
+
+        std::size_t weight = 1;
+
+        uint64_t expiration_time = 0;
+
+        std::atomic<uint8_t> frequency { 0 };
+
+        bool is_main = false;
+    };
+}
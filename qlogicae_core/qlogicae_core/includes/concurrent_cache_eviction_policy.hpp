@@ -0,0 +1,18 @@
+#pragma once
+
+#include <cstdint>
+
+namespace QLogicaeCore
+{
+    enum class ConcurrentCacheEvictionPolicy :
+        uint8_t
+    {
+        S3_FIFO,
+
+        LRU,
+
+        CLOCK,
+
+        FIFO
+    };
+}
@@ -0,0 +1,73 @@
+#pragma once
+
+#include "concurrent_cache_entry.hpp"
+
+#include <list>
+#include <deque>
+#include <mutex>
+#include <atomic>
+#include <future>
+#include <cstdint>
+#include <cstddef>
+#include <optional>
+#include <shared_mutex>
+#include <unordered_map>
+
+namespace QLogicaeCore
+{
+    template <typename KeyType, typename ValueType>
+    struct ConcurrentCacheLoader
+    {
+        std::shared_future<std::optional<ValueType>> future;
+
+        bool is_invalidated = false;
+    };
+
+    template <typename KeyType, typename ValueType, typename HashType>
+    struct alignas(64) ConcurrentCacheShard
+    {
+        using entry_t = ConcurrentCacheEntry<KeyType, ValueType>;
+
+        using queue_t = std::list<entry_t>;
+
+        std::shared_mutex mutex;
+
+        std::unordered_map<KeyType, typename queue_t::iterator, HashType> index;
+
+        queue_t small_queue;
+
+        queue_t main_queue;
+
+        std::size_t small_weight = 0;
+
+        std::size_t main_weight = 0;
+
+        std::deque<std::size_t> ghost_queue;
+
+        std::unordered_map<std::size_t, uint32_t> ghost_index;
+
+        std::mutex loader_mutex;
+
+        std::unordered_map<
+            KeyType,
+            ConcurrentCacheLoader<KeyType, ValueType>,
+            HashType
+        > loaders;
+
+        std::atomic<uint64_t> hit_count { 0 };
+
+        std::atomic<uint64_t> miss_count { 0 };
+
+        std::atomic<uint64_t> insertion_count { 0 };
+
+        std::atomic<uint64_t> rejection_count { 0 };
+
+        std::atomic<uint64_t> eviction_count { 0 };
+
+        std::atomic<uint64_t> expiration_count { 0 };
+
+        std::atomic<uint64_t> load_count { 0 };
+
+        std::atomic<uint64_t> coalesced_load_count { 0 };
+    };
+}
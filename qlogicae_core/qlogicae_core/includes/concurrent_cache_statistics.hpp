@@ -0,0 +1,32 @@
+#pragma once
+
+#include <cstdint>
+#include <cstddef>
+
+namespace QLogicaeCore
+{
+    struct ConcurrentCacheStatistics
+    {
+        uint64_t hit_count = 0;
+
+        uint64_t miss_count = 0;
+
+        uint64_t insertion_count = 0;
+
+        uint64_t rejection_count = 0;
+
+        uint64_t eviction_count = 0;
+
+        uint64_t expiration_count = 0;
+
+        uint64_t load_count = 0;
+
+        uint64_t coalesced_load_count = 0;
+
+        std::size_t entry_count = 0;
+
+        std::size_t weight = 0;
+
+        double hit_ratio = 0.0;
+    };
+}
@@ -0,0 +1,71 @@
+#pragma once
+
+#include "result.hpp"
+
+namespace QLogicaeCore
+{
+    class CpuFeatures
+    {
+    public:
+        bool is_ssse3_supported();
+
+        bool is_avx2_supported();
+
+        bool is_sha_supported();
+
+        bool is_avx512f_supported();
+
+        void is_ssse3_supported(
+            Result<bool>& result
+        );
+
+        void is_avx2_supported(
+            Result<bool>& result
+        );
+
+        void is_sha_supported(
+            Result<bool>& result
+        );
+
+        void is_avx512f_supported(
+            Result<bool>& result
+        );
+
+        static CpuFeatures& get_instance();
+
+        static void get_instance(
+            Result<CpuFeatures*>& result
+        );
+
+    protected:
+        CpuFeatures();
+
+        ~CpuFeatures();
+
+        CpuFeatures(
+            const CpuFeatures& instance
+        ) = delete;
+
+        CpuFeatures(
+            CpuFeatures&& instance
+        ) noexcept = delete;
+
+        CpuFeatures& operator = (
+            CpuFeatures&& instance
+        ) = delete;
+
+        CpuFeatures& operator = (
+            const CpuFeatures& instance
+        ) = delete;
+
+        bool _is_ssse3_supported = false;
+
+        bool _is_avx2_supported = false;
+
+        bool _is_sha_supported = false;
+
+        bool _is_avx512f_supported = false;
+    };
+
+    inline static CpuFeatures& CPU_FEATURES = CpuFeatures::get_instance();
+}
@@ -1,5 +1,10 @@
 #pragma once
 
+#include <sodium.h>
+
+#include <cstddef>
+#include <cstdint>
+
 namespace QLogicaeCore
 {
     struct CryptographerProperties
@@ -34,4 +39,12 @@ namespace QLogicaeCore
         
         .uint32_t_3 = 2
     };
+
+    static CryptographerProperties
+        DEFAULT_CRYPTOGRAPHER_4_PROPERTIES
+    {
+        .size_t_1 = crypto_pwhash_OPSLIMIT_MODERATE,
+        
+        .size_t_2 = crypto_pwhash_MEMLIMIT_MODERATE
+    };
 }
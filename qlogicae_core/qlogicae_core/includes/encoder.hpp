@@ -3,6 +3,11 @@
 #include "result.hpp"
 #include "logger.hpp"
 #include "utilities.hpp"
+#include "encoding_type.hpp"
+#include "unicode_kernels.hpp"
+#include "encoding_kernels.hpp"
+
+#include <span>
 
 namespace QLogicaeCore
 {
@@ -80,6 +85,36 @@ namespace QLogicaeCore
             const std::wstring_view& text
         );
 
+        void from_utf8_to_utf16(
+            Result<std::size_t>& result,
+            const std::string_view& text,
+            std::span<wchar_t> output
+        );
+
+        void from_utf16_to_utf8(
+            Result<std::size_t>& result,
+            const std::wstring_view& text,
+            std::span<char> output
+        );
+
+        std::size_t get_utf16_length(
+            const std::string_view& text
+        );
+
+        void get_utf16_length(
+            Result<std::size_t>& result,
+            const std::string_view& text
+        );
+
+        std::size_t get_utf8_length(
+            const std::wstring_view& text
+        );
+
+        void get_utf8_length(
+            Result<std::size_t>& result,
+            const std::wstring_view& text
+        );
+
         std::string from_base64_to_utf8(
             const std::string_view& text
         );
@@ -138,6 +173,42 @@ namespace QLogicaeCore
             const std::string_view& text
         );
 
+        std::size_t get_encoded_length(
+            const EncodingType& type,
+            const std::size_t& size
+        );
+
+        void get_encoded_length(
+            Result<std::size_t>& result,
+            const EncodingType& type,
+            const std::size_t& size
+        );
+
+        std::size_t get_decoded_length(
+            const EncodingType& type,
+            const std::string_view& text
+        );
+
+        void get_decoded_length(
+            Result<std::size_t>& result,
+            const EncodingType& type,
+            const std::string_view& text
+        );
+
+        void encode_into(
+            Result<std::size_t>& result,
+            const EncodingType& type,
+            std::span<const unsigned char> bytes,
+            std::span<char> output
+        );
+
+        void decode_into(
+            Result<std::size_t>& result,
+            const EncodingType& type,
+            const std::string_view& text,
+            std::span<unsigned char> output
+        );
+
         static Encoder& get_instance();
 
         static void get_instance(
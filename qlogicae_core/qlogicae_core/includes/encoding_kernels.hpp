@@ -0,0 +1,54 @@
+#pragma once
+
+#include "cpu_features.hpp"
+
+#include <span>
+#include <array>
+#include <cstring>
+#include <cstdint>
+#include <cstddef>
+#include <optional>
+#include <string_view>
+
+namespace QLogicaeCore
+{
+    class EncodingKernels
+    {
+    public:
+        static std::size_t get_hex_encoded_length(
+            const std::size_t size
+        );
+
+        static std::size_t get_hex_decoded_length(
+            const std::string_view text
+        );
+
+        static std::size_t get_base64_encoded_length(
+            const std::size_t size
+        );
+
+        static std::size_t get_base64_decoded_length(
+            const std::string_view text
+        );
+
+        static std::optional<std::size_t> encode_hex(
+            const std::span<const unsigned char> bytes,
+            std::span<char> output
+        );
+
+        static std::optional<std::size_t> decode_hex(
+            const std::string_view text,
+            std::span<unsigned char> output
+        );
+
+        static std::optional<std::size_t> encode_base64(
+            const std::span<const unsigned char> bytes,
+            std::span<char> output
+        );
+
+        static std::optional<std::size_t> decode_base64(
+            const std::string_view text,
+            std::span<unsigned char> output
+        );
+    };
+}
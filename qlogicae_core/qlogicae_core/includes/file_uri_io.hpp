@@ -1,6 +1,7 @@
 #pragma once
 
 #include "result.hpp"
+#include "encoder.hpp"
 #include "utilities.hpp"
 #include "abstract_file_io.hpp"
 
@@ -95,5 +96,10 @@ namespace QLogicaeCore
         {
             UTILITIES.DEFAULT_FILE_URI_IO_MIMETYPE.data()
         };
+
+        void _encode_data_uri(
+            Result<std::string>& result,
+            std::ifstream& input_file
+        );
     };
 }
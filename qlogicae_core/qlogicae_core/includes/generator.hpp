@@ -3,7 +3,9 @@
 #include "logger.hpp"
 #include "encoder.hpp"
 #include "utilities.hpp"
+#include "xoshiro256_plus_plus.hpp"
 
+#include <span>
 #include <random>
 
 namespace QLogicaeCore
@@ -33,6 +35,15 @@ namespace QLogicaeCore
             Result<std::string>& result
         );
 
+        std::vector<std::string> random_uuid4_batch(
+            const size_t& count
+        );
+
+        void random_uuid4_batch(
+            Result<std::vector<std::string>>& result,
+            const size_t& count
+        );
+
         std::string random_rgb_hex();
 
         void random_rgb_hex(
@@ -62,6 +73,17 @@ namespace QLogicaeCore
             size_t size
         );
 
+        bool random_bytes_into(
+            std::span<unsigned char> buffer,
+            const bool& is_cryptographically_secure = true
+        );
+
+        void random_bytes_into(
+            Result<void>& result,
+            std::span<unsigned char> buffer,
+            const bool& is_cryptographically_secure = true
+        );
+
         bool random_bool(
             const double& = UTILITIES.RANDOM_BOOLEAN_MAXIMUM
         );
@@ -108,6 +130,21 @@ namespace QLogicaeCore
             UTILITIES.FULL_VISIBLE_ASCII_CHARACTERSET
         );
 
+        bool random_string_into(
+            std::span<char> buffer,
+            const std::string_view& character_set =
+                UTILITIES.FULL_VISIBLE_ASCII_CHARACTERSET,
+            const bool& is_cryptographically_secure = false
+        );
+
+        void random_string_into(
+            Result<void>& result,
+            std::span<char> buffer,
+            const std::string_view& character_set =
+                UTILITIES.FULL_VISIBLE_ASCII_CHARACTERSET,
+            const bool& is_cryptographically_secure = false
+        );
+
         std::string random_base64(
             const size_t&,
             const std::string_view & =
@@ -170,7 +207,7 @@ namespace QLogicaeCore
             const Generator& instance
         ) = delete;
 
-        static std::mt19937& _random_m19937();
+        static Xoshiro256PlusPlus& _random_engine();
     };
 
     inline static Generator& GENERATOR =
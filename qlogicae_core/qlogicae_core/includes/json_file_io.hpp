@@ -3,6 +3,8 @@
 #include "result.hpp"
 #include "json.hpp"
 #include "abstract_file_io.hpp"
+#include "concurrent_cache.hpp"
+#include "json_file_io_document.hpp"
 
 #include <rapidjson/writer.h>
 #include <rapidjson/pointer.h>
@@ -12,6 +14,7 @@
 #include <rapidjson/ostreamwrapper.h>
 
 #include <any>
+#include <memory>
 #include <future>
 #include <shared_mutex>
 
@@ -524,6 +527,10 @@ namespace QLogicaeCore
 
         bool _is_formatting_allowed;
 
+        std::shared_ptr<const JsonFileIODocument> _get_document();
+
+        void _invalidate_document();
+
         rapidjson::Pointer build_pointer(
             const JsonPath&
         );
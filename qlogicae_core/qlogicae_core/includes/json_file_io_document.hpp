@@ -0,0 +1,18 @@
+#pragma once
+
+#include <rapidjson/document.h>
+
+#include <cstdint>
+#include <filesystem>
+
+namespace QLogicaeCore
+{
+    struct JsonFileIODocument
+    {
+        std::filesystem::file_time_type last_write_time;
+
+        std::uintmax_t size = 0;
+
+        rapidjson::Document document;
+    };
+}
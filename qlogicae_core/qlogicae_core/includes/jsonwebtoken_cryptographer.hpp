@@ -4,6 +4,8 @@
 #include "encoder.hpp"
 #include "generator.hpp"
 #include "cryptographer.hpp"
+#include "concurrent_cache.hpp"
+#include "sha256_hash_context.hpp"
 #include "jsonwebtoken_reverse_input.hpp"
 #include "jsonwebtoken_reverse_result.hpp"
 #include "jsonwebtoken_transform_input.hpp"
@@ -123,6 +125,12 @@ namespace QLogicaeCore
             JsonWebTokenReverseInput options
         );
 
+        void clear_verification_cache();
+
+        void clear_verification_cache(
+            Result<void>& result
+        );
+
         static JsonWebTokenCryptographer& get_instance();
 
         static void get_instance(
@@ -130,14 +138,48 @@ namespace QLogicaeCore
         );
 
     protected:
-        const jwt::algorithm::es256k& _get_es256k_signer(
+        ConcurrentCache<
+            std::string,
+            std::shared_ptr<const jwt::algorithm::es256k>
+        > _es256k_algorithms;
+
+        ConcurrentCache<
+            std::string,
+            std::shared_ptr<const jsonwebtoken_verifier_t>
+        > _verifiers;
+
+        ConcurrentCache<
+            std::string,
+            std::shared_ptr<const JsonWebTokenVerifiedToken>
+        > _verified_tokens;
+
+        std::shared_ptr<const jwt::algorithm::es256k> _get_es256k_signer(
             const std::string& public_key,
             const std::string& private_key
         );
 
-        const jwt::algorithm::es256k& _get_es256k_verifier(
+        std::shared_ptr<const jwt::algorithm::es256k> _get_es256k_verifier(
+            const std::string& public_key
+        );
+
+        std::shared_ptr<const jsonwebtoken_verifier_t> _get_verifier(
+            const std::string& issuer,
             const std::string& public_key
         );
+
+        std::string _get_verified_token_key(
+            const JsonWebTokenReverseInput& options
+        );
+
+        std::shared_ptr<const JsonWebTokenVerifiedToken> _verify(
+            const JsonWebTokenReverseInput& options
+        );
+
+        void _set_reverse_result(
+            JsonWebTokenReverseResult& result,
+            const JsonWebTokenReverseInput& options,
+            std::shared_ptr<const JsonWebTokenVerifiedToken> token
+        );
     };
 
     inline static JsonWebTokenCryptographer& JSONWEBTOKEN_CRYPTOGRAPHER =
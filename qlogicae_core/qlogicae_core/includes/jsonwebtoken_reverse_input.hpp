@@ -9,6 +9,8 @@ namespace QLogicaeCore
         std::string issuer;
 
         std::string public_key;
+
+        bool is_claim_extraction_enabled = true;
     };
 }
 
@@ -1,5 +1,9 @@
 #pragma once
 
+#include "jsonwebtoken_verified_token.hpp"
+
+#include <memory>
+
 namespace QLogicaeCore
 {
     struct JsonWebTokenReverseResult
@@ -13,5 +17,7 @@ namespace QLogicaeCore
         std::map<std::string, std::string> headers;
 
         std::map<std::string, std::string> payloads;
+
+        std::shared_ptr<const JsonWebTokenVerifiedToken> token;
     };
 }
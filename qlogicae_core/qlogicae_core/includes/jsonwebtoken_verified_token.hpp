@@ -0,0 +1,60 @@
+#pragma once
+
+#ifdef _MSC_VER
+#pragma warning(push)
+#pragma warning(disable: 4244)
+#endif
+
+#include <jwt-cpp/jwt.h>
+
+#ifdef _MSC_VER
+#pragma warning(pop)
+#endif
+
+#include <map>
+#include <chrono>
+#include <string>
+#include <optional>
+
+namespace QLogicaeCore
+{
+    using jsonwebtoken_decoded_t =
+        decltype(jwt::decode(std::string()));
+
+    using jsonwebtoken_verifier_t =
+        decltype(jwt::verify());
+
+    class JsonWebTokenVerifiedToken
+    {
+    public:
+        JsonWebTokenVerifiedToken(
+            jsonwebtoken_decoded_t decoded,
+            const std::chrono::system_clock::time_point& expires_at
+        );
+
+        bool is_expired(
+            const std::chrono::system_clock::time_point& now
+        ) const;
+
+        std::string get_subject() const;
+
+        std::chrono::system_clock::time_point get_expires_at() const;
+
+        std::optional<std::string> get_header(
+            const std::string& name
+        ) const;
+
+        std::optional<std::string> get_payload(
+            const std::string& name
+        ) const;
+
+        std::map<std::string, std::string> get_headers() const;
+
+        std::map<std::string, std::string> get_payloads() const;
+
+    private:
+        jsonwebtoken_decoded_t _decoded;
+
+        std::chrono::system_clock::time_point _expires_at;
+    };
+}
@@ -0,0 +1,17 @@
+#pragma once
+
+#include <chrono>
+#include <cstdint>
+#include <cstddef>
+
+namespace QLogicaeCore
+{
+    struct PasswordHashCalibration
+    {
+        std::uint64_t operations_limit = 0;
+
+        std::size_t memory_limit_in_bytes = 0;
+
+        std::chrono::nanoseconds duration { 0 };
+    };
+}
@@ -0,0 +1,31 @@
+#pragma once
+
+#include "result.hpp"
+#include "password_hash_calibration.hpp"
+
+#include <chrono>
+#include <functional>
+
+namespace QLogicaeCore
+{
+    using password_hash_calibration_t =
+        std::function<bool(const PasswordHashCalibration& calibration)>;
+
+    class PasswordHashCalibrator
+    {
+    public:
+        static void run(
+            Result<PasswordHashCalibration>& result,
+            const std::chrono::milliseconds& target_latency,
+            const PasswordHashCalibration& minimum,
+            const PasswordHashCalibration& maximum,
+            const password_hash_calibration_t& hash
+        );
+
+    protected:
+        static bool _measure(
+            PasswordHashCalibration& calibration,
+            const password_hash_calibration_t& hash
+        );
+    };
+}
@@ -0,0 +1,203 @@
+#pragma once
+
+#include "result.hpp"
+#include "logger.hpp"
+#include "utilities.hpp"
+#include "password_hash_executor_configurations.hpp"
+
+#include <boost/asio/post.hpp>
+#include <boost/asio/thread_pool.hpp>
+
+#include <mutex>
+#include <atomic>
+#include <memory>
+#include <cstdint>
+#include <shared_mutex>
+#include <condition_variable>
+
+namespace QLogicaeCore
+{
+    class PasswordHashExecutor
+    {
+    public:
+        PasswordHashExecutor();
+
+        explicit PasswordHashExecutor(
+            const PasswordHashExecutorConfigurations& configurations
+        );
+
+        ~PasswordHashExecutor();
+
+        PasswordHashExecutor(
+            const PasswordHashExecutor& instance
+        ) = delete;
+
+        PasswordHashExecutor(
+            PasswordHashExecutor&& instance
+        ) noexcept = delete;
+
+        PasswordHashExecutor& operator = (
+            PasswordHashExecutor&& instance
+        ) = delete;
+
+        PasswordHashExecutor& operator = (
+            const PasswordHashExecutor& instance
+        ) = delete;
+
+        bool setup(
+            const PasswordHashExecutorConfigurations& configurations
+        );
+
+        void setup(
+            Result<void>& result,
+            const PasswordHashExecutorConfigurations& configurations
+        );
+
+        template <typename Callable>
+        bool post(
+            Callable&& task,
+            const std::size_t memory_in_bytes = 0
+        );
+
+        template <typename Callable>
+        void post(
+            Result<void>& result,
+            Callable&& task,
+            const std::size_t memory_in_bytes = 0
+        );
+
+        std::size_t get_concurrency();
+
+        std::size_t get_queue_depth();
+
+        std::size_t get_active_count();
+
+        std::uint64_t get_rejected_count();
+
+        void get_concurrency(
+            Result<std::size_t>& result
+        );
+
+        void get_queue_depth(
+            Result<std::size_t>& result
+        );
+
+        void get_active_count(
+            Result<std::size_t>& result
+        );
+
+        void get_rejected_count(
+            Result<std::uint64_t>& result
+        );
+
+        static PasswordHashExecutor& get_instance();
+
+        static void get_instance(
+            Result<PasswordHashExecutor*>& result
+        );
+
+    protected:
+        std::shared_mutex _mutex;
+
+        PasswordHashExecutorConfigurations _configurations;
+
+        std::size_t _concurrency = 1;
+
+        std::unique_ptr<boost::asio::thread_pool> _pool;
+
+        std::atomic<std::size_t> _queue_depth { 0 };
+
+        std::atomic<std::size_t> _active_count { 0 };
+
+        std::atomic<std::uint64_t> _rejected_count { 0 };
+
+        std::mutex _memory_mutex;
+
+        std::condition_variable _memory_condition;
+
+        std::size_t _memory_in_use = 0;
+
+        void _acquire_memory(
+            const std::size_t memory_in_bytes,
+            const std::size_t memory_limit_in_bytes
+        );
+
+        void _release_memory(
+            const std::size_t memory_in_bytes
+        );
+
+        static std::size_t _get_concurrency(
+            const PasswordHashExecutorConfigurations& configurations
+        );
+    };
+
+    template <typename Callable>
+    bool PasswordHashExecutor::post(
+        Callable&& task,
+        const std::size_t memory_in_bytes
+    )
+    {
+        std::shared_lock lock(_mutex);
+
+        if (_queue_depth.fetch_add(1) >= _configurations.maximum_queue_depth)
+        {
+            _queue_depth.fetch_sub(1);
+            _rejected_count.fetch_add(1);
+
+            return false;
+        }
+
+        const std::size_t hash_memory_in_bytes = memory_in_bytes != 0 ?
+            memory_in_bytes : _configurations.hash_memory_in_bytes;
+        const std::size_t memory_limit_in_bytes =
+            _configurations.memory_limit_in_bytes;
+
+        boost::asio::post(
+            *_pool,
+            [this, hash_memory_in_bytes, memory_limit_in_bytes,
+            task = std::forward<Callable>(task)]() mutable
+            {
+                _acquire_memory(hash_memory_in_bytes, memory_limit_in_bytes);
+                _queue_depth.fetch_sub(1);
+                _active_count.fetch_add(1);
+
+                try
+                {
+                    task();
+                }
+                catch (const std::exception& exception)
+                {
+                    LOGGER.handle_exception_async(
+                        "QLogicaeCore::PasswordHashExecutor::post()",
+                        exception.what()
+                    );
+                }
+
+                _active_count.fetch_sub(1);
+                _release_memory(hash_memory_in_bytes);
+            }
+        );
+
+        return true;
+    }
+
+    template <typename Callable>
+    void PasswordHashExecutor::post(
+        Result<void>& result,
+        Callable&& task,
+        const std::size_t memory_in_bytes
+    )
+    {
+        if (!post(std::forward<Callable>(task), memory_in_bytes))
+        {
+            return result.set_to_bad_status_without_value(
+                "Hashing queue is full"
+            );
+        }
+
+        result.set_to_good_status_without_value();
+    }
+
+    inline static PasswordHashExecutor& PASSWORD_HASH_EXECUTOR =
+        PasswordHashExecutor::get_instance();
+}
@@ -0,0 +1,24 @@
+#pragma once
+
+#include "utilities.hpp"
+#include "cryptographer_properties.hpp"
+
+#include <cstddef>
+
+namespace QLogicaeCore
+{
+    struct PasswordHashExecutorConfigurations
+    {
+        std::size_t maximum_concurrency =
+            UTILITIES.PASSWORD_HASH_MAXIMUM_CONCURRENCY;
+
+        std::size_t maximum_queue_depth =
+            UTILITIES.PASSWORD_HASH_MAXIMUM_QUEUE_DEPTH;
+
+        std::size_t memory_limit_in_bytes =
+            UTILITIES.PASSWORD_HASH_MAXIMUM_CONCURRENCY *
+            DEFAULT_CRYPTOGRAPHER_4_PROPERTIES.size_t_2;
+
+        std::size_t hash_memory_in_bytes = 0;
+    };
+}
@@ -3,10 +3,12 @@
 #include "result.hpp"
 #include "logger.hpp"
 #include "utilities.hpp"
+#include "concurrent_cache.hpp"
 
 #define PCRE2_CODE_UNIT_WIDTH 8
 #include <pcre2.h>
 
+#include <memory>
 #include <string>
 #include <vector>
 
@@ -155,6 +157,13 @@ namespace QLogicaeCore
 		std::unordered_map<std::string, std::pair<std::string, pcre2_code*>>
 			_compiled_patterns;
 
+		ConcurrentCache<std::string, std::shared_ptr<pcre2_code>>
+			_direct_patterns;
+
+		std::shared_ptr<pcre2_code> _get_direct_pattern(
+			const std::string& pattern
+		);
+
 		bool _do_match(
 			const std::string& subject, pcre2_code* get_error_code);
 	};
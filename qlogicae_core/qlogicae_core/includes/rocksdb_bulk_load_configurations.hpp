@@ -0,0 +1,30 @@
+#pragma once
+
+#include <string>
+#include <cstddef>
+#include <functional>
+
+namespace QLogicaeCore
+{
+    struct RocksDBBulkLoadConfigurations
+    {
+        std::string staging_folder_path = "";
+
+        size_t entries_per_file = 1000000;
+
+        bool is_input_sorted = false;
+
+        bool is_staging_folder_removed = true;
+
+        bool move_files = true;
+
+        bool snapshot_consistency = true;
+
+        bool allow_global_seqno = true;
+
+        bool allow_blocking_flush = true;
+
+        std::function<void(const size_t& loaded_count, const size_t& total_count)>
+            progress_callback;
+    };
+}
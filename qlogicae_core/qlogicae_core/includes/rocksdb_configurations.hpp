@@ -6,6 +6,8 @@
 #include <rocksdb/options.h>
 #include <rocksdb/iterator.h>
 #include <rocksdb/listener.h>
+#include <rocksdb/perf_level.h>
+#include <rocksdb/statistics.h>
 #include <rocksdb/convenience.h>
 #include <rocksdb/write_batch.h>
 #include <rocksdb/filter_policy.h>
@@ -73,5 +75,15 @@ namespace QLogicaeCore
         size_t background_threads = 4;
 
         double new_bloom_filter_policy = 10;
+
+        bool is_statistics_enabled = true;
+
+        rocksdb::StatsLevel statistics_level =
+            rocksdb::StatsLevel::kExceptDetailedTimers;
+
+        rocksdb::PerfLevel perf_level =
+            rocksdb::PerfLevel::kEnableTimeExceptForMutex;
+
+        size_t statistics_logging_interval_in_milliseconds = 0;
     };
 }
@@ -2,8 +2,14 @@
 
 #include "result.hpp"
 #include "logger.hpp"
+#include "interval.hpp"
 #include "utilities.hpp"
+#include "thread_pool.hpp"
+#include "rocksdb_statistics.hpp"
+#include "rocksdb_perf_context.hpp"
 #include "rocksdb_configurations.hpp"
+#include "rocksdb_event_listener.hpp"
+#include "rocksdb_bulk_load_configurations.hpp"
 
 #include <rocksdb/db.h>
 #include <rocksdb/slice.h>
@@ -11,9 +17,13 @@
 #include <rocksdb/options.h>
 #include <rocksdb/iterator.h>
 #include <rocksdb/listener.h>
+#include <rocksdb/perf_level.h>
+#include <rocksdb/statistics.h>
 #include <rocksdb/convenience.h>
+#include <rocksdb/perf_context.h>
 #include <rocksdb/write_batch.h>
 #include <rocksdb/filter_policy.h>
+#include <rocksdb/sst_file_writer.h>
 #include <rocksdb/compaction_filter.h>
 #include <rocksdb/utilities/checkpoint.h>
 #include <rocksdb/utilities/backup_engine.h>
@@ -423,6 +433,70 @@ namespace QLogicaeCore
             const std::function<void(Result<void>& result)>& callback
         );
 
+        bool bulk_load(
+            std::vector<std::pair<std::string, std::string>> entries,
+            const RocksDBBulkLoadConfigurations& configurations = {}
+        );
+
+        void bulk_load(
+            Result<void>& result,
+            std::vector<std::pair<std::string, std::string>> entries,
+            const RocksDBBulkLoadConfigurations& configurations = {}
+        );
+
+        std::future<bool> bulk_load_async(
+            std::vector<std::pair<std::string, std::string>> entries,
+            const RocksDBBulkLoadConfigurations& configurations = {}
+        );
+
+        void bulk_load_async(
+            const std::function<void(const bool& result)>& callback,
+            std::vector<std::pair<std::string, std::string>> entries,
+            const RocksDBBulkLoadConfigurations& configurations = {}
+        );
+
+        void bulk_load_async(
+            const std::function<void(Result<void>& result)>& callback,
+            std::vector<std::pair<std::string, std::string>> entries,
+            const RocksDBBulkLoadConfigurations& configurations = {}
+        );
+
+        template <typename Type>
+        bool bulk_load(
+            const std::vector<std::pair<std::string, Type>>& entries,
+            const RocksDBBulkLoadConfigurations& configurations = {}
+        );
+
+        RocksDBStatistics get_statistics();
+
+        void get_statistics(
+            Result<RocksDBStatistics>& result
+        );
+
+        bool reset_statistics();
+
+        void reset_statistics(
+            Result<void>& result
+        );
+
+        bool log_statistics();
+
+        void log_statistics(
+            Result<void>& result
+        );
+
+        bool begin_perf_context();
+
+        void begin_perf_context(
+            Result<void>& result
+        );
+
+        RocksDBPerfContext end_perf_context();
+
+        void end_perf_context(
+            Result<RocksDBPerfContext>& result
+        );
+
         void open_db();
 
         void close_db();
@@ -470,6 +544,26 @@ namespace QLogicaeCore
 
         std::unordered_map<std::string, rocksdb::ColumnFamilyHandle*> _column_families;
 
+        std::shared_ptr<rocksdb::Statistics> _statistics;
+
+        std::shared_ptr<RocksDBEventListener> _event_listener;
+
+        std::unique_ptr<Interval> _statistics_interval;
+
+        void _start_statistics_interval();
+
+        std::string _generate_bulk_load_staging_folder_path();
+
+        static void _sort_and_deduplicate_bulk_load_entries(
+            std::vector<std::pair<std::string, std::string>>& entries
+        );
+
+        void _stop_statistics_interval();
+
+        static std::string _to_statistics_text(
+            const RocksDBStatistics& statistics
+        );
+
         rocksdb::ColumnFamilyHandle* get_cf_handle(const std::string& name);
 
         template <typename Type>
@@ -733,7 +827,7 @@ namespace QLogicaeCore
     )
     {        
         auto serialized = serialize(value);
-        if (!_object->Put(_options, key, serialized).ok())
+        if (!_object->Put(_write_options, key, serialized).ok())
         {            
             return result.set_to_bad_status_without_value();
         }
@@ -939,6 +1033,37 @@ namespace QLogicaeCore
         );
     }
 
+    template <typename Type>
+    bool RocksDBDatabase::bulk_load(
+        const std::vector<std::pair<std::string, Type>>& entries,
+        const RocksDBBulkLoadConfigurations& configurations
+    )
+    {
+        try
+        {
+            std::vector<std::pair<std::string, std::string>> serialized_entries;
+            serialized_entries.reserve(entries.size());
+            for (const auto& [key, value] : entries)
+            {
+                serialized_entries.emplace_back(key, serialize(value));
+            }
+
+            return bulk_load(
+                std::move(serialized_entries),
+                configurations
+            );
+        }
+        catch (const std::exception& exception)
+        {
+            LOGGER.handle_exception_async(
+                "QLogicaeCore::RocksDBDatabase::bulk_load()",
+                exception.what()
+            );
+
+            return false;
+        }
+    }
+
     inline static RocksDBDatabase& ROCKSDB_DATABASE = 
         RocksDBDatabase::get_instance();
 }
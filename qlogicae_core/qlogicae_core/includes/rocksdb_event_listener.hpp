@@ -0,0 +1,86 @@
+#pragma once
+
+#include "rocksdb_statistics.hpp"
+
+#include <rocksdb/db.h>
+#include <rocksdb/listener.h>
+
+#include <mutex>
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <unordered_map>
+
+namespace QLogicaeCore
+{
+    class RocksDBEventListener :
+        public rocksdb::EventListener
+    {
+    public:
+        RocksDBEventListener() = default;
+
+        ~RocksDBEventListener() override = default;
+
+        RocksDBEventListener(
+            const RocksDBEventListener&
+        ) = delete;
+
+        RocksDBEventListener& operator=(
+            const RocksDBEventListener&
+        ) = delete;
+
+        void OnFlushBegin(
+            rocksdb::DB* database,
+            const rocksdb::FlushJobInfo& information
+        ) override;
+
+        void OnFlushCompleted(
+            rocksdb::DB* database,
+            const rocksdb::FlushJobInfo& information
+        ) override;
+
+        void OnCompactionCompleted(
+            rocksdb::DB* database,
+            const rocksdb::CompactionJobInfo& information
+        ) override;
+
+        void OnStallConditionsChanged(
+            const rocksdb::WriteStallInfo& information
+        ) override;
+
+        void collect(
+            RocksDBStatistics& statistics
+        );
+
+        void reset();
+
+    protected:
+        std::mutex _mutex;
+
+        std::unordered_map<int, std::chrono::steady_clock::time_point>
+            _flush_begin_times;
+
+        std::atomic<uint64_t> _flush_count { 0 };
+
+        std::atomic<uint64_t> _flush_total_microseconds { 0 };
+
+        std::atomic<uint64_t> _flush_maximum_microseconds { 0 };
+
+        std::atomic<uint64_t> _compaction_count { 0 };
+
+        std::atomic<uint64_t> _compaction_total_microseconds { 0 };
+
+        std::atomic<uint64_t> _compaction_maximum_microseconds { 0 };
+
+        std::atomic<uint64_t> _stall_condition_change_count { 0 };
+
+        std::atomic<uint64_t> _stall_delayed_count { 0 };
+
+        std::atomic<uint64_t> _stall_stopped_count { 0 };
+
+        static void _update_maximum(
+            std::atomic<uint64_t>& maximum,
+            const uint64_t& value
+        );
+    };
+}
@@ -0,0 +1,41 @@
+#pragma once
+
+#include <cstdint>
+
+namespace QLogicaeCore
+{
+    struct RocksDBPerfContext
+    {
+        uint64_t user_key_comparison_count = 0;
+
+        uint64_t block_cache_hit_count = 0;
+
+        uint64_t block_read_count = 0;
+
+        uint64_t block_read_bytes = 0;
+
+        uint64_t block_read_nanoseconds = 0;
+
+        uint64_t get_snapshot_nanoseconds = 0;
+
+        uint64_t get_from_memtable_count = 0;
+
+        uint64_t get_from_memtable_nanoseconds = 0;
+
+        uint64_t get_from_output_files_nanoseconds = 0;
+
+        uint64_t bloom_memtable_hit_count = 0;
+
+        uint64_t bloom_memtable_miss_count = 0;
+
+        uint64_t bloom_sst_hit_count = 0;
+
+        uint64_t bloom_sst_miss_count = 0;
+
+        uint64_t write_wal_nanoseconds = 0;
+
+        uint64_t write_memtable_nanoseconds = 0;
+
+        uint64_t write_delay_nanoseconds = 0;
+    };
+}
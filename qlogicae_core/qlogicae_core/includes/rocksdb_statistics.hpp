@@ -0,0 +1,63 @@
+#pragma once
+
+#include <cstdint>
+
+namespace QLogicaeCore
+{
+    struct RocksDBStatistics
+    {
+        uint64_t block_cache_hit_count = 0;
+
+        uint64_t block_cache_miss_count = 0;
+
+        double block_cache_hit_rate = 0.0;
+
+        uint64_t bloom_filter_useful_count = 0;
+
+        uint64_t memtable_hit_count = 0;
+
+        uint64_t memtable_miss_count = 0;
+
+        uint64_t sst_level_0_hit_count = 0;
+
+        uint64_t sst_level_1_hit_count = 0;
+
+        uint64_t sst_level_2_and_up_hit_count = 0;
+
+        uint64_t keys_read_count = 0;
+
+        uint64_t keys_written_count = 0;
+
+        uint64_t bytes_read = 0;
+
+        uint64_t bytes_written = 0;
+
+        uint64_t stall_microseconds = 0;
+
+        uint64_t stall_condition_change_count = 0;
+
+        uint64_t stall_delayed_count = 0;
+
+        uint64_t stall_stopped_count = 0;
+
+        uint64_t flush_count = 0;
+
+        uint64_t flush_write_bytes = 0;
+
+        uint64_t flush_total_microseconds = 0;
+
+        uint64_t flush_maximum_microseconds = 0;
+
+        uint64_t compaction_count = 0;
+
+        uint64_t compaction_read_bytes = 0;
+
+        uint64_t compaction_write_bytes = 0;
+
+        uint64_t compaction_total_microseconds = 0;
+
+        uint64_t compaction_maximum_microseconds = 0;
+
+        double write_amplification = 0.0;
+    };
+}
@@ -0,0 +1,79 @@
+#pragma once
+
+#include "result.hpp"
+#include "sha256_kernels.hpp"
+
+#include <span>
+#include <array>
+#include <cstdint>
+#include <cstddef>
+#include <string_view>
+
+namespace QLogicaeCore
+{
+    class SHA256HashContext
+    {
+    public:
+        SHA256HashContext();
+
+        ~SHA256HashContext() = default;
+
+        SHA256HashContext(
+            const SHA256HashContext& instance
+        ) = default;
+
+        SHA256HashContext(
+            SHA256HashContext&& instance
+        ) noexcept = default;
+
+        SHA256HashContext& operator = (
+            SHA256HashContext&& instance
+        ) = default;
+
+        SHA256HashContext& operator = (
+            const SHA256HashContext& instance
+        ) = default;
+
+        void setup();
+
+        void setup(
+            Result<void>& result
+        );
+
+        void update(
+            std::span<const unsigned char> bytes
+        );
+
+        void update(
+            const std::string_view& text
+        );
+
+        void update(
+            Result<void>& result,
+            std::span<const unsigned char> bytes
+        );
+
+        void update(
+            Result<void>& result,
+            const std::string_view& text
+        );
+
+        std::array<unsigned char, SHA256Kernels::DIGEST_SIZE> finalize();
+
+        void finalize(
+            Result<std::array<unsigned char, SHA256Kernels::DIGEST_SIZE>>&
+                result
+        );
+
+        std::uint64_t get_total_size() const;
+
+    private:
+        std::array<std::uint32_t, 8> _state;
+
+        std::array<unsigned char, SHA256Kernels::BLOCK_SIZE> _buffer;
+
+        std::size_t _buffer_size;
+
+        std::uint64_t _total_size;
+    };
+}
@@ -4,7 +4,14 @@
 #include "logger.hpp"
 #include "encoder.hpp"
 #include "generator.hpp"
+#include "thread_pool.hpp"
 #include "cryptographer.hpp"
+#include "binary_file_io.hpp"
+#include "sha256_hash_context.hpp"
+
+#include <span>
+#include <vector>
+#include <string_view>
 
 namespace QLogicaeCore
 {
@@ -118,6 +125,31 @@ namespace QLogicaeCore
             const std::string& key
         );
 
+        std::string transform_file(
+            const std::string& file_path
+        );
+
+        std::vector<unsigned char> transform_batch(
+            std::span<const std::string_view> texts
+        );
+
+        void transform(
+            Result<std::size_t>& result,
+            std::span<const unsigned char> bytes,
+            std::span<unsigned char> digest
+        );
+
+        void transform_file(
+            Result<std::string>& result,
+            const std::string& file_path
+        );
+
+        void transform_batch(
+            Result<std::size_t>& result,
+            std::span<const std::string_view> texts,
+            std::span<unsigned char> digests
+        );
+
         static SHA256HashCryptographer& get_instance();
 
         static void get_instance(
@@ -0,0 +1,18 @@
+#pragma once
+
+#include <cstdint>
+
+namespace QLogicaeCore
+{
+    enum class SHA256Kernel :
+        uint8_t
+    {
+        AUTOMATIC,
+
+        SCALAR,
+
+        SHA,
+
+        AVX2
+    };
+}
@@ -0,0 +1,63 @@
+#pragma once
+
+#include "cpu_features.hpp"
+#include "sha256_kernel.hpp"
+
+#include <bit>
+#include <span>
+#include <array>
+#include <vector>
+#include <algorithm>
+#include <cstring>
+#include <cstdint>
+#include <cstddef>
+#include <string_view>
+
+namespace QLogicaeCore
+{
+    class SHA256Kernels
+    {
+    public:
+        static constexpr std::size_t BLOCK_SIZE = 64;
+
+        static constexpr std::size_t DIGEST_SIZE = 32;
+
+        static constexpr std::array<std::uint32_t, 8> INITIAL_STATE =
+        {
+            0x6a09e667, 0xbb67ae85, 0x3c6ef372, 0xa54ff53a,
+            0x510e527f, 0x9b05688c, 0x1f83d9ab, 0x5be0cd19
+        };
+
+        static void compress(
+            std::array<std::uint32_t, 8>& state,
+            const unsigned char* blocks,
+            const std::size_t block_count
+        );
+
+        static void hash(
+            const std::span<const unsigned char> bytes,
+            std::span<unsigned char, DIGEST_SIZE> digest
+        );
+
+        static void hash(
+            const std::span<const unsigned char> bytes,
+            std::span<unsigned char, DIGEST_SIZE> digest,
+            const SHA256Kernel kernel
+        );
+
+        static bool hash_many(
+            const std::span<const std::string_view> messages,
+            std::span<unsigned char> digests
+        );
+
+        static bool hash_many(
+            const std::span<const std::string_view> messages,
+            std::span<unsigned char> digests,
+            const SHA256Kernel kernel
+        );
+
+        static bool is_kernel_supported(
+            const SHA256Kernel kernel
+        );
+    };
+}
@@ -2,8 +2,10 @@
 
 #include "sqlite_backend.hpp"
 #include "sqlite_exception.hpp"
+#include "sqlite_configurations.hpp"
 #include "sqlite_statement_data.hpp"
 #include "sqlite_row.hpp"
+#include "sqlite_row_cursor.hpp"
 #include "sqlite_database.hpp"
 #include "sqlite_statement.hpp"
 #include "sqlite_transaction.hpp"
@@ -0,0 +1,24 @@
+#pragma once
+
+#include <string>
+#include <cstdint>
+
+namespace QLogicaeCore
+{
+    struct SQLiteConfigurations
+    {
+        size_t statement_cache_capacity = 64;
+
+        size_t reader_connection_count = 0;
+
+        bool is_wal_mode_enabled = false;
+
+        std::string synchronous_mode = "";
+
+        int64_t mmap_size = 0;
+
+        int64_t cache_size = 0;
+
+        int busy_timeout_in_milliseconds = 0;
+    };
+}
@@ -3,6 +3,7 @@
 #include "result.hpp"
 #include "sqlite_exception.hpp"
 #include "sqlite_statement.hpp"
+#include "sqlite_configurations.hpp"
 
 namespace QLogicaeCore
 {
@@ -13,6 +14,11 @@ namespace QLogicaeCore
             const std::string& file_path
         );
 
+        SQLiteDatabase(
+            const std::string& file_path,
+            const SQLiteConfigurations& configurations
+        );
+
         ~SQLiteDatabase();
 
         void enable_foreign_keys();
@@ -27,11 +33,166 @@ namespace QLogicaeCore
             const std::string_view& sql_text
         );
 
+        std::shared_ptr<SQLiteStatement> prepare_cached(
+            const std::string_view& sql_text
+        );
+
+        std::shared_ptr<SQLiteStatement> prepare_read(
+            const std::string_view& sql_text
+        );
+
+        std::future<void> query_async(
+            const std::string_view& sql_text,
+            const std::function<void(SQLiteRow& row)>& callback
+        );
+
+        size_t get_reader_connection_count();
+
+        size_t get_statement_cache_size();
+
+        size_t get_statement_cache_capacity();
+
+        void set_statement_cache_capacity(
+            const size_t& value
+        );
+
+        void clear_statement_cache();
+
+        void execute(
+            const std::string_view& sql_text
+        );
+
+        template<typename Range>
+        size_t insert_batch(
+            const std::string_view& sql_text,
+            const Range& rows
+        );
+
+        template<typename Range, typename Mapper>
+        size_t insert_batch(
+            const std::string_view& sql_text,
+            const Range& rows,
+            const Mapper& mapper
+        );
+
         void setup(
             Result<void>& result
         );
 
     protected:
         std::shared_ptr<SQLiteBackend> backend;
+
+        SQLiteConfigurations configurations;
+
+        std::mutex reader_mutex;
+
+        std::vector<std::shared_ptr<SQLiteBackend>> reader_backends;
+
+        std::vector<std::unordered_map<std::string, std::shared_ptr<SQLiteStatement>>>
+            reader_statement_caches;
+
+        void open_connections(
+            const std::string& file_path
+        );
+
+        void apply_pragmas(
+            sqlite3* database_handle,
+            const bool& is_reader
+        );
+
+        std::shared_ptr<SQLiteStatement> acquire_reader_statement(
+            const std::string_view& sql_text
+        );
+
+        size_t get_least_busy_reader_index();
+
+        std::mutex statement_cache_mutex;
+
+        size_t statement_cache_capacity;
+
+        std::list<std::pair<std::string, std::shared_ptr<SQLiteStatement>>>
+            statement_cache_entries;
+
+        std::unordered_map<
+            std::string,
+            std::list<std::pair<std::string, std::shared_ptr<SQLiteStatement>>>::iterator
+        > statement_cache_lookup;
+
+        void evict_statement_cache_entries();
     };
+
+    template<typename Range>
+    size_t SQLiteDatabase::insert_batch(
+        const std::string_view& sql_text,
+        const Range& rows
+    )
+    {
+        return insert_batch(
+            sql_text,
+            rows,
+            [](const auto& row) -> const auto&
+            {
+                return row;
+            }
+        );
+    }
+
+    template<typename Range, typename Mapper>
+    size_t SQLiteDatabase::insert_batch(
+        const std::string_view& sql_text,
+        const Range& rows,
+        const Mapper& mapper
+    )
+    {
+        std::shared_ptr<SQLiteStatement> statement =
+            prepare_cached(sql_text);
+        size_t inserted_count = 0;
+
+        const bool is_transaction_open =
+            sqlite3_get_autocommit(backend->database_handle) == 0;
+        execute(is_transaction_open ?
+            "SAVEPOINT insert_batch;" : "BEGIN;");
+        try
+        {
+            for (const auto& row : rows)
+            {
+                decltype(auto) values = mapper(row);
+
+                statement->bind_tuple_static(values);
+                statement->step();
+                statement->reset();
+
+                ++inserted_count;
+            }
+            statement->clear_bindings();
+
+            execute(is_transaction_open ?
+                "RELEASE SAVEPOINT insert_batch;" : "COMMIT;");
+        }
+        catch (...)
+        {
+            try
+            {
+                statement->reset();
+                statement->clear_bindings();
+                if (is_transaction_open)
+                {
+                    execute("ROLLBACK TO SAVEPOINT insert_batch;");
+                    execute("RELEASE SAVEPOINT insert_batch;");
+                }
+                else
+                {
+                    execute("ROLLBACK;");
+                }
+            }
+            catch (...)
+            {
+
+            }
+
+            throw;
+        }
+
+        return inserted_count;
+    }
 }
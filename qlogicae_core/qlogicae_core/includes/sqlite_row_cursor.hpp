@@ -0,0 +1,82 @@
+#pragma once
+
+#include "result.hpp"
+#include "sqlite_row.hpp"
+
+#include <iterator>
+#include <optional>
+
+namespace QLogicaeCore
+{
+    class SQLiteStatement;
+
+    class SQLiteRowCursor
+    {
+    public:
+        class Iterator
+        {
+        public:
+            using iterator_category = std::input_iterator_tag;
+
+            using value_type = SQLiteRow;
+
+            using difference_type = std::ptrdiff_t;
+
+            using pointer = SQLiteRow*;
+
+            using reference = SQLiteRow&;
+
+            Iterator() = default;
+
+            explicit Iterator(
+                SQLiteStatement* statement_instance
+            );
+
+            SQLiteRow& operator*();
+
+            SQLiteRow* operator->();
+
+            Iterator& operator++();
+
+            bool operator==(
+                const Iterator& other
+            ) const;
+
+            bool operator!=(
+                const Iterator& other
+            ) const;
+
+        protected:
+            SQLiteStatement* statement = nullptr;
+
+            std::optional<SQLiteRow> current_row;
+
+            void advance();
+        };
+
+        explicit SQLiteRowCursor(
+            SQLiteStatement& statement_instance
+        );
+
+        ~SQLiteRowCursor();
+
+        SQLiteRowCursor(
+            const SQLiteRowCursor&
+        ) = delete;
+
+        SQLiteRowCursor& operator = (
+            const SQLiteRowCursor&
+        ) = delete;
+
+        Iterator begin();
+
+        Iterator end();
+
+        void setup(
+            Result<void>& result
+        );
+
+    protected:
+        SQLiteStatement& statement;
+    };
+}
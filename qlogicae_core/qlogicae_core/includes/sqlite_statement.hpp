@@ -5,6 +5,7 @@
 #include "sqlite_exception.hpp"
 #include "sqlite_statement_data.hpp"
 #include "sqlite_row.hpp"
+#include "sqlite_row_cursor.hpp"
 
 namespace QLogicaeCore
 {
@@ -42,10 +43,18 @@ namespace QLogicaeCore
 
         bool is_valid();
 
+        bool is_read_only();
+
         std::optional<SQLiteRow> row();
 
         std::vector<SQLiteRow> query();
 
+        SQLiteRowCursor rows();
+
+        void for_each_row(
+            const std::function<void(SQLiteRow& row)>& callback
+        );
+
         SQLiteStatement& bind(
             int index,
             int value
@@ -126,6 +135,28 @@ namespace QLogicaeCore
             const char* value
         );
 
+        SQLiteStatement& bind_static(
+            int index,
+            const std::string_view& value
+        );
+
+        SQLiteStatement& bind_static(
+            int index,
+            const std::span<const std::byte>& value
+        );
+
+        template<typename... Types>
+        SQLiteStatement& bind_all_static(
+            const Types&... values
+        );
+
+        template<typename... Types>
+        SQLiteStatement& bind_tuple_static(
+            const std::tuple<Types...>& values
+        );
+
+        int get_parameter_count();
+
         template<typename T>
         SQLiteStatement& bind(
             int index,
@@ -160,5 +191,138 @@ namespace QLogicaeCore
         int resolve_named_index(
             const std::string_view& name
         );
+
+        template<typename Type>
+        void bind_positional_static(
+            int index,
+            const Type& value
+        );
+    };
+
+    template<typename Type>
+    struct is_sqlite_optional :
+        std::false_type
+    {
+
+    };
+
+    template<typename Type>
+    struct is_sqlite_optional<std::optional<Type>> :
+        std::true_type
+    {
+
     };
+
+    template<typename... Types>
+    SQLiteStatement& SQLiteStatement::bind_all_static(
+        const Types&... values
+    )
+    {
+        if (get_parameter_count() != static_cast<int>(sizeof...(Types)))
+        {
+            throw SQLiteException("bind_all_static() parameter count mismatch",
+                SQLITE_RANGE, SQLITE_RANGE);
+        }
+
+        int index = 0;
+        (bind_positional_static(++index, values), ...);
+
+        return *this;
+    }
+
+    template<typename... Types>
+    SQLiteStatement& SQLiteStatement::bind_tuple_static(
+        const std::tuple<Types...>& values
+    )
+    {
+        std::apply(
+            [this](const auto&... tuple_values)
+            {
+                bind_all_static(tuple_values...);
+            },
+            values
+        );
+
+        return *this;
+    }
+
+    template<typename Type>
+    void SQLiteStatement::bind_positional_static(
+        int index,
+        const Type& value
+    )
+    {
+        using Value = std::remove_cvref_t<Type>;
+
+        if constexpr (is_sqlite_optional<Value>::value)
+        {
+            if (value.has_value())
+            {
+                bind_positional_static(index, *value);
+            }
+            else
+            {
+                bind(index, nullptr);
+            }
+        }
+        else if constexpr (std::is_same_v<Value, std::nullptr_t>)
+        {
+            bind(index, nullptr);
+        }
+        else if constexpr (std::is_same_v<Value, bool>)
+        {
+            bind(index, value);
+        }
+        else if constexpr (std::is_integral_v<Value>)
+        {
+            if constexpr (std::is_unsigned_v<Value> &&
+                sizeof(Value) >= sizeof(int64_t))
+            {
+                if (value > static_cast<Value>(
+                    std::numeric_limits<int64_t>::max()))
+                {
+                    throw SQLiteException(
+                        "bind_all_static() unsigned value exceeds INT64_MAX",
+                        SQLITE_RANGE, SQLITE_RANGE);
+                }
+            }
+
+            bind(index, static_cast<int64_t>(value));
+        }
+        else if constexpr (std::is_floating_point_v<Value>)
+        {
+            bind(index, static_cast<double>(value));
+        }
+        else if constexpr (std::is_same_v<Value, std::string> ||
+            std::is_same_v<Value, std::string_view>)
+        {
+            bind_static(index, std::string_view(value));
+        }
+        else if constexpr (std::is_same_v<Value, const char*> ||
+            std::is_same_v<Value, char*>)
+        {
+            if (value == nullptr)
+            {
+                bind(index, nullptr);
+            }
+            else
+            {
+                bind_static(index, std::string_view(value));
+            }
+        }
+        else if constexpr (std::is_same_v<Value, std::vector<std::byte>> ||
+            std::is_same_v<Value, std::span<const std::byte>>)
+        {
+            bind_static(index, std::span<const std::byte>(value));
+        }
+        else if constexpr (std::is_same_v<Value, std::vector<unsigned char>>)
+        {
+            bind_static(index, std::as_bytes(std::span(value)));
+        }
+        else
+        {
+            static_assert(sizeof(Value) == 0,
+                "Unsupported SQLiteStatement column type");
+        }
+    }
 }
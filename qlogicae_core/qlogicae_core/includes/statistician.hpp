@@ -1,6 +1,10 @@
 #pragma once
 
 #include "utilities.hpp"
+#include "thread_pool.hpp"
+#include "statistician_kernels.hpp"
+#include "statistician_strided_span.hpp"
+#include "statistician_accumulator.hpp"
 #include "outlier_removal_options.hpp"
 
 namespace QLogicaeCore
@@ -24,6 +28,10 @@ namespace QLogicaeCore
             std::vector<double>& values, double mean
         );
 
+        StatisticianAccumulator compute_accumulator(
+            std::vector<std::vector<double>>& data
+        );
+
         bool remove_outliers_via_median_absolute_deviation(
             std::vector<std::vector<double>>& data,
             const OutlierRemovalOptions& options
@@ -64,6 +72,69 @@ namespace QLogicaeCore
             const OutlierRemovalOptions& options
         );
 
+        bool is_valid_data(
+            const StatisticianStridedSpan& values
+        );
+
+        double compute_median(const StatisticianStridedSpan& values);
+
+        double compute_mean(const StatisticianStridedSpan& values);
+
+        double compute_standard_deviation(
+            const StatisticianStridedSpan& values, double mean
+        );
+
+        StatisticianAccumulator compute_accumulator(
+            const StatisticianStridedSpan& values
+        );
+
+        bool remove_outliers_via_median_absolute_deviation(
+            const StatisticianStridedSpan& values,
+            const OutlierRemovalOptions& options,
+            std::vector<std::size_t>& indices
+        );
+
+        bool remove_outliers_via_inter_quartile_range(
+            const StatisticianStridedSpan& values,
+            const OutlierRemovalOptions& options,
+            std::vector<std::size_t>& indices
+        );
+
+        bool remove_outliers_via_z_score(
+            const StatisticianStridedSpan& values,
+            const OutlierRemovalOptions& options,
+            std::vector<std::size_t>& indices
+        );
+
+        bool remove_outliers_via_winsorizing(
+            std::span<double> values,
+            const OutlierRemovalOptions& options
+        );
+
+        bool remove_outliers_via_trimmed_mean(
+            const StatisticianStridedSpan& values,
+            const OutlierRemovalOptions& options,
+            std::vector<std::size_t>& indices
+        );
+
+        bool remove_outliers_via_grubbs_test(
+            const StatisticianStridedSpan& values,
+            const OutlierRemovalOptions& options,
+            std::vector<std::size_t>& indices
+        );
+
+        bool remove_outliers_via_tukey(
+            const StatisticianStridedSpan& values,
+            const OutlierRemovalOptions& options,
+            std::vector<std::size_t>& indices
+        );
+
+        bool remove_outliers_via_modified_z_score(
+            const StatisticianStridedSpan& values,
+            const OutlierRemovalOptions& options,
+            std::vector<std::size_t>& indices
+        );
+
         std::future<bool> is_valid_data_async(
             std::vector<std::vector<double>>& data
         );
@@ -0,0 +1,86 @@
+#pragma once
+
+#include "thread_pool.hpp"
+#include "statistician_digest.hpp"
+#include "statistician_kernels.hpp"
+
+#include <span>
+#include <cmath>
+#include <limits>
+#include <vector>
+#include <cstddef>
+#include <algorithm>
+
+namespace QLogicaeCore
+{
+    class StatisticianAccumulator
+    {
+    public:
+        StatisticianAccumulator();
+
+        explicit StatisticianAccumulator(
+            const double& compression
+        );
+
+        void update(
+            const double& value
+        );
+
+        void update(
+            std::span<const double> values
+        );
+
+        void merge(
+            const StatisticianAccumulator& accumulator
+        );
+
+        void clear();
+
+        std::size_t get_count() const;
+
+        double get_mean() const;
+
+        double get_variance() const;
+
+        double get_sample_variance() const;
+
+        double get_standard_deviation() const;
+
+        double get_minimum() const;
+
+        double get_maximum() const;
+
+        double get_median();
+
+        double get_quantile(
+            const double& quantile
+        );
+
+    protected:
+        std::size_t _count;
+
+        double _mean;
+
+        double _m2;
+
+        double _minimum;
+
+        double _maximum;
+
+        bool _is_quantile_tracking_enabled;
+
+        StatisticianDigest _digest;
+
+        void _update_moments(
+            const double& value
+        );
+
+        void _update_moments(
+            std::span<const double> values
+        );
+
+        void _merge_moments(
+            const StatisticianAccumulator& accumulator
+        );
+    };
+}
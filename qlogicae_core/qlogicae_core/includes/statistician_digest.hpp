@@ -0,0 +1,61 @@
+#pragma once
+
+#include "utilities.hpp"
+#include "statistician_digest_centroid.hpp"
+
+#include <cmath>
+#include <limits>
+#include <vector>
+#include <numbers>
+#include <algorithm>
+
+namespace QLogicaeCore
+{
+    class StatisticianDigest
+    {
+    public:
+        StatisticianDigest();
+
+        explicit StatisticianDigest(
+            const double& compression
+        );
+
+        void update(
+            const double& value,
+            const double& weight = 1.0
+        );
+
+        void merge(
+            const StatisticianDigest& digest
+        );
+
+        void clear();
+
+        double get_total_weight() const;
+
+        std::size_t get_centroid_count();
+
+        double get_quantile(
+            const double& quantile
+        );
+
+    protected:
+        double _compression;
+
+        double _total_weight;
+
+        double _minimum;
+
+        double _maximum;
+
+        std::vector<StatisticianDigestCentroid> _centroids;
+
+        std::vector<StatisticianDigestCentroid> _buffer;
+
+        void _compress();
+
+        double _get_quantile_limit(
+            const double& quantile
+        ) const;
+    };
+}
@@ -0,0 +1,11 @@
+#pragma once
+
+namespace QLogicaeCore
+{
+    struct StatisticianDigestCentroid
+    {
+        double mean = 0.0;
+
+        double weight = 0.0;
+    };
+}
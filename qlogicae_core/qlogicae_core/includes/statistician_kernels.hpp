@@ -0,0 +1,52 @@
+#pragma once
+
+#include "cpu_features.hpp"
+
+#include <span>
+#include <array>
+#include <cmath>
+#include <bit>
+#include <cstdint>
+#include <cstddef>
+#include <algorithm>
+
+namespace QLogicaeCore
+{
+    class StatisticianKernels
+    {
+    public:
+        static double sum(
+            std::span<const double> values
+        );
+
+        static double sum_of_squared_deviations(
+            std::span<const double> values,
+            const double center
+        );
+
+        static double maximum_absolute_deviation(
+            std::span<const double> values,
+            const double center
+        );
+
+        static void absolute_deviations(
+            std::span<const double> values,
+            const double center,
+            double* output
+        );
+
+        static std::size_t filter_within(
+            std::span<const double> values,
+            const double center,
+            const double bound,
+            double* output
+        );
+
+        static std::size_t select_within(
+            std::span<const double> values,
+            const double center,
+            const double bound,
+            std::size_t* output
+        );
+    };
+}
@@ -0,0 +1,51 @@
+#pragma once
+
+#include <span>
+#include <vector>
+#include <cstddef>
+
+namespace QLogicaeCore
+{
+    class StatisticianStridedSpan
+    {
+    public:
+        StatisticianStridedSpan();
+
+        StatisticianStridedSpan(
+            const std::vector<double>& values
+        );
+
+        StatisticianStridedSpan(
+            std::span<const double> values
+        );
+
+        StatisticianStridedSpan(
+            const double* data,
+            const std::size_t& size,
+            const std::size_t& stride = 1
+        );
+
+        const double* get_data() const;
+
+        std::size_t get_size() const;
+
+        std::size_t get_stride() const;
+
+        bool is_empty() const;
+
+        bool is_contiguous() const;
+
+        std::span<const double> get_span() const;
+
+        const double& operator[](
+            const std::size_t& index
+        ) const;
+
+    protected:
+        const double* _data;
+
+        std::size_t _size;
+
+        std::size_t _stride;
+    };
+}
@@ -35,6 +35,12 @@ namespace QLogicaeCore
             const TaskPriority& priority =
                 TaskPriority::MEDIUM
         );
+
+        template <typename Callable>
+        void parallel_for(
+            const std::size_t& task_count,
+            Callable&& task
+        );
         
         std::size_t worker_count();
         
@@ -79,6 +85,13 @@ namespace QLogicaeCore
             Callable&& task,
             const TaskPriority& priority = TaskPriority::MEDIUM);
 
+        template <typename Callable>
+        void parallel_for(
+            Result<void>& result,
+            const std::size_t& task_count,
+            Callable&& task
+        );
+
     protected:
         std::size_t _max_queue_capacity;
         
@@ -213,4 +226,94 @@ namespace QLogicaeCore
 
         result.set_to_good_status_with_value(task_future);
     }
+
+    template <typename Callable>
+    void ThreadPool::parallel_for(const std::size_t& task_count,
+        Callable&& task)
+    {
+        if (task_count == 0)
+        {
+            return;
+        }
+
+        if (task_count == 1 ||
+            current_worker_index() != std::numeric_limits<std::size_t>::max())
+        {
+            for (std::size_t task_index = 0; task_index < task_count;
+                ++task_index)
+            {
+                task(task_index);
+            }
+
+            return;
+        }
+
+        std::vector<std::future<void>> futures;
+        futures.reserve(task_count - 1);
+        std::exception_ptr exception;
+        try
+        {
+            for (std::size_t task_index = 1; task_index < task_count;
+                ++task_index)
+            {
+                std::optional<std::future<void>> future = enqueue_task(
+                    [&task, task_index]()
+                    {
+                        task(task_index);
+                    }
+                );
+                if (future.has_value())
+                {
+                    futures.push_back(std::move(*future));
+                }
+                else
+                {
+                    task(task_index);
+                }
+            }
+
+            task(0);
+        }
+        catch (...)
+        {
+            exception = std::current_exception();
+        }
+
+        for (std::future<void>& future : futures)
+        {
+            try
+            {
+                future.get();
+            }
+            catch (...)
+            {
+                if (!exception)
+                {
+                    exception = std::current_exception();
+                }
+            }
+        }
+
+        if (exception)
+        {
+            std::rethrow_exception(exception);
+        }
+    }
+
+    template <typename Callable>
+    void ThreadPool::parallel_for(Result<void>& result,
+        const std::size_t& task_count,
+        Callable&& task)
+    {
+        try
+        {
+            parallel_for(task_count, std::forward<Callable>(task));
+
+            result.set_to_good_status_without_value();
+        }
+        catch (const std::exception& exception)
+        {
+            result.set_to_bad_status_without_value(exception.what());
+        }
+    }
 }
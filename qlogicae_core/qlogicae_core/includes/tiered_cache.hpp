@@ -0,0 +1,175 @@
+#pragma once
+
+#include "result.hpp"
+#include "logger.hpp"
+#include "interval.hpp"
+#include "utilities.hpp"
+#include "concurrent_cache.hpp"
+#include "rocksdb_database.hpp"
+#include "tiered_cache_statistics.hpp"
+#include "tiered_cache_write_policy.hpp"
+#include "tiered_cache_configurations.hpp"
+
+#include <array>
+#include <mutex>
+#include <atomic>
+#include <future>
+#include <memory>
+#include <string>
+#include <cstdint>
+#include <cstddef>
+#include <optional>
+#include <functional>
+#include <unordered_map>
+
+namespace QLogicaeCore
+{
+    class TieredCache
+    {
+    public:
+        explicit TieredCache(
+            RocksDBDatabase& database = ROCKSDB_DATABASE,
+            const TieredCacheConfigurations& configurations = {}
+        );
+
+        ~TieredCache();
+
+        TieredCache(
+            const TieredCache& instance
+        ) = delete;
+
+        TieredCache(
+            TieredCache&& instance
+        ) noexcept = delete;
+
+        TieredCache& operator = (
+            TieredCache&& instance
+        ) = delete;
+
+        TieredCache& operator = (
+            const TieredCache& instance
+        ) = delete;
+
+        bool read(
+            const std::string& key,
+            std::string& value
+        );
+
+        std::optional<std::string> read(
+            const std::string& key
+        );
+
+        void read(
+            Result<std::string>& result,
+            const std::string& key
+        );
+
+        bool write(
+            const std::string& key,
+            const std::string& value
+        );
+
+        void write(
+            Result<void>& result,
+            const std::string& key,
+            const std::string& value
+        );
+
+        bool remove(
+            const std::string& key
+        );
+
+        void remove(
+            Result<void>& result,
+            const std::string& key
+        );
+
+        bool is_key_found(
+            const std::string& key
+        );
+
+        void is_key_found(
+            Result<bool>& result,
+            const std::string& key
+        );
+
+        bool flush();
+
+        void flush(
+            Result<void>& result
+        );
+
+        std::future<bool> flush_async();
+
+        void invalidate(
+            const std::string& key
+        );
+
+        void clear();
+
+        TieredCacheConfigurations get_configurations();
+
+        TieredCacheStatistics get_statistics();
+
+        void get_statistics(
+            Result<TieredCacheStatistics>& result
+        );
+
+    private:
+        RocksDBDatabase* _database;
+
+        TieredCacheConfigurations _configurations;
+
+        ConcurrentCache<std::string, std::string> _memory_cache;
+
+        std::array<std::mutex, 64> _write_mutexes;
+
+        std::mutex _pending_writes_mutex;
+
+        std::unordered_map<
+            std::string,
+            std::optional<std::string>
+        > _pending_writes;
+
+        std::mutex _flush_mutex;
+
+        std::unique_ptr<Interval> _write_back_interval;
+
+        std::atomic<uint64_t> _backend_read_count { 0 };
+
+        std::atomic<uint64_t> _backend_write_count { 0 };
+
+        std::atomic<uint64_t> _backend_remove_count { 0 };
+
+        std::atomic<uint64_t> _backend_failure_count { 0 };
+
+        std::atomic<uint64_t> _pending_write_hit_count { 0 };
+
+        std::atomic<uint64_t> _flush_count { 0 };
+
+        std::mutex& _get_write_mutex(
+            const std::string& key
+        );
+
+        bool _is_write_back();
+
+        bool _read_pending_write(
+            const std::string& key,
+            std::optional<std::string>& value
+        );
+
+        bool _stage_pending_write(
+            const std::string& key,
+            std::optional<std::string> value
+        );
+
+        std::optional<std::string> _read_backend(
+            const std::string& key
+        );
+
+        bool _write_backend(
+            const std::string& key,
+            const std::optional<std::string>& value
+        );
+    };
+}
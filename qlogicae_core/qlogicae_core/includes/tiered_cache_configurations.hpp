@@ -0,0 +1,28 @@
+#pragma once
+
+#include "tiered_cache_write_policy.hpp"
+#include "concurrent_cache_configurations.hpp"
+
+#include <cstdint>
+#include <cstddef>
+
+namespace QLogicaeCore
+{
+    struct TieredCacheConfigurations
+    {
+        ConcurrentCacheConfigurations memory_cache_configurations =
+        {
+            .shard_count = 16,
+            .maximum_weight = 67108864
+        };
+
+        TieredCacheWritePolicy write_policy =
+            TieredCacheWritePolicy::WRITE_THROUGH;
+
+        uint64_t write_back_interval_in_milliseconds = 1000;
+
+        std::size_t maximum_pending_write_count = 4096;
+
+        bool is_weighted_by_size = true;
+    };
+}
@@ -0,0 +1,28 @@
+#pragma once
+
+#include "concurrent_cache_statistics.hpp"
+
+#include <cstdint>
+#include <cstddef>
+
+namespace QLogicaeCore
+{
+    struct TieredCacheStatistics
+    {
+        ConcurrentCacheStatistics memory_cache_statistics;
+
+        uint64_t backend_read_count = 0;
+
+        uint64_t backend_write_count = 0;
+
+        uint64_t backend_remove_count = 0;
+
+        uint64_t backend_failure_count = 0;
+
+        uint64_t pending_write_hit_count = 0;
+
+        uint64_t flush_count = 0;
+
+        std::size_t pending_write_count = 0;
+    };
+}
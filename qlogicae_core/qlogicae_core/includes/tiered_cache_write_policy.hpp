@@ -0,0 +1,14 @@
+#pragma once
+
+#include <cstdint>
+
+namespace QLogicaeCore
+{
+    enum class TieredCacheWritePolicy :
+        uint8_t
+    {
+        WRITE_THROUGH,
+
+        WRITE_BACK
+    };
+}
@@ -0,0 +1,46 @@
+#pragma once
+
+#include "cpu_features.hpp"
+
+#include <span>
+#include <cstdint>
+#include <cstddef>
+#include <optional>
+#include <string_view>
+
+namespace QLogicaeCore
+{
+    class UnicodeKernels
+    {
+    public:
+        static bool is_utf8(
+            const std::string_view value
+        );
+
+        static bool is_utf16(
+            const std::u16string_view value
+        );
+
+        static std::size_t get_ascii_prefix_size(
+            const std::string_view value
+        );
+
+        static std::size_t get_utf16_length(
+            const std::string_view value
+        );
+
+        static std::size_t get_utf8_length(
+            const std::u16string_view value
+        );
+
+        static std::optional<std::size_t> convert_utf8_to_utf16(
+            const std::string_view value,
+            std::span<char16_t> output
+        );
+
+        static std::optional<std::size_t> convert_utf16_to_utf8(
+            const std::u16string_view value,
+            std::span<char> output
+        );
+    };
+}
@@ -160,6 +160,63 @@ namespace QLogicaeCore
         const std::string DEFAULT_HOST_ADDRESS =
             "1.1.1.1";
 
+        const std::size_t VALIDATION_PARALLEL_MINIMUM_COUNT =
+            16'384;
+
+        const std::size_t VALIDATION_PARALLEL_CHUNK_SIZE =
+            4'096;
+
+        const std::size_t CIPHER_STREAM_CHUNK_SIZE =
+            65'536;
+
+        const std::size_t CIPHER_STREAM_QUEUE_CAPACITY =
+            4;
+
+        const std::size_t CIPHER_BATCH_PARALLEL_MINIMUM_COUNT =
+            1'024;
+
+        const std::size_t CIPHER_BATCH_CHUNK_SIZE =
+            256;
+
+        const std::size_t PASSWORD_HASH_MAXIMUM_CONCURRENCY =
+            2;
+
+        const std::size_t PASSWORD_HASH_MAXIMUM_QUEUE_DEPTH =
+            256;
+
+        const std::uint64_t PASSWORD_HASH_MAXIMUM_OPERATIONS_LIMIT =
+            64;
+
+        const std::size_t SHA256_STREAM_CHUNK_SIZE =
+            1'048'576;
+
+        const std::size_t SHA256_BATCH_PARALLEL_MINIMUM_COUNT =
+            4'096;
+
+        const std::size_t SHA256_BATCH_CHUNK_SIZE =
+            1'024;
+
+        const std::size_t JSONWEBTOKEN_VERIFIED_CACHE_CAPACITY =
+            4'096;
+
+        const std::chrono::seconds JSONWEBTOKEN_VERIFIED_CACHE_TIME_TO_LIVE =
+            std::chrono::seconds(300);
+
+        const std::size_t JSONWEBTOKEN_LEEWAY_IN_SECONDS =
+            30;
+
+        const double STATISTICIAN_DIGEST_COMPRESSION =
+            100.0;
+
+        const std::size_t STATISTICIAN_PARALLEL_MINIMUM_SIZE =
+            1'048'576;
+
+        const std::size_t STATISTICIAN_PARALLEL_CHUNK_SIZE =
+            262'144;
+
+        const std::size_t STATISTICIAN_GATHER_BLOCK_SIZE =
+            4'096;
+
         const double SECONDS_OVER_NANOSECONDS =
             1'000'000'000.0;
         
@@ -1163,6 +1220,18 @@ namespace QLogicaeCore
         const std::string DEFAULT_BOOST_INTERPROCESS_CACHE_SEGMENT_NAME =
             "BoostInterprocessCacheSharedData";
 
+        const std::string DEFAULT_BOOST_INTERPROCESS_CACHE_CONTROL_NAME =
+            "BoostInterprocessCacheControlData";
+
+        const std::size_t BOOST_INTERPROCESS_CACHE_READER_SLOT_ATTEMPT_LIMIT =
+            64;
+
+        const std::size_t BOOST_INTERPROCESS_CACHE_MAPPING_ATTEMPT_LIMIT =
+            1'024;
+
+        const std::size_t BOOST_INTERPROCESS_CACHE_SEQUENCE_ATTEMPT_LIMIT =
+            65'536;
+
         const std::string RELATIVE_PUBLIC_FOLDER_PATH_1 =
             "public";
 
@@ -0,0 +1,50 @@
+#pragma once
+
+#include "unicode_kernels.hpp"
+#include "validation_matchers.hpp"
+#include "validation_predicate.hpp"
+
+#include <cstdint>
+#include <cstddef>
+#include <string_view>
+
+namespace QLogicaeCore
+{
+    using validation_kernel_t = bool(*)(const std::string_view value);
+
+    class ValidationKernels
+    {
+    public:
+        static bool is_hex(
+            const std::string_view value
+        );
+
+        static bool is_base64(
+            const std::string_view value
+        );
+
+        static bool is_alphanumeric(
+            const std::string_view value
+        );
+
+        static bool is_lowercase(
+            const std::string_view value
+        );
+
+        static bool is_uppercase(
+            const std::string_view value
+        );
+
+        static bool is_decimal(
+            const std::string_view value
+        );
+
+        static bool is_utf8(
+            const std::string_view value
+        );
+
+        static validation_kernel_t get_kernel(
+            const ValidationPredicate predicate
+        );
+    };
+}
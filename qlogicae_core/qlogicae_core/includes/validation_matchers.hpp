@@ -0,0 +1,902 @@
+#pragma once
+
+#include <cstddef>
+#include <string_view>
+
+namespace QLogicaeCore
+{
+    class ValidationMatchers
+    {
+    public:
+        static constexpr bool is_digit(
+            const char character
+        );
+
+        static constexpr bool is_hex_digit(
+            const char character
+        );
+
+        static constexpr bool is_alpha(
+            const char character
+        );
+
+        static constexpr bool is_alphanumeric(
+            const char character
+        );
+
+        static constexpr bool is_lowercase_alphanumeric(
+            const char character
+        );
+
+        static constexpr bool is_base64_character(
+            const char character
+        );
+
+        static constexpr bool is_space(
+            const char character
+        );
+
+        static constexpr bool is_mime_token_character(
+            const char character
+        );
+
+        static constexpr bool is_all_of(
+            const std::string_view value,
+            bool (*predicate)(const char)
+        );
+
+        static constexpr bool match_iso8601(
+            const std::string_view value
+        );
+
+        static constexpr bool match_hex_color(
+            const std::string_view value
+        );
+
+        static constexpr bool match_base64(
+            const std::string_view value
+        );
+
+        static constexpr bool match_slug(
+            const std::string_view value
+        );
+
+        static constexpr bool match_hex(
+            const std::string_view value
+        );
+
+        static constexpr bool match_uuid(
+            const std::string_view value,
+            const char version
+        );
+
+        static constexpr bool match_ipv4(
+            const std::string_view value
+        );
+
+        static constexpr bool match_ipv6(
+            const std::string_view value
+        );
+
+        static constexpr bool match_url(
+            const std::string_view value
+        );
+
+        static constexpr bool match_mac_address(
+            const std::string_view value
+        );
+
+        static constexpr bool match_hostname(
+            const std::string_view value
+        );
+
+        static constexpr bool match_domain(
+            const std::string_view value
+        );
+
+        static constexpr bool match_rgb_color(
+            const std::string_view value
+        );
+
+        static constexpr bool match_rgba_color(
+            const std::string_view value
+        );
+
+        static constexpr bool match_base64_image(
+            const std::string_view value
+        );
+
+        static constexpr bool match_data_uri(
+            const std::string_view value
+        );
+
+        static constexpr bool match_e164_phone_number(
+            const std::string_view value
+        );
+
+        static constexpr bool match_country_calling_code(
+            const std::string_view value
+        );
+
+        static constexpr bool match_full_name(
+            const std::string_view value
+        );
+
+        static constexpr bool match_email(
+            const std::string_view value
+        );
+
+    private:
+        static constexpr bool _match_separated(
+            const std::string_view value,
+            bool (*predicate)(const char),
+            const std::string_view separators
+        );
+
+        static constexpr bool _match_hostname_label(
+            const std::string_view value
+        );
+
+        static constexpr bool _match_color_component(
+            const std::string_view value,
+            std::size_t& index
+        );
+
+        static constexpr bool _match_alpha_component(
+            const std::string_view value,
+            std::size_t& index
+        );
+
+        static constexpr void _skip_spaces(
+            const std::string_view value,
+            std::size_t& index
+        );
+    };
+
+    constexpr bool ValidationMatchers::is_digit(
+        const char character
+    )
+    {
+        return character >= '0' && character <= '9';
+    }
+
+    constexpr bool ValidationMatchers::is_hex_digit(
+        const char character
+    )
+    {
+        return is_digit(character) ||
+            (character >= 'a' && character <= 'f') ||
+            (character >= 'A' && character <= 'F');
+    }
+
+    constexpr bool ValidationMatchers::is_alpha(
+        const char character
+    )
+    {
+        return (character >= 'a' && character <= 'z') ||
+            (character >= 'A' && character <= 'Z');
+    }
+
+    constexpr bool ValidationMatchers::is_alphanumeric(
+        const char character
+    )
+    {
+        return is_alpha(character) || is_digit(character);
+    }
+
+    constexpr bool ValidationMatchers::is_lowercase_alphanumeric(
+        const char character
+    )
+    {
+        return (character >= 'a' && character <= 'z') || is_digit(character);
+    }
+
+    constexpr bool ValidationMatchers::is_base64_character(
+        const char character
+    )
+    {
+        return is_alphanumeric(character) ||
+            character == '+' ||
+            character == '/';
+    }
+
+    constexpr bool ValidationMatchers::is_space(
+        const char character
+    )
+    {
+        return character == ' ' ||
+            (character >= '\t' && character <= '\r');
+    }
+
+    constexpr bool ValidationMatchers::is_mime_token_character(
+        const char character
+    )
+    {
+        return is_alphanumeric(character) ||
+            std::string_view("!#$&^_.+-").find(character) !=
+                std::string_view::npos;
+    }
+
+    constexpr bool ValidationMatchers::is_all_of(
+        const std::string_view value,
+        bool (*predicate)(const char)
+    )
+    {
+        for (const char character : value)
+        {
+            if (!predicate(character))
+            {
+                return false;
+            }
+        }
+
+        return true;
+    }
+
+    constexpr bool ValidationMatchers::match_iso8601(
+        const std::string_view value
+    )
+    {
+        constexpr std::string_view layout = "dddd-dd-ddTdd:dd:dd";
+
+        if (value.size() < layout.size())
+        {
+            return false;
+        }
+
+        for (std::size_t index = 0; index < layout.size(); ++index)
+        {
+            if (layout[index] == 'd' ?
+                !is_digit(value[index]) : value[index] != layout[index])
+            {
+                return false;
+            }
+        }
+
+        const std::string_view zone = value.substr(layout.size());
+
+        return zone.empty() ||
+            zone == "Z" ||
+            (zone.size() == 6 &&
+                (zone[0] == '+' || zone[0] == '-') &&
+                is_digit(zone[1]) &&
+                is_digit(zone[2]) &&
+                zone[3] == ':' &&
+                is_digit(zone[4]) &&
+                is_digit(zone[5]));
+    }
+
+    constexpr bool ValidationMatchers::match_hex_color(
+        const std::string_view value
+    )
+    {
+        return (value.size() == 4 || value.size() == 7) &&
+            value[0] == '#' &&
+            is_all_of(value.substr(1), is_hex_digit);
+    }
+
+    constexpr bool ValidationMatchers::match_base64(
+        const std::string_view value
+    )
+    {
+        if (value.size() % 4 != 0)
+        {
+            return false;
+        }
+
+        if (value.empty())
+        {
+            return true;
+        }
+
+        const std::size_t body_size = value.size() - 4;
+        if (!is_all_of(value.substr(0, body_size), is_base64_character))
+        {
+            return false;
+        }
+
+        const std::string_view tail = value.substr(body_size);
+        if (tail[3] != '=')
+        {
+            return is_all_of(tail, is_base64_character);
+        }
+
+        if (tail[2] == '=')
+        {
+            return is_base64_character(tail[0]) &&
+                is_base64_character(tail[1]);
+        }
+
+        return is_all_of(tail.substr(0, 3), is_base64_character);
+    }
+
+    constexpr bool ValidationMatchers::match_slug(
+        const std::string_view value
+    )
+    {
+        return _match_separated(value, is_lowercase_alphanumeric, "-");
+    }
+
+    constexpr bool ValidationMatchers::match_hex(
+        const std::string_view value
+    )
+    {
+        const std::string_view digits = value.starts_with("0x") ?
+            value.substr(2) : value;
+
+        return !digits.empty() && is_all_of(digits, is_hex_digit);
+    }
+
+    constexpr bool ValidationMatchers::match_uuid(
+        const std::string_view value,
+        const char version
+    )
+    {
+        if (value.size() != 36)
+        {
+            return false;
+        }
+
+        for (std::size_t index = 0; index < value.size(); ++index)
+        {
+            const bool is_valid =
+                index == 8 || index == 13 || index == 18 || index == 23 ?
+                value[index] == '-' :
+                is_hex_digit(value[index]);
+            if (!is_valid)
+            {
+                return false;
+            }
+        }
+
+        return value[14] == version &&
+            std::string_view("89abAB").find(value[19]) !=
+                std::string_view::npos;
+    }
+
+    constexpr bool ValidationMatchers::match_ipv4(
+        const std::string_view value
+    )
+    {
+        std::size_t index = 0;
+
+        for (std::size_t part = 0; part < 4; ++part)
+        {
+            if (part != 0)
+            {
+                if (index >= value.size() || value[index] != '.')
+                {
+                    return false;
+                }
+
+                ++index;
+            }
+
+            const std::size_t start = index;
+            unsigned int number = 0;
+            while (index < value.size() &&
+                index - start < 3 &&
+                is_digit(value[index]))
+            {
+                number = number * 10 + static_cast<unsigned int>(
+                    value[index] - '0'
+                );
+                ++index;
+            }
+
+            const std::size_t length = index - start;
+            if (length == 0 ||
+                number > 255 ||
+                (length > 1 && value[start] == '0'))
+            {
+                return false;
+            }
+        }
+
+        return index == value.size();
+    }
+
+    constexpr bool ValidationMatchers::match_ipv6(
+        const std::string_view value
+    )
+    {
+        std::size_t index = 0;
+
+        for (std::size_t group = 0; group < 8; ++group)
+        {
+            if (group != 0)
+            {
+                if (index >= value.size() || value[index] != ':')
+                {
+                    return false;
+                }
+
+                ++index;
+            }
+
+            const std::size_t start = index;
+            while (index < value.size() &&
+                index - start < 4 &&
+                is_hex_digit(value[index]))
+            {
+                ++index;
+            }
+
+            if (index == start)
+            {
+                return false;
+            }
+        }
+
+        return index == value.size();
+    }
+
+    constexpr bool ValidationMatchers::match_url(
+        const std::string_view value
+    )
+    {
+        std::size_t index = 0;
+
+        if (value.starts_with("https://"))
+        {
+            index = 8;
+        }
+        else if (value.starts_with("http://"))
+        {
+            index = 7;
+        }
+        else
+        {
+            return false;
+        }
+
+        const std::size_t host_start = index;
+        while (index < value.size() &&
+            (is_alphanumeric(value[index]) ||
+                value[index] == '.' ||
+                value[index] == '-'))
+        {
+            ++index;
+        }
+
+        if (index == host_start)
+        {
+            return false;
+        }
+
+        if (index < value.size() && value[index] == ':')
+        {
+            const std::size_t port_start = ++index;
+            while (index < value.size() && is_digit(value[index]))
+            {
+                ++index;
+            }
+
+            if (index == port_start)
+            {
+                return false;
+            }
+        }
+
+        if (index == value.size())
+        {
+            return true;
+        }
+
+        if (value[index] != '/')
+        {
+            return false;
+        }
+
+        for (++index; index < value.size(); ++index)
+        {
+            if (is_space(value[index]))
+            {
+                return false;
+            }
+        }
+
+        return true;
+    }
+
+    constexpr bool ValidationMatchers::match_mac_address(
+        const std::string_view value
+    )
+    {
+        if (value.size() != 17)
+        {
+            return false;
+        }
+
+        for (std::size_t index = 0; index < value.size(); ++index)
+        {
+            const bool is_valid = index % 3 == 2 ?
+                value[index] == ':' || value[index] == '-' :
+                is_hex_digit(value[index]);
+            if (!is_valid)
+            {
+                return false;
+            }
+        }
+
+        return true;
+    }
+
+    constexpr bool ValidationMatchers::match_hostname(
+        const std::string_view value
+    )
+    {
+        std::size_t start = 0;
+
+        while (true)
+        {
+            const std::size_t end = value.find('.', start);
+            if (!_match_hostname_label(value.substr(start, end - start)))
+            {
+                return false;
+            }
+
+            if (end == std::string_view::npos)
+            {
+                return true;
+            }
+
+            start = end + 1;
+        }
+    }
+
+    constexpr bool ValidationMatchers::match_domain(
+        const std::string_view value
+    )
+    {
+        const std::size_t last_dot = value.rfind('.');
+        if (last_dot == std::string_view::npos || last_dot == 0)
+        {
+            return false;
+        }
+
+        const std::string_view top_level_domain = value.substr(last_dot + 1);
+        if (top_level_domain.size() < 2 ||
+            !is_all_of(top_level_domain, is_alpha))
+        {
+            return false;
+        }
+
+        std::size_t start = 0;
+        while (true)
+        {
+            const std::size_t end = value.find('.', start);
+            if (!_match_separated(
+                value.substr(start, end - start), is_alphanumeric, "-"))
+            {
+                return false;
+            }
+
+            if (end == last_dot)
+            {
+                return true;
+            }
+
+            start = end + 1;
+        }
+    }
+
+    constexpr bool ValidationMatchers::match_rgb_color(
+        const std::string_view value
+    )
+    {
+        if (!value.starts_with("rgb(") || !value.ends_with(")"))
+        {
+            return false;
+        }
+
+        const std::string_view body = value.substr(4, value.size() - 5);
+        std::size_t index = 0;
+
+        for (std::size_t component = 0; component < 3; ++component)
+        {
+            if (component != 0)
+            {
+                if (index >= body.size() || body[index] != ',')
+                {
+                    return false;
+                }
+
+                ++index;
+            }
+
+            if (!_match_color_component(body, index))
+            {
+                return false;
+            }
+        }
+
+        return index == body.size();
+    }
+
+    constexpr bool ValidationMatchers::match_rgba_color(
+        const std::string_view value
+    )
+    {
+        if (!value.starts_with("rgba(") || !value.ends_with(")"))
+        {
+            return false;
+        }
+
+        const std::string_view body = value.substr(5, value.size() - 6);
+        std::size_t index = 0;
+
+        for (std::size_t component = 0; component < 3; ++component)
+        {
+            if (!_match_color_component(body, index) ||
+                index >= body.size() ||
+                body[index] != ',')
+            {
+                return false;
+            }
+
+            ++index;
+        }
+
+        _skip_spaces(body, index);
+        if (!_match_alpha_component(body, index))
+        {
+            return false;
+        }
+
+        _skip_spaces(body, index);
+
+        return index == body.size();
+    }
+
+    constexpr bool ValidationMatchers::match_base64_image(
+        const std::string_view value
+    )
+    {
+        constexpr std::string_view prefix = "data:image/";
+        constexpr std::string_view suffix = ";base64,";
+
+        if (!value.starts_with(prefix))
+        {
+            return false;
+        }
+
+        const std::string_view rest = value.substr(prefix.size());
+        for (const std::string_view type : { "png", "jpeg", "jpg", "gif" })
+        {
+            if (rest.starts_with(type) &&
+                rest.substr(type.size()).starts_with(suffix))
+            {
+                return match_base64(
+                    rest.substr(type.size() + suffix.size())
+                );
+            }
+        }
+
+        return false;
+    }
+
+    constexpr bool ValidationMatchers::match_data_uri(
+        const std::string_view value
+    )
+    {
+        constexpr std::string_view prefix = "data:";
+        constexpr std::string_view suffix = ";base64,";
+
+        if (!value.starts_with(prefix))
+        {
+            return false;
+        }
+
+        const std::string_view rest = value.substr(prefix.size());
+        const std::size_t slash = rest.find('/');
+        const std::size_t semicolon = rest.find(';');
+        if (slash == std::string_view::npos ||
+            semicolon == std::string_view::npos ||
+            slash == 0 ||
+            semicolon <= slash + 1)
+        {
+            return false;
+        }
+
+        return is_all_of(rest.substr(0, slash), is_mime_token_character) &&
+            is_all_of(
+                rest.substr(slash + 1, semicolon - slash - 1),
+                is_mime_token_character
+            ) &&
+            rest.substr(semicolon).starts_with(suffix) &&
+            match_base64(rest.substr(semicolon + suffix.size()));
+    }
+
+    constexpr bool ValidationMatchers::match_e164_phone_number(
+        const std::string_view value
+    )
+    {
+        return value.size() >= 2 &&
+            value.size() <= 16 &&
+            value[0] == '+' &&
+            is_all_of(value.substr(1), is_digit);
+    }
+
+    constexpr bool ValidationMatchers::match_country_calling_code(
+        const std::string_view value
+    )
+    {
+        return value.size() >= 2 &&
+            value.size() <= 4 &&
+            value[0] == '+' &&
+            is_all_of(value.substr(1), is_digit);
+    }
+
+    constexpr bool ValidationMatchers::match_full_name(
+        const std::string_view value
+    )
+    {
+        return _match_separated(value, is_alpha, " '-");
+    }
+
+    constexpr bool ValidationMatchers::match_email(
+        const std::string_view value
+    )
+    {
+        const std::size_t at = value.find('@');
+        if (at == std::string_view::npos || at == 0)
+        {
+            return false;
+        }
+
+        for (const char character : value.substr(0, at))
+        {
+            if (!is_alphanumeric(character) &&
+                std::string_view("._%+-").find(character) ==
+                    std::string_view::npos)
+            {
+                return false;
+            }
+        }
+
+        const std::string_view domain = value.substr(at + 1);
+        const std::size_t last_dot = domain.rfind('.');
+        if (last_dot == std::string_view::npos || last_dot == 0)
+        {
+            return false;
+        }
+
+        for (const char character : domain.substr(0, last_dot))
+        {
+            if (!is_alphanumeric(character) &&
+                character != '.' &&
+                character != '-')
+            {
+                return false;
+            }
+        }
+
+        const std::string_view top_level_domain = domain.substr(last_dot + 1);
+
+        return top_level_domain.size() >= 2 &&
+            is_all_of(top_level_domain, is_alpha);
+    }
+
+    constexpr bool ValidationMatchers::_match_separated(
+        const std::string_view value,
+        bool (*predicate)(const char),
+        const std::string_view separators
+    )
+    {
+        bool is_previous_separator = true;
+
+        for (const char character : value)
+        {
+            if (separators.find(character) != std::string_view::npos)
+            {
+                if (is_previous_separator)
+                {
+                    return false;
+                }
+
+                is_previous_separator = true;
+            }
+            else if (predicate(character))
+            {
+                is_previous_separator = false;
+            }
+            else
+            {
+                return false;
+            }
+        }
+
+        return !is_previous_separator;
+    }
+
+    constexpr bool ValidationMatchers::_match_hostname_label(
+        const std::string_view value
+    )
+    {
+        if (value.empty() ||
+            value.front() == '-' ||
+            value.back() == '-')
+        {
+            return false;
+        }
+
+        for (const char character : value)
+        {
+            if (!is_alphanumeric(character) && character != '-')
+            {
+                return false;
+            }
+        }
+
+        return true;
+    }
+
+    constexpr bool ValidationMatchers::_match_color_component(
+        const std::string_view value,
+        std::size_t& index
+    )
+    {
+        _skip_spaces(value, index);
+
+        const std::size_t start = index;
+        while (index < value.size() &&
+            index - start < 3 &&
+            is_digit(value[index]))
+        {
+            ++index;
+        }
+
+        if (index == start)
+        {
+            return false;
+        }
+
+        _skip_spaces(value, index);
+
+        return true;
+    }
+
+    constexpr bool ValidationMatchers::_match_alpha_component(
+        const std::string_view value,
+        std::size_t& index
+    )
+    {
+        const std::size_t start = index;
+
+        if (index < value.size() &&
+            (value[index] == '0' || value[index] == '1'))
+        {
+            ++index;
+        }
+
+        if (index < value.size() && value[index] == '.')
+        {
+            if (index != start && value[start] != '0')
+            {
+                return false;
+            }
+
+            const std::size_t fraction_start = ++index;
+            while (index < value.size() && is_digit(value[index]))
+            {
+                ++index;
+            }
+
+            return index != fraction_start;
+        }
+
+        return index != start;
+    }
+
+    constexpr void ValidationMatchers::_skip_spaces(
+        const std::string_view value,
+        std::size_t& index
+    )
+    {
+        while (index < value.size() && is_space(value[index]))
+        {
+            ++index;
+        }
+    }
+}
@@ -0,0 +1,24 @@
+#pragma once
+
+#include <cstdint>
+
+namespace QLogicaeCore
+{
+    enum class ValidationPredicate :
+        uint8_t
+    {
+        HEX = 0,
+
+        BASE64 = 1,
+
+        ALPHANUMERIC = 2,
+
+        LOWERCASE = 3,
+
+        UPPERCASE = 4,
+
+        UTF8 = 5,
+
+        DECIMAL = 6
+    };
+}
@@ -3,13 +3,22 @@
 #include "result.hpp"
 #include "logger.hpp"
 #include "utilities.hpp"
+#include "concurrent_cache.hpp"
+#include "thread_pool.hpp"
 #include "regular_expression.hpp"
+#include "validation_kernels.hpp"
+#include "validation_matchers.hpp"
+#include "validation_predicate.hpp"
 #include "validation_password_rules.hpp"
 
+#include <boost/dynamic_bitset.hpp>
+
 #include <set>
+#include <span>
 #include <vector>
 #include <string>
 #include <algorithm>
+#include <functional>
 #include <unordered_set>
 
 namespace QLogicaeCore
@@ -432,6 +441,16 @@ namespace QLogicaeCore
             const std::string_view& value,
             const std::vector<std::string>& blacklist
         );
+
+        boost::dynamic_bitset<> validate_many(
+            const std::span<const std::string_view> values,
+            const ValidationPredicate& predicate
+        );
+
+        boost::dynamic_bitset<> validate_many(
+            const std::span<const std::string_view> values,
+            const std::function<bool(const std::string_view&)>& predicate
+        );
         
         template<std::ranges::input_range Range,
         typename Predicate>
@@ -954,6 +973,18 @@ namespace QLogicaeCore
             const std::vector<std::string>& blacklist
         );
 
+        void validate_many(
+            Result<boost::dynamic_bitset<>>& result,
+            const std::span<const std::string_view> values,
+            const ValidationPredicate& predicate
+        );
+
+        void validate_many(
+            Result<boost::dynamic_bitset<>>& result,
+            const std::span<const std::string_view> values,
+            const std::function<bool(const std::string_view&)>& predicate
+        );
+
         template<std::ranges::input_range Range,
         typename Predicate>
             void is_valid_range(
@@ -4,6 +4,10 @@
 #include "logger.hpp"
 #include "encoder.hpp"
 #include "cryptographer.hpp"
+#include "cipher_file_stream.hpp"
+#include "cipher_batch_runner.hpp"
+
+#include <span>
 
 namespace QLogicaeCore
 {
@@ -215,6 +219,82 @@ namespace QLogicaeCore
             const std::string& nonce
         );
 
+        std::size_t get_cipher_size(
+            const std::size_t& text_size
+        );
+
+        std::size_t get_text_size(
+            const std::size_t& cipher_size
+        );
+
+        void reverse(
+            Result<std::size_t>& result,
+            std::span<const unsigned char> cipher,
+            std::span<unsigned char> text,
+            const unsigned char* key,
+            const unsigned char* nonce
+        );
+
+        void transform(
+            Result<std::size_t>& result,
+            std::span<const unsigned char> text,
+            std::span<unsigned char> cipher,
+            const unsigned char* key,
+            const unsigned char* nonce
+        );
+
+        CipherBatch reverse_batch(
+            std::span<const std::string_view> ciphers,
+            const unsigned char* key,
+            std::span<const unsigned char> nonces
+        );
+
+        CipherBatch transform_batch(
+            std::span<const std::string_view> texts,
+            const unsigned char* key,
+            std::span<const unsigned char> nonces
+        );
+
+        void reverse_batch(
+            Result<CipherBatch>& result,
+            std::span<const std::string_view> ciphers,
+            const unsigned char* key,
+            std::span<const unsigned char> nonces
+        );
+
+        void transform_batch(
+            Result<CipherBatch>& result,
+            std::span<const std::string_view> texts,
+            const unsigned char* key,
+            std::span<const unsigned char> nonces
+        );
+
+        bool reverse_file(
+            const std::string& input_path,
+            const std::string& output_path,
+            const unsigned char* key
+        );
+
+        bool transform_file(
+            const std::string& input_path,
+            const std::string& output_path,
+            const unsigned char* key
+        );
+
+        void reverse_file(
+            Result<std::uint64_t>& result,
+            const std::string& input_path,
+            const std::string& output_path,
+            const unsigned char* key
+        );
+
+        void transform_file(
+            Result<std::uint64_t>& result,
+            const std::string& input_path,
+            const std::string& output_path,
+            const unsigned char* key
+        );
+
         static XChaCha20Poly1305CipherCryptographer& get_instance();
 
         static void get_instance(
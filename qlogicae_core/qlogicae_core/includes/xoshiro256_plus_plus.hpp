@@ -0,0 +1,47 @@
+#pragma once
+
+#include <bit>
+#include <span>
+#include <array>
+#include <cstring>
+#include <limits>
+#include <cstdint>
+#include <cstddef>
+
+namespace QLogicaeCore
+{
+    class Xoshiro256PlusPlus
+    {
+    public:
+        using result_type = std::uint64_t;
+
+        Xoshiro256PlusPlus();
+
+        explicit Xoshiro256PlusPlus(
+            const std::uint64_t seed
+        );
+
+        void seed(
+            const std::uint64_t seed
+        );
+
+        result_type operator()();
+
+        void fill(
+            std::span<unsigned char> buffer
+        );
+
+        static constexpr result_type min()
+        {
+            return std::numeric_limits<result_type>::min();
+        }
+
+        static constexpr result_type max()
+        {
+            return std::numeric_limits<result_type>::max();
+        }
+
+    private:
+        std::array<std::uint64_t, 4> _state;
+    };
+}
@@ -0,0 +1,79 @@
+#include "pch.hpp"
+
+#include "../includes/aes256_cipher_context.hpp"
+
+namespace QLogicaeCore
+{
+    AES256CipherContext::AES256CipherContext() :
+        _is_ready(false)
+    {
+
+    }
+
+    AES256CipherContext::~AES256CipherContext()
+    {
+        sodium_memzero(&_state, sizeof(_state));
+    }
+
+    AES256CipherContext::AES256CipherContext(
+        const unsigned char* key
+    ) :
+        _is_ready(false)
+    {
+        setup(key);
+    }
+
+    bool AES256CipherContext::setup(
+        const unsigned char* key
+    )
+    {
+        Result<void> result;
+
+        setup(result, key);
+
+        return result.is_status_safe();
+    }
+
+    void AES256CipherContext::setup(
+        Result<void>& result,
+        const unsigned char* key
+    )
+    {
+        _is_ready = false;
+
+        if (!key)
+        {
+            return result.set_to_bad_status_without_value(
+                "Empty key"
+            );
+        }
+
+        if (!crypto_aead_aes256gcm_is_available())
+        {
+            return result.set_to_bad_status_without_value(
+                "AES256-GCM is not supported by this processor"
+            );
+        }
+
+        if (crypto_aead_aes256gcm_beforenm(&_state, key) != 0)
+        {
+            return result.set_to_bad_status_without_value(
+                "Key expansion failed"
+            );
+        }
+
+        _is_ready = true;
+
+        result.set_to_good_status_without_value();
+    }
+
+    bool AES256CipherContext::is_ready() const
+    {
+        return _is_ready;
+    }
+
+    const crypto_aead_aes256gcm_state& AES256CipherContext::get_state() const
+    {
+        return _state;
+    }
+}
@@ -4,6 +4,39 @@
 
 namespace QLogicaeCore
 {
+	static std::span<unsigned char> get_aes256_cipher_buffer(
+		const std::size_t size
+	)
+	{
+		static thread_local std::vector<unsigned char> buffer;
+		if (buffer.size() < size)
+		{
+			buffer.resize(size);
+		}
+
+		return std::span<unsigned char>(buffer.data(), size);
+	}
+
+	static void get_aes256_chunk_parameters(
+		const std::array<unsigned char, crypto_aead_aes256gcm_NPUBBYTES>& nonce,
+		const CipherStreamChunk& chunk,
+		std::array<unsigned char, crypto_aead_aes256gcm_NPUBBYTES>& chunk_nonce,
+		std::array<unsigned char, 9>& additional_data
+	)
+	{
+		chunk_nonce = nonce;
+		for (std::size_t index = 0; index < 8; ++index)
+		{
+			const unsigned char value =
+				static_cast<unsigned char>(chunk.index >> (index * 8));
+
+			chunk_nonce[chunk_nonce.size() - 1 - index] ^= value;
+			additional_data[index] = value;
+		}
+
+		additional_data[8] = chunk.is_final ? 1 : 0;
+	}
+
 	AES256CipherCryptographer::AES256CipherCryptographer() :
 		Cryptographer()
 	{
@@ -207,33 +240,11 @@ namespace QLogicaeCore
 	{
 		try
 		{
-			std::scoped_lock lock(_mutex);
-
-			if (!vb || !vc)
-			{
-				return "";
-			}
-
-			unsigned long long ve = va.size(), vg;
-			const unsigned char* vd = reinterpret_cast<const unsigned char*>(
-				va.data()
-			);
-
-
-			std::vector<unsigned char> vf(
-				ve + crypto_aead_aes256gcm_ABYTES
-			);
-			unsigned char* vh = vf.data();
+			Result<std::string> result;
 
-			crypto_aead_aes256gcm_encrypt(
-				vh, &vg, vd, ve,
-				nullptr, 0, nullptr,
-				vc, vb
-			);
+			transform(result, va, vb, vc);
 
-			return ENCODER.from_bytes_to_base64(
-				vh, vg
-			);
+			return result.get_value();
 		}
 		catch (const std::exception& exception)
 		{
@@ -257,29 +268,11 @@ namespace QLogicaeCore
 	{
 		try
 		{
-			std::scoped_lock lock(_mutex);
-
-			if (!vb || !vc)
-			{
-				return "";
-			}
+			Result<std::string> result;
 
-			std::vector<unsigned char> vf =
-				ENCODER.from_base64_to_bytes(va);
-			unsigned long long vh, vi = vf.size();
-			std::vector<unsigned char> vg(vi);
-			unsigned char* vj = vg.data();
+			reverse(result, va, vb, vc);
 
-			if (crypto_aead_aes256gcm_decrypt(
-				vj, &vh, nullptr,
-				vf.data(), vi,
-				nullptr, 0, vc, vb) != 0)
-			{
-				return "";
-			}
-			return std::string(
-				reinterpret_cast<const char*>(vj), vh
-			);
+			return result.get_value();
 		}
 		catch (const std::exception& exception)
 		{
@@ -388,34 +381,24 @@ namespace QLogicaeCore
 		const unsigned char* nonce
 	)
 	{
-		std::scoped_lock lock(_mutex);
-
 		if (!key || !nonce)
-		{			
+		{
 			return result.set_to_bad_status_without_value(
 				"Empty key or nonce"
 			);
 		}
 
-		std::vector<unsigned char> bytes =
-			ENCODER.from_base64_to_bytes(cipher);
-		unsigned long long out_len, in_len = bytes.size();
-		std::vector<unsigned char> decrypted(in_len);
-		unsigned char* out_ptr = decrypted.data();
-
-		if (crypto_aead_aes256gcm_decrypt(
-			out_ptr, &out_len, nullptr,
-			bytes.data(), in_len,
-			nullptr, 0, nonce, key) != 0)
+		AES256CipherContext context;
+		Result<void> context_result;
+		context.setup(context_result, key);
+		if (!context_result.is_status_safe())
 		{
 			return result.set_to_bad_status_without_value(
-				"Decryption failed"
+				context_result.get_message()
 			);
 		}
 
-		result.set_to_good_status_with_value(
-			std::string(reinterpret_cast<const char*>(out_ptr), out_len)
-		);
+		reverse(result, cipher, context, nonce);
 	}
 
 	void AES256CipherCryptographer::transform(
@@ -425,8 +408,6 @@ namespace QLogicaeCore
 		const unsigned char* nonce
 	)
 	{
-		std::scoped_lock lock(_mutex);
-
 		if (!key || !nonce)
 		{
 			return result.set_to_bad_status_without_value(
@@ -434,25 +415,19 @@ namespace QLogicaeCore
 			);
 		}
 
-		unsigned long long text_len = text.size(), cipher_len;
-		const unsigned char* text_ptr =
-			reinterpret_cast<const unsigned char*>(text.data());
-		std::vector<unsigned char> cipher_buf(
-			text_len + crypto_aead_aes256gcm_ABYTES
-		);
-		unsigned char* cipher_ptr = cipher_buf.data();
-
-		crypto_aead_aes256gcm_encrypt(
-			cipher_ptr, &cipher_len,
-			text_ptr, text_len,
-			nullptr, 0, nullptr,
-			nonce, key
-		);
+		AES256CipherContext context;
+		Result<void> context_result;
+		context.setup(context_result, key);
+		if (!context_result.is_status_safe())
+		{
+			return result.set_to_bad_status_without_value(
+				context_result.get_message()
+			);
+		}
 
-		ENCODER.from_bytes_to_base64(result, cipher_ptr, cipher_len);
+		transform(result, text, context, nonce);
 	}
 
-
 	void AES256CipherCryptographer::reverse_async(
 		Result<std::future<std::string>>& result,
 		const std::string& cipher,
@@ -789,6 +764,646 @@ namespace QLogicaeCore
 		);
 	}
 
+	std::size_t AES256CipherCryptographer::get_cipher_size(
+		const std::size_t& text_size
+	)
+	{
+		return text_size + crypto_aead_aes256gcm_ABYTES;
+	}
+
+	std::size_t AES256CipherCryptographer::get_text_size(
+		const std::size_t& cipher_size
+	)
+	{
+		return (cipher_size < crypto_aead_aes256gcm_ABYTES) ?
+			0 : cipher_size - crypto_aead_aes256gcm_ABYTES;
+	}
+
+	void AES256CipherCryptographer::reverse(
+		Result<std::size_t>& result,
+		std::span<const unsigned char> cipher,
+		std::span<unsigned char> text,
+		const unsigned char* key,
+		const unsigned char* nonce
+	)
+	{
+		AES256CipherContext context;
+		Result<void> context_result;
+		context.setup(context_result, key);
+		if (!context_result.is_status_safe())
+		{
+			return result.set_to_bad_status_without_value(
+				context_result.get_message()
+			);
+		}
+
+		reverse(result, cipher, text, context, nonce);
+	}
+
+	void AES256CipherCryptographer::transform(
+		Result<std::size_t>& result,
+		std::span<const unsigned char> text,
+		std::span<unsigned char> cipher,
+		const unsigned char* key,
+		const unsigned char* nonce
+	)
+	{
+		AES256CipherContext context;
+		Result<void> context_result;
+		context.setup(context_result, key);
+		if (!context_result.is_status_safe())
+		{
+			return result.set_to_bad_status_without_value(
+				context_result.get_message()
+			);
+		}
+
+		transform(result, text, cipher, context, nonce);
+	}
+
+	void AES256CipherCryptographer::reverse(
+		Result<std::size_t>& result,
+		std::span<const unsigned char> cipher,
+		std::span<unsigned char> text,
+		const AES256CipherContext& context,
+		const unsigned char* nonce
+	)
+	{
+		if (!context.is_ready() || !nonce)
+		{
+			return result.set_to_bad_status_without_value(
+				"Empty key or nonce"
+			);
+		}
+
+		if (cipher.size() < crypto_aead_aes256gcm_ABYTES ||
+			text.size() < get_text_size(cipher.size()))
+		{
+			return result.set_to_bad_status_without_value(
+				"Cipher is too short or the output is too small"
+			);
+		}
+
+		unsigned long long text_size = 0;
+		if (crypto_aead_aes256gcm_decrypt_afternm(
+			text.data(), &text_size, nullptr,
+			cipher.data(), cipher.size(),
+			nullptr, 0, nonce, &context.get_state()) != 0)
+		{
+			return result.set_to_bad_status_without_value(
+				"Decryption failed"
+			);
+		}
+
+		result.set_to_good_status_with_value(
+			static_cast<std::size_t>(text_size)
+		);
+	}
+
+	void AES256CipherCryptographer::transform(
+		Result<std::size_t>& result,
+		std::span<const unsigned char> text,
+		std::span<unsigned char> cipher,
+		const AES256CipherContext& context,
+		const unsigned char* nonce
+	)
+	{
+		if (!context.is_ready() || !nonce)
+		{
+			return result.set_to_bad_status_without_value(
+				"Empty key or nonce"
+			);
+		}
+
+		if (cipher.size() < get_cipher_size(text.size()))
+		{
+			return result.set_to_bad_status_without_value(
+				"Output is too small"
+			);
+		}
+
+		unsigned long long cipher_size = 0;
+		if (crypto_aead_aes256gcm_encrypt_afternm(
+			cipher.data(), &cipher_size,
+			text.data(), text.size(),
+			nullptr, 0, nullptr, nonce, &context.get_state()) != 0)
+		{
+			return result.set_to_bad_status_without_value(
+				"Encryption failed"
+			);
+		}
+
+		result.set_to_good_status_with_value(
+			static_cast<std::size_t>(cipher_size)
+		);
+	}
+
+	void AES256CipherCryptographer::reverse(
+		Result<std::string>& result,
+		const std::string& cipher,
+		const AES256CipherContext& context,
+		const unsigned char* nonce
+	)
+	{
+		std::span<unsigned char> bytes = get_aes256_cipher_buffer(
+			ENCODER.get_decoded_length(EncodingType::BASE64, cipher));
+		Result<std::size_t> decode_result;
+		ENCODER.decode_into(decode_result, EncodingType::BASE64, cipher, bytes);
+		if (!decode_result.is_status_safe())
+		{
+			return result.set_to_bad_status_without_value(
+				"Decryption failed"
+			);
+		}
+
+		bytes = bytes.first(decode_result.get_value());
+		std::string text(get_text_size(bytes.size()), '\0');
+		Result<std::size_t> size_result;
+		reverse(
+			size_result,
+			bytes,
+			std::span<unsigned char>(
+				reinterpret_cast<unsigned char*>(text.data()),
+				text.size()
+			),
+			context,
+			nonce
+		);
+		if (!size_result.is_status_safe())
+		{
+			return result.set_to_bad_status_without_value(
+				size_result.get_message()
+			);
+		}
+
+		result.set_to_good_status_with_value(std::move(text));
+	}
+
+	void AES256CipherCryptographer::transform(
+		Result<std::string>& result,
+		const std::string& text,
+		const AES256CipherContext& context,
+		const unsigned char* nonce
+	)
+	{
+		std::span<unsigned char> bytes =
+			get_aes256_cipher_buffer(get_cipher_size(text.size()));
+		Result<std::size_t> size_result;
+		transform(
+			size_result,
+			std::span<const unsigned char>(
+				reinterpret_cast<const unsigned char*>(text.data()),
+				text.size()
+			),
+			bytes,
+			context,
+			nonce
+		);
+		if (!size_result.is_status_safe())
+		{
+			return result.set_to_bad_status_without_value(
+				size_result.get_message()
+			);
+		}
+
+		std::string cipher(
+			ENCODER.get_encoded_length(EncodingType::BASE64, bytes.size()),
+			'\0'
+		);
+		Result<std::size_t> encode_result;
+		ENCODER.encode_into(encode_result, EncodingType::BASE64, bytes, cipher);
+
+		result.set_to_good_status_with_value(std::move(cipher));
+	}
+
+	CipherBatch AES256CipherCryptographer::reverse_batch(
+		std::span<const std::string_view> ciphers,
+		const unsigned char* key,
+		std::span<const unsigned char> nonces
+	)
+	{
+		try
+		{
+			Result<CipherBatch> result;
+
+			reverse_batch(result, ciphers, key, nonces);
+
+			return std::move(result.get_value());
+		}
+		catch (const std::exception& exception)
+		{
+			LOGGER.handle_exception_async(
+				"QLogicaeCore::AES256CipherCryptographer::reverse_batch()",
+				exception.what()
+			);
+
+			return {};
+		}
+	}
+
+	CipherBatch AES256CipherCryptographer::transform_batch(
+		std::span<const std::string_view> texts,
+		const unsigned char* key,
+		std::span<const unsigned char> nonces
+	)
+	{
+		try
+		{
+			Result<CipherBatch> result;
+
+			transform_batch(result, texts, key, nonces);
+
+			return std::move(result.get_value());
+		}
+		catch (const std::exception& exception)
+		{
+			LOGGER.handle_exception_async(
+				"QLogicaeCore::AES256CipherCryptographer::transform_batch()",
+				exception.what()
+			);
+
+			return {};
+		}
+	}
+
+	void AES256CipherCryptographer::reverse_batch(
+		Result<CipherBatch>& result,
+		std::span<const std::string_view> ciphers,
+		const unsigned char* key,
+		std::span<const unsigned char> nonces
+	)
+	{
+		AES256CipherContext context;
+		Result<void> context_result;
+		context.setup(context_result, key);
+		if (!context_result.is_status_safe())
+		{
+			return result.set_to_bad_status_without_value(
+				context_result.get_message()
+			);
+		}
+
+		reverse_batch(result, ciphers, context, nonces);
+	}
+
+	void AES256CipherCryptographer::transform_batch(
+		Result<CipherBatch>& result,
+		std::span<const std::string_view> texts,
+		const unsigned char* key,
+		std::span<const unsigned char> nonces
+	)
+	{
+		AES256CipherContext context;
+		Result<void> context_result;
+		context.setup(context_result, key);
+		if (!context_result.is_status_safe())
+		{
+			return result.set_to_bad_status_without_value(
+				context_result.get_message()
+			);
+		}
+
+		transform_batch(result, texts, context, nonces);
+	}
+
+	void AES256CipherCryptographer::reverse_batch(
+		Result<CipherBatch>& result,
+		std::span<const std::string_view> ciphers,
+		const AES256CipherContext& context,
+		std::span<const unsigned char> nonces
+	)
+	{
+		if (!context.is_ready() ||
+			nonces.size() !=
+				ciphers.size() * crypto_aead_aes256gcm_NPUBBYTES)
+		{
+			return result.set_to_bad_status_without_value(
+				"Key is empty or the nonce count does not match the batch"
+			);
+		}
+
+		CipherBatchRunner::run(
+			result,
+			ciphers.size(),
+			[this, ciphers](const std::size_t& index)
+			{
+				return get_text_size(
+					ENCODER.get_decoded_length(
+						EncodingType::BASE64, ciphers[index]
+					)
+				);
+			},
+			[this, ciphers, &context, nonces](
+				const std::size_t& index,
+				std::span<char> output
+			) -> std::optional<std::size_t>
+			{
+				std::span<unsigned char> bytes = get_aes256_cipher_buffer(
+					ENCODER.get_decoded_length(
+						EncodingType::BASE64, ciphers[index]
+					)
+				);
+				Result<std::size_t> decode_result;
+				ENCODER.decode_into(
+					decode_result, EncodingType::BASE64, ciphers[index], bytes
+				);
+				if (!decode_result.is_status_safe())
+				{
+					return std::nullopt;
+				}
+
+				Result<std::size_t> size_result;
+				reverse(
+					size_result,
+					bytes.first(decode_result.get_value()),
+					std::span<unsigned char>(
+						reinterpret_cast<unsigned char*>(output.data()),
+						output.size()
+					),
+					context,
+					nonces.data() + index * crypto_aead_aes256gcm_NPUBBYTES
+				);
+				if (!size_result.is_status_safe())
+				{
+					return std::nullopt;
+				}
+
+				return size_result.get_value();
+			}
+		);
+	}
+
+	void AES256CipherCryptographer::transform_batch(
+		Result<CipherBatch>& result,
+		std::span<const std::string_view> texts,
+		const AES256CipherContext& context,
+		std::span<const unsigned char> nonces
+	)
+	{
+		if (!context.is_ready() ||
+			nonces.size() !=
+				texts.size() * crypto_aead_aes256gcm_NPUBBYTES)
+		{
+			return result.set_to_bad_status_without_value(
+				"Key is empty or the nonce count does not match the batch"
+			);
+		}
+
+		CipherBatchRunner::run(
+			result,
+			texts.size(),
+			[this, texts](const std::size_t& index)
+			{
+				return ENCODER.get_encoded_length(
+					EncodingType::BASE64, get_cipher_size(texts[index].size())
+				);
+			},
+			[this, texts, &context, nonces](
+				const std::size_t& index,
+				std::span<char> output
+			) -> std::optional<std::size_t>
+			{
+				std::span<unsigned char> bytes = get_aes256_cipher_buffer(
+					get_cipher_size(texts[index].size())
+				);
+				Result<std::size_t> size_result;
+				transform(
+					size_result,
+					std::span<const unsigned char>(
+						reinterpret_cast<const unsigned char*>(
+							texts[index].data()
+						),
+						texts[index].size()
+					),
+					bytes,
+					context,
+					nonces.data() + index * crypto_aead_aes256gcm_NPUBBYTES
+				);
+				if (!size_result.is_status_safe())
+				{
+					return std::nullopt;
+				}
+
+				Result<std::size_t> encode_result;
+				ENCODER.encode_into(
+					encode_result, EncodingType::BASE64, bytes, output
+				);
+				if (!encode_result.is_status_safe())
+				{
+					return std::nullopt;
+				}
+
+				return encode_result.get_value();
+			}
+		);
+	}
+
+	bool AES256CipherCryptographer::reverse_file(
+		const std::string& input_path,
+		const std::string& output_path,
+		const unsigned char* key
+	)
+	{
+		try
+		{
+			Result<std::uint64_t> result;
+
+			reverse_file(result, input_path, output_path, key);
+
+			return result.is_status_safe();
+		}
+		catch (const std::exception& exception)
+		{
+			LOGGER.handle_exception_async(
+				"QLogicaeCore::AES256CipherCryptographer::reverse_file()",
+				exception.what()
+			);
+
+			return false;
+		}
+	}
+
+	bool AES256CipherCryptographer::transform_file(
+		const std::string& input_path,
+		const std::string& output_path,
+		const unsigned char* key
+	)
+	{
+		try
+		{
+			Result<std::uint64_t> result;
+
+			transform_file(result, input_path, output_path, key);
+
+			return result.is_status_safe();
+		}
+		catch (const std::exception& exception)
+		{
+			LOGGER.handle_exception_async(
+				"QLogicaeCore::AES256CipherCryptographer::transform_file()",
+				exception.what()
+			);
+
+			return false;
+		}
+	}
+
+	void AES256CipherCryptographer::reverse_file(
+		Result<std::uint64_t>& result,
+		const std::string& input_path,
+		const std::string& output_path,
+		const unsigned char* key
+	)
+	{
+		AES256CipherContext context;
+		Result<void> context_result;
+		context.setup(context_result, key);
+		if (!context_result.is_status_safe())
+		{
+			return result.set_to_bad_status_without_value(
+				context_result.get_message()
+			);
+		}
+
+		reverse_file(result, input_path, output_path, context);
+	}
+
+	void AES256CipherCryptographer::transform_file(
+		Result<std::uint64_t>& result,
+		const std::string& input_path,
+		const std::string& output_path,
+		const unsigned char* key
+	)
+	{
+		AES256CipherContext context;
+		Result<void> context_result;
+		context.setup(context_result, key);
+		if (!context_result.is_status_safe())
+		{
+			return result.set_to_bad_status_without_value(
+				context_result.get_message()
+			);
+		}
+
+		transform_file(result, input_path, output_path, context);
+	}
+
+	void AES256CipherCryptographer::reverse_file(
+		Result<std::uint64_t>& result,
+		const std::string& input_path,
+		const std::string& output_path,
+		const AES256CipherContext& context
+	)
+	{
+		if (!context.is_ready())
+		{
+			return result.set_to_bad_status_without_value(
+				"Empty key"
+			);
+		}
+
+		std::array<unsigned char, crypto_aead_aes256gcm_NPUBBYTES> nonce;
+		Result<void> header_result;
+		CipherFileStream::read_header(header_result, input_path, nonce);
+		if (!header_result.is_status_safe())
+		{
+			return result.set_to_bad_status_without_value(
+				header_result.get_message()
+			);
+		}
+
+		CipherFileStream::run(
+			result,
+			input_path,
+			output_path,
+			nonce.size(),
+			get_cipher_size(UTILITIES.CIPHER_STREAM_CHUNK_SIZE),
+			{},
+			[this, &context, &nonce](CipherStreamChunk& chunk)
+			{
+				std::array<unsigned char, crypto_aead_aes256gcm_NPUBBYTES>
+					chunk_nonce;
+				std::array<unsigned char, 9> additional_data;
+				get_aes256_chunk_parameters(
+					nonce, chunk, chunk_nonce, additional_data);
+
+				if (chunk.data.size() < crypto_aead_aes256gcm_ABYTES)
+				{
+					return false;
+				}
+
+				unsigned long long text_size = 0;
+				std::vector<unsigned char> text(
+					get_text_size(chunk.data.size()));
+				if (crypto_aead_aes256gcm_decrypt_afternm(
+					text.data(), &text_size, nullptr,
+					chunk.data.data(), chunk.data.size(),
+					additional_data.data(), additional_data.size(),
+					chunk_nonce.data(), &context.get_state()) != 0)
+				{
+					return false;
+				}
+
+				text.resize(static_cast<std::size_t>(text_size));
+				chunk.data = std::move(text);
+
+				return true;
+			}
+		);
+	}
+
+	void AES256CipherCryptographer::transform_file(
+		Result<std::uint64_t>& result,
+		const std::string& input_path,
+		const std::string& output_path,
+		const AES256CipherContext& context
+	)
+	{
+		if (!context.is_ready())
+		{
+			return result.set_to_bad_status_without_value(
+				"Empty key"
+			);
+		}
+
+		std::array<unsigned char, crypto_aead_aes256gcm_NPUBBYTES> nonce;
+		randombytes_buf(nonce.data(), nonce.size());
+
+		CipherFileStream::run(
+			result,
+			input_path,
+			output_path,
+			0,
+			UTILITIES.CIPHER_STREAM_CHUNK_SIZE,
+			nonce,
+			[this, &context, &nonce](CipherStreamChunk& chunk)
+			{
+				std::array<unsigned char, crypto_aead_aes256gcm_NPUBBYTES>
+					chunk_nonce;
+				std::array<unsigned char, 9> additional_data;
+				get_aes256_chunk_parameters(
+					nonce, chunk, chunk_nonce, additional_data);
+
+				unsigned long long cipher_size = 0;
+				std::vector<unsigned char> cipher(
+					get_cipher_size(chunk.data.size()));
+				if (crypto_aead_aes256gcm_encrypt_afternm(
+					cipher.data(), &cipher_size,
+					chunk.data.data(), chunk.data.size(),
+					additional_data.data(), additional_data.size(),
+					nullptr, chunk_nonce.data(), &context.get_state()) != 0)
+				{
+					return false;
+				}
+
+				cipher.resize(static_cast<std::size_t>(cipher_size));
+				chunk.data = std::move(cipher);
+
+				return true;
+			}
+		);
+	}
+
 	AES256CipherCryptographer& AES256CipherCryptographer::get_instance()
 	{
 		static AES256CipherCryptographer instance;
@@ -69,6 +69,11 @@ namespace QLogicaeCore
                 );
             }
             
+            _tiered_cache = std::make_unique<TieredCache>(
+                ROCKSDB_DATABASE,
+                _configurations.tiered_cache_configurations
+            );
+
             set_is_enabled(true);
 
             result.set_to_good_status_without_value();
@@ -145,6 +150,167 @@ namespace QLogicaeCore
         );
     }
 
+    bool ApplicationCache::is_cache_key_path_found(
+        const std::string& cache_name,
+        const std::string& key_path
+    )
+    {
+        try
+        {
+            Result<void> void_result;
+
+            is_cache_key_path_found(void_result, cache_name, key_path);
+
+            return void_result.is_status_safe();
+        }
+        catch (const std::exception& exception)
+        {
+            LOGGER.handle_exception_async(
+                "QLogicaeCore::ApplicationCache::is_cache_key_path_found()",
+                exception.what()
+            );
+
+            return false;
+        }
+    }
+
+    void ApplicationCache::is_cache_key_path_found(
+        Result<void>& result,
+        const std::string& cache_name,
+        const std::string& key_path
+    )
+    {
+        if (_tiered_cache == nullptr ||
+            !_tiered_cache->is_key_found(_get_key(cache_name, key_path)))
+        {
+            return result.set_to_bad_status_without_value();
+        }
+
+        result.set_to_good_status_without_value();
+    }
+
+    std::string ApplicationCache::read_one(
+        const std::string& cache_name,
+        const std::string& key_path
+    )
+    {
+        try
+        {
+            Result<std::string> string_result;
+
+            read_one(string_result, cache_name, key_path);
+
+            return string_result.get_value();
+        }
+        catch (const std::exception& exception)
+        {
+            LOGGER.handle_exception_async(
+                "QLogicaeCore::ApplicationCache::read_one()",
+                exception.what()
+            );
+
+            return "";
+        }
+    }
+
+    void ApplicationCache::read_one(
+        Result<std::string>& result,
+        const std::string& cache_name,
+        const std::string& key_path
+    )
+    {
+        if (_tiered_cache == nullptr)
+        {
+            return result.set_to_bad_status_without_value(
+                "QLogicaeCore::ApplicationCache::read_one() - ApplicationCache is not enabled"
+            );
+        }
+
+        _tiered_cache->read(result, _get_key(cache_name, key_path));
+    }
+
+    bool ApplicationCache::update_one(
+        const std::string& cache_name,
+        const std::string& key_path,
+        const std::string& value
+    )
+    {
+        try
+        {
+            Result<void> void_result;
+
+            update_one(void_result, cache_name, key_path, value);
+
+            return void_result.is_status_safe();
+        }
+        catch (const std::exception& exception)
+        {
+            LOGGER.handle_exception_async(
+                "QLogicaeCore::ApplicationCache::update_one()",
+                exception.what()
+            );
+
+            return false;
+        }
+    }
+
+    void ApplicationCache::update_one(
+        Result<void>& result,
+        const std::string& cache_name,
+        const std::string& key_path,
+        const std::string& value
+    )
+    {
+        if (_tiered_cache == nullptr)
+        {
+            return result.set_to_bad_status_without_value(
+                "QLogicaeCore::ApplicationCache::update_one() - ApplicationCache is not enabled"
+            );
+        }
+
+        _tiered_cache->write(result, _get_key(cache_name, key_path), value);
+    }
+
+    bool ApplicationCache::delete_one(
+        const std::string& cache_name,
+        const std::string& key_path
+    )
+    {
+        try
+        {
+            Result<void> void_result;
+
+            delete_one(void_result, cache_name, key_path);
+
+            return void_result.is_status_safe();
+        }
+        catch (const std::exception& exception)
+        {
+            LOGGER.handle_exception_async(
+                "QLogicaeCore::ApplicationCache::delete_one()",
+                exception.what()
+            );
+
+            return false;
+        }
+    }
+
+    void ApplicationCache::delete_one(
+        Result<void>& result,
+        const std::string& cache_name,
+        const std::string& key_path
+    )
+    {
+        if (_tiered_cache == nullptr)
+        {
+            return result.set_to_bad_status_without_value(
+                "QLogicaeCore::ApplicationCache::delete_one() - ApplicationCache is not enabled"
+            );
+        }
+
+        _tiered_cache->remove(result, _get_key(cache_name, key_path));
+    }
+
     bool ApplicationCache::terminate()
     {
         try
@@ -170,6 +336,8 @@ namespace QLogicaeCore
         Result<void>& result
     )
     {
+        _tiered_cache.reset();
+
         ROCKSDB_DATABASE.terminate();
 
         set_is_enabled(false);
@@ -235,6 +403,14 @@ namespace QLogicaeCore
         );
     }
 
+    std::string ApplicationCache::_get_key(
+        const std::string& cache_name,
+        const std::string& key_path
+    )
+    {
+        return cache_name + ":" + key_path;
+    }
+
     ApplicationCache& ApplicationCache::get_instance()
     {
         static ApplicationCache instance;
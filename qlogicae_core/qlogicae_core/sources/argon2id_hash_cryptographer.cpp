@@ -62,6 +62,8 @@ namespace QLogicaeCore
 		const CryptographerProperties& properties
 	)
 	{
+		std::unique_lock lock(_mutex);
+
 		_cryptographer_properties = properties;
 
 		result.set_to_good_status_without_value();
@@ -238,18 +240,19 @@ namespace QLogicaeCore
 	{
 		try
 		{
-			std::scoped_lock lock(_mutex);
+			const CryptographerProperties properties =
+				_get_cryptographer_properties();
 
 			std::array<char, 512> vb{};
 			int vc = argon2id_hash_encoded(
-				_cryptographer_properties.uint32_t_1,
-				_cryptographer_properties.uint32_t_2,
-				_cryptographer_properties.uint32_t_3,
+				properties.uint32_t_1,
+				properties.uint32_t_2,
+				properties.uint32_t_3,
 				va.data(),
 				va.size(),
 				GENERATOR.random_salt().data(),
-				_cryptographer_properties.size_t_2,
-				_cryptographer_properties.size_t_1,
+				properties.size_t_2,
+				properties.size_t_1,
 				vb.data(), vb.size());
 			if (vc != ARGON2_OK)
 			{
@@ -276,8 +279,7 @@ namespace QLogicaeCore
 		std::promise<std::string> promise;
 		auto future = promise.get_future();
 
-		boost::asio::post(
-			UTILITIES.BOOST_ASIO_POOL,
+		if (!PASSWORD_HASH_EXECUTOR.post(
 			[this, va,
 			promise = std::move(promise)]() mutable
 			{
@@ -286,8 +288,15 @@ namespace QLogicaeCore
 						va
 					)
 				);
-			}
-		);
+			},
+			_get_hash_memory_in_bytes()
+		))
+		{
+			std::promise<std::string> rejected_promise;
+			rejected_promise.set_value("");
+
+			return rejected_promise.get_future();
+		}
 
 		return future;
 	}
@@ -299,8 +308,6 @@ namespace QLogicaeCore
 	{
 		try
 		{
-			std::scoped_lock lock(_mutex);
-
 			return argon2id_verify(
 				va.data(), vb.data(), vb.size()
 			) == ARGON2_OK;
@@ -324,8 +331,7 @@ namespace QLogicaeCore
 		std::promise<bool> promise;
 		auto future = promise.get_future();
 
-		boost::asio::post(
-			UTILITIES.BOOST_ASIO_POOL,
+		if (!PASSWORD_HASH_EXECUTOR.post(
 			[this, va, vb,
 			promise = std::move(promise)]() mutable
 			{
@@ -335,8 +341,15 @@ namespace QLogicaeCore
 						vb
 					)
 				);
-			}
-		);
+			},
+			_get_hash_memory_in_bytes()
+		))
+		{
+			std::promise<bool> rejected_promise;
+			rejected_promise.set_value(false);
+
+			return rejected_promise.get_future();
+		}
 
 		return future;
 	}
@@ -346,18 +359,19 @@ namespace QLogicaeCore
 		const std::string& text
 	)
 	{
-		std::scoped_lock lock(_mutex);
+		const CryptographerProperties properties =
+			_get_cryptographer_properties();
 
 		std::array<char, 512> buffer{};
 		int status = argon2id_hash_encoded(
-			_cryptographer_properties.uint32_t_1,
-			_cryptographer_properties.uint32_t_2,
-			_cryptographer_properties.uint32_t_3,
+			properties.uint32_t_1,
+			properties.uint32_t_2,
+			properties.uint32_t_3,
 			text.data(),
 			text.size(),
 			GENERATOR.random_salt().data(),
-			_cryptographer_properties.size_t_2,
-			_cryptographer_properties.size_t_1,
+			properties.size_t_2,
+			properties.size_t_1,
 			buffer.data(),
 			buffer.size()
 		);
@@ -380,8 +394,6 @@ namespace QLogicaeCore
 		const std::string& key
 	)
 	{
-		std::scoped_lock lock(_mutex);
-
 		bool verified = argon2id_verify(
 			hash.data(),
 			key.data(),
@@ -399,8 +411,7 @@ namespace QLogicaeCore
 		std::promise<std::string> promise;
 		auto future = promise.get_future();
 
-		boost::asio::post(
-			UTILITIES.BOOST_ASIO_POOL,
+		if (!PASSWORD_HASH_EXECUTOR.post(
 			[this, text,
 			promise = std::move(promise)]() mutable
 			{
@@ -414,8 +425,14 @@ namespace QLogicaeCore
 				promise.set_value(
 					result.get_value()
 				);
-			}
-		);
+			},
+			_get_hash_memory_in_bytes()
+		))
+		{
+			return result.set_to_bad_status_without_value(
+				"Hashing queue is full"
+			);
+		}
 
 		result.set_to_good_status_with_value(
 			std::move(future)
@@ -431,8 +448,7 @@ namespace QLogicaeCore
 		std::promise<bool> promise;
 		auto future = promise.get_future();
 
-		boost::asio::post(
-			UTILITIES.BOOST_ASIO_POOL,
+		if (!PASSWORD_HASH_EXECUTOR.post(
 			[this, hash, key,
 			promise = std::move(promise)]() mutable
 			{
@@ -447,8 +463,14 @@ namespace QLogicaeCore
 				promise.set_value(
 					result.get_value()
 				);
-			}
-		);
+			},
+			_get_hash_memory_in_bytes()
+		))
+		{
+			return result.set_to_bad_status_without_value(
+				"Hashing queue is full"
+			);
+		}
 
 		result.set_to_good_status_with_value(
 			std::move(future)
@@ -461,8 +483,7 @@ namespace QLogicaeCore
 		const std::string& key
 	)
 	{
-		boost::asio::post(
-			UTILITIES.BOOST_ASIO_POOL,
+		if (!PASSWORD_HASH_EXECUTOR.post(
 			[this, hash, key, callback]() mutable
 			{
 				callback(
@@ -471,8 +492,12 @@ namespace QLogicaeCore
 						key
 					)
 				);
-			}
-		);
+			},
+			_get_hash_memory_in_bytes()
+		))
+		{
+			callback(false);
+		}
 	}
 
 	void Argon2idHashCryptographer::transform_async(
@@ -480,8 +505,7 @@ namespace QLogicaeCore
 		const std::string& text
 	)
 	{
-		boost::asio::post(
-			UTILITIES.BOOST_ASIO_POOL,
+		if (!PASSWORD_HASH_EXECUTOR.post(
 			[this, text, callback]() mutable
 			{
 				callback(
@@ -489,8 +513,12 @@ namespace QLogicaeCore
 						text
 					)
 				);
-			}
-		);
+			},
+			_get_hash_memory_in_bytes()
+		))
+		{
+			callback("");
+		}
 	}
 
 	void Argon2idHashCryptographer::reverse_async(
@@ -499,8 +527,7 @@ namespace QLogicaeCore
 		const std::string& key
 	)
 	{
-		boost::asio::post(
-			UTILITIES.BOOST_ASIO_POOL,
+		if (!PASSWORD_HASH_EXECUTOR.post(
 			[this, hash, key, callback]() mutable
 			{
 				Result<bool> result;
@@ -514,8 +541,17 @@ namespace QLogicaeCore
 				callback(
 					result
 				);
-			}
-		);
+			},
+			_get_hash_memory_in_bytes()
+		))
+		{
+			Result<bool> result;
+			result.set_to_bad_status_without_value(
+				"Hashing queue is full"
+			);
+
+			callback(result);
+		}
 	}
 
 	void Argon2idHashCryptographer::transform_async(
@@ -523,8 +559,7 @@ namespace QLogicaeCore
 		const std::string& text
 	)
 	{
-		boost::asio::post(
-			UTILITIES.BOOST_ASIO_POOL,
+		if (!PASSWORD_HASH_EXECUTOR.post(
 			[this, text, callback]() mutable
 			{
 				Result<std::string> result;
@@ -537,8 +572,117 @@ namespace QLogicaeCore
 				callback(
 					result
 				);
+			},
+			_get_hash_memory_in_bytes()
+		))
+		{
+			Result<std::string> result;
+			result.set_to_bad_status_without_value(
+				"Hashing queue is full"
+			);
+
+			callback(result);
+		}
+	}
+
+	CryptographerProperties Argon2idHashCryptographer::calibrate(
+		const std::chrono::milliseconds& target_latency,
+		const std::size_t& memory_limit_in_bytes
+	)
+	{
+		try
+		{
+			Result<CryptographerProperties> result;
+
+			calibrate(result, target_latency, memory_limit_in_bytes);
+			if (result.is_status_bad())
+			{
+				return {};
+			}
+
+			return result.get_value();
+		}
+		catch (const std::exception& exception)
+		{
+			LOGGER.handle_exception_async(
+				"QLogicaeCore::Argon2idHashCryptographer::calibrate()",
+				exception.what()
+			);
+
+			return {};
+		}
+	}
+
+	void Argon2idHashCryptographer::calibrate(
+		Result<CryptographerProperties>& result,
+		const std::chrono::milliseconds& target_latency,
+		const std::size_t& memory_limit_in_bytes
+	)
+	{
+		CryptographerProperties properties = _get_cryptographer_properties();
+		const std::uint32_t parallelism =
+			std::max<std::uint32_t>(1, properties.uint32_t_3);
+		const std::string text = "calibration";
+		std::vector<unsigned char> salt(properties.size_t_2);
+		std::vector<unsigned char> hash(properties.size_t_1);
+
+		Result<PasswordHashCalibration> calibration_result;
+		PasswordHashCalibrator::run(
+			calibration_result,
+			target_latency,
+			PasswordHashCalibration
+			{
+				.operations_limit = ARGON2_MIN_TIME,
+				.memory_limit_in_bytes =
+					std::size_t { 2 * ARGON2_SYNC_POINTS } * parallelism * 1024
+			},
+			PasswordHashCalibration
+			{
+				.operations_limit =
+					UTILITIES.PASSWORD_HASH_MAXIMUM_OPERATIONS_LIMIT,
+				.memory_limit_in_bytes = memory_limit_in_bytes
+			},
+			[&](const PasswordHashCalibration& calibration)
+			{
+				return argon2id_hash_raw(
+					static_cast<std::uint32_t>(calibration.operations_limit),
+					static_cast<std::uint32_t>(
+						calibration.memory_limit_in_bytes / 1024),
+					parallelism,
+					text.data(),
+					text.size(),
+					salt.data(),
+					salt.size(),
+					hash.data(),
+					hash.size()
+				) == ARGON2_OK;
 			}
 		);
+		if (!calibration_result.is_status_safe())
+		{
+			return result.set_to_bad_status_without_value(
+				calibration_result.get_message()
+			);
+		}
+
+		properties.uint32_t_1 = static_cast<std::uint32_t>(
+			calibration_result.get_value().operations_limit);
+		properties.uint32_t_2 = static_cast<std::uint32_t>(
+			calibration_result.get_value().memory_limit_in_bytes / 1024);
+
+		result.set_to_good_status_with_value(properties);
+	}
+
+	CryptographerProperties Argon2idHashCryptographer::_get_cryptographer_properties()
+	{
+		std::shared_lock lock(_mutex);
+
+		return _cryptographer_properties;
+	}
+
+	std::size_t Argon2idHashCryptographer::_get_hash_memory_in_bytes()
+	{
+		return std::size_t { _get_cryptographer_properties().uint32_t_2 } * 1024;
 	}
 
 	Argon2idHashCryptographer& Argon2idHashCryptographer::get_instance()
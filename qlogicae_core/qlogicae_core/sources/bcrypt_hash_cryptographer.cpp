@@ -7,7 +7,15 @@ namespace QLogicaeCore
 	BcryptHashCryptographer::BcryptHashCryptographer() :
 		Cryptographer()
 	{
-		
+		_cryptographer_properties = DEFAULT_CRYPTOGRAPHER_4_PROPERTIES;
+	}
+
+	BcryptHashCryptographer::BcryptHashCryptographer(
+		const CryptographerProperties& properties
+	) :
+			Cryptographer()
+	{
+		_cryptographer_properties = properties;
 	}
 
 	bool BcryptHashCryptographer::setup()
@@ -38,6 +46,29 @@ namespace QLogicaeCore
         result.set_to_good_status_without_value();
     }
 
+	bool BcryptHashCryptographer::setup(
+		const CryptographerProperties& properties
+	)
+	{
+		Result<void> result;
+
+		setup(result, properties);
+
+		return result.is_status_safe();
+	}
+
+	void BcryptHashCryptographer::setup(
+		Result<void>& result,
+		const CryptographerProperties& properties
+	)
+	{
+		std::unique_lock lock(_mutex);
+
+		_cryptographer_properties = properties;
+
+		result.set_to_good_status_without_value();
+	}
+
 	std::future<bool> BcryptHashCryptographer::setup_async()
 	{
 		std::promise<bool> promise;
@@ -122,14 +153,17 @@ namespace QLogicaeCore
 	{
 		try
 		{
+			const CryptographerProperties properties =
+				_get_cryptographer_properties();
+
 			std::string hash;
 			hash.resize(crypto_pwhash_STRBYTES);
 
 			bool is_successful = crypto_pwhash_str(
 				hash.data(),
 				va.c_str(), va.size(),
-				crypto_pwhash_OPSLIMIT_MODERATE,
-				crypto_pwhash_MEMLIMIT_MODERATE) != 0;
+				properties.size_t_1,
+				properties.size_t_2) != 0;
 		
 			return hash.c_str();
 		}
@@ -176,8 +210,7 @@ namespace QLogicaeCore
 		std::promise<bool> promise;
 		auto future = promise.get_future();
 
-		boost::asio::post(
-			UTILITIES.BOOST_ASIO_POOL,
+		if (!PASSWORD_HASH_EXECUTOR.post(
 			[this, va, vb,
 			promise = std::move(promise)]() mutable
 			{
@@ -187,8 +220,15 @@ namespace QLogicaeCore
 						vb
 					)
 				);
-			}
-		);
+			},
+			_get_hash_memory_in_bytes()
+		))
+		{
+			std::promise<bool> rejected_promise;
+			rejected_promise.set_value(false);
+
+			return rejected_promise.get_future();
+		}
 
 		return future;
 	}
@@ -200,8 +240,7 @@ namespace QLogicaeCore
 		std::promise<std::string> promise;
 		auto future = promise.get_future();
 
-		boost::asio::post(
-			UTILITIES.BOOST_ASIO_POOL,
+		if (!PASSWORD_HASH_EXECUTOR.post(
 			[this, va,
 			promise = std::move(promise)]() mutable
 			{
@@ -210,8 +249,15 @@ namespace QLogicaeCore
 						va
 					)
 				);
-			}
-		);
+			},
+			_get_hash_memory_in_bytes()
+		))
+		{
+			std::promise<std::string> rejected_promise;
+			rejected_promise.set_value("");
+
+			return rejected_promise.get_future();
+		}
 
 		return future;
 	}
@@ -222,7 +268,8 @@ namespace QLogicaeCore
         const std::string& text
 	)
     {
-		std::scoped_lock lock(_mutex);
+		const CryptographerProperties properties =
+			_get_cryptographer_properties();
 
         std::string hash;
         hash.resize(crypto_pwhash_STRBYTES);
@@ -231,8 +278,8 @@ namespace QLogicaeCore
             hash.data(),
             text.c_str(),
             text.size(),
-            crypto_pwhash_OPSLIMIT_MODERATE,
-            crypto_pwhash_MEMLIMIT_MODERATE
+            properties.size_t_1,
+            properties.size_t_2
         ) == 0;
 
         result.set_to_good_status_with_value(
@@ -246,8 +293,6 @@ namespace QLogicaeCore
         const std::string& key
 	)
     {
-		std::scoped_lock lock(_mutex);
-
         bool verified = crypto_pwhash_str_verify(
             key.c_str(),
             hash.c_str(),
@@ -265,8 +310,7 @@ namespace QLogicaeCore
 		std::promise<std::string> promise;
 		auto future = promise.get_future();
 
-		boost::asio::post(
-			UTILITIES.BOOST_ASIO_POOL,
+		if (!PASSWORD_HASH_EXECUTOR.post(
 			[this, text,
 			promise = std::move(promise)]() mutable
 			{
@@ -280,8 +324,14 @@ namespace QLogicaeCore
 				promise.set_value(
 					result.get_value()
 				);
-			}
-		);
+			},
+			_get_hash_memory_in_bytes()
+		))
+		{
+			return result.set_to_bad_status_without_value(
+				"Hashing queue is full"
+			);
+		}
 
 		result.set_to_good_status_with_value(
 			std::move(future)
@@ -297,8 +347,7 @@ namespace QLogicaeCore
 		std::promise<bool> promise;
 		auto future = promise.get_future();
 
-		boost::asio::post(
-			UTILITIES.BOOST_ASIO_POOL,
+		if (!PASSWORD_HASH_EXECUTOR.post(
 			[this, hash, key,
 			promise = std::move(promise)]() mutable
 			{
@@ -313,8 +362,14 @@ namespace QLogicaeCore
 				promise.set_value(
 					result.get_value()
 				);
-			}
-		);
+			},
+			_get_hash_memory_in_bytes()
+		))
+		{
+			return result.set_to_bad_status_without_value(
+				"Hashing queue is full"
+			);
+		}
 
 		result.set_to_good_status_with_value(
 			std::move(future)
@@ -327,8 +382,7 @@ namespace QLogicaeCore
         const std::string& key
     )
     {
-        boost::asio::post(
-            UTILITIES.BOOST_ASIO_POOL,
+        if (!PASSWORD_HASH_EXECUTOR.post(
             [this, hash, key, callback]() mutable
             {
                 callback(
@@ -337,8 +391,12 @@ namespace QLogicaeCore
                         key
                     )
                 );
-            }
-        );
+            },
+            _get_hash_memory_in_bytes()
+        ))
+        {
+            callback(false);
+        }
     }
 
     void BcryptHashCryptographer::transform_async(
@@ -346,8 +404,7 @@ namespace QLogicaeCore
         const std::string& text
     )
     {
-        boost::asio::post(
-            UTILITIES.BOOST_ASIO_POOL,
+        if (!PASSWORD_HASH_EXECUTOR.post(
             [this, text, callback]() mutable
             {
                 callback(
@@ -355,8 +412,12 @@ namespace QLogicaeCore
                         text
                     )
                 );
-            }
-        );
+            },
+            _get_hash_memory_in_bytes()
+        ))
+        {
+            callback("");
+        }
     }
 
     void BcryptHashCryptographer::reverse_async(
@@ -365,8 +426,7 @@ namespace QLogicaeCore
         const std::string& key
     )
     {
-        boost::asio::post(
-            UTILITIES.BOOST_ASIO_POOL,
+        if (!PASSWORD_HASH_EXECUTOR.post(
             [this, hash, key, callback]() mutable
             {
                 Result<bool> result;
@@ -380,8 +440,17 @@ namespace QLogicaeCore
                 callback(
                     result
                 );
-            }
-        );
+            },
+            _get_hash_memory_in_bytes()
+        ))
+        {
+            Result<bool> result;
+            result.set_to_bad_status_without_value(
+                "Hashing queue is full"
+            );
+
+            callback(result);
+        }
     }
 
     void BcryptHashCryptographer::transform_async(
@@ -389,8 +458,7 @@ namespace QLogicaeCore
         const std::string& text
     )
     {
-        boost::asio::post(
-            UTILITIES.BOOST_ASIO_POOL,
+        if (!PASSWORD_HASH_EXECUTOR.post(
             [this, text, callback]() mutable
             {
                 Result<std::string> result;
@@ -403,10 +471,117 @@ namespace QLogicaeCore
                 callback(
                     result
                 );
-            }
-        );
+            },
+            _get_hash_memory_in_bytes()
+        ))
+        {
+            Result<std::string> result;
+            result.set_to_bad_status_without_value(
+                "Hashing queue is full"
+            );
+
+            callback(result);
+        }
     }
 
+	CryptographerProperties BcryptHashCryptographer::calibrate(
+		const std::chrono::milliseconds& target_latency,
+		const std::size_t& memory_limit_in_bytes
+	)
+	{
+		try
+		{
+			Result<CryptographerProperties> result;
+
+			calibrate(result, target_latency, memory_limit_in_bytes);
+			if (result.is_status_bad())
+			{
+				return {};
+			}
+
+			return result.get_value();
+		}
+		catch (const std::exception& exception)
+		{
+			LOGGER.handle_exception_async(
+				"QLogicaeCore::BcryptHashCryptographer::calibrate()",
+				exception.what()
+			);
+
+			return {};
+		}
+	}
+
+	void BcryptHashCryptographer::calibrate(
+		Result<CryptographerProperties>& result,
+		const std::chrono::milliseconds& target_latency,
+		const std::size_t& memory_limit_in_bytes
+	)
+	{
+		CryptographerProperties properties = _get_cryptographer_properties();
+		const std::string text = "calibration";
+		std::array<unsigned char, crypto_pwhash_SALTBYTES> salt{};
+		std::array<unsigned char, crypto_pwhash_BYTES_MIN> hash{};
+
+		Result<PasswordHashCalibration> calibration_result;
+		PasswordHashCalibrator::run(
+			calibration_result,
+			target_latency,
+			PasswordHashCalibration
+			{
+				.operations_limit = crypto_pwhash_OPSLIMIT_MIN,
+				.memory_limit_in_bytes = crypto_pwhash_MEMLIMIT_MIN
+			},
+			PasswordHashCalibration
+			{
+				.operations_limit = std::min<std::uint64_t>(
+					UTILITIES.PASSWORD_HASH_MAXIMUM_OPERATIONS_LIMIT,
+					crypto_pwhash_OPSLIMIT_MAX),
+				.memory_limit_in_bytes = std::min<std::size_t>(
+					memory_limit_in_bytes,
+					crypto_pwhash_MEMLIMIT_MAX)
+			},
+			[&](const PasswordHashCalibration& calibration)
+			{
+				return crypto_pwhash(
+					hash.data(),
+					hash.size(),
+					text.data(),
+					text.size(),
+					salt.data(),
+					calibration.operations_limit,
+					calibration.memory_limit_in_bytes,
+					crypto_pwhash_ALG_DEFAULT
+				) == 0;
+			}
+		);
+		if (!calibration_result.is_status_safe())
+		{
+			return result.set_to_bad_status_without_value(
+				calibration_result.get_message()
+			);
+		}
+
+		properties.size_t_1 = static_cast<std::size_t>(
+			calibration_result.get_value().operations_limit);
+		properties.size_t_2 =
+			calibration_result.get_value().memory_limit_in_bytes;
+
+		result.set_to_good_status_with_value(properties);
+	}
+
+	CryptographerProperties BcryptHashCryptographer::_get_cryptographer_properties()
+	{
+		std::shared_lock lock(_mutex);
+
+		return _cryptographer_properties;
+	}
+
+	std::size_t BcryptHashCryptographer::_get_hash_memory_in_bytes()
+	{
+		return _get_cryptographer_properties().size_t_2;
+	}
+
 	BcryptHashCryptographer& BcryptHashCryptographer::get_instance()
 	{
 		static BcryptHashCryptographer instance;
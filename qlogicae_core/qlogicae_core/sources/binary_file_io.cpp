@@ -118,6 +118,7 @@ namespace QLogicaeCore
                 {
                     _read_file.reset();
                 }
+                _read_block_handle.reset();
 
                 return true;
 
@@ -319,6 +320,71 @@ namespace QLogicaeCore
         });
     }
 
+    std::size_t BinaryFileIO::get_size()
+    {
+        try
+        {
+            Result<std::size_t> result;
+
+            get_size(result);
+
+            return result.get_value();
+        }
+        catch (const std::exception& exception)
+        {
+            throw std::runtime_error(
+                std::string() +
+                "Exception at BinaryFileIO::get_size(): " +
+                exception.what()
+            );
+        }
+    }
+
+    std::size_t BinaryFileIO::read_block(
+        const std::uint64_t& offset,
+        std::span<std::byte> buffer
+    )
+    {
+        try
+        {
+            Result<std::size_t> result;
+
+            read_block(result, offset, buffer);
+
+            return result.get_value();
+        }
+        catch (const std::exception& exception)
+        {
+            throw std::runtime_error(
+                std::string() +
+                "Exception at BinaryFileIO::read_block(): " +
+                exception.what()
+            );
+        }
+    }
+
+    bool BinaryFileIO::write_block(
+        const std::span<const std::byte>& content
+    )
+    {
+        try
+        {
+            Result<bool> result;
+
+            write_block(result, content);
+
+            return result.is_status_safe();
+        }
+        catch (const std::exception& exception)
+        {
+            throw std::runtime_error(
+                std::string() +
+                "Exception at BinaryFileIO::write_block(): " +
+                exception.what()
+            );
+        }
+    }
+
     std::future<bool> BinaryFileIO::open_async(const FileMode& file_mode)
     {
         return std::async(std::launch::async, [this, file_mode]() -> bool
@@ -569,6 +635,148 @@ namespace QLogicaeCore
         );
     }
 
+    void BinaryFileIO::get_size(
+        Result<std::size_t>& result
+    )
+    {
+        std::scoped_lock lock(_mutex);
+
+        WIN32_FILE_ATTRIBUTE_DATA file_attributes;
+        if (!GetFileAttributesExW(
+                ENCODER.from_utf8_to_utf16(_file_path).c_str(),
+                GetFileExInfoStandard,
+                &file_attributes
+            ))
+        {
+            return result.set_to_bad_status_without_value(
+                "File not open to read"
+            );
+        }
+
+        result.set_to_good_status_with_value(
+            static_cast<std::size_t>(
+                (static_cast<std::uint64_t>(file_attributes.nFileSizeHigh) << 32) |
+                file_attributes.nFileSizeLow
+            )
+        );
+    }
+
+    void BinaryFileIO::read_block(
+        Result<std::size_t>& result,
+        const std::uint64_t& offset,
+        std::span<std::byte> buffer
+    )
+    {
+        std::scoped_lock lock(_mutex);
+
+        if (!_read_block_handle)
+        {
+            HANDLE file_handle = CreateFileW(
+                ENCODER.from_utf8_to_utf16(_file_path).c_str(),
+                GENERIC_READ,
+                FILE_SHARE_READ | FILE_SHARE_WRITE,
+                nullptr,
+                OPEN_EXISTING,
+                FILE_ATTRIBUTE_NORMAL | FILE_FLAG_SEQUENTIAL_SCAN,
+                nullptr
+            );
+            if (file_handle == INVALID_HANDLE_VALUE)
+            {
+                return result.set_to_bad_status_without_value(
+                    "File not open to read"
+                );
+            }
+
+            _read_block_handle = std::shared_ptr<void>(
+                file_handle,
+                [](void* handle)
+                {
+                    CloseHandle(handle);
+                }
+            );
+        }
+        HANDLE file_handle = _read_block_handle.get();
+
+        LARGE_INTEGER file_size;
+        if (!GetFileSizeEx(file_handle, &file_size) ||
+            offset > static_cast<std::uint64_t>(file_size.QuadPart))
+        {
+            return result.set_to_bad_status_without_value(
+                "Offset is past the end of the file"
+            );
+        }
+
+        const std::size_t size = static_cast<std::size_t>(
+            std::min<std::uint64_t>(
+                buffer.size(),
+                static_cast<std::uint64_t>(file_size.QuadPart) - offset
+            )
+        );
+        std::size_t read_size = 0;
+        while (read_size < size)
+        {
+            const std::uint64_t read_offset = offset + read_size;
+            OVERLAPPED overlapped {};
+            overlapped.Offset = static_cast<DWORD>(read_offset);
+            overlapped.OffsetHigh = static_cast<DWORD>(read_offset >> 32);
+
+            DWORD chunk_size = 0;
+            if (!ReadFile(
+                    file_handle,
+                    buffer.data() + read_size,
+                    static_cast<DWORD>(std::min<std::size_t>(
+                        size - read_size,
+                        MAXDWORD
+                    )),
+                    &chunk_size,
+                    &overlapped
+                ))
+            {
+                if (GetLastError() == ERROR_HANDLE_EOF)
+                {
+                    break;
+                }
+
+                return result.set_to_bad_status_without_value(
+                    "File could not be read"
+                );
+            }
+            if (chunk_size == 0)
+            {
+                break;
+            }
+
+            read_size += chunk_size;
+        }
+
+        result.set_to_good_status_with_value(read_size);
+    }
+
+    void BinaryFileIO::write_block(
+        Result<bool>& result,
+        const std::span<const std::byte>& content
+    )
+    {
+        std::scoped_lock lock(_mutex);
+
+        if (!open(FileMode::WRITE))
+        {
+            return result.set_to_bad_status_without_value(
+                "File not open to write"
+            );
+        }
+
+        fast_io::write(
+            _write_file.value(),
+            content.begin(),
+            content.end()
+        );
+
+        result.set_to_good_status_with_value(
+            true
+        );
+    }
+
     void BinaryFileIO::open_async(
         Result<std::future<bool>>& result,
         const FileMode& file_mode
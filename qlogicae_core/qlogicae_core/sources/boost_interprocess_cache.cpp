@@ -8,16 +8,24 @@ namespace QLogicaeCore
             const std::string& name,
             const BytesSize& size_in_bytes
     )
-        : _segment(
-            boost::interprocess::open_or_create,
-            name.c_str(),
-            static_cast<std::size_t>(size_in_bytes)
-        )
     {
-        boost::interprocess::shared_memory_object::remove(name.c_str());
-        _data = _segment.find_or_construct<BoostInterprocessCacheSharedData>(
-            UTILITIES.DEFAULT_BOOST_INTERPROCESS_CACHE_SEGMENT_NAME.c_str())(
-                value_allocator_t(_segment.get_segment_manager()));
+        BoostInterprocessCacheConfigurations configurations;
+        configurations.name = name;
+        configurations.size = size_in_bytes;
+
+        _attach(configurations);
+    }
+
+    BoostInterprocessCache::BoostInterprocessCache(
+        const BoostInterprocessCacheConfigurations& configurations
+    )
+    {
+        _attach(configurations);
+    }
+
+    BoostInterprocessCache::~BoostInterprocessCache()
+    {
+        _detach();
     }
 
     void BoostInterprocessCache::setup(
@@ -26,20 +34,21 @@ namespace QLogicaeCore
         const BytesSize& size_in_bytes
     )
     {
-        _segment = segment_t(
-            boost::interprocess::open_or_create,
-            name.c_str(),
-            static_cast<std::size_t>(size_in_bytes)
-        );void setup(
-            Result<void>& result,
-            const std::string& name,
-            const BytesSize& size_in_bytes
-        );
+        BoostInterprocessCacheConfigurations configurations;
+        configurations.name = name;
+        configurations.size = size_in_bytes;
 
-        boost::interprocess::shared_memory_object::remove(name.c_str());
-        _data = _segment.find_or_construct<BoostInterprocessCacheSharedData>(
-            UTILITIES.DEFAULT_BOOST_INTERPROCESS_CACHE_SEGMENT_NAME.c_str())(
-                value_allocator_t(_segment.get_segment_manager()));
+        setup(result, configurations);
+    }
+
+    void BoostInterprocessCache::setup(
+        Result<void>& result,
+        const BoostInterprocessCacheConfigurations& configurations
+    )
+    {
+        _attach(configurations);
+
+        result.set_to_good_status_without_value();
     }
 
     void BoostInterprocessCache::write(
@@ -48,27 +57,55 @@ namespace QLogicaeCore
         Result<void>& result
     )
     {
-        boost::interprocess::scoped_lock lock(_data->_mutex);
-        string_t shm_key(key, _segment.get_segment_manager());
-        string_t shm_value(value, _segment.get_segment_manager());
+        write(
+            key,
+            value,
+            std::chrono::milliseconds(
+                _configurations.default_time_to_live_in_milliseconds
+            ),
+            result
+        );
+    }
 
-        auto iterative = _data->map.find(shm_key);
-        if (iterative != _data->map.end())
-        {
-            iterative->second.assign(
-                shm_value.c_str(),
-                shm_value.size()
-            );
-        }
-        else
+    void BoostInterprocessCache::write(
+        const char* key,
+        const char* value,
+        const std::chrono::milliseconds& time_to_live,
+        Result<void>& result
+    )
+    {
+        const uint64_t expiration_time = _get_expiration_time(time_to_live);
+
+        while (true)
         {
-            _data->map.emplace(
-                std::move(shm_key),
-                std::move(shm_value)
-            );
-        }
+            std::shared_ptr<BoostInterprocessCacheMapping> mapping;
+            writer_lock_t lock = _lock_writer(mapping);
+            if (mapping == nullptr)
+            {
+                result.set_to_bad_status_without_value(
+                    "Cache segment could not be mapped"
+                );
 
-        result.set_to_good_status_without_value();
+                return;
+            }
+
+            const auto status = _store(*mapping, key, value, expiration_time);
+            if (status == BoostInterprocessCacheStoreStatus::RETRY)
+            {
+                continue;
+            }
+
+            if (status == BoostInterprocessCacheStoreStatus::STORED)
+            {
+                result.set_to_good_status_without_value();
+            }
+            else
+            {
+                result.set_to_bad_status_without_value();
+            }
+
+            return;
+        }
     }
 
     std::future<void> BoostInterprocessCache::write_async(
@@ -91,14 +128,20 @@ namespace QLogicaeCore
         Result<const char*>& result
     )
     {
-        boost::interprocess::scoped_lock lock(_data->_mutex);
-    
-        auto iterative = _data->map.find(
-            string_t(key, _segment.get_segment_manager())
-        );
-        if (iterative != _data->map.end())
+        const auto mapping = _get_mapping();
+        if (mapping == nullptr)
+        {
+            result.set_to_bad_status_without_value(
+                "Cache segment could not be mapped"
+            );
+
+            return;
+        }
+
+        const char* value = nullptr;
+        if (_find(*mapping, key, &value))
         {
-            result.set_to_good_status_with_value(iterative->second.c_str());
+            result.set_to_good_status_with_value(value);
         }
         else
         {
@@ -120,15 +163,152 @@ namespace QLogicaeCore
         );
     }
 
+    void BoostInterprocessCache::read_view(
+        const std::string_view key,
+        BoostInterprocessCacheReadGuard& guard,
+        Result<std::string_view>& result
+    )
+    {
+        const auto mapping = _get_mapping();
+        if (mapping == nullptr)
+        {
+            result.set_to_bad_status_without_value(
+                "Cache segment could not be mapped"
+            );
+
+            return;
+        }
+
+        guard.release();
+        guard._mapping = mapping;
+        guard._reader_slot = _acquire_reader_slot(*mapping, guard._reader_owner);
+        if (guard._reader_slot == nullptr)
+        {
+            std::size_t size = 0;
+            bool is_copied = false;
+            while (!is_copied)
+            {
+                guard._buffer.resize(size);
+                if (!_find(
+                        *mapping,
+                        key,
+                        nullptr,
+                        &size,
+                        guard._buffer.data(),
+                        guard._buffer.size(),
+                        true,
+                        &is_copied))
+                {
+                    guard.release();
+                    result.set_to_bad_status_without_value();
+
+                    return;
+                }
+            }
+
+            guard._value = std::string_view(guard._buffer.data(), size);
+            result.set_to_good_status_with_value(guard._value);
+
+            return;
+        }
+
+        const char* value = nullptr;
+        std::size_t size = 0;
+        bool is_copied = false;
+        if (!_find(
+                *mapping,
+                key,
+                &value,
+                &size,
+                guard._inline_buffer,
+                BoostInterprocessCacheBucket::INLINE_CAPACITY,
+                false,
+                &is_copied))
+        {
+            guard.release();
+            result.set_to_bad_status_without_value();
+
+            return;
+        }
+
+        guard._value = (is_copied) ?
+            std::string_view(guard._inline_buffer, size) :
+            std::string_view(value, size);
+
+        result.set_to_good_status_with_value(guard._value);
+    }
+
+    std::future<void> BoostInterprocessCache::read_view_async(
+        const std::string_view key,
+        BoostInterprocessCacheReadGuard& guard,
+        Result<std::string_view>& result
+    )
+    {
+        return std::async(
+            std::launch::async,
+            [this, key, &guard, &result]()
+            {
+                read_view(key, guard, result);
+            }
+        );
+    }
+
+    void BoostInterprocessCache::copy_into(
+        const std::string_view key,
+        std::span<char> buffer,
+        Result<std::size_t>& result
+    )
+    {
+        const auto mapping = _get_mapping();
+        if (mapping == nullptr)
+        {
+            result.set_to_bad_status_without_value(
+                "Cache segment could not be mapped"
+            );
+
+            return;
+        }
+
+        std::size_t size = 0;
+        if (!_find(*mapping, key, nullptr, &size, buffer.data(), buffer.size()))
+        {
+            result.set_to_bad_status_without_value();
+
+            return;
+        }
+
+        if (size > buffer.size())
+        {
+            result.set_to_bad_status_with_value(size);
+
+            return;
+        }
+
+        result.set_to_good_status_with_value(size);
+    }
+
+    std::future<void> BoostInterprocessCache::copy_into_async(
+        const std::string_view key,
+        std::span<char> buffer,
+        Result<std::size_t>& result
+    )
+    {
+        return std::async(
+            std::launch::async,
+            [this, key, buffer, &result]()
+            {
+                copy_into(key, buffer, result);
+            }
+        );
+    }
+
     bool BoostInterprocessCache::is_key_found(
         const char* key
     )
     {
-        boost::interprocess::scoped_lock lock(_data->_mutex);
+        const auto mapping = _get_mapping();
 
-        return _data->map.find(
-            string_t(key, _segment.get_segment_manager())
-        ) != _data->map.end();
+        return mapping != nullptr && _find(*mapping, key);
     }
 
     std::future<bool> BoostInterprocessCache::is_key_found_async(
@@ -147,12 +327,18 @@ namespace QLogicaeCore
         Result<void>& result
     )
     {
-        boost::interprocess::scoped_lock lock(_data->_mutex);
-    
-        auto count = _data->map.erase(
-            string_t(key, _segment.get_segment_manager())
-        );
-        if (count > 0)
+        std::shared_ptr<BoostInterprocessCacheMapping> mapping;
+        writer_lock_t lock = _lock_writer(mapping);
+        if (mapping == nullptr)
+        {
+            result.set_to_bad_status_without_value(
+                "Cache segment could not be mapped"
+            );
+
+            return;
+        }
+
+        if (_erase(*mapping, key))
         {
             result.set_to_good_status_without_value();
         }
@@ -176,13 +362,107 @@ namespace QLogicaeCore
         );
     }
 
+    void BoostInterprocessCache::remove_expired(
+        Result<std::size_t>& result
+    )
+    {
+        std::shared_ptr<BoostInterprocessCacheMapping> mapping;
+        writer_lock_t lock = _lock_writer(mapping);
+        if (mapping == nullptr)
+        {
+            result.set_to_bad_status_without_value(
+                "Cache segment could not be mapped"
+            );
+
+            return;
+        }
+
+        auto& data = *mapping->data;
+        const uint64_t current_time = _get_current_time();
+        std::size_t count = 0;
+        for (uint64_t index = 0; index < data.bucket_count; ++index)
+        {
+            auto& bucket = data.buckets[index];
+            if (bucket.state.load(std::memory_order_relaxed) !=
+                static_cast<uint32_t>(BoostInterprocessCacheBucketState::OCCUPIED) ||
+                !_is_expired(
+                    bucket.expiration_time.load(std::memory_order_relaxed),
+                    current_time))
+            {
+                continue;
+            }
+
+            if (!_erase_bucket(*mapping, bucket))
+            {
+                break;
+            }
+            ++count;
+        }
+
+        result.set_to_good_status_with_value(count);
+    }
+
     void BoostInterprocessCache::clear(
         Result<void>& result
     )
     {
-        boost::interprocess::scoped_lock lock(_data->_mutex);
-        
-        _data->map.clear();
+        std::shared_ptr<BoostInterprocessCacheMapping> mapping;
+        writer_lock_t lock = _lock_writer(mapping);
+        if (mapping == nullptr)
+        {
+            result.set_to_bad_status_without_value(
+                "Cache segment could not be mapped"
+            );
+
+            return;
+        }
+
+        auto& data = *mapping->data;
+        for (uint64_t index = 0; index < data.bucket_count; ++index)
+        {
+            auto& bucket = data.buckets[index];
+            if (bucket.state.load(std::memory_order_relaxed) !=
+                static_cast<uint32_t>(BoostInterprocessCacheBucketState::OCCUPIED))
+            {
+                continue;
+            }
+
+            if (!_erase_bucket(*mapping, bucket))
+            {
+                result.set_to_bad_status_without_value();
+
+                return;
+            }
+        }
+
+        for (uint64_t index = 0; index < data.bucket_count; ++index)
+        {
+            auto& bucket = data.buckets[index];
+
+            bucket.sequence.fetch_add(1, std::memory_order_relaxed);
+            std::atomic_thread_fence(std::memory_order_release);
+            bucket.state.store(
+                static_cast<uint32_t>(BoostInterprocessCacheBucketState::EMPTY),
+                std::memory_order_relaxed
+            );
+            bucket.sequence.fetch_add(1, std::memory_order_release);
+        }
+        data.tombstone_count.store(0, std::memory_order_relaxed);
+
+        result.set_to_good_status_without_value();
+    }
+
+    void BoostInterprocessCache::flush(
+        Result<void>& result
+    )
+    {
+        const auto mapping = _get_mapping();
+        if (mapping == nullptr || !_flush(*mapping))
+        {
+            result.set_to_bad_status_without_value();
+
+            return;
+        }
 
         result.set_to_good_status_without_value();
     }
@@ -205,36 +485,46 @@ namespace QLogicaeCore
         Result<void>& result
     )
     {
-        std::vector<std::pair<string_t, string_t>> temporaries;
-        temporaries.reserve(items.size());
+        const uint64_t expiration_time = _get_expiration_time(
+            std::chrono::milliseconds(
+                _configurations.default_time_to_live_in_milliseconds
+            )
+        );
 
-        for (const auto& [key, value] : items)
+        std::shared_ptr<BoostInterprocessCacheMapping> mapping;
+        writer_lock_t lock = _lock_writer(mapping);
+        if (mapping == nullptr)
         {
-            temporaries.emplace_back(
-                string_t(key, _segment.get_segment_manager()),
-                string_t(value, _segment.get_segment_manager())
+            result.set_to_bad_status_without_value(
+                "Cache segment could not be mapped"
             );
+
+            return;
         }
 
+        for (const auto& [key, value] : items)
         {
-            boost::interprocess::scoped_lock lock(_data->_mutex);
-            for (auto& [shm_key, shm_value] : temporaries)
+            auto status = _store(*mapping, key, value, expiration_time);
+            while (status == BoostInterprocessCacheStoreStatus::RETRY)
             {
-                auto iterative = _data->map.find(shm_key);
-                if (iterative != _data->map.end())
+                lock.unlock();
+                lock = _lock_writer(mapping);
+                if (mapping == nullptr)
                 {
-                    iterative->second.assign(
-                        shm_value.c_str(),
-                        shm_value.size()
+                    result.set_to_bad_status_without_value(
+                        "Cache segment could not be mapped"
                     );
+
+                    return;
                 }
-                else
-                {
-                    _data->map.emplace(
-                        std::move(shm_key),
-                        std::move(shm_value)
-                    );                    
-                }
+                status = _store(*mapping, key, value, expiration_time);
+            }
+
+            if (status != BoostInterprocessCacheStoreStatus::STORED)
+            {
+                result.set_to_bad_status_without_value();
+
+                return;
             }
         }
 
@@ -261,24 +551,87 @@ namespace QLogicaeCore
         Result<void>& result
     )
     {
-        boost::interprocess::scoped_lock lock(_data->_mutex);
-        for (const auto& key : keys)
+        const auto mapping = _get_mapping();
+        if (mapping == nullptr)
         {
-            auto iterative = _data->map.find(
-                    string_t(
-                        key,
-                        _segment.get_segment_manager()
-                    )
+            result.set_to_bad_status_without_value(
+                "Cache segment could not be mapped"
             );
-            if (iterative != _data->map.end())
+
+            return;
+        }
+        for (const auto& key : keys)
+        {
+            const char* value = nullptr;
+            if (_find(*mapping, key, &value))
             {
-                out[key] = iterative->second.c_str();
+                out[key] = value;
             }
         }
 
         result.set_to_good_status_without_value();
     }
 
+    void BoostInterprocessCache::read_batch(
+        const std::vector<std::string_view>& keys,
+        std::span<char> buffer,
+        std::vector<std::optional<std::string_view>>& out,
+        Result<std::size_t>& result
+    )
+    {
+        const auto mapping = _get_mapping();
+        if (mapping == nullptr)
+        {
+            result.set_to_bad_status_without_value(
+                "Cache segment could not be mapped"
+            );
+
+            return;
+        }
+        std::size_t offset = 0;
+        std::size_t required_size = 0;
+
+        out.clear();
+        out.reserve(keys.size());
+        for (const auto& key : keys)
+        {
+            std::size_t size = 0;
+            char* destination = buffer.data() + offset;
+            if (!_find(
+                    *mapping,
+                    key,
+                    nullptr,
+                    &size,
+                    destination,
+                    buffer.size() - offset))
+            {
+                out.emplace_back(std::nullopt);
+
+                continue;
+            }
+
+            required_size += size;
+            if (size > buffer.size() - offset)
+            {
+                out.emplace_back(std::nullopt);
+
+                continue;
+            }
+
+            out.emplace_back(std::string_view(destination, size));
+            offset += size;
+        }
+
+        if (required_size > offset)
+        {
+            result.set_to_bad_status_with_value(required_size);
+
+            return;
+        }
+
+        result.set_to_good_status_with_value(offset);
+    }
+
     std::future<void> BoostInterprocessCache::read_batch_async(
         const std::vector<const char*>& keys,
         std::unordered_map<const char*, const char*>& out,
@@ -299,16 +652,20 @@ namespace QLogicaeCore
         Result<void>& result
     )
     {
-        boost::interprocess::scoped_lock lock(_data->_mutex);
-    
-        for (const auto& key : keys)
+        std::shared_ptr<BoostInterprocessCacheMapping> mapping;
+        writer_lock_t lock = _lock_writer(mapping);
+        if (mapping == nullptr)
         {
-            _data->map.erase(
-                string_t(
-                    key,
-                    _segment.get_segment_manager()
-                )
+            result.set_to_bad_status_without_value(
+                "Cache segment could not be mapped"
             );
+
+            return;
+        }
+
+        for (const auto& key : keys)
+        {
+            _erase(*mapping, key);
         }
 
         result.set_to_good_status_without_value();
@@ -327,5 +684,1219 @@ namespace QLogicaeCore
             }
         );
     }
-}
 
+    uint64_t BoostInterprocessCache::get_entry_count()
+    {
+        const auto mapping = _get_mapping();
+
+        return (mapping != nullptr) ? mapping->data->entry_count.load(std::memory_order_relaxed) : 0;
+    }
+
+    uint64_t BoostInterprocessCache::get_bucket_count()
+    {
+        const auto mapping = _get_mapping();
+
+        return (mapping != nullptr) ? mapping->data->bucket_count : 0;
+    }
+
+    uint64_t BoostInterprocessCache::get_generation()
+    {
+        const auto mapping = _get_mapping();
+
+        return (mapping != nullptr) ? mapping->generation : 0;
+    }
+
+    std::size_t BoostInterprocessCache::get_segment_size()
+    {
+        const auto mapping = _get_mapping();
+
+        return (mapping != nullptr) ? mapping->size : 0;
+    }
+
+    void BoostInterprocessCache::_attach(
+        const BoostInterprocessCacheConfigurations& configurations
+    )
+    {
+        _detach();
+
+        _configurations = configurations;
+        _mapping.store(nullptr);
+
+        const std::string base_name = _get_base_name();
+        if (_configurations.is_persistent)
+        {
+            _control_file = std::make_unique<mapped_file_t>(
+                boost::interprocess::open_or_create,
+                base_name.c_str(),
+                static_cast<std::size_t>(BytesSize::KB_4)
+            );
+            _control = _control_file->find_or_construct<
+                BoostInterprocessCacheControlData>(
+                    UTILITIES.DEFAULT_BOOST_INTERPROCESS_CACHE_CONTROL_NAME.c_str())();
+
+            _file_lock = boost::interprocess::file_lock(base_name.c_str());
+            if (_file_lock.try_lock())
+            {
+                _recover();
+                _file_lock.unlock();
+            }
+            _file_lock.lock_sharable();
+            _is_file_locked = true;
+            _control_segment.reset();
+        }
+        else
+        {
+            _control_file.reset();
+            _control_segment = std::make_unique<segment_t>(
+                boost::interprocess::open_or_create,
+                base_name.c_str(),
+                static_cast<std::size_t>(BytesSize::KB_4)
+            );
+            _control = _control_segment->find_or_construct<
+                BoostInterprocessCacheControlData>(
+                    UTILITIES.DEFAULT_BOOST_INTERPROCESS_CACHE_CONTROL_NAME.c_str())();
+        }
+
+        {
+            writer_lock_t lock(_control->_mutex);
+            if (_control->generation.load(std::memory_order_acquire) == 0)
+            {
+                auto mapping = _create_mapping(
+                    1,
+                    static_cast<std::size_t>(_configurations.size)
+                );
+                _flush(*mapping);
+                _publish_mapping(std::move(mapping));
+            }
+        }
+
+        _get_mapping();
+    }
+
+    void BoostInterprocessCache::_detach()
+    {
+        if (!_is_file_locked)
+        {
+            return;
+        }
+
+        const auto mapping = _mapping.load();
+        if (mapping != nullptr)
+        {
+            _flush(*mapping);
+        }
+
+        _file_lock.unlock();
+        _is_file_locked = false;
+        if (_file_lock.try_lock())
+        {
+            _control->is_clean = true;
+            _control_file->flush();
+            _file_lock.unlock();
+        }
+    }
+
+    void BoostInterprocessCache::_recover()
+    {
+        new (&_control->_mutex) boost::interprocess::interprocess_mutex();
+
+        const uint64_t generation =
+            _control->generation.load(std::memory_order_acquire);
+        if (generation == 0)
+        {
+            return;
+        }
+
+        _remove_segment(_get_segment_name(generation + 1));
+        _remove_segment(_get_segment_name(generation - 1));
+
+        std::unique_ptr<BoostInterprocessCacheMapping> mapping;
+        try
+        {
+            mapping = _open_mapping(generation);
+        }
+        catch (const boost::interprocess::interprocess_exception&)
+        {
+
+        }
+        if (mapping == nullptr)
+        {
+            _remove_segment(_get_segment_name(generation));
+            _control->generation.store(0, std::memory_order_release);
+            _control->is_clean = false;
+            _control_file->flush();
+
+            return;
+        }
+
+        auto& data = *mapping->data;
+        new (&data._mutex) boost::interprocess::interprocess_mutex();
+        for (auto& reader_slot : data.reader_slots)
+        {
+            reader_slot.owner.store(0, std::memory_order_relaxed);
+            reader_slot.epoch.store(0, std::memory_order_relaxed);
+            reader_slot.lease_time.store(0, std::memory_order_relaxed);
+        }
+        data.is_retired.store(false, std::memory_order_relaxed);
+
+        if (!_control->is_clean)
+        {
+            uint64_t entry_count = 0;
+            uint64_t tombstone_count = 0;
+            for (uint64_t index = 0; index < data.bucket_count; ++index)
+            {
+                auto& bucket = data.buckets[index];
+                const auto state = static_cast<BoostInterprocessCacheBucketState>(
+                    bucket.state.load(std::memory_order_relaxed)
+                );
+                const std::size_t size =
+                    bucket.key_size.load(std::memory_order_relaxed) +
+                    bucket.value_size.load(std::memory_order_relaxed) + 1;
+
+                if ((bucket.sequence.load(std::memory_order_relaxed) & 1) ||
+                    (state == BoostInterprocessCacheBucketState::OCCUPIED &&
+                        _get_bucket_data(*mapping, bucket, size) == nullptr))
+                {
+                    bucket.state.store(
+                        static_cast<uint32_t>(
+                            BoostInterprocessCacheBucketState::DELETED),
+                        std::memory_order_relaxed
+                    );
+                    bucket.external_handle.store(0, std::memory_order_relaxed);
+                    bucket.sequence.store(
+                        (bucket.sequence.load(std::memory_order_relaxed) | 1) + 1,
+                        std::memory_order_relaxed
+                    );
+                }
+
+                switch (static_cast<BoostInterprocessCacheBucketState>(
+                    bucket.state.load(std::memory_order_relaxed)))
+                {
+                    case BoostInterprocessCacheBucketState::OCCUPIED:
+                        ++entry_count;
+                        break;
+
+                    case BoostInterprocessCacheBucketState::DELETED:
+                        ++tombstone_count;
+                        break;
+
+                    default:
+                        break;
+                }
+            }
+
+            data.entry_count.store(entry_count, std::memory_order_relaxed);
+            data.tombstone_count.store(tombstone_count, std::memory_order_relaxed);
+            data.retired_count = std::min(
+                data.retired_count, data.retired_capacity);
+        }
+        _reclaim(*mapping);
+
+        _flush(*mapping);
+        _control->is_clean = false;
+        _control_file->flush();
+    }
+
+    bool BoostInterprocessCache::_flush(
+        BoostInterprocessCacheMapping& mapping
+    )
+    {
+        if (mapping.file == nullptr)
+        {
+            return true;
+        }
+
+        return mapping.file->flush() &&
+            (_control_file == nullptr || _control_file->flush());
+    }
+
+    std::shared_ptr<BoostInterprocessCacheMapping>
+        BoostInterprocessCache::_get_mapping()
+    {
+        auto mapping = _mapping.load();
+        if (mapping != nullptr &&
+            mapping->generation ==
+                _control->generation.load(std::memory_order_acquire))
+        {
+            return mapping;
+        }
+
+        std::scoped_lock lock(_mapping_mutex);
+        for (std::size_t attempt = 0;
+            attempt < UTILITIES.BOOST_INTERPROCESS_CACHE_MAPPING_ATTEMPT_LIMIT;
+            ++attempt)
+        {
+            mapping = _mapping.load();
+            const uint64_t generation =
+                _control->generation.load(std::memory_order_acquire);
+            if (mapping != nullptr && mapping->generation == generation)
+            {
+                return mapping;
+            }
+
+            try
+            {
+                std::shared_ptr<BoostInterprocessCacheMapping> next =
+                    _open_mapping(generation);
+                if (next != nullptr)
+                {
+                    _mapping.store(next);
+
+                    return next;
+                }
+            }
+            catch (const boost::interprocess::interprocess_exception&)
+            {
+
+            }
+
+            std::this_thread::yield();
+        }
+
+        return nullptr;
+    }
+
+    std::unique_ptr<BoostInterprocessCacheMapping>
+        BoostInterprocessCache::_open_mapping(
+            const uint64_t generation
+        )
+    {
+        const std::string name = _get_segment_name(generation);
+        const char* object_name =
+            UTILITIES.DEFAULT_BOOST_INTERPROCESS_CACHE_SEGMENT_NAME.c_str();
+
+        auto mapping = std::make_unique<BoostInterprocessCacheMapping>();
+        if (_configurations.is_persistent)
+        {
+            mapping->file = std::make_unique<mapped_file_t>(
+                boost::interprocess::open_only,
+                name.c_str()
+            );
+            mapping->manager = mapping->file->get_segment_manager();
+            mapping->address = static_cast<char*>(mapping->file->get_address());
+            mapping->size = mapping->file->get_size();
+        }
+        else
+        {
+            mapping->segment = std::make_unique<segment_t>(
+                boost::interprocess::open_only,
+                name.c_str()
+            );
+            mapping->manager = mapping->segment->get_segment_manager();
+            mapping->address = static_cast<char*>(mapping->segment->get_address());
+            mapping->size = mapping->segment->get_size();
+        }
+
+        mapping->data = mapping->manager->find<BoostInterprocessCacheSharedData>(
+            object_name).first;
+        if (mapping->data == nullptr)
+        {
+            return nullptr;
+        }
+        mapping->generation = generation;
+
+        return mapping;
+    }
+
+    std::unique_ptr<BoostInterprocessCacheMapping>
+        BoostInterprocessCache::_create_mapping(
+            const uint64_t generation,
+            const std::size_t size_in_bytes
+        )
+    {
+        const std::string name = _get_segment_name(generation);
+        const std::size_t segment_size = std::max(
+            size_in_bytes,
+            static_cast<std::size_t>(BytesSize::KB_4)
+        );
+        _remove_segment(name);
+
+        auto mapping = std::make_unique<BoostInterprocessCacheMapping>();
+        if (_configurations.is_persistent)
+        {
+            mapping->file = std::make_unique<mapped_file_t>(
+                boost::interprocess::create_only,
+                name.c_str(),
+                segment_size
+            );
+            mapping->manager = mapping->file->get_segment_manager();
+            mapping->address = static_cast<char*>(mapping->file->get_address());
+            mapping->size = mapping->file->get_size();
+        }
+        else
+        {
+            mapping->segment = std::make_unique<segment_t>(
+                boost::interprocess::create_only,
+                name.c_str(),
+                segment_size
+            );
+            mapping->manager = mapping->segment->get_segment_manager();
+            mapping->address = static_cast<char*>(mapping->segment->get_address());
+            mapping->size = mapping->segment->get_size();
+        }
+
+        mapping->data = mapping->manager->construct<BoostInterprocessCacheSharedData>(
+            UTILITIES.DEFAULT_BOOST_INTERPROCESS_CACHE_SEGMENT_NAME.c_str())(
+                mapping->manager, _get_bucket_count(segment_size));
+        mapping->generation = generation;
+
+        return mapping;
+    }
+
+    void BoostInterprocessCache::_publish_mapping(
+        std::shared_ptr<BoostInterprocessCacheMapping> mapping
+    )
+    {
+        std::scoped_lock lock(_mapping_mutex);
+
+        const uint64_t generation = mapping->generation;
+        _mapping.store(std::move(mapping));
+        _control->generation.store(generation, std::memory_order_release);
+    }
+
+    std::string BoostInterprocessCache::_get_segment_name(
+        const uint64_t generation
+    )
+    {
+        return fmt::format("{}.{}", _get_base_name(), generation);
+    }
+
+    std::string BoostInterprocessCache::_get_base_name()
+    {
+        if (_configurations.is_persistent && !_configurations.file_path.empty())
+        {
+            return _configurations.file_path;
+        }
+
+        return _configurations.name;
+    }
+
+    void BoostInterprocessCache::_remove_segment(
+        const std::string& name
+    )
+    {
+        if (_configurations.is_persistent)
+        {
+            boost::interprocess::file_mapping::remove(name.c_str());
+        }
+        else
+        {
+            boost::interprocess::shared_memory_object::remove(name.c_str());
+        }
+    }
+
+    writer_lock_t BoostInterprocessCache::_lock_writer(
+        std::shared_ptr<BoostInterprocessCacheMapping>& mapping
+    )
+    {
+        while (true)
+        {
+            mapping = _get_mapping();
+            if (mapping == nullptr)
+            {
+                return writer_lock_t();
+            }
+
+            writer_lock_t lock(mapping->data->_mutex);
+            if (!mapping->data->is_retired.load(std::memory_order_acquire))
+            {
+                return lock;
+            }
+        }
+    }
+
+    bool BoostInterprocessCache::_find(
+        BoostInterprocessCacheMapping& mapping,
+        const std::string_view key,
+        const char** value_pointer,
+        std::size_t* value_size,
+        char* buffer,
+        const std::size_t buffer_capacity,
+        const bool is_external_copied,
+        bool* is_copied
+    )
+    {
+        auto& data = *mapping.data;
+        const uint64_t hash = _hash(key);
+        const uint64_t mask = data.bucket_count - 1;
+        auto* buckets = data.buckets.get();
+
+        for (uint64_t probe = 0; probe < data.bucket_count; ++probe)
+        {
+            auto& bucket = buckets[(hash + probe) & mask];
+
+            for (std::size_t attempt = 0; ; ++attempt)
+            {
+                if (attempt == UTILITIES.BOOST_INTERPROCESS_CACHE_SEQUENCE_ATTEMPT_LIMIT)
+                {
+                    return false;
+                }
+
+                const uint64_t sequence =
+                    bucket.sequence.load(std::memory_order_acquire);
+                if (sequence & 1)
+                {
+                    std::this_thread::yield();
+
+                    continue;
+                }
+
+                const auto state = static_cast<BoostInterprocessCacheBucketState>(
+                    bucket.state.load(std::memory_order_relaxed)
+                );
+                bool is_matched = false;
+                bool is_buffer_filled = false;
+                const char* value = nullptr;
+                std::size_t size = 0;
+                uint64_t expiration_time = 0;
+
+                if (state == BoostInterprocessCacheBucketState::OCCUPIED &&
+                    bucket.hash.load(std::memory_order_relaxed) == hash &&
+                    bucket.key_size.load(std::memory_order_relaxed) == key.size())
+                {
+                    size = bucket.value_size.load(std::memory_order_relaxed);
+                    expiration_time =
+                        bucket.expiration_time.load(std::memory_order_relaxed);
+                    value = _get_bucket_data(
+                        mapping, bucket, key.size() + size + 1);
+                    is_matched = value != nullptr &&
+                        std::memcmp(value, key.data(), key.size()) == 0;
+                    if (is_matched && buffer != nullptr && size <= buffer_capacity &&
+                        (is_external_copied || value == bucket.inline_data))
+                    {
+                        std::memcpy(buffer, value + key.size(), size);
+                        is_buffer_filled = true;
+                    }
+                }
+
+                std::atomic_thread_fence(std::memory_order_acquire);
+                if (bucket.sequence.load(std::memory_order_relaxed) != sequence)
+                {
+                    continue;
+                }
+
+                if (state == BoostInterprocessCacheBucketState::EMPTY)
+                {
+                    return false;
+                }
+                if (!is_matched)
+                {
+                    break;
+                }
+                if (expiration_time != 0 &&
+                    _is_expired(expiration_time, _get_current_time()))
+                {
+                    return false;
+                }
+
+                if (bucket.is_referenced.load(std::memory_order_relaxed) == 0)
+                {
+                    bucket.is_referenced.store(1, std::memory_order_relaxed);
+                }
+                if (value_pointer != nullptr)
+                {
+                    *value_pointer = value + key.size();
+                }
+                if (value_size != nullptr)
+                {
+                    *value_size = size;
+                }
+                if (is_copied != nullptr)
+                {
+                    *is_copied = is_buffer_filled;
+                }
+
+                return true;
+            }
+        }
+
+        return false;
+    }
+
+    BoostInterprocessCacheBucket* BoostInterprocessCache::_find_slot(
+        BoostInterprocessCacheMapping& mapping,
+        const std::string_view key,
+        const uint64_t hash,
+        bool& is_found
+    )
+    {
+        auto& data = *mapping.data;
+        const uint64_t mask = data.bucket_count - 1;
+        auto* buckets = data.buckets.get();
+        BoostInterprocessCacheBucket* tombstone = nullptr;
+
+        is_found = false;
+        for (uint64_t probe = 0; probe < data.bucket_count; ++probe)
+        {
+            auto& bucket = buckets[(hash + probe) & mask];
+            const auto state = static_cast<BoostInterprocessCacheBucketState>(
+                bucket.state.load(std::memory_order_relaxed)
+            );
+
+            if (state == BoostInterprocessCacheBucketState::EMPTY)
+            {
+                return (tombstone != nullptr) ? tombstone : &bucket;
+            }
+            if (state == BoostInterprocessCacheBucketState::DELETED)
+            {
+                if (tombstone == nullptr)
+                {
+                    tombstone = &bucket;
+                }
+
+                continue;
+            }
+            if (bucket.hash.load(std::memory_order_relaxed) == hash &&
+                bucket.key_size.load(std::memory_order_relaxed) == key.size() &&
+                std::memcmp(
+                    _get_bucket_data(mapping, bucket, key.size()),
+                    key.data(),
+                    key.size()) == 0)
+            {
+                is_found = true;
+
+                return &bucket;
+            }
+        }
+
+        return tombstone;
+    }
+
+    BoostInterprocessCacheStoreStatus BoostInterprocessCache::_store(
+        BoostInterprocessCacheMapping& mapping,
+        const std::string_view key,
+        const std::string_view value,
+        const uint64_t expiration_time
+    )
+    {
+        const auto status = _store_entry(mapping, key, value, expiration_time);
+        if (status != BoostInterprocessCacheStoreStatus::FULL)
+        {
+            return status;
+        }
+
+        return (_make_room(mapping, key.size() + value.size() + 1)) ?
+            BoostInterprocessCacheStoreStatus::RETRY :
+            BoostInterprocessCacheStoreStatus::REJECTED;
+    }
+
+    BoostInterprocessCacheStoreStatus BoostInterprocessCache::_store_entry(
+        BoostInterprocessCacheMapping& mapping,
+        const std::string_view key,
+        const std::string_view value,
+        const uint64_t expiration_time
+    )
+    {
+        auto& data = *mapping.data;
+        const uint64_t hash = _hash(key);
+        bool is_found = false;
+        auto* bucket = _find_slot(mapping, key, hash, is_found);
+        if (bucket == nullptr)
+        {
+            return BoostInterprocessCacheStoreStatus::FULL;
+        }
+
+        if (!is_found)
+        {
+            const uint64_t maximum_entry_count =
+                _configurations.maximum_entry_count;
+            if (maximum_entry_count != 0 &&
+                data.entry_count.load(std::memory_order_relaxed) >=
+                    maximum_entry_count)
+            {
+                if (!_configurations.is_eviction_enabled)
+                {
+                    return BoostInterprocessCacheStoreStatus::REJECTED;
+                }
+
+                _evict(
+                    mapping,
+                    data.entry_count.load(std::memory_order_relaxed) -
+                        maximum_entry_count + 1
+                );
+                if (data.entry_count.load(std::memory_order_relaxed) >=
+                    maximum_entry_count)
+                {
+                    return BoostInterprocessCacheStoreStatus::REJECTED;
+                }
+
+                bucket = _find_slot(mapping, key, hash, is_found);
+                if (bucket == nullptr)
+                {
+                    return BoostInterprocessCacheStoreStatus::FULL;
+                }
+            }
+
+            if (bucket->state.load(std::memory_order_relaxed) ==
+                    static_cast<uint32_t>(BoostInterprocessCacheBucketState::EMPTY) &&
+                static_cast<double>(
+                    data.entry_count.load(std::memory_order_relaxed) +
+                    data.tombstone_count.load(std::memory_order_relaxed) + 1) >
+                    static_cast<double>(data.bucket_count) *
+                        _configurations.maximum_load_factor)
+            {
+                return BoostInterprocessCacheStoreStatus::FULL;
+            }
+        }
+
+        const std::size_t size = key.size() + value.size() + 1;
+        const bool is_inline =
+            size <= BoostInterprocessCacheBucket::INLINE_CAPACITY;
+        const bool is_tombstone = !is_found &&
+            bucket->state.load(std::memory_order_relaxed) ==
+                static_cast<uint32_t>(BoostInterprocessCacheBucketState::DELETED);
+
+        uint64_t handle = 0;
+        if (!is_inline)
+        {
+            auto* external = static_cast<char*>(
+                mapping.manager->allocate(size, std::nothrow)
+            );
+            if (external == nullptr)
+            {
+                return BoostInterprocessCacheStoreStatus::FULL;
+            }
+
+            std::memcpy(external, key.data(), key.size());
+            std::memcpy(external + key.size(), value.data(), value.size());
+            external[size - 1] = '\0';
+            handle = static_cast<uint64_t>(external - mapping.address);
+        }
+        const uint64_t previous_handle =
+            bucket->external_handle.load(std::memory_order_relaxed);
+        if (previous_handle != 0 && !_has_retired_capacity(mapping))
+        {
+            if (handle != 0)
+            {
+                mapping.manager->deallocate(mapping.address + handle);
+            }
+
+            return BoostInterprocessCacheStoreStatus::REJECTED;
+        }
+
+        bucket->sequence.fetch_add(1, std::memory_order_relaxed);
+        std::atomic_thread_fence(std::memory_order_release);
+        if (is_inline)
+        {
+            std::memcpy(bucket->inline_data, key.data(), key.size());
+            std::memcpy(
+                bucket->inline_data + key.size(), value.data(), value.size());
+            bucket->inline_data[size - 1] = '\0';
+        }
+        bucket->external_handle.store(handle, std::memory_order_relaxed);
+        bucket->hash.store(hash, std::memory_order_relaxed);
+        bucket->key_size.store(
+            static_cast<uint32_t>(key.size()), std::memory_order_relaxed);
+        bucket->value_size.store(
+            static_cast<uint32_t>(value.size()), std::memory_order_relaxed);
+        bucket->expiration_time.store(
+            expiration_time, std::memory_order_relaxed);
+        bucket->is_referenced.store(0, std::memory_order_relaxed);
+        bucket->state.store(
+            static_cast<uint32_t>(BoostInterprocessCacheBucketState::OCCUPIED),
+            std::memory_order_relaxed
+        );
+        bucket->sequence.fetch_add(1, std::memory_order_release);
+
+        if (previous_handle != 0)
+        {
+            _retire(mapping, previous_handle);
+        }
+        if (!is_found)
+        {
+            data.entry_count.fetch_add(1, std::memory_order_relaxed);
+            if (is_tombstone)
+            {
+                data.tombstone_count.fetch_sub(1, std::memory_order_relaxed);
+            }
+        }
+
+        return BoostInterprocessCacheStoreStatus::STORED;
+    }
+
+    bool BoostInterprocessCache::_make_room(
+        BoostInterprocessCacheMapping& mapping,
+        const std::size_t required_size
+    )
+    {
+        auto& data = *mapping.data;
+        const std::size_t size = mapping.size;
+        const std::size_t maximum_size = _configurations.maximum_size_in_bytes;
+        const uint64_t entry_count =
+            data.entry_count.load(std::memory_order_relaxed);
+
+        if (data.tombstone_count.load(std::memory_order_relaxed) > entry_count)
+        {
+            return _rebuild(mapping, size);
+        }
+
+        if (maximum_size == 0 || size < maximum_size)
+        {
+            std::size_t next_size = std::max(
+                static_cast<std::size_t>(
+                    static_cast<double>(size) * _configurations.growth_factor),
+                size + required_size * 2
+            );
+            if (maximum_size != 0)
+            {
+                next_size = std::min(next_size, maximum_size);
+            }
+
+            if (next_size > size && _rebuild(mapping, next_size))
+            {
+                return true;
+            }
+        }
+
+        if (!_configurations.is_eviction_enabled || entry_count == 0)
+        {
+            return false;
+        }
+
+        if (_evict(mapping, entry_count / 8 + 1) == 0)
+        {
+            return false;
+        }
+        _reclaim(mapping);
+
+        return true;
+    }
+
+    bool BoostInterprocessCache::_rebuild(
+        BoostInterprocessCacheMapping& mapping,
+        const std::size_t size_in_bytes
+    )
+    {
+        const uint64_t generation = mapping.generation + 1;
+
+        std::unique_ptr<BoostInterprocessCacheMapping> next;
+        try
+        {
+            next = _create_mapping(generation, size_in_bytes);
+        }
+        catch (const std::exception&)
+        {
+            _remove_segment(_get_segment_name(generation));
+
+            return false;
+        }
+
+        auto& data = *mapping.data;
+        const uint64_t current_time = _get_current_time();
+        for (uint64_t index = 0; index < data.bucket_count; ++index)
+        {
+            auto& bucket = data.buckets[index];
+            const uint64_t expiration_time =
+                bucket.expiration_time.load(std::memory_order_relaxed);
+            if (bucket.state.load(std::memory_order_relaxed) !=
+                    static_cast<uint32_t>(BoostInterprocessCacheBucketState::OCCUPIED) ||
+                _is_expired(expiration_time, current_time))
+            {
+                continue;
+            }
+
+            const std::size_t key_size =
+                bucket.key_size.load(std::memory_order_relaxed);
+            const std::size_t value_size =
+                bucket.value_size.load(std::memory_order_relaxed);
+            const char* entry = _get_bucket_data(
+                mapping, bucket, key_size + value_size + 1);
+            if (_store_entry(
+                    *next,
+                    std::string_view(entry, key_size),
+                    std::string_view(entry + key_size, value_size),
+                    expiration_time) != BoostInterprocessCacheStoreStatus::STORED)
+            {
+                next.reset();
+                _remove_segment(_get_segment_name(generation));
+
+                return false;
+            }
+        }
+
+        _flush(*next);
+        _publish_mapping(std::move(next));
+        data.is_retired.store(true, std::memory_order_release);
+        if (_control_file != nullptr)
+        {
+            _control_file->flush();
+        }
+        _remove_segment(_get_segment_name(mapping.generation));
+
+        return true;
+    }
+
+    uint64_t BoostInterprocessCache::_evict(
+        BoostInterprocessCacheMapping& mapping,
+        const uint64_t count
+    )
+    {
+        auto& data = *mapping.data;
+        const uint64_t mask = data.bucket_count - 1;
+        const uint64_t current_time = _get_current_time();
+        uint64_t evicted_count = 0;
+
+        for (uint64_t step = 0;
+            step < data.bucket_count * 2 && evicted_count < count;
+            ++step)
+        {
+            auto& bucket = data.buckets[data.clock_hand];
+            data.clock_hand = (data.clock_hand + 1) & mask;
+
+            if (bucket.state.load(std::memory_order_relaxed) !=
+                static_cast<uint32_t>(BoostInterprocessCacheBucketState::OCCUPIED))
+            {
+                continue;
+            }
+            if (!_is_expired(
+                    bucket.expiration_time.load(std::memory_order_relaxed),
+                    current_time) &&
+                bucket.is_referenced.exchange(0, std::memory_order_relaxed) != 0)
+            {
+                continue;
+            }
+
+            if (!_erase_bucket(mapping, bucket))
+            {
+                break;
+            }
+            ++evicted_count;
+        }
+
+        return evicted_count;
+    }
+
+    bool BoostInterprocessCache::_erase(
+        BoostInterprocessCacheMapping& mapping,
+        const std::string_view key
+    )
+    {
+        bool is_found = false;
+        auto* bucket = _find_slot(mapping, key, _hash(key), is_found);
+        if (!is_found)
+        {
+            return false;
+        }
+
+        return _erase_bucket(mapping, *bucket);
+    }
+
+    bool BoostInterprocessCache::_erase_bucket(
+        BoostInterprocessCacheMapping& mapping,
+        BoostInterprocessCacheBucket& bucket
+    )
+    {
+        const uint64_t handle =
+            bucket.external_handle.load(std::memory_order_relaxed);
+        if (handle != 0 && !_has_retired_capacity(mapping))
+        {
+            return false;
+        }
+
+        bucket.sequence.fetch_add(1, std::memory_order_relaxed);
+        std::atomic_thread_fence(std::memory_order_release);
+        bucket.state.store(
+            static_cast<uint32_t>(BoostInterprocessCacheBucketState::DELETED),
+            std::memory_order_relaxed
+        );
+        bucket.external_handle.store(0, std::memory_order_relaxed);
+        bucket.sequence.fetch_add(1, std::memory_order_release);
+
+        if (handle != 0)
+        {
+            _retire(mapping, handle);
+        }
+        auto& data = *mapping.data;
+        data.entry_count.fetch_sub(1, std::memory_order_relaxed);
+        data.tombstone_count.fetch_add(1, std::memory_order_relaxed);
+
+        const uint64_t mask = data.bucket_count - 1;
+        auto* buckets = data.buckets.get();
+        uint64_t index = static_cast<uint64_t>(&bucket - buckets);
+        if (buckets[(index + 1) & mask].state.load(std::memory_order_relaxed) !=
+            static_cast<uint32_t>(BoostInterprocessCacheBucketState::EMPTY))
+        {
+            return true;
+        }
+
+        while (buckets[index].state.load(std::memory_order_relaxed) ==
+            static_cast<uint32_t>(BoostInterprocessCacheBucketState::DELETED))
+        {
+            auto& tombstone = buckets[index];
+
+            tombstone.sequence.fetch_add(1, std::memory_order_relaxed);
+            std::atomic_thread_fence(std::memory_order_release);
+            tombstone.state.store(
+                static_cast<uint32_t>(BoostInterprocessCacheBucketState::EMPTY),
+                std::memory_order_relaxed
+            );
+            tombstone.sequence.fetch_add(1, std::memory_order_release);
+
+            data.tombstone_count.fetch_sub(1, std::memory_order_relaxed);
+            index = (index - 1) & mask;
+        }
+
+        return true;
+    }
+
+    BoostInterprocessCacheReaderSlot* BoostInterprocessCache::_acquire_reader_slot(
+        BoostInterprocessCacheMapping& mapping,
+        uint64_t& owner
+    )
+    {
+        auto& data = *mapping.data;
+        const uint64_t reader_owner = _get_reader_owner();
+
+        for (std::size_t attempt = 0;
+            attempt < UTILITIES.BOOST_INTERPROCESS_CACHE_READER_SLOT_ATTEMPT_LIMIT;
+            ++attempt)
+        {
+            for (auto& reader_slot : data.reader_slots)
+            {
+                uint64_t expected = 0;
+                if (!reader_slot.owner.compare_exchange_strong(
+                        expected, reader_owner, std::memory_order_seq_cst))
+                {
+                    continue;
+                }
+
+                reader_slot.lease_time.store(
+                    _get_current_time(), std::memory_order_relaxed);
+                uint64_t epoch = data.epoch.load(std::memory_order_seq_cst);
+                reader_slot.epoch.store(epoch, std::memory_order_seq_cst);
+                uint64_t current = data.epoch.load(std::memory_order_seq_cst);
+                while (current != epoch)
+                {
+                    epoch = current;
+                    reader_slot.epoch.store(epoch, std::memory_order_seq_cst);
+                    current = data.epoch.load(std::memory_order_seq_cst);
+                }
+                owner = reader_owner;
+
+                return &reader_slot;
+            }
+
+            if (attempt == 0)
+            {
+                _release_abandoned_reader_slots(mapping);
+            }
+            else
+            {
+                std::this_thread::yield();
+            }
+        }
+
+        return nullptr;
+    }
+
+    void BoostInterprocessCache::_release_abandoned_reader_slots(
+        BoostInterprocessCacheMapping& mapping
+    )
+    {
+        const uint64_t current_time = _get_current_time();
+        const uint64_t lease = _configurations.reader_lease_in_milliseconds;
+
+        for (auto& reader_slot : mapping.data->reader_slots)
+        {
+            uint64_t owner = reader_slot.owner.load(std::memory_order_acquire);
+            if (owner == 0 ||
+                owner == BoostInterprocessCacheReaderSlot::RELEASING_OWNER)
+            {
+                continue;
+            }
+
+            const uint64_t lease_time =
+                reader_slot.lease_time.load(std::memory_order_relaxed);
+            const bool is_lease_active = lease != 0 &&
+                current_time <= lease_time + lease;
+            if (is_lease_active || _is_reader_owner_alive(owner))
+            {
+                continue;
+            }
+
+            if (reader_slot.owner.compare_exchange_strong(
+                    owner,
+                    BoostInterprocessCacheReaderSlot::RELEASING_OWNER,
+                    std::memory_order_acq_rel))
+            {
+                reader_slot.epoch.store(0, std::memory_order_release);
+                reader_slot.lease_time.store(0, std::memory_order_relaxed);
+                reader_slot.owner.store(0, std::memory_order_release);
+            }
+        }
+    }
+
+    bool BoostInterprocessCache::_has_retired_capacity(
+        BoostInterprocessCacheMapping& mapping
+    )
+    {
+        auto& data = *mapping.data;
+        if (data.retired_count < data.retired_capacity)
+        {
+            return true;
+        }
+
+        _reclaim(mapping);
+
+        return data.retired_count < data.retired_capacity;
+    }
+
+    void BoostInterprocessCache::_retire(
+        BoostInterprocessCacheMapping& mapping,
+        const uint64_t handle
+    )
+    {
+        auto& data = *mapping.data;
+
+        data.retired_buffers[data.retired_count++] = {
+            handle,
+            data.epoch.fetch_add(1, std::memory_order_seq_cst)
+        };
+    }
+
+    void BoostInterprocessCache::_reclaim(
+        BoostInterprocessCacheMapping& mapping
+    )
+    {
+        _release_abandoned_reader_slots(mapping);
+
+        auto& data = *mapping.data;
+        uint64_t minimum_epoch = UINT64_MAX;
+        for (auto& reader_slot : data.reader_slots)
+        {
+            const uint64_t epoch = reader_slot.epoch.load(std::memory_order_seq_cst);
+            if (epoch != 0)
+            {
+                minimum_epoch = std::min(minimum_epoch, epoch);
+            }
+        }
+
+        auto* retired_buffers = data.retired_buffers.get();
+        uint64_t kept_count = 0;
+        for (uint64_t index = 0; index < data.retired_count; ++index)
+        {
+            if (retired_buffers[index].epoch >= minimum_epoch)
+            {
+                retired_buffers[kept_count++] = retired_buffers[index];
+
+                continue;
+            }
+
+            mapping.manager->deallocate(
+                mapping.address + retired_buffers[index].handle);
+        }
+        data.retired_count = kept_count;
+    }
+
+    const char* BoostInterprocessCache::_get_bucket_data(
+        BoostInterprocessCacheMapping& mapping,
+        const BoostInterprocessCacheBucket& bucket,
+        const std::size_t size
+    )
+    {
+        const uint64_t handle =
+            bucket.external_handle.load(std::memory_order_relaxed);
+        if (handle == 0)
+        {
+            return (size <= BoostInterprocessCacheBucket::INLINE_CAPACITY) ?
+                bucket.inline_data : nullptr;
+        }
+
+        if (handle + size > mapping.size)
+        {
+            return nullptr;
+        }
+
+        return mapping.address + handle;
+    }
+
+    uint64_t BoostInterprocessCache::_get_expiration_time(
+        const std::chrono::milliseconds& time_to_live
+    )
+    {
+        if (time_to_live.count() <= 0)
+        {
+            return 0;
+        }
+
+        return _get_current_time() + static_cast<uint64_t>(time_to_live.count());
+    }
+
+    bool BoostInterprocessCache::_is_expired(
+        const uint64_t expiration_time,
+        const uint64_t current_time
+    )
+    {
+        return expiration_time != 0 && current_time >= expiration_time;
+    }
+
+    uint64_t BoostInterprocessCache::_get_current_time()
+    {
+        return static_cast<uint64_t>(
+            std::chrono::duration_cast<std::chrono::milliseconds>(
+                std::chrono::system_clock::now().time_since_epoch()
+            ).count()
+        );
+    }
+
+    uint64_t BoostInterprocessCache::_get_reader_owner()
+    {
+        static std::atomic<uint32_t> sequence { 0 };
+
+        uint32_t ticket = sequence.fetch_add(1, std::memory_order_relaxed) + 1;
+        if (ticket == 0)
+        {
+            ticket = sequence.fetch_add(1, std::memory_order_relaxed) + 1;
+        }
+
+        return (static_cast<uint64_t>(GetCurrentProcessId()) << 32) | ticket;
+    }
+
+    bool BoostInterprocessCache::_is_reader_owner_alive(
+        const uint64_t owner
+    )
+    {
+        const DWORD process_id = static_cast<DWORD>(owner >> 32);
+        if (process_id == GetCurrentProcessId())
+        {
+            return true;
+        }
+
+        HANDLE process = OpenProcess(SYNCHRONIZE, FALSE, process_id);
+        if (process == nullptr)
+        {
+            return GetLastError() == ERROR_ACCESS_DENIED;
+        }
+
+        const bool is_alive = WaitForSingleObject(process, 0) == WAIT_TIMEOUT;
+        CloseHandle(process);
+
+        return is_alive;
+    }
+
+    uint64_t BoostInterprocessCache::_get_bucket_count(
+        const std::size_t size_in_bytes
+    )
+    {
+        return std::bit_floor(
+            std::max<uint64_t>(
+                8,
+                size_in_bytes / (sizeof(BoostInterprocessCacheBucket) * 4)
+            )
+        );
+    }
+
+    uint64_t BoostInterprocessCache::_hash(
+        const std::string_view key
+    )
+    {
+        uint64_t hash = 14695981039346656037ull;
+        for (const char character : key)
+        {
+            hash ^= static_cast<unsigned char>(character);
+            hash *= 1099511628211ull;
+        }
+
+        return hash;
+    }
+}
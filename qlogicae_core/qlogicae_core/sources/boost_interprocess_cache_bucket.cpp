@@ -0,0 +1,8 @@
+#include "pch.hpp"
+
+#include "../includes/boost_interprocess_cache_bucket.hpp"
+
+namespace QLogicaeCore
+{
+
+}
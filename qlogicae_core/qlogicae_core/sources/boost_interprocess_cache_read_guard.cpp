@@ -0,0 +1,92 @@
+#include "pch.hpp"
+
+#include "../includes/boost_interprocess_cache_read_guard.hpp"
+
+namespace QLogicaeCore
+{
+    BoostInterprocessCacheReadGuard::~BoostInterprocessCacheReadGuard()
+    {
+        release();
+    }
+
+    BoostInterprocessCacheReadGuard::BoostInterprocessCacheReadGuard(
+        BoostInterprocessCacheReadGuard&& other
+    ) noexcept
+    {
+        _move_from(other);
+    }
+
+    BoostInterprocessCacheReadGuard& BoostInterprocessCacheReadGuard::operator=(
+        BoostInterprocessCacheReadGuard&& other
+    ) noexcept
+    {
+        if (this != &other)
+        {
+            release();
+            _move_from(other);
+        }
+
+        return *this;
+    }
+
+    bool BoostInterprocessCacheReadGuard::is_active() const
+    {
+        return _reader_slot != nullptr;
+    }
+
+    std::string_view BoostInterprocessCacheReadGuard::get_value() const
+    {
+        return _value;
+    }
+
+    void BoostInterprocessCacheReadGuard::release()
+    {
+        if (_reader_slot != nullptr)
+        {
+            uint64_t owner = _reader_owner;
+            if (_reader_slot->owner.compare_exchange_strong(
+                    owner,
+                    BoostInterprocessCacheReaderSlot::RELEASING_OWNER,
+                    std::memory_order_acq_rel))
+            {
+                _reader_slot->epoch.store(0, std::memory_order_release);
+                _reader_slot->lease_time.store(0, std::memory_order_relaxed);
+                _reader_slot->owner.store(0, std::memory_order_release);
+            }
+            _reader_slot = nullptr;
+            _reader_owner = 0;
+        }
+        _value = {};
+        _buffer.clear();
+        _mapping.reset();
+    }
+
+    void BoostInterprocessCacheReadGuard::_move_from(
+        BoostInterprocessCacheReadGuard& other
+    )
+    {
+        _mapping = std::move(other._mapping);
+        _reader_slot = other._reader_slot;
+        _reader_owner = other._reader_owner;
+        if (other._value.data() == other._inline_buffer)
+        {
+            std::memcpy(_inline_buffer, other._inline_buffer, other._value.size());
+            _value = std::string_view(_inline_buffer, other._value.size());
+        }
+        else if (!other._buffer.empty() &&
+            other._value.data() == other._buffer.data())
+        {
+            _buffer = std::move(other._buffer);
+            _value = std::string_view(_buffer.data(), other._value.size());
+        }
+        else
+        {
+            _value = other._value;
+        }
+
+        other._reader_slot = nullptr;
+        other._reader_owner = 0;
+        other._value = {};
+        other._buffer.clear();
+    }
+}
@@ -0,0 +1,8 @@
+#include "pch.hpp"
+
+#include "../includes/boost_interprocess_cache_reader_slot.hpp"
+
+namespace QLogicaeCore
+{
+
+}
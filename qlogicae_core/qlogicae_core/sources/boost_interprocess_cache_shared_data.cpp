@@ -5,11 +5,27 @@
 namespace QLogicaeCore
 {
     BoostInterprocessCacheSharedData::BoostInterprocessCacheSharedData(
-        const value_allocator_t& alloc
+        manager_t* manager,
+        const uint64_t bucket_count
     ) :
-        map(std::less<string_t>(), alloc)
+        bucket_count(bucket_count),
+        retired_capacity(bucket_count * 2)
     {
+        auto* memory = static_cast<BoostInterprocessCacheBucket*>(
+            manager->allocate(
+                sizeof(BoostInterprocessCacheBucket) * bucket_count
+            )
+        );
+        for (uint64_t index = 0; index < bucket_count; ++index)
+        {
+            new (memory + index) BoostInterprocessCacheBucket();
+        }
 
+        buckets = memory;
+        retired_buffers = static_cast<BoostInterprocessCacheRetiredBuffer*>(
+            manager->allocate(
+                sizeof(BoostInterprocessCacheRetiredBuffer) * retired_capacity
+            )
+        );
     }
 }
-
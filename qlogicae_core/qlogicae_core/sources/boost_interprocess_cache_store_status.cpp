@@ -0,0 +1,8 @@
+#include "pch.hpp"
+
+#include "../includes/boost_interprocess_cache_store_status.hpp"
+
+namespace QLogicaeCore
+{
+
+}
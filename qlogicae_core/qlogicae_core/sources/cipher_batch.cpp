@@ -0,0 +1,13 @@
+#include "pch.hpp"
+
+#include "../includes/cipher_batch.hpp"
+
+namespace QLogicaeCore
+{
+    std::string_view CipherBatch::get_value(
+        const std::size_t& index
+    ) const
+    {
+        return std::string_view(arena).substr(offsets[index], sizes[index]);
+    }
+}
@@ -0,0 +1,82 @@
+#include "pch.hpp"
+
+#include "../includes/cipher_batch_runner.hpp"
+
+namespace QLogicaeCore
+{
+    void CipherBatchRunner::run(
+        Result<CipherBatch>& result,
+        const std::size_t& count,
+        const cipher_batch_capacity_t& get_capacity,
+        const cipher_batch_transform_t& transform
+    )
+    {
+        if (!get_capacity || !transform)
+        {
+            return result.set_to_bad_status_without_value(
+                "Capacity or transform is invalid"
+            );
+        }
+
+        CipherBatch batch;
+        batch.offsets.resize(count + 1);
+        for (std::size_t index = 0; index < count; ++index)
+        {
+            batch.offsets[index + 1] =
+                batch.offsets[index] + get_capacity(index);
+        }
+
+        batch.arena.resize(batch.offsets[count]);
+        batch.sizes.assign(count, 0);
+        batch.flags.resize(count);
+
+        const std::size_t chunk_size = UTILITIES.CIPHER_BATCH_CHUNK_SIZE;
+        const std::size_t chunk_count = (count + chunk_size - 1) / chunk_size;
+
+        auto run_chunk =
+            [&batch, &transform, chunk_size, count](
+                const std::size_t chunk_index
+            )
+            {
+                const std::size_t begin = chunk_index * chunk_size;
+                const std::size_t end = std::min(begin + chunk_size, count);
+                for (std::size_t index = begin; index < end; ++index)
+                {
+                    const std::optional<std::size_t> size = transform(
+                        index,
+                        std::span<char>(
+                            batch.arena.data() + batch.offsets[index],
+                            batch.offsets[index + 1] - batch.offsets[index]
+                        )
+                    );
+                    if (size.has_value())
+                    {
+                        batch.sizes[index] = *size;
+                        batch.flags.set(index);
+                    }
+                }
+            };
+
+        try
+        {
+            if (count < UTILITIES.CIPHER_BATCH_PARALLEL_MINIMUM_COUNT)
+            {
+                for (std::size_t chunk_index = 0; chunk_index < chunk_count;
+                    ++chunk_index)
+                {
+                    run_chunk(chunk_index);
+                }
+            }
+            else
+            {
+                ThreadPool::get_instance().parallel_for(chunk_count, run_chunk);
+            }
+        }
+        catch (const std::exception& exception)
+        {
+            return result.set_to_bad_status_without_value(exception.what());
+        }
+
+        result.set_to_good_status_with_value(std::move(batch));
+    }
+}
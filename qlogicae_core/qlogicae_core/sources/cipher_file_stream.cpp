@@ -0,0 +1,210 @@
+#include "pch.hpp"
+
+#include "../includes/cipher_file_stream.hpp"
+
+namespace QLogicaeCore
+{
+    void CipherFileStream::run(
+        Result<std::uint64_t>& result,
+        const std::string& input_path,
+        const std::string& output_path,
+        const std::uint64_t& input_offset,
+        const std::size_t& chunk_size,
+        std::span<const unsigned char> header,
+        const cipher_stream_transform_t& transform
+    )
+    {
+        if (chunk_size == 0 || !transform)
+        {
+            return result.set_to_bad_status_without_value(
+                "Chunk size or transform is invalid"
+            );
+        }
+
+        BinaryFileIO input_file(input_path);
+        Result<std::size_t> size_result;
+        input_file.get_size(size_result);
+        if (!size_result.is_status_safe())
+        {
+            return result.set_to_bad_status_without_value(
+                size_result.get_message()
+            );
+        }
+
+        const std::uint64_t input_size = size_result.get_value();
+        if (input_size < input_offset)
+        {
+            return result.set_to_bad_status_without_value(
+                "Input is shorter than its header"
+            );
+        }
+
+        BinaryFileIO output_file(output_path);
+        Result<bool> header_result;
+        output_file.write_block(header_result, std::as_bytes(header));
+        if (!header_result.is_status_safe())
+        {
+            return result.set_to_bad_status_without_value(
+                header_result.get_message()
+            );
+        }
+
+        CipherStreamQueue read_queue(UTILITIES.CIPHER_STREAM_QUEUE_CAPACITY);
+        CipherStreamQueue write_queue(UTILITIES.CIPHER_STREAM_QUEUE_CAPACITY);
+        std::atomic<bool> is_failed = false;
+        std::mutex message_mutex;
+        std::string message;
+        std::uint64_t written_size = header.size();
+
+        const auto fail = [&](const std::string& text)
+            {
+                {
+                    std::scoped_lock lock(message_mutex);
+
+                    if (!is_failed.exchange(true))
+                    {
+                        message = text;
+                    }
+                }
+
+                read_queue.close();
+                write_queue.close();
+            };
+
+        std::thread reader([&]()
+            {
+                try
+                {
+                    std::uint64_t offset = input_offset;
+                    for (std::uint64_t index = 0; !is_failed; ++index)
+                    {
+                        CipherStreamChunk chunk;
+                        chunk.index = index;
+                        chunk.data.resize(static_cast<std::size_t>(
+                            std::min<std::uint64_t>(
+                                chunk_size, input_size - offset)));
+                        chunk.is_final =
+                            offset + chunk.data.size() == input_size;
+
+                        Result<std::size_t> read_result;
+                        input_file.read_block(
+                            read_result,
+                            offset,
+                            std::as_writable_bytes(std::span(chunk.data))
+                        );
+                        if (!read_result.is_status_safe() ||
+                            read_result.get_value() != chunk.data.size())
+                        {
+                            return fail("Reading failed");
+                        }
+
+                        offset += chunk.data.size();
+
+                        const bool is_final = chunk.is_final;
+                        if (!read_queue.push(std::move(chunk)) || is_final)
+                        {
+                            break;
+                        }
+                    }
+
+                    read_queue.close();
+                }
+                catch (const std::exception& exception)
+                {
+                    fail(exception.what());
+                }
+            });
+
+        std::thread writer([&]()
+            {
+                try
+                {
+                    CipherStreamChunk chunk;
+                    while (write_queue.pop(chunk) && !is_failed)
+                    {
+                        Result<bool> write_result;
+                        output_file.write_block(
+                            write_result,
+                            std::as_bytes(std::span(chunk.data))
+                        );
+                        if (!write_result.is_status_safe())
+                        {
+                            return fail("Writing failed");
+                        }
+
+                        written_size += chunk.data.size();
+                    }
+                }
+                catch (const std::exception& exception)
+                {
+                    fail(exception.what());
+                }
+            });
+
+        try
+        {
+            CipherStreamChunk chunk;
+            while (read_queue.pop(chunk) && !is_failed)
+            {
+                if (!transform(chunk))
+                {
+                    fail("Transformation failed");
+
+                    break;
+                }
+
+                if (!write_queue.push(std::move(chunk)))
+                {
+                    break;
+                }
+            }
+        }
+        catch (const std::exception& exception)
+        {
+            fail(exception.what());
+        }
+
+        write_queue.close();
+        reader.join();
+        writer.join();
+
+        input_file.close(FileMode::READ);
+        output_file.close(FileMode::WRITE);
+
+        if (is_failed)
+        {
+            std::error_code error_code;
+            std::filesystem::remove(output_path, error_code);
+
+            return result.set_to_bad_status_without_value(message);
+        }
+
+        result.set_to_good_status_with_value(written_size);
+    }
+
+    void CipherFileStream::read_header(
+        Result<void>& result,
+        const std::string& input_path,
+        std::span<unsigned char> header
+    )
+    {
+        BinaryFileIO input_file(input_path);
+        Result<std::size_t> read_result;
+        input_file.read_block(
+            read_result,
+            0,
+            std::as_writable_bytes(header)
+        );
+        input_file.close(FileMode::READ);
+
+        if (!read_result.is_status_safe() ||
+            read_result.get_value() != header.size())
+        {
+            return result.set_to_bad_status_without_value(
+                "Input is shorter than its header"
+            );
+        }
+
+        result.set_to_good_status_without_value();
+    }
+}
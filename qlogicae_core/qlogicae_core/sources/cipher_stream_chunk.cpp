@@ -0,0 +1,8 @@
+#include "pch.hpp"
+
+#include "../includes/cipher_stream_chunk.hpp"
+
+namespace QLogicaeCore
+{
+
+}
@@ -0,0 +1,77 @@
+#include "pch.hpp"
+
+#include "../includes/cipher_stream_queue.hpp"
+
+namespace QLogicaeCore
+{
+    CipherStreamQueue::CipherStreamQueue(
+        const std::size_t capacity
+    ) :
+        _capacity(std::max<std::size_t>(capacity, 1)),
+        _is_closed(false)
+    {
+
+    }
+
+    CipherStreamQueue::~CipherStreamQueue()
+    {
+        close();
+    }
+
+    bool CipherStreamQueue::push(
+        CipherStreamChunk&& chunk
+    )
+    {
+        std::unique_lock lock(_mutex);
+
+        _push_signal.wait(lock, [this]()
+            {
+                return _is_closed || _chunks.size() < _capacity;
+            });
+
+        if (_is_closed)
+        {
+            return false;
+        }
+
+        _chunks.push_back(std::move(chunk));
+        _pop_signal.notify_one();
+
+        return true;
+    }
+
+    bool CipherStreamQueue::pop(
+        CipherStreamChunk& chunk
+    )
+    {
+        std::unique_lock lock(_mutex);
+
+        _pop_signal.wait(lock, [this]()
+            {
+                return _is_closed || !_chunks.empty();
+            });
+
+        if (_chunks.empty())
+        {
+            return false;
+        }
+
+        chunk = std::move(_chunks.front());
+        _chunks.pop_front();
+        _push_signal.notify_one();
+
+        return true;
+    }
+
+    void CipherStreamQueue::close()
+    {
+        {
+            std::scoped_lock lock(_mutex);
+
+            _is_closed = true;
+        }
+
+        _push_signal.notify_all();
+        _pop_signal.notify_all();
+    }
+}
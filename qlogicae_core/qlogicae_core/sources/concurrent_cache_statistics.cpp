@@ -0,0 +1,8 @@
+#include "pch.hpp"
+
+#include "../includes/concurrent_cache_statistics.hpp"
+
+namespace QLogicaeCore
+{
+
+}
@@ -0,0 +1,112 @@
+#include "pch.hpp"
+
+#include "../includes/cpu_features.hpp"
+
+#include <intrin.h>
+#include <immintrin.h>
+
+namespace QLogicaeCore
+{
+    CpuFeatures::CpuFeatures()
+    {
+        int registers[4] = {};
+
+        __cpuid(registers, 0);
+        const int maximum_leaf = registers[0];
+        if (maximum_leaf < 1)
+        {
+            return;
+        }
+
+        __cpuid(registers, 1);
+        const bool is_osxsave_supported = (registers[2] & (1 << 27)) != 0;
+        const bool is_avx_supported = (registers[2] & (1 << 28)) != 0;
+        const unsigned long long enabled_states =
+            is_osxsave_supported ? _xgetbv(0) : 0;
+        const bool is_ymm_state_enabled = (enabled_states & 0x6) == 0x6;
+        const bool is_zmm_state_enabled = (enabled_states & 0xE6) == 0xE6;
+
+        _is_ssse3_supported = (registers[2] & (1 << 9)) != 0;
+        const bool is_sse41_supported = (registers[2] & (1 << 19)) != 0;
+
+        if (maximum_leaf < 7)
+        {
+            return;
+        }
+
+        __cpuidex(registers, 7, 0);
+        _is_avx2_supported = is_avx_supported && is_ymm_state_enabled &&
+            (registers[1] & (1 << 5)) != 0;
+        _is_sha_supported = _is_ssse3_supported && is_sse41_supported &&
+            (registers[1] & (1 << 29)) != 0;
+        _is_avx512f_supported = _is_avx2_supported && is_zmm_state_enabled &&
+            (registers[1] & (1 << 16)) != 0;
+    }
+
+    CpuFeatures::~CpuFeatures()
+    {
+
+    }
+
+    bool CpuFeatures::is_ssse3_supported()
+    {
+        return _is_ssse3_supported;
+    }
+
+    bool CpuFeatures::is_avx2_supported()
+    {
+        return _is_avx2_supported;
+    }
+
+    bool CpuFeatures::is_sha_supported()
+    {
+        return _is_sha_supported;
+    }
+
+    bool CpuFeatures::is_avx512f_supported()
+    {
+        return _is_avx512f_supported;
+    }
+
+    void CpuFeatures::is_ssse3_supported(
+        Result<bool>& result
+    )
+    {
+        result.set_to_good_status_with_value(_is_ssse3_supported);
+    }
+
+    void CpuFeatures::is_avx2_supported(
+        Result<bool>& result
+    )
+    {
+        result.set_to_good_status_with_value(_is_avx2_supported);
+    }
+
+    void CpuFeatures::is_sha_supported(
+        Result<bool>& result
+    )
+    {
+        result.set_to_good_status_with_value(_is_sha_supported);
+    }
+
+    void CpuFeatures::is_avx512f_supported(
+        Result<bool>& result
+    )
+    {
+        result.set_to_good_status_with_value(_is_avx512f_supported);
+    }
+
+    CpuFeatures& CpuFeatures::get_instance()
+    {
+        static CpuFeatures instance;
+
+        return instance;
+    }
+
+    void CpuFeatures::get_instance(
+        Result<CpuFeatures*>& result
+    )
+    {
+        result.set_to_good_status_with_value(&get_instance());
+    }
+}
@@ -144,22 +144,12 @@ namespace QLogicaeCore
         const size_t& length
     )
     {
-        std::string base64(sodium_base64_encoded_len(
-            length,
-            sodium_base64_VARIANT_ORIGINAL),
-            '\0'
-        );
-        sodium_bin2base64(
-            base64.data(),
-            base64.size(),
-            text,
-            length,
-            sodium_base64_VARIANT_ORIGINAL
-        );
-
-        base64.resize(strlen(base64.data()));
+        std::string base64(
+            EncodingKernels::get_base64_encoded_length(length), '\0');
+        EncodingKernels::encode_base64(
+            std::span<const unsigned char>(text, length), base64);
 
-        result.set_to_good_status_with_value(base64);
+        result.set_to_good_status_with_value(std::move(base64));
     }
 
     std::vector<unsigned char> Encoder::from_base64_to_bytes(
@@ -200,24 +190,16 @@ namespace QLogicaeCore
             );
         }
 
-        std::vector<unsigned char> buffer(text.length());
-        size_t actual_len = 0;
-
-        if (sodium_base642bin(
-            buffer.data(), buffer.size(),
-            text.data(), text.length(),
-            nullptr, &actual_len,
-            nullptr, sodium_base64_VARIANT_ORIGINAL
-        ) != 0)
+        std::vector<unsigned char> buffer(
+            EncodingKernels::get_base64_decoded_length(text));
+        if (!EncodingKernels::decode_base64(text, buffer).has_value())
         {
             return result.set_to_bad_status_without_value(
                 "Encoding failed"
             );
         }
 
-        buffer.resize(actual_len);
-
-        result.set_to_good_status_with_value(buffer);
+        result.set_to_good_status_with_value(std::move(buffer));
     }
 
     std::string Encoder::from_bytes_to_hex(
@@ -254,19 +236,12 @@ namespace QLogicaeCore
         const size_t& length
     )
     {
-        const char* hex_chars = UTILITIES.HEXADECIMAL_CHARACTERSET_1.c_str();
-        std::string output;
-        output.reserve(length * 2);
+        std::string output(
+            EncodingKernels::get_hex_encoded_length(length), '\0');
+        EncodingKernels::encode_hex(
+            std::span<const unsigned char>(text, length), output);
 
-        size_t index = 0;
-        for (index = 0; index < length; ++index)
-        {
-            unsigned char byte = text[index];
-            output.push_back(hex_chars[(byte >> 4) & 0x0F]);
-            output.push_back(hex_chars[byte & 0x0F]);
-        }
-
-        result.set_to_good_status_with_value(output);
+        result.set_to_good_status_with_value(std::move(output));
     }
 
     std::vector<unsigned char> Encoder::from_hex_to_bytes(
@@ -307,18 +282,16 @@ namespace QLogicaeCore
             );
         }
 
-        unsigned int byte;
-        std::string va = text.data();
-        std::vector<unsigned char> bytes;
-        bytes.reserve(text.length() / 2);
-        size_t index = 0, text_length = text.length();
-        for (index = 0; index < text_length; index += 2)
+        std::vector<unsigned char> bytes(
+            EncodingKernels::get_hex_decoded_length(text));
+        if (!EncodingKernels::decode_hex(text, bytes).has_value())
         {
-            std::istringstream(va.substr(index, 2)) >> std::hex >> byte;
-            bytes.push_back(static_cast<unsigned char>(byte));
+            return result.set_to_bad_status_without_value(
+                "Encoding failed"
+            );
         }
 
-        result.set_to_good_status_with_value(bytes);
+        result.set_to_good_status_with_value(std::move(bytes));
     }
 
     std::string Encoder::from_utf16_to_utf8(
@@ -359,22 +332,35 @@ namespace QLogicaeCore
             );
         }
 
+        const std::u16string_view units(
+            reinterpret_cast<const char16_t*>(text.data()),
+            text.size()
+        );
+        std::string data(UnicodeKernels::get_utf8_length(units), 0);
+        const std::optional<std::size_t> size =
+            UnicodeKernels::convert_utf16_to_utf8(units, data);
+        if (size.has_value())
+        {
+            data.resize(*size);
+
+            return result.set_to_good_status_with_value(std::move(data));
+        }
+
         int size_needed = WideCharToMultiByte(
             CP_UTF8, 0,
-            text.data(), -1,
+            text.data(), static_cast<int>(text.size()),
             nullptr, 0,
             nullptr, nullptr
         );
-        std::string data(size_needed, 0);
+        data.assign(size_needed, 0);
         WideCharToMultiByte(
             CP_UTF8, 0,
-            text.data(), -1,
-            &data[0], size_needed,
+            text.data(), static_cast<int>(text.size()),
+            data.data(), size_needed,
             nullptr, nullptr
         );
-        data.pop_back();
 
-        result.set_to_good_status_with_value(data);
+        result.set_to_good_status_with_value(std::move(data));
     }
 
     std::wstring Encoder::from_utf8_to_utf16(
@@ -415,20 +401,119 @@ namespace QLogicaeCore
             );
         }
 
-        unsigned int size_needed = MultiByteToWideChar(
+        std::wstring data(UnicodeKernels::get_utf16_length(text), 0);
+        const std::optional<std::size_t> size =
+            UnicodeKernels::convert_utf8_to_utf16(
+                text,
+                std::span<char16_t>(
+                    reinterpret_cast<char16_t*>(data.data()),
+                    data.size()
+                )
+            );
+        if (size.has_value())
+        {
+            data.resize(*size);
+
+            return result.set_to_good_status_with_value(std::move(data));
+        }
+
+        int size_needed = MultiByteToWideChar(
             CP_UTF8, 0,
-            text.data(), -1,
+            text.data(), static_cast<int>(text.size()),
             nullptr, 0
         );
-        std::wstring data(size_needed, 0);
+        data.assign(size_needed, 0);
         MultiByteToWideChar(
             CP_UTF8, 0,
-            text.data(), -1,
-            &data[0], size_needed
+            text.data(), static_cast<int>(text.size()),
+            data.data(), size_needed
         );
-        data.pop_back();
 
-        result.set_to_good_status_with_value(data);
+        result.set_to_good_status_with_value(std::move(data));
+    }
+
+    void Encoder::from_utf8_to_utf16(
+        Result<std::size_t>& result,
+        const std::string_view& text,
+        std::span<wchar_t> output
+    )
+    {
+        const std::optional<std::size_t> size =
+            UnicodeKernels::convert_utf8_to_utf16(
+                text,
+                std::span<char16_t>(
+                    reinterpret_cast<char16_t*>(output.data()),
+                    output.size()
+                )
+            );
+        if (!size.has_value())
+        {
+            return result.set_to_bad_status_without_value(
+                "Text is not valid UTF-8 or the output is too small"
+            );
+        }
+
+        result.set_to_good_status_with_value(*size);
+    }
+
+    void Encoder::from_utf16_to_utf8(
+        Result<std::size_t>& result,
+        const std::wstring_view& text,
+        std::span<char> output
+    )
+    {
+        const std::optional<std::size_t> size =
+            UnicodeKernels::convert_utf16_to_utf8(
+                std::u16string_view(
+                    reinterpret_cast<const char16_t*>(text.data()),
+                    text.size()
+                ),
+                output
+            );
+        if (!size.has_value())
+        {
+            return result.set_to_bad_status_without_value(
+                "Text is not valid UTF-16 or the output is too small"
+            );
+        }
+
+        result.set_to_good_status_with_value(*size);
+    }
+
+    std::size_t Encoder::get_utf16_length(
+        const std::string_view& text
+    )
+    {
+        return UnicodeKernels::get_utf16_length(text);
+    }
+
+    void Encoder::get_utf16_length(
+        Result<std::size_t>& result,
+        const std::string_view& text
+    )
+    {
+        result.set_to_good_status_with_value(
+            UnicodeKernels::get_utf16_length(text));
+    }
+
+    std::size_t Encoder::get_utf8_length(
+        const std::wstring_view& text
+    )
+    {
+        return UnicodeKernels::get_utf8_length(
+            std::u16string_view(
+                reinterpret_cast<const char16_t*>(text.data()),
+                text.size()
+            )
+        );
+    }
+
+    void Encoder::get_utf8_length(
+        Result<std::size_t>& result,
+        const std::wstring_view& text
+    )
+    {
+        result.set_to_good_status_with_value(get_utf8_length(text));
     }
 
     std::string Encoder::from_utf8_to_hex(
@@ -551,24 +636,17 @@ namespace QLogicaeCore
             );
         }
 
-        size_t bin_len = 0;
-        std::vector<unsigned char> buffer(text.size() / 2, 0);
-
-        if (sodium_hex2bin(
-            buffer.data(), buffer.size(),
-            text.data(), text.size(),
-            nullptr, &bin_len, nullptr) != 0)
+        std::string output(EncodingKernels::get_hex_decoded_length(text), '\0');
+        if (!EncodingKernels::decode_hex(text, std::span<unsigned char>(
+                reinterpret_cast<unsigned char*>(output.data()),
+                output.size())).has_value())
         {
             return result.set_to_bad_status_without_value(
                 "Encoding failed"
             );
         }
 
-        result.set_to_good_status_with_value(
-            std::string(reinterpret_cast<const char*>(
-                buffer.data()), bin_len
-            )
-        );
+        result.set_to_good_status_with_value(std::move(output));
     }
 
     std::string Encoder::from_hex_to_base64(
@@ -654,24 +732,18 @@ namespace QLogicaeCore
             );
         }
 
-        size_t bin_len = 0;
-        std::vector<unsigned char> buffer(text.size(), 0);
-
-        if (sodium_base642bin(buffer.data(), buffer.size(),
-            text.data(), text.size(),
-            nullptr, &bin_len, nullptr,
-            sodium_base64_VARIANT_ORIGINAL) != 0)
+        std::string output(
+            EncodingKernels::get_base64_decoded_length(text), '\0');
+        if (!EncodingKernels::decode_base64(text, std::span<unsigned char>(
+                reinterpret_cast<unsigned char*>(output.data()),
+                output.size())).has_value())
         {
             return result.set_to_bad_status_without_value(
                 "Encoding failed"
             );
         }
 
-        result.set_to_good_status_with_value(
-            std::string(reinterpret_cast<const char*>(
-                buffer.data()), bin_len
-            )
-        );
+        result.set_to_good_status_with_value(std::move(output));
     }
 
     std::string Encoder::from_base64_to_hex(
@@ -739,6 +811,152 @@ namespace QLogicaeCore
         );
     }
 
+    std::size_t Encoder::get_encoded_length(
+        const EncodingType& type,
+        const std::size_t& size
+    )
+    {
+        switch (type)
+        {
+        case EncodingType::HEX:
+            return EncodingKernels::get_hex_encoded_length(size);
+
+        case EncodingType::BASE64:
+            return EncodingKernels::get_base64_encoded_length(size);
+
+        default:
+            return size;
+        }
+    }
+
+    void Encoder::get_encoded_length(
+        Result<std::size_t>& result,
+        const EncodingType& type,
+        const std::size_t& size
+    )
+    {
+        result.set_to_good_status_with_value(
+            get_encoded_length(type, size));
+    }
+
+    std::size_t Encoder::get_decoded_length(
+        const EncodingType& type,
+        const std::string_view& text
+    )
+    {
+        switch (type)
+        {
+        case EncodingType::HEX:
+            return EncodingKernels::get_hex_decoded_length(text);
+
+        case EncodingType::BASE64:
+            return EncodingKernels::get_base64_decoded_length(text);
+
+        default:
+            return text.size();
+        }
+    }
+
+    void Encoder::get_decoded_length(
+        Result<std::size_t>& result,
+        const EncodingType& type,
+        const std::string_view& text
+    )
+    {
+        result.set_to_good_status_with_value(
+            get_decoded_length(type, text));
+    }
+
+    void Encoder::encode_into(
+        Result<std::size_t>& result,
+        const EncodingType& type,
+        std::span<const unsigned char> bytes,
+        std::span<char> output
+    )
+    {
+        if (output.size() < get_encoded_length(type, bytes.size()))
+        {
+            return result.set_to_bad_status_without_value(
+                "Output is too small"
+            );
+        }
+
+        std::optional<std::size_t> size;
+        switch (type)
+        {
+        case EncodingType::HEX:
+            size = EncodingKernels::encode_hex(bytes, output);
+            break;
+
+        case EncodingType::BASE64:
+            size = EncodingKernels::encode_base64(bytes, output);
+            break;
+
+        default:
+            if (UnicodeKernels::is_utf8(std::string_view(
+                    reinterpret_cast<const char*>(bytes.data()),
+                    bytes.size())))
+            {
+                std::memcpy(output.data(), bytes.data(), bytes.size());
+                size = bytes.size();
+            }
+            break;
+        }
+
+        if (!size.has_value())
+        {
+            return result.set_to_bad_status_without_value(
+                "Encoding failed"
+            );
+        }
+
+        result.set_to_good_status_with_value(*size);
+    }
+
+    void Encoder::decode_into(
+        Result<std::size_t>& result,
+        const EncodingType& type,
+        const std::string_view& text,
+        std::span<unsigned char> output
+    )
+    {
+        if (output.size() < get_decoded_length(type, text))
+        {
+            return result.set_to_bad_status_without_value(
+                "Output is too small"
+            );
+        }
+
+        std::optional<std::size_t> size;
+        switch (type)
+        {
+        case EncodingType::HEX:
+            size = EncodingKernels::decode_hex(text, output);
+            break;
+
+        case EncodingType::BASE64:
+            size = EncodingKernels::decode_base64(text, output);
+            break;
+
+        default:
+            if (UnicodeKernels::is_utf8(text))
+            {
+                std::memcpy(output.data(), text.data(), text.size());
+                size = text.size();
+            }
+            break;
+        }
+
+        if (!size.has_value())
+        {
+            return result.set_to_bad_status_without_value(
+                "Encoding failed"
+            );
+        }
+
+        result.set_to_good_status_with_value(*size);
+    }
+
     Encoder& Encoder::get_instance()
     {
         static Encoder instance;
@@ -793,17 +1011,13 @@ namespace QLogicaeCore
             );
         }
 
-        std::string output(text.size() * 3, '\0');
-
-        sodium_bin2hex(output.data(), output.size(),
-            reinterpret_cast<const unsigned char*>(
-                text.data()),
-            text.size());
-        output.resize(std::strlen(output.c_str()));
+        std::string output(
+            EncodingKernels::get_hex_encoded_length(text.size()), '\0');
+        EncodingKernels::encode_hex(std::span<const unsigned char>(
+            reinterpret_cast<const unsigned char*>(text.data()),
+            text.size()), output);
 
-        result.set_to_good_status_with_value(
-            output
-        );
+        result.set_to_good_status_with_value(std::move(output));
     }
 
     std::string Encoder::_to_base64(
@@ -844,20 +1058,12 @@ namespace QLogicaeCore
             );
         }
 
-        std::string output(sodium_base64_encoded_len(
-            text.size(),
-            sodium_base64_VARIANT_ORIGINAL),
-            '\0'
-        );
-
-        sodium_bin2base64(output.data(), output.size(),
-            reinterpret_cast<const unsigned char*>(
-                text.data()), text.size(),
-            sodium_base64_VARIANT_ORIGINAL);
-        output.resize(std::strlen(output.c_str()));
+        std::string output(
+            EncodingKernels::get_base64_encoded_length(text.size()), '\0');
+        EncodingKernels::encode_base64(std::span<const unsigned char>(
+            reinterpret_cast<const unsigned char*>(text.data()),
+            text.size()), output);
 
-        result.set_to_good_status_with_value(
-            output
-        );
+        result.set_to_good_status_with_value(std::move(output));
     }
 }
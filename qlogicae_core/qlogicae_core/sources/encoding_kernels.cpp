@@ -0,0 +1,811 @@
+#include "pch.hpp"
+
+#include "../includes/encoding_kernels.hpp"
+
+#include <immintrin.h>
+
+namespace QLogicaeCore
+{
+    static constexpr unsigned char INVALID_DIGIT = 0xFF;
+
+    static constexpr char HEX_ALPHABET[] = "0123456789abcdef";
+
+    static constexpr char BASE64_ALPHABET[] =
+        "ABCDEFGHIJKLMNOPQRSTUVWXYZabcdefghijklmnopqrstuvwxyz0123456789+/";
+
+    static constexpr std::array<unsigned char, 256> HEX_DIGITS = []()
+        {
+            std::array<unsigned char, 256> digits {};
+            digits.fill(INVALID_DIGIT);
+
+            for (unsigned char index = 0; index < 10; ++index)
+            {
+                digits['0' + index] = index;
+            }
+
+            for (unsigned char index = 0; index < 6; ++index)
+            {
+                digits['a' + index] = 10 + index;
+                digits['A' + index] = 10 + index;
+            }
+
+            return digits;
+        }();
+
+    static constexpr std::array<unsigned char, 256> BASE64_DIGITS = []()
+        {
+            std::array<unsigned char, 256> digits {};
+            digits.fill(INVALID_DIGIT);
+
+            for (unsigned char index = 0; index < 64; ++index)
+            {
+                digits[static_cast<unsigned char>(BASE64_ALPHABET[index])] =
+                    index;
+            }
+
+            return digits;
+        }();
+
+    struct EncodingSse2Block
+    {
+        static constexpr std::size_t SIZE = 16;
+
+        static __m128i match_range(
+            const __m128i block,
+            const char minimum,
+            const char maximum
+        )
+        {
+            const __m128i offset = _mm_sub_epi8(block, _mm_set1_epi8(minimum));
+
+            return _mm_cmpeq_epi8(
+                _mm_min_epu8(offset, _mm_set1_epi8(
+                    static_cast<char>(maximum - minimum))),
+                offset
+            );
+        }
+
+        static __m128i to_hex_characters(
+            const __m128i nibbles
+        )
+        {
+            const __m128i letters = _mm_and_si128(
+                _mm_cmpgt_epi8(nibbles, _mm_set1_epi8(9)),
+                _mm_set1_epi8('a' - '0' - 10)
+            );
+
+            return _mm_add_epi8(nibbles,
+                _mm_add_epi8(_mm_set1_epi8('0'), letters));
+        }
+
+        static bool to_hex_digits(
+            const __m128i block,
+            __m128i& digits
+        )
+        {
+            const __m128i lowered = _mm_or_si128(block, _mm_set1_epi8(0x20));
+            const __m128i decimals = match_range(block, '0', '9');
+            const __m128i letters = match_range(lowered, 'a', 'f');
+
+            digits = _mm_or_si128(
+                _mm_and_si128(decimals,
+                    _mm_sub_epi8(block, _mm_set1_epi8('0'))),
+                _mm_and_si128(letters,
+                    _mm_sub_epi8(lowered, _mm_set1_epi8('a' - 10)))
+            );
+
+            return _mm_movemask_epi8(_mm_or_si128(decimals, letters)) ==
+                0xFFFF;
+        }
+
+        static __m128i merge_hex_digits(
+            const __m128i digits
+        )
+        {
+            return _mm_or_si128(
+                _mm_slli_epi16(_mm_and_si128(digits, _mm_set1_epi16(0x00FF)), 4),
+                _mm_srli_epi16(digits, 8)
+            );
+        }
+
+        static void encode_hex(
+            const unsigned char* input,
+            char* output
+        )
+        {
+            const __m128i block = _mm_loadu_si128(
+                reinterpret_cast<const __m128i*>(input));
+            const __m128i high = to_hex_characters(_mm_and_si128(
+                _mm_srli_epi16(block, 4), _mm_set1_epi8(0x0F)));
+            const __m128i low = to_hex_characters(
+                _mm_and_si128(block, _mm_set1_epi8(0x0F)));
+
+            _mm_storeu_si128(reinterpret_cast<__m128i*>(output),
+                _mm_unpacklo_epi8(high, low));
+            _mm_storeu_si128(reinterpret_cast<__m128i*>(output + SIZE),
+                _mm_unpackhi_epi8(high, low));
+        }
+
+        static bool decode_hex(
+            const char* input,
+            unsigned char* output
+        )
+        {
+            __m128i first;
+            __m128i second;
+            if (!to_hex_digits(_mm_loadu_si128(
+                    reinterpret_cast<const __m128i*>(input)), first) ||
+                !to_hex_digits(_mm_loadu_si128(
+                    reinterpret_cast<const __m128i*>(input + SIZE)), second))
+            {
+                return false;
+            }
+
+            _mm_storeu_si128(reinterpret_cast<__m128i*>(output),
+                _mm_packus_epi16(
+                    merge_hex_digits(first), merge_hex_digits(second)));
+
+            return true;
+        }
+    };
+
+    struct EncodingSsse3Block :
+        public EncodingSse2Block
+    {
+        static constexpr std::size_t BASE64_ENCODE_INPUT_SIZE = 12;
+
+        static constexpr std::size_t BASE64_ENCODE_LOAD_SIZE = 16;
+
+        static constexpr std::size_t BASE64_DECODE_INPUT_SIZE = 16;
+
+        static __m128i to_base64_indices(
+            const __m128i block
+        )
+        {
+            const __m128i shuffled = _mm_shuffle_epi8(block, _mm_set_epi8(
+                10, 11, 9, 10, 7, 8, 6, 7, 4, 5, 3, 4, 1, 2, 0, 1));
+            const __m128i high = _mm_mulhi_epu16(
+                _mm_and_si128(shuffled, _mm_set1_epi32(0x0FC0FC00)),
+                _mm_set1_epi32(0x04000040));
+            const __m128i low = _mm_mullo_epi16(
+                _mm_and_si128(shuffled, _mm_set1_epi32(0x003F03F0)),
+                _mm_set1_epi32(0x01000010));
+
+            return _mm_or_si128(high, low);
+        }
+
+        static __m128i to_base64_characters(
+            const __m128i indices
+        )
+        {
+            __m128i offsets = _mm_subs_epu8(indices, _mm_set1_epi8(51));
+            offsets = _mm_or_si128(offsets, _mm_and_si128(
+                _mm_cmpgt_epi8(_mm_set1_epi8(26), indices),
+                _mm_set1_epi8(13)));
+
+            const __m128i shifts = _mm_setr_epi8(
+                'a' - 26, '0' - 52, '0' - 52, '0' - 52, '0' - 52, '0' - 52,
+                '0' - 52, '0' - 52, '0' - 52, '0' - 52, '0' - 52, '+' - 62,
+                '/' - 63, 'A', 0, 0);
+
+            return _mm_add_epi8(_mm_shuffle_epi8(shifts, offsets), indices);
+        }
+
+        static bool to_base64_digits(
+            __m128i& block
+        )
+        {
+            const __m128i mask = _mm_set1_epi8(0x2F);
+            const __m128i high_nibbles =
+                _mm_and_si128(_mm_srli_epi32(block, 4), mask);
+            const __m128i low_nibbles = _mm_and_si128(block, mask);
+            const __m128i high = _mm_shuffle_epi8(_mm_setr_epi8(
+                0x10, 0x10, 0x01, 0x02, 0x04, 0x08, 0x04, 0x08,
+                0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10), high_nibbles);
+            const __m128i low = _mm_shuffle_epi8(_mm_setr_epi8(
+                0x15, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
+                0x11, 0x11, 0x13, 0x1A, 0x1B, 0x1B, 0x1B, 0x1A), low_nibbles);
+
+            if (_mm_movemask_epi8(_mm_cmpeq_epi8(
+                    _mm_and_si128(high, low), _mm_setzero_si128())) != 0xFFFF)
+            {
+                return false;
+            }
+
+            const __m128i rolls = _mm_shuffle_epi8(_mm_setr_epi8(
+                0, 16, 19, 4, -65, -65, -71, -71, 0, 0, 0, 0, 0, 0, 0, 0),
+                _mm_add_epi8(_mm_cmpeq_epi8(block, mask), high_nibbles));
+            block = _mm_add_epi8(block, rolls);
+
+            return true;
+        }
+
+        static __m128i pack_base64_digits(
+            const __m128i digits
+        )
+        {
+            const __m128i merged = _mm_madd_epi16(
+                _mm_maddubs_epi16(digits, _mm_set1_epi32(0x01400140)),
+                _mm_set1_epi32(0x00011000));
+
+            return _mm_shuffle_epi8(merged, _mm_setr_epi8(
+                2, 1, 0, 6, 5, 4, 10, 9, 8, 14, 13, 12, -1, -1, -1, -1));
+        }
+
+        static void encode_base64(
+            const unsigned char* input,
+            char* output
+        )
+        {
+            _mm_storeu_si128(reinterpret_cast<__m128i*>(output),
+                to_base64_characters(to_base64_indices(_mm_loadu_si128(
+                    reinterpret_cast<const __m128i*>(input)))));
+        }
+
+        static bool decode_base64(
+            const char* input,
+            unsigned char* output
+        )
+        {
+            __m128i block = _mm_loadu_si128(
+                reinterpret_cast<const __m128i*>(input));
+            if (!to_base64_digits(block))
+            {
+                return false;
+            }
+
+            alignas(16) unsigned char buffer[16];
+            _mm_store_si128(reinterpret_cast<__m128i*>(buffer),
+                pack_base64_digits(block));
+            std::memcpy(output, buffer, 12);
+
+            return true;
+        }
+    };
+
+    struct EncodingAvx2Block
+    {
+        static constexpr std::size_t SIZE = 32;
+
+        static constexpr std::size_t BASE64_ENCODE_INPUT_SIZE = 24;
+
+        static constexpr std::size_t BASE64_ENCODE_LOAD_SIZE = 28;
+
+        static constexpr std::size_t BASE64_DECODE_INPUT_SIZE = 32;
+
+        static __m256i match_range(
+            const __m256i block,
+            const char minimum,
+            const char maximum
+        )
+        {
+            const __m256i offset =
+                _mm256_sub_epi8(block, _mm256_set1_epi8(minimum));
+
+            return _mm256_cmpeq_epi8(
+                _mm256_min_epu8(offset, _mm256_set1_epi8(
+                    static_cast<char>(maximum - minimum))),
+                offset
+            );
+        }
+
+        static __m256i to_hex_characters(
+            const __m256i nibbles
+        )
+        {
+            const __m256i letters = _mm256_and_si256(
+                _mm256_cmpgt_epi8(nibbles, _mm256_set1_epi8(9)),
+                _mm256_set1_epi8('a' - '0' - 10)
+            );
+
+            return _mm256_add_epi8(nibbles,
+                _mm256_add_epi8(_mm256_set1_epi8('0'), letters));
+        }
+
+        static bool to_hex_digits(
+            const __m256i block,
+            __m256i& digits
+        )
+        {
+            const __m256i lowered =
+                _mm256_or_si256(block, _mm256_set1_epi8(0x20));
+            const __m256i decimals = match_range(block, '0', '9');
+            const __m256i letters = match_range(lowered, 'a', 'f');
+
+            digits = _mm256_or_si256(
+                _mm256_and_si256(decimals,
+                    _mm256_sub_epi8(block, _mm256_set1_epi8('0'))),
+                _mm256_and_si256(letters,
+                    _mm256_sub_epi8(lowered, _mm256_set1_epi8('a' - 10)))
+            );
+
+            return static_cast<uint32_t>(_mm256_movemask_epi8(
+                _mm256_or_si256(decimals, letters))) == 0xFFFFFFFF;
+        }
+
+        static __m256i merge_hex_digits(
+            const __m256i digits
+        )
+        {
+            return _mm256_or_si256(
+                _mm256_slli_epi16(_mm256_and_si256(
+                    digits, _mm256_set1_epi16(0x00FF)), 4),
+                _mm256_srli_epi16(digits, 8)
+            );
+        }
+
+        static void encode_hex(
+            const unsigned char* input,
+            char* output
+        )
+        {
+            const __m256i block = _mm256_loadu_si256(
+                reinterpret_cast<const __m256i*>(input));
+            const __m256i high = to_hex_characters(_mm256_and_si256(
+                _mm256_srli_epi16(block, 4), _mm256_set1_epi8(0x0F)));
+            const __m256i low = to_hex_characters(
+                _mm256_and_si256(block, _mm256_set1_epi8(0x0F)));
+            const __m256i first = _mm256_unpacklo_epi8(high, low);
+            const __m256i second = _mm256_unpackhi_epi8(high, low);
+
+            _mm256_storeu_si256(reinterpret_cast<__m256i*>(output),
+                _mm256_permute2x128_si256(first, second, 0x20));
+            _mm256_storeu_si256(reinterpret_cast<__m256i*>(output + SIZE),
+                _mm256_permute2x128_si256(first, second, 0x31));
+        }
+
+        static bool decode_hex(
+            const char* input,
+            unsigned char* output
+        )
+        {
+            __m256i first;
+            __m256i second;
+            if (!to_hex_digits(_mm256_loadu_si256(
+                    reinterpret_cast<const __m256i*>(input)), first) ||
+                !to_hex_digits(_mm256_loadu_si256(
+                    reinterpret_cast<const __m256i*>(input + SIZE)), second))
+            {
+                return false;
+            }
+
+            _mm256_storeu_si256(reinterpret_cast<__m256i*>(output),
+                _mm256_permute4x64_epi64(_mm256_packus_epi16(
+                    merge_hex_digits(first), merge_hex_digits(second)), 0xD8));
+
+            return true;
+        }
+
+        static __m256i to_base64_indices(
+            const __m256i block
+        )
+        {
+            const __m256i shuffled = _mm256_shuffle_epi8(block, _mm256_set_epi8(
+                10, 11, 9, 10, 7, 8, 6, 7, 4, 5, 3, 4, 1, 2, 0, 1,
+                10, 11, 9, 10, 7, 8, 6, 7, 4, 5, 3, 4, 1, 2, 0, 1));
+            const __m256i high = _mm256_mulhi_epu16(
+                _mm256_and_si256(shuffled, _mm256_set1_epi32(0x0FC0FC00)),
+                _mm256_set1_epi32(0x04000040));
+            const __m256i low = _mm256_mullo_epi16(
+                _mm256_and_si256(shuffled, _mm256_set1_epi32(0x003F03F0)),
+                _mm256_set1_epi32(0x01000010));
+
+            return _mm256_or_si256(high, low);
+        }
+
+        static __m256i to_base64_characters(
+            const __m256i indices
+        )
+        {
+            __m256i offsets = _mm256_subs_epu8(indices, _mm256_set1_epi8(51));
+            offsets = _mm256_or_si256(offsets, _mm256_and_si256(
+                _mm256_cmpgt_epi8(_mm256_set1_epi8(26), indices),
+                _mm256_set1_epi8(13)));
+
+            const __m256i shifts = _mm256_setr_epi8(
+                'a' - 26, '0' - 52, '0' - 52, '0' - 52, '0' - 52, '0' - 52,
+                '0' - 52, '0' - 52, '0' - 52, '0' - 52, '0' - 52, '+' - 62,
+                '/' - 63, 'A', 0, 0,
+                'a' - 26, '0' - 52, '0' - 52, '0' - 52, '0' - 52, '0' - 52,
+                '0' - 52, '0' - 52, '0' - 52, '0' - 52, '0' - 52, '+' - 62,
+                '/' - 63, 'A', 0, 0);
+
+            return _mm256_add_epi8(
+                _mm256_shuffle_epi8(shifts, offsets), indices);
+        }
+
+        static bool to_base64_digits(
+            __m256i& block
+        )
+        {
+            const __m256i mask = _mm256_set1_epi8(0x2F);
+            const __m256i high_nibbles =
+                _mm256_and_si256(_mm256_srli_epi32(block, 4), mask);
+            const __m256i low_nibbles = _mm256_and_si256(block, mask);
+            const __m256i high = _mm256_shuffle_epi8(_mm256_setr_epi8(
+                0x10, 0x10, 0x01, 0x02, 0x04, 0x08, 0x04, 0x08,
+                0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10,
+                0x10, 0x10, 0x01, 0x02, 0x04, 0x08, 0x04, 0x08,
+                0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10), high_nibbles);
+            const __m256i low = _mm256_shuffle_epi8(_mm256_setr_epi8(
+                0x15, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
+                0x11, 0x11, 0x13, 0x1A, 0x1B, 0x1B, 0x1B, 0x1A,
+                0x15, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
+                0x11, 0x11, 0x13, 0x1A, 0x1B, 0x1B, 0x1B, 0x1A), low_nibbles);
+
+            if (!_mm256_testz_si256(high, low))
+            {
+                return false;
+            }
+
+            const __m256i rolls = _mm256_shuffle_epi8(_mm256_setr_epi8(
+                0, 16, 19, 4, -65, -65, -71, -71, 0, 0, 0, 0, 0, 0, 0, 0,
+                0, 16, 19, 4, -65, -65, -71, -71, 0, 0, 0, 0, 0, 0, 0, 0),
+                _mm256_add_epi8(_mm256_cmpeq_epi8(block, mask), high_nibbles));
+            block = _mm256_add_epi8(block, rolls);
+
+            return true;
+        }
+
+        static void encode_base64(
+            const unsigned char* input,
+            char* output
+        )
+        {
+            const __m256i block = _mm256_set_m128i(
+                _mm_loadu_si128(reinterpret_cast<const __m128i*>(input + 12)),
+                _mm_loadu_si128(reinterpret_cast<const __m128i*>(input)));
+
+            _mm256_storeu_si256(reinterpret_cast<__m256i*>(output),
+                to_base64_characters(to_base64_indices(block)));
+        }
+
+        static bool decode_base64(
+            const char* input,
+            unsigned char* output
+        )
+        {
+            __m256i block = _mm256_loadu_si256(
+                reinterpret_cast<const __m256i*>(input));
+            if (!to_base64_digits(block))
+            {
+                return false;
+            }
+
+            const __m256i merged = _mm256_madd_epi16(
+                _mm256_maddubs_epi16(block, _mm256_set1_epi32(0x01400140)),
+                _mm256_set1_epi32(0x00011000));
+            const __m256i packed = _mm256_permutevar8x32_epi32(
+                _mm256_shuffle_epi8(merged, _mm256_setr_epi8(
+                    2, 1, 0, 6, 5, 4, 10, 9, 8, 14, 13, 12, -1, -1, -1, -1,
+                    2, 1, 0, 6, 5, 4, 10, 9, 8, 14, 13, 12, -1, -1, -1, -1)),
+                _mm256_setr_epi32(0, 1, 2, 4, 5, 6, 7, 7));
+
+            alignas(32) unsigned char buffer[32];
+            _mm256_store_si256(reinterpret_cast<__m256i*>(buffer), packed);
+            std::memcpy(output, buffer, 24);
+
+            return true;
+        }
+    };
+
+    template<typename Block>
+    static std::size_t encode_hex_blocks(
+        const std::span<const unsigned char> bytes,
+        std::span<char> output
+    )
+    {
+        std::size_t index = 0;
+        for (; index + Block::SIZE <= bytes.size(); index += Block::SIZE)
+        {
+            Block::encode_hex(bytes.data() + index, output.data() + index * 2);
+        }
+
+        for (; index < bytes.size(); ++index)
+        {
+            output[index * 2] = HEX_ALPHABET[bytes[index] >> 4];
+            output[index * 2 + 1] = HEX_ALPHABET[bytes[index] & 0x0F];
+        }
+
+        return bytes.size() * 2;
+    }
+
+    template<typename Block>
+    static std::optional<std::size_t> decode_hex_blocks(
+        const std::string_view text,
+        std::span<unsigned char> output
+    )
+    {
+        const std::size_t size = text.size() / 2;
+
+        std::size_t index = 0;
+        for (; index + Block::SIZE <= size; index += Block::SIZE)
+        {
+            if (!Block::decode_hex(text.data() + index * 2,
+                    output.data() + index))
+            {
+                return std::nullopt;
+            }
+        }
+
+        for (; index < size; ++index)
+        {
+            const unsigned char high =
+                HEX_DIGITS[static_cast<unsigned char>(text[index * 2])];
+            const unsigned char low =
+                HEX_DIGITS[static_cast<unsigned char>(text[index * 2 + 1])];
+            if (((high | low) & 0xF0) != 0)
+            {
+                return std::nullopt;
+            }
+
+            output[index] = static_cast<unsigned char>((high << 4) | low);
+        }
+
+        return size;
+    }
+
+    static std::size_t encode_base64_scalar(
+        const std::span<const unsigned char> bytes,
+        std::size_t input_index,
+        std::span<char> output,
+        std::size_t output_index
+    )
+    {
+        for (; input_index + 3 <= bytes.size(); input_index += 3)
+        {
+            const uint32_t group =
+                (static_cast<uint32_t>(bytes[input_index]) << 16) |
+                (static_cast<uint32_t>(bytes[input_index + 1]) << 8) |
+                static_cast<uint32_t>(bytes[input_index + 2]);
+
+            output[output_index++] = BASE64_ALPHABET[(group >> 18) & 0x3F];
+            output[output_index++] = BASE64_ALPHABET[(group >> 12) & 0x3F];
+            output[output_index++] = BASE64_ALPHABET[(group >> 6) & 0x3F];
+            output[output_index++] = BASE64_ALPHABET[group & 0x3F];
+        }
+
+        const std::size_t remainder = bytes.size() - input_index;
+        if (remainder != 0)
+        {
+            uint32_t group = static_cast<uint32_t>(bytes[input_index]) << 16;
+            if (remainder == 2)
+            {
+                group |= static_cast<uint32_t>(bytes[input_index + 1]) << 8;
+            }
+
+            output[output_index++] = BASE64_ALPHABET[(group >> 18) & 0x3F];
+            output[output_index++] = BASE64_ALPHABET[(group >> 12) & 0x3F];
+            output[output_index++] = (remainder == 2) ?
+                BASE64_ALPHABET[(group >> 6) & 0x3F] : '=';
+            output[output_index++] = '=';
+        }
+
+        return output_index;
+    }
+
+    template<typename Block>
+    static std::size_t encode_base64_blocks(
+        const std::span<const unsigned char> bytes,
+        std::span<char> output
+    )
+    {
+        std::size_t input_index = 0;
+        std::size_t output_index = 0;
+        for (; input_index + Block::BASE64_ENCODE_LOAD_SIZE <= bytes.size();
+            input_index += Block::BASE64_ENCODE_INPUT_SIZE)
+        {
+            Block::encode_base64(bytes.data() + input_index,
+                output.data() + output_index);
+            output_index += Block::BASE64_ENCODE_INPUT_SIZE / 3 * 4;
+        }
+
+        return encode_base64_scalar(bytes, input_index, output, output_index);
+    }
+
+    static std::optional<std::size_t> decode_base64_scalar(
+        const std::string_view text,
+        std::size_t input_index,
+        std::span<unsigned char> output,
+        std::size_t output_index
+    )
+    {
+        for (; input_index + 4 <= text.size(); input_index += 4)
+        {
+            const bool is_last = input_index + 4 == text.size();
+            const std::size_t padding = !is_last ? 0 :
+                (text[input_index + 3] != '=') ? 0 :
+                (text[input_index + 2] != '=') ? 1 : 2;
+
+            uint32_t group = 0;
+            for (std::size_t offset = 0; offset < 4 - padding; ++offset)
+            {
+                const unsigned char digit = BASE64_DIGITS[
+                    static_cast<unsigned char>(text[input_index + offset])];
+                if (digit == INVALID_DIGIT)
+                {
+                    return std::nullopt;
+                }
+
+                group |= static_cast<uint32_t>(digit) << (18 - offset * 6);
+            }
+
+            if ((padding == 1 && (group & 0xFF) != 0) ||
+                (padding == 2 && (group & 0xFFFF) != 0))
+            {
+                return std::nullopt;
+            }
+
+            output[output_index++] = static_cast<unsigned char>(group >> 16);
+            if (padding < 2)
+            {
+                output[output_index++] = static_cast<unsigned char>(group >> 8);
+            }
+
+            if (padding < 1)
+            {
+                output[output_index++] = static_cast<unsigned char>(group);
+            }
+        }
+
+        return output_index;
+    }
+
+    template<typename Block>
+    static std::optional<std::size_t> decode_base64_blocks(
+        const std::string_view text,
+        std::span<unsigned char> output
+    )
+    {
+        const std::size_t body_size = text.size() - 4;
+
+        std::size_t input_index = 0;
+        std::size_t output_index = 0;
+        for (; input_index + Block::BASE64_DECODE_INPUT_SIZE <= body_size;
+            input_index += Block::BASE64_DECODE_INPUT_SIZE)
+        {
+            if (!Block::decode_base64(text.data() + input_index,
+                    output.data() + output_index))
+            {
+                return std::nullopt;
+            }
+
+            output_index += Block::BASE64_DECODE_INPUT_SIZE / 4 * 3;
+        }
+
+        return decode_base64_scalar(text, input_index, output, output_index);
+    }
+
+    std::size_t EncodingKernels::get_hex_encoded_length(
+        const std::size_t size
+    )
+    {
+        return size * 2;
+    }
+
+    std::size_t EncodingKernels::get_hex_decoded_length(
+        const std::string_view text
+    )
+    {
+        return text.size() / 2;
+    }
+
+    std::size_t EncodingKernels::get_base64_encoded_length(
+        const std::size_t size
+    )
+    {
+        return (size + 2) / 3 * 4;
+    }
+
+    std::size_t EncodingKernels::get_base64_decoded_length(
+        const std::string_view text
+    )
+    {
+        std::size_t size = text.size() / 4 * 3;
+        if (text.size() % 4 != 0 || text.empty())
+        {
+            return size;
+        }
+
+        if (text[text.size() - 1] == '=')
+        {
+            --size;
+        }
+
+        if (text[text.size() - 2] == '=')
+        {
+            --size;
+        }
+
+        return size;
+    }
+
+    std::optional<std::size_t> EncodingKernels::encode_hex(
+        const std::span<const unsigned char> bytes,
+        std::span<char> output
+    )
+    {
+        if (output.size() < get_hex_encoded_length(bytes.size()))
+        {
+            return std::nullopt;
+        }
+
+        if (CPU_FEATURES.is_avx2_supported())
+        {
+            return encode_hex_blocks<EncodingAvx2Block>(bytes, output);
+        }
+
+        return encode_hex_blocks<EncodingSse2Block>(bytes, output);
+    }
+
+    std::optional<std::size_t> EncodingKernels::decode_hex(
+        const std::string_view text,
+        std::span<unsigned char> output
+    )
+    {
+        if (text.size() % 2 != 0 ||
+            output.size() < get_hex_decoded_length(text))
+        {
+            return std::nullopt;
+        }
+
+        if (CPU_FEATURES.is_avx2_supported())
+        {
+            return decode_hex_blocks<EncodingAvx2Block>(text, output);
+        }
+
+        return decode_hex_blocks<EncodingSse2Block>(text, output);
+    }
+
+    std::optional<std::size_t> EncodingKernels::encode_base64(
+        const std::span<const unsigned char> bytes,
+        std::span<char> output
+    )
+    {
+        if (output.size() < get_base64_encoded_length(bytes.size()))
+        {
+            return std::nullopt;
+        }
+
+        if (CPU_FEATURES.is_avx2_supported())
+        {
+            return encode_base64_blocks<EncodingAvx2Block>(bytes, output);
+        }
+
+        if (CPU_FEATURES.is_ssse3_supported())
+        {
+            return encode_base64_blocks<EncodingSsse3Block>(bytes, output);
+        }
+
+        return encode_base64_scalar(bytes, 0, output, 0);
+    }
+
+    std::optional<std::size_t> EncodingKernels::decode_base64(
+        const std::string_view text,
+        std::span<unsigned char> output
+    )
+    {
+        if (text.size() % 4 != 0 ||
+            output.size() < get_base64_decoded_length(text))
+        {
+            return std::nullopt;
+        }
+
+        if (text.empty())
+        {
+            return 0;
+        }
+
+        if (CPU_FEATURES.is_avx2_supported())
+        {
+            return decode_base64_blocks<EncodingAvx2Block>(text, output);
+        }
+
+        if (CPU_FEATURES.is_ssse3_supported())
+        {
+            return decode_base64_blocks<EncodingSsse3Block>(text, output);
+        }
+
+        return decode_base64_scalar(text, 0, output, 0);
+    }
+}
@@ -99,17 +99,18 @@ namespace QLogicaeCore
                 return "";
             }
 
-            std::ostringstream output_buffer;
-            output_buffer << input_file.rdbuf();
-            std::string raw_data = output_buffer.str();
-
-            return std::string() +
-                "data:" +
-                _mimetype.data() +
-                ";base64," +
-                "AKLOMP_ENCODED(" +
-                raw_data +
-                ")";
+            Result<std::string> result;
+            _encode_data_uri(result, input_file);
+            if (result.is_status_bad())
+            {
+                throw std::runtime_error(
+                    std::string() +
+                    "Exception at FileUriIO::generate_data_uri(): " +
+                    result.get_message()
+                );
+            }
+
+            return result.get_value();
         }
         catch (const std::exception& exception)
         {
@@ -158,19 +159,7 @@ namespace QLogicaeCore
             );
         }
 
-        std::ostringstream output_buffer;
-        output_buffer << input_file.rdbuf();
-        std::string raw_data = output_buffer.str();
-
-        result.set_to_good_status_with_value(
-            std::string() +
-            "data:" +
-            _mimetype.data() +
-            ";base64," +
-            "AKLOMP_ENCODED(" +
-            raw_data +
-            ")"
-        );
+        _encode_data_uri(result, input_file);
     }
 
     void FileUriIO::generate_data_uri_async(
@@ -225,4 +214,45 @@ namespace QLogicaeCore
 
         result.set_to_good_status_without_value();
     }
+
+    void FileUriIO::_encode_data_uri(
+        Result<std::string>& result,
+        std::ifstream& input_file
+    )
+    {
+        std::vector<unsigned char> raw_data(
+            std::filesystem::file_size(_file_path));
+        input_file.read(
+            reinterpret_cast<char*>(raw_data.data()),
+            static_cast<std::streamsize>(raw_data.size())
+        );
+        raw_data.resize(static_cast<std::size_t>(input_file.gcount()));
+
+        const std::size_t encoded_size = ENCODER.get_encoded_length(
+            EncodingType::BASE64, raw_data.size());
+
+        std::string data_uri;
+        data_uri.reserve(5 + _mimetype.size() + 8 + encoded_size);
+        data_uri.append("data:").append(_mimetype).append(";base64,");
+
+        const std::size_t offset = data_uri.size();
+        data_uri.resize(offset + encoded_size);
+
+        Result<std::size_t> encode_result;
+        ENCODER.encode_into(
+            encode_result,
+            EncodingType::BASE64,
+            raw_data,
+            std::span<char>(data_uri.data() + offset, encoded_size)
+        );
+        if (encode_result.is_status_bad())
+        {
+            return result.set_to_bad_status_without_value(
+                "Encoding failed"
+            );
+        }
+
+        data_uri.resize(offset + encode_result.get_value());
+        result.set_to_good_status_with_value(std::move(data_uri));
+    }
 }
@@ -4,6 +4,30 @@
 
 namespace QLogicaeCore
 {
+    static constexpr std::size_t RANDOM_DRAW_BLOCK_SIZE = 256;
+
+    static constexpr char UUID_HEX_DIGITS[] = "0123456789abcdef";
+
+    static void write_uuid4(
+        unsigned char* bytes,
+        char* output
+    )
+    {
+        bytes[6] = static_cast<unsigned char>((bytes[6] & 0x0F) | 0x40);
+        bytes[8] = static_cast<unsigned char>((bytes[8] & 0x3F) | 0x80);
+
+        for (std::size_t index = 0; index < 16; ++index)
+        {
+            if (index == 4 || index == 6 || index == 8 || index == 10)
+            {
+                *output++ = '-';
+            }
+
+            *output++ = UUID_HEX_DIGITS[bytes[index] >> 4];
+            *output++ = UUID_HEX_DIGITS[bytes[index] & 0x0F];
+        }
+    }
+
     Generator::Generator()
     {
         static const int status = sodium_init();
@@ -317,12 +341,70 @@ namespace QLogicaeCore
         Result<std::string>& result
     )
     {
-        thread_local uuids::uuid_random_generator uuid_generator(
-            _random_m19937()
+        unsigned char bytes[16];
+        _random_engine().fill(bytes);
+
+        std::string content(36, '\0');
+        write_uuid4(bytes, content.data());
+
+        result.set_to_good_status_with_value(
+            std::move(content)
         );
+    }
+
+    std::vector<std::string> Generator::random_uuid4_batch(
+        const size_t& count
+    )
+    {
+        try
+        {
+            Result<std::vector<std::string>> result;
+
+            random_uuid4_batch(
+                result,
+                count
+            );
+
+            return result.get_value();
+        }
+        catch (const std::exception& exception)
+        {
+            LOGGER.handle_exception_async(
+                "QLogicaeCore::Generator::random_uuid4_batch()",
+                exception.what()
+            );
+
+            return {};
+        }
+    }
+
+    void Generator::random_uuid4_batch(
+        Result<std::vector<std::string>>& result,
+        const size_t& count
+    )
+    {
+        Xoshiro256PlusPlus& random_engine = _random_engine();
+        std::array<unsigned char, RANDOM_DRAW_BLOCK_SIZE * 16> bytes;
+        std::vector<std::string> content(count, std::string(36, '\0'));
+
+        for (std::size_t offset = 0; offset < count;
+            offset += RANDOM_DRAW_BLOCK_SIZE)
+        {
+            const std::size_t size =
+                std::min(RANDOM_DRAW_BLOCK_SIZE, count - offset);
+            random_engine.fill(std::span(bytes.data(), size * 16));
+
+            for (std::size_t index = 0; index < size; ++index)
+            {
+                write_uuid4(
+                    bytes.data() + index * 16,
+                    content[offset + index].data()
+                );
+            }
+        }
 
         result.set_to_good_status_with_value(
-            uuids::to_string(uuid_generator())
+            std::move(content)
         );
     }
 
@@ -403,7 +485,7 @@ namespace QLogicaeCore
         result.set_to_good_status_with_value(
             std::bernoulli_distribution(
                 true_probability
-            )(_random_m19937())
+            )(_random_engine())
         );
     }
 
@@ -494,20 +576,90 @@ namespace QLogicaeCore
             );
         }
 
-        std::string content;
-        content.reserve(length);
+        std::string content(length, '\0');
+        Result<void> void_result;
 
-        std::mt19937& random_engine = _random_m19937();
+        random_string_into(
+            void_result,
+            content,
+            character_set
+        );
 
-        std::uniform_int_distribution<std::size_t> distribution(
-            0, character_set.size() - 1);
+        result.set_to_good_status_with_value(std::move(content));
+    }
 
-        for (std::size_t index = 0; index < length; ++index)
+    bool Generator::random_string_into(
+        std::span<char> buffer,
+        const std::string_view& character_set,
+        const bool& is_cryptographically_secure
+    )
+    {
+        try
         {
-            content += character_set[distribution(random_engine)];
+            Result<void> result;
+
+            random_string_into(
+                result,
+                buffer,
+                character_set,
+                is_cryptographically_secure
+            );
+
+            return result.is_status_safe();
         }
+        catch (const std::exception& exception)
+        {
+            LOGGER.handle_exception_async(
+                "QLogicaeCore::Generator::random_string_into()",
+                exception.what()
+            );
 
-        result.set_to_good_status_with_value(content);
+            return false;
+        }
+    }
+
+    void Generator::random_string_into(
+        Result<void>& result,
+        std::span<char> buffer,
+        const std::string_view& character_set,
+        const bool& is_cryptographically_secure
+    )
+    {
+        if (character_set.empty() ||
+            character_set.size() > std::numeric_limits<std::uint32_t>::max())
+        {
+            return result.set_to_bad_status_without_value(
+                "Character set is empty or too large"
+            );
+        }
+
+        const std::uint64_t character_set_size = character_set.size();
+        std::array<std::uint32_t, RANDOM_DRAW_BLOCK_SIZE> draws;
+
+        for (std::size_t offset = 0; offset < buffer.size();
+            offset += draws.size())
+        {
+            const std::size_t size =
+                std::min(draws.size(), buffer.size() - offset);
+            Result<void> bytes_result;
+            random_bytes_into(
+                bytes_result,
+                std::span<unsigned char>(
+                    reinterpret_cast<unsigned char*>(draws.data()),
+                    size * sizeof(std::uint32_t)
+                ),
+                is_cryptographically_secure
+            );
+
+            for (std::size_t index = 0; index < size; ++index)
+            {
+                buffer[offset + index] = character_set[
+                    (draws[index] * character_set_size) >> 32
+                ];
+            }
+        }
+
+        result.set_to_good_status_without_value();
     }
 
     int Generator::random_int(
@@ -553,7 +705,7 @@ namespace QLogicaeCore
 
         result.set_to_good_status_with_value(
             std::uniform_int_distribution<int>(
-                minimum, maximum)(_random_m19937())
+                minimum, maximum)(_random_engine())
         );
     }
 
@@ -600,7 +752,7 @@ namespace QLogicaeCore
 
         result.set_to_good_status_with_value(
             std::uniform_real_distribution<double>(
-                minimum, maximum)(_random_m19937())
+                minimum, maximum)(_random_engine())
         );
     }
 
@@ -645,6 +797,52 @@ namespace QLogicaeCore
         result.set_to_good_status_without_value();
     }
 
+    bool Generator::random_bytes_into(
+        std::span<unsigned char> buffer,
+        const bool& is_cryptographically_secure
+    )
+    {
+        try
+        {
+            Result<void> result;
+
+            random_bytes_into(
+                result,
+                buffer,
+                is_cryptographically_secure
+            );
+
+            return result.is_status_safe();
+        }
+        catch (const std::exception& exception)
+        {
+            LOGGER.handle_exception_async(
+                "QLogicaeCore::Generator::random_bytes_into()",
+                exception.what()
+            );
+
+            return false;
+        }
+    }
+
+    void Generator::random_bytes_into(
+        Result<void>& result,
+        std::span<unsigned char> buffer,
+        const bool& is_cryptographically_secure
+    )
+    {
+        if (is_cryptographically_secure)
+        {
+            randombytes_buf(buffer.data(), buffer.size());
+        }
+        else
+        {
+            _random_engine().fill(buffer);
+        }
+
+        result.set_to_good_status_without_value();
+    }
+
     Generator& Generator::get_instance()
     {
         static Generator get_instance;
@@ -661,12 +859,15 @@ namespace QLogicaeCore
         result.set_to_good_status_with_value(&instance);
     }
 
-    std::mt19937& Generator::_random_m19937()
+    Xoshiro256PlusPlus& Generator::_random_engine()
     {
-        static thread_local std::mt19937 generator
-        {
-            std::random_device{}()
-        };
+        static thread_local Xoshiro256PlusPlus generator = []()
+            {
+                std::uint64_t seed;
+                randombytes_buf(&seed, sizeof(seed));
+
+                return Xoshiro256PlusPlus(seed);
+            }();
 
         return generator;
     }
@@ -4,6 +4,30 @@
 
 namespace QLogicaeCore
 {
+    static ConcurrentCache<
+        std::string,
+        std::shared_ptr<const JsonFileIODocument>
+    >& get_json_file_io_documents()
+    {
+        static ConcurrentCache<
+            std::string,
+            std::shared_ptr<const JsonFileIODocument>
+        > documents(
+            {
+                .shard_count = 8,
+                .maximum_weight = 67108864
+            },
+            [](const std::string& file_path,
+                const std::shared_ptr<const JsonFileIODocument>& document)
+            {
+                return file_path.size() +
+                    static_cast<std::size_t>(document->size);
+            }
+        );
+
+        return documents;
+    }
+
     JsonFileIO::JsonFileIO()
     {
 
@@ -147,8 +171,12 @@ namespace QLogicaeCore
 
         try
         {
-            fast_io::obuf_file writer{ _file_path };
-            fast_io::io::print(writer, content);
+            {
+                fast_io::obuf_file writer{ _file_path };
+                fast_io::io::print(writer, content);
+            }
+
+            _invalidate_document();
 
             return true;
         }
@@ -187,6 +215,52 @@ namespace QLogicaeCore
         return buffer.GetString();
     }
 
+    std::shared_ptr<const JsonFileIODocument> JsonFileIO::_get_document()
+    {
+        std::error_code error_code;
+        const std::filesystem::file_time_type last_write_time =
+            std::filesystem::last_write_time(_file_path, error_code);
+        if (error_code)
+        {
+            return nullptr;
+        }
+
+        const std::uintmax_t size =
+            std::filesystem::file_size(_file_path, error_code);
+        if (error_code)
+        {
+            return nullptr;
+        }
+
+        auto& documents = get_json_file_io_documents();
+        std::shared_ptr<const JsonFileIODocument> document;
+        if (documents.get(_file_path, document) &&
+            document->last_write_time == last_write_time &&
+            document->size == size)
+        {
+            return document;
+        }
+
+        auto parsed_document = std::make_shared<JsonFileIODocument>();
+        parsed_document->last_write_time = last_write_time;
+        parsed_document->size = size;
+        if (parsed_document->document.Parse(read().c_str()).HasParseError())
+        {
+            documents.remove(_file_path);
+
+            return nullptr;
+        }
+
+        documents.put(_file_path, parsed_document);
+
+        return parsed_document;
+    }
+
+    void JsonFileIO::_invalidate_document()
+    {
+        get_json_file_io_documents().remove(_file_path);
+    }
+
     bool JsonFileIO::is_key_path_valid(const JsonPath& path)
     {
         std::scoped_lock lock(_mutex);
@@ -196,12 +270,15 @@ namespace QLogicaeCore
             return false;
         }
 
-        rapidjson::Document document;
-        if (document.Parse(read().c_str()).HasParseError())
+        std::shared_ptr<const JsonFileIODocument> cached_document =
+            _get_document();
+        if (cached_document == nullptr)
         {
             return false;
         }
 
+        const rapidjson::Document& document = cached_document->document;
+
         auto pointer = build_pointer(path);
 
         return pointer.Get(document) != nullptr;
@@ -216,12 +293,15 @@ namespace QLogicaeCore
             return "";
         }
 
-        rapidjson::Document document;
-        if (document.Parse(read().c_str()).HasParseError())
+        std::shared_ptr<const JsonFileIODocument> cached_document =
+            _get_document();
+        if (cached_document == nullptr)
         {
             return "";
         }
 
+        const rapidjson::Document& document = cached_document->document;
+
         auto pointer = build_pointer(path);
         const rapidjson::Value* value = pointer.Get(document);
 
@@ -237,12 +317,15 @@ namespace QLogicaeCore
             return false;
         }
 
-        rapidjson::Document document;
-        if (document.Parse(read().c_str()).HasParseError())
+        std::shared_ptr<const JsonFileIODocument> cached_document =
+            _get_document();
+        if (cached_document == nullptr)
         {
             return false;
         }
 
+        const rapidjson::Document& document = cached_document->document;
+
         auto ptr = build_pointer(path);
         const rapidjson::Value* val = ptr.Get(document);
 
@@ -258,12 +341,15 @@ namespace QLogicaeCore
             return 0.0;
         }
 
-        rapidjson::Document document;
-        if (document.Parse(read().c_str()).HasParseError())
+        std::shared_ptr<const JsonFileIODocument> cached_document =
+            _get_document();
+        if (cached_document == nullptr)
         {
             return 0.0;
         }
 
+        const rapidjson::Document& document = cached_document->document;
+
         auto ptr = build_pointer(path);
         const rapidjson::Value* val = ptr.Get(document);
 
@@ -279,12 +365,15 @@ namespace QLogicaeCore
             return nullptr;
         }
 
-        rapidjson::Document document;
-        if (document.Parse(read().c_str()).HasParseError())
+        std::shared_ptr<const JsonFileIODocument> cached_document =
+            _get_document();
+        if (cached_document == nullptr)
         {
             return nullptr;
         }
 
+        const rapidjson::Document& document = cached_document->document;
+
         auto ptr = build_pointer(path);
         const rapidjson::Value* val = ptr.Get(document);
 
@@ -299,23 +388,17 @@ namespace QLogicaeCore
             throw std::runtime_error("Exception at JsonFileIO::get_array(): File path is empty");
         }
 
-        std::ifstream in_file(_file_path);
-        if (!in_file.is_open())
-        {
-            throw std::runtime_error("Exception at JsonFileIO::get_array(): Failed to open JSON file '" + _file_path + "'");
-        }
-
-        std::string json_string((std::istreambuf_iterator<char>(in_file)),
-            std::istreambuf_iterator<char>());
-
-        rapidjson::Document document;
-        if (document.Parse(json_string.c_str()).HasParseError())
+        std::shared_ptr<const JsonFileIODocument> cached_document =
+            _get_document();
+        if (cached_document == nullptr)
         {
             throw std::runtime_error("Exception at JsonFileIO::get_array(): Failed to parse JSON content");
         }
 
+        const rapidjson::Document& document = cached_document->document;
+
         auto pointer = build_pointer(key_path);
-        rapidjson::Value* array_value = pointer.Get(document);
+        const rapidjson::Value* array_value = pointer.Get(document);
 
         if (!array_value || !array_value->IsArray())
         {
@@ -363,23 +446,17 @@ namespace QLogicaeCore
             throw std::runtime_error("Exception at JsonFileIO::get_object(): File path is empty");
         }
 
-        std::ifstream in_file(_file_path);
-        if (!in_file.is_open())
-        {
-            throw std::runtime_error("Exception at JsonFileIO::get_object(): Failed to open JSON file '" + _file_path + "'");
-        }
-
-        std::string json_string((std::istreambuf_iterator<char>(in_file)),
-            std::istreambuf_iterator<char>());
-
-        rapidjson::Document document;
-        if (document.Parse(json_string.c_str()).HasParseError())
+        std::shared_ptr<const JsonFileIODocument> cached_document =
+            _get_document();
+        if (cached_document == nullptr)
         {
             throw std::runtime_error("Exception at JsonFileIO::get_object(): Failed to parse JSON content");
         }
 
+        const rapidjson::Document& document = cached_document->document;
+
         auto pointer = build_pointer(key_path);
-        rapidjson::Value* value_pointer = pointer.Get(document);
+        const rapidjson::Value* value_pointer = pointer.Get(document);
 
         if (!value_pointer || !value_pointer->IsObject())
         {
@@ -580,8 +657,12 @@ namespace QLogicaeCore
 
         pointer.Create(root, allocator);
         pointer.Set(root, make_value(value, allocator), allocator);
-        fast_io::obuf_file writer{ _file_path };
-        fast_io::io::print(writer, to_string(document));
+        {
+            fast_io::obuf_file writer{ _file_path };
+            fast_io::io::print(writer, to_string(document));
+        }
+
+        _invalidate_document();
 
         return true;
     }
@@ -614,8 +695,12 @@ namespace QLogicaeCore
 
         pointer.Create(root, allocator);
         pointer.Set(root, make_value(value, allocator), allocator);
-        fast_io::obuf_file writer{ _file_path };
-        fast_io::io::print(writer, to_string(document));
+        {
+            fast_io::obuf_file writer{ _file_path };
+            fast_io::io::print(writer, to_string(document));
+        }
+
+        _invalidate_document();
 
         return true;
     }
@@ -650,8 +735,12 @@ namespace QLogicaeCore
 
         pointer.Create(root, allocator);
         pointer.Set(root, make_value(value, allocator), allocator);
-        fast_io::obuf_file writer{ _file_path };
-        fast_io::io::print(writer, to_string(document));
+        {
+            fast_io::obuf_file writer{ _file_path };
+            fast_io::io::print(writer, to_string(document));
+        }
+
+        _invalidate_document();
 
         return true;
     }
@@ -686,8 +775,12 @@ namespace QLogicaeCore
 
         pointer.Create(root, allocator);
         pointer.Set(root, make_value(value, allocator), allocator);
-        fast_io::obuf_file writer{ _file_path };
-        fast_io::io::print(writer, to_string(document));
+        {
+            fast_io::obuf_file writer{ _file_path };
+            fast_io::io::print(writer, to_string(document));
+        }
+
+        _invalidate_document();
 
         return true;
     }
@@ -722,8 +815,12 @@ namespace QLogicaeCore
 
         pointer.Create(root, allocator);
         pointer.Set(root, make_value(value, allocator), allocator);
-        fast_io::obuf_file writer{ _file_path };
-        fast_io::io::print(writer, to_string(document));
+        {
+            fast_io::obuf_file writer{ _file_path };
+            fast_io::io::print(writer, to_string(document));
+        }
+
+        _invalidate_document();
 
         return true;
     }
@@ -758,8 +855,12 @@ namespace QLogicaeCore
 
         pointer.Create(root, allocator);
         pointer.Set(root, make_value(value, allocator), allocator);
-        fast_io::obuf_file writer{ _file_path };
-        fast_io::io::print(writer, to_string(document));
+        {
+            fast_io::obuf_file writer{ _file_path };
+            fast_io::io::print(writer, to_string(document));
+        }
+
+        _invalidate_document();
 
         return true;
     }
@@ -1003,8 +1104,12 @@ namespace QLogicaeCore
             return result.set_to_bad_status_with_value(false);
         }
 
-        fast_io::obuf_file writer{ _file_path };
-        fast_io::io::print(writer, content);
+        {
+            fast_io::obuf_file writer{ _file_path };
+            fast_io::io::print(writer, content);
+        }
+
+        _invalidate_document();
         result.set_to_good_status_with_value(true);
     }
 
@@ -1023,12 +1128,15 @@ namespace QLogicaeCore
             return result.set_to_bad_status_with_value(false);
         }
 
-        rapidjson::Document document;
-        if (document.Parse(read().c_str()).HasParseError())
+        std::shared_ptr<const JsonFileIODocument> cached_document =
+            _get_document();
+        if (cached_document == nullptr)
         {
             return result.set_to_bad_status_with_value(false);
         }
 
+        const rapidjson::Document& document = cached_document->document;
+
         auto pointer = build_pointer(path);
         bool is_valid = pointer.Get(document) != nullptr;
         result.set_to_good_status_with_value(is_valid);
@@ -1053,12 +1161,15 @@ namespace QLogicaeCore
             return result.set_to_bad_status_with_value(false);
         }
 
-        rapidjson::Document document;
-        if (document.Parse(read().c_str()).HasParseError())
+        std::shared_ptr<const JsonFileIODocument> cached_document =
+            _get_document();
+        if (cached_document == nullptr)
         {
             return result.set_to_bad_status_with_value(false);
         }
 
+        const rapidjson::Document& document = cached_document->document;
+
         auto ptr = build_pointer(path);
         const rapidjson::Value* val = ptr.Get(document);
         bool value = (val && val->IsBool()) ? val->GetBool() : false;
@@ -1074,12 +1185,15 @@ namespace QLogicaeCore
             return result.set_to_bad_status_with_value(0.0);
         }
 
-        rapidjson::Document document;
-        if (document.Parse(read().c_str()).HasParseError())
+        std::shared_ptr<const JsonFileIODocument> cached_document =
+            _get_document();
+        if (cached_document == nullptr)
         {
             return result.set_to_bad_status_with_value(0.0);
         }
 
+        const rapidjson::Document& document = cached_document->document;
+
         auto ptr = build_pointer(path);
         const rapidjson::Value* val = ptr.Get(document);
         double value = (val && val->IsNumber()) ? val->GetDouble() : 0.0;
@@ -1096,12 +1210,15 @@ namespace QLogicaeCore
             return result.set_to_bad_status_with_value("");
         }
 
-        rapidjson::Document document;
-        if (document.Parse(read().c_str()).HasParseError())
+        std::shared_ptr<const JsonFileIODocument> cached_document =
+            _get_document();
+        if (cached_document == nullptr)
         {
             return result.set_to_bad_status_with_value("");
         }
 
+        const rapidjson::Document& document = cached_document->document;
+
         auto pointer = build_pointer(path);
         const rapidjson::Value* value = pointer.Get(document);
         std::string str_value =
@@ -1119,12 +1236,15 @@ namespace QLogicaeCore
             return result.set_to_bad_status_with_value(nullptr);
         }
 
-        rapidjson::Document document;
-        if (document.Parse(read().c_str()).HasParseError())
+        std::shared_ptr<const JsonFileIODocument> cached_document =
+            _get_document();
+        if (cached_document == nullptr)
         {
             return result.set_to_bad_status_with_value(nullptr);
         }
 
+        const rapidjson::Document& document = cached_document->document;
+
         auto ptr = build_pointer(path);
         const rapidjson::Value* val = ptr.Get(document);
         result.set_to_good_status_with_value(nullptr);
@@ -1138,23 +1258,17 @@ namespace QLogicaeCore
             return result.set_to_bad_status_with_value({});
         }
 
-        std::ifstream in_file(_file_path);
-        if (!in_file.is_open())
+        std::shared_ptr<const JsonFileIODocument> cached_document =
+            _get_document();
+        if (cached_document == nullptr)
         {
             return result.set_to_bad_status_with_value({});
         }
 
-        std::string json_string((std::istreambuf_iterator<char>(in_file)),
-            std::istreambuf_iterator<char>());
-
-        rapidjson::Document document;
-        if (document.Parse(json_string.c_str()).HasParseError())
-        {
-            return result.set_to_bad_status_with_value({});
-        }
+        const rapidjson::Document& document = cached_document->document;
 
         auto pointer = build_pointer(path);
-        rapidjson::Value* array_value = pointer.Get(document);
+        const rapidjson::Value* array_value = pointer.Get(document);
         if (!array_value || !array_value->IsArray())
         {
             return result.set_to_bad_status_with_value({});
@@ -1199,23 +1313,17 @@ namespace QLogicaeCore
             return result.set_to_bad_status_with_value({});
         }
 
-        std::ifstream in_file(_file_path);
-        if (!in_file.is_open())
+        std::shared_ptr<const JsonFileIODocument> cached_document =
+            _get_document();
+        if (cached_document == nullptr)
         {
             return result.set_to_bad_status_with_value({});
         }
 
-        std::string json_string((std::istreambuf_iterator<char>(in_file)),
-            std::istreambuf_iterator<char>());
-
-        rapidjson::Document document;
-        if (document.Parse(json_string.c_str()).HasParseError())
-        {
-            return result.set_to_bad_status_with_value({});
-        }
+        const rapidjson::Document& document = cached_document->document;
 
         auto pointer = build_pointer(path);
-        rapidjson::Value* value_pointer = pointer.Get(document);
+        const rapidjson::Value* value_pointer = pointer.Get(document);
         if (!value_pointer || !value_pointer->IsObject())
         {
             return result.set_to_bad_status_with_value({});
@@ -1305,8 +1413,12 @@ namespace QLogicaeCore
         pointer.Create(root, allocator);
         pointer.Set(root, make_value(value, allocator), allocator);
 
-        fast_io::obuf_file writer{ _file_path };
-        fast_io::io::print(writer, to_string(document));
+        {
+            fast_io::obuf_file writer{ _file_path };
+            fast_io::io::print(writer, to_string(document));
+        }
+
+        _invalidate_document();
         result.set_to_good_status_with_value(true);
     }
 
@@ -1342,8 +1454,12 @@ namespace QLogicaeCore
         pointer.Create(root, allocator);
         pointer.Set(root, make_value(value, allocator), allocator);
 
-        fast_io::obuf_file writer{ _file_path };
-        fast_io::io::print(writer, to_string(document));
+        {
+            fast_io::obuf_file writer{ _file_path };
+            fast_io::io::print(writer, to_string(document));
+        }
+
+        _invalidate_document();
         result.set_to_good_status_with_value(true);
     }
 
@@ -1379,8 +1495,12 @@ namespace QLogicaeCore
         pointer.Create(root, allocator);
         pointer.Set(root, make_value(value, allocator), allocator);
 
-        fast_io::obuf_file writer{ _file_path };
-        fast_io::io::print(writer, to_string(document));
+        {
+            fast_io::obuf_file writer{ _file_path };
+            fast_io::io::print(writer, to_string(document));
+        }
+
+        _invalidate_document();
         result.set_to_good_status_with_value(true);
     }
 
@@ -1416,8 +1536,12 @@ namespace QLogicaeCore
         pointer.Create(root, allocator);
         pointer.Set(root, make_value(value, allocator), allocator);
 
-        fast_io::obuf_file writer{ _file_path };
-        fast_io::io::print(writer, to_string(document));
+        {
+            fast_io::obuf_file writer{ _file_path };
+            fast_io::io::print(writer, to_string(document));
+        }
+
+        _invalidate_document();
         result.set_to_good_status_with_value(true);
     }
 
@@ -1453,8 +1577,12 @@ namespace QLogicaeCore
         pointer.Create(root, allocator);
         pointer.Set(root, make_value(value, allocator), allocator);
 
-        fast_io::obuf_file writer{ _file_path };
-        fast_io::io::print(writer, to_string(document));
+        {
+            fast_io::obuf_file writer{ _file_path };
+            fast_io::io::print(writer, to_string(document));
+        }
+
+        _invalidate_document();
         result.set_to_good_status_with_value(true);
     }
 
@@ -1490,8 +1618,12 @@ namespace QLogicaeCore
         pointer.Create(root, allocator);
         pointer.Set(root, make_value(value, allocator), allocator);
 
-        fast_io::obuf_file writer{ _file_path };
-        fast_io::io::print(writer, to_string(document));
+        {
+            fast_io::obuf_file writer{ _file_path };
+            fast_io::io::print(writer, to_string(document));
+        }
+
+        _invalidate_document();
         result.set_to_good_status_with_value(true);
     }
 
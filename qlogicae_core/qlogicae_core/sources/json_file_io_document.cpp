@@ -0,0 +1,8 @@
+#include "pch.hpp"
+
+#include "../includes/json_file_io_document.hpp"
+
+namespace QLogicaeCore
+{
+
+}
@@ -5,7 +5,25 @@
 namespace QLogicaeCore
 {
     JsonWebTokenCryptographer::JsonWebTokenCryptographer() :
-        Cryptographer()
+        Cryptographer(),
+        _es256k_algorithms(
+            {
+                .shard_count = 4,
+                .maximum_weight = 64
+            }
+        ),
+        _verifiers(
+            {
+                .shard_count = 4,
+                .maximum_weight = 64
+            }
+        ),
+        _verified_tokens(
+            {
+                .shard_count = 16,
+                .maximum_weight = UTILITIES.JSONWEBTOKEN_VERIFIED_CACHE_CAPACITY
+            }
+        )
     {
 
     }
@@ -15,27 +33,152 @@ namespace QLogicaeCore
 
     }
 
-    const jwt::algorithm::es256k& JsonWebTokenCryptographer::
+    std::shared_ptr<const jwt::algorithm::es256k> JsonWebTokenCryptographer::
         _get_es256k_signer(
             const std::string& public_key,
             const std::string& private_key
         )
     {
-        static const jwt::algorithm::es256k signer(
-            public_key, private_key, "", "");
-
-        return signer;        
+        return *_es256k_algorithms.get_or_load(
+            public_key + '\n' + private_key,
+            [&public_key, &private_key]()
+            {
+                return std::optional<std::shared_ptr<const jwt::algorithm::es256k>>(
+                    std::make_shared<const jwt::algorithm::es256k>(
+                        public_key, private_key, "", ""
+                    )
+                );
+            }
+        );
     }
 
-    const jwt::algorithm::es256k& JsonWebTokenCryptographer::
+    std::shared_ptr<const jwt::algorithm::es256k> JsonWebTokenCryptographer::
         _get_es256k_verifier(
             const std::string& public_key
         )
     {
-        static const jwt::algorithm::es256k verifier(
-            public_key, "", "", "");
+        return _get_es256k_signer(public_key, "");
+    }
+
+    std::shared_ptr<const jsonwebtoken_verifier_t> JsonWebTokenCryptographer::
+        _get_verifier(
+            const std::string& issuer,
+            const std::string& public_key
+        )
+    {
+        return *_verifiers.get_or_load(
+            issuer + '\n' + public_key,
+            [this, &issuer, &public_key]()
+            {
+                return std::optional<std::shared_ptr<const jsonwebtoken_verifier_t>>(
+                    std::make_shared<const jsonwebtoken_verifier_t>(
+                        jwt::verify()
+                            .allow_algorithm(*_get_es256k_verifier(public_key))
+                            .with_issuer(issuer)
+                            .leeway(UTILITIES.JSONWEBTOKEN_LEEWAY_IN_SECONDS)
+                    )
+                );
+            }
+        );
+    }
+
+    std::string JsonWebTokenCryptographer::_get_verified_token_key(
+        const JsonWebTokenReverseInput& options
+    )
+    {
+        SHA256HashContext context;
+        context.update(options.token);
+        context.update(std::string_view("\0", 1));
+        context.update(options.issuer);
+        context.update(std::string_view("\0", 1));
+        context.update(options.public_key);
+
+        const std::array<unsigned char, SHA256Kernels::DIGEST_SIZE> digest =
+            context.finalize();
+
+        return std::string(digest.begin(), digest.end());
+    }
+
+    std::shared_ptr<const JsonWebTokenVerifiedToken> JsonWebTokenCryptographer::
+        _verify(
+            const JsonWebTokenReverseInput& options
+        )
+    {
+        const std::chrono::system_clock::time_point now =
+            std::chrono::system_clock::now();
+        const std::string key = _get_verified_token_key(options);
+
+        std::shared_ptr<const JsonWebTokenVerifiedToken> token;
+        if (_verified_tokens.get(key, token))
+        {
+            if (!token->is_expired(now))
+            {
+                return token;
+            }
+
+            _verified_tokens.remove(key);
+        }
+
+        jsonwebtoken_decoded_t decoded = jwt::decode(options.token);
+        if (decoded.get_issuer() != options.issuer)
+        {
+            return nullptr;
+        }
+
+        _get_verifier(options.issuer, options.public_key)->verify(decoded);
+
+        const std::chrono::system_clock::time_point expires_at =
+            decoded.has_expires_at() ?
+                decoded.get_expires_at() :
+                std::chrono::system_clock::time_point::max();
+        token = std::make_shared<const JsonWebTokenVerifiedToken>(
+            std::move(decoded), expires_at
+        );
+
+        const std::chrono::milliseconds time_to_live =
+            expires_at - now < UTILITIES.JSONWEBTOKEN_VERIFIED_CACHE_TIME_TO_LIVE ?
+                std::chrono::duration_cast<std::chrono::milliseconds>(
+                    expires_at - now) :
+                std::chrono::duration_cast<std::chrono::milliseconds>(
+                    UTILITIES.JSONWEBTOKEN_VERIFIED_CACHE_TIME_TO_LIVE);
+        if (time_to_live.count() > 0)
+        {
+            _verified_tokens.put(key, token, time_to_live);
+        }
+
+        return token;
+    }
+
+    void JsonWebTokenCryptographer::_set_reverse_result(
+        JsonWebTokenReverseResult& result,
+        const JsonWebTokenReverseInput& options,
+        std::shared_ptr<const JsonWebTokenVerifiedToken> token
+    )
+    {
+        result.is_successful = true;
+        result.subject = token->get_subject();
+
+        if (options.is_claim_extraction_enabled)
+        {
+            result.headers = token->get_headers();
+            result.payloads = token->get_payloads();
+        }
+
+        result.token = std::move(token);
+    }
+
+    void JsonWebTokenCryptographer::clear_verification_cache()
+    {
+        _verified_tokens.clear();
+    }
+
+    void JsonWebTokenCryptographer::clear_verification_cache(
+        Result<void>& result
+    )
+    {
+        clear_verification_cache();
 
-        return verifier;
+        result.set_to_good_status_without_value();
     }
 
     std::string JsonWebTokenCryptographer::transform(
@@ -76,7 +219,7 @@ namespace QLogicaeCore
             for (const auto& [k, v] : options.claims)
                 builder.set_payload_claim(k, jwt::claim(v));
 
-            return builder.sign(_get_es256k_signer(
+            return builder.sign(*_get_es256k_signer(
                 options.public_key, options.private_key));
         }
         catch (const std::exception& exception)
@@ -126,9 +269,9 @@ namespace QLogicaeCore
                 return result;
             }
 
-            auto decoded = jwt::decode(options.token);
-
-            if (decoded.get_issuer() != options.issuer)
+            std::shared_ptr<const JsonWebTokenVerifiedToken> token =
+                _verify(options);
+            if (!token)
             {
                 result.message =
                     "QLogicaeCore::JsonWebTokenCryptographer::reverse(): Invalid issuer";
@@ -136,24 +279,7 @@ namespace QLogicaeCore
                 return result;
             }
 
-            jwt::verify()
-                .allow_algorithm(_get_es256k_verifier(options.public_key))
-                .with_issuer(options.issuer)
-                .leeway(30)
-                .verify(decoded);
-
-            result.is_successful = true;
-            result.subject = decoded.get_subject();
-
-            for (const auto& [k, v] : decoded.get_header_json())
-            {
-                result.headers[k] = v.serialize();
-            }
-
-            for (const auto& [k, v] : decoded.get_payload_json())
-            {
-                result.payloads[k] = v.serialize();
-            }
+            _set_reverse_result(result, options, std::move(token));
         }
         catch (const std::exception& ex)
         {
@@ -273,7 +399,7 @@ namespace QLogicaeCore
             builder.set_payload_claim(k, jwt::claim(v));
         }
 
-        result.set_to_good_status_with_value(builder.sign(_get_es256k_signer(
+        result.set_to_good_status_with_value(builder.sign(*_get_es256k_signer(
             options.public_key, options.private_key))
         );
     }
@@ -303,32 +429,15 @@ namespace QLogicaeCore
             return result.set_status_to_bad();
         }
 
-        auto decoded = jwt::decode(options.token);
-
-        if (decoded.get_issuer() != options.issuer)
+        std::shared_ptr<const JsonWebTokenVerifiedToken> token =
+            _verify(options);
+        if (!token)
         {
             json_result.message = "Invalid issuer";
             return result.set_status_to_bad();
         }
 
-        jwt::verify()
-            .allow_algorithm(_get_es256k_verifier(options.public_key))
-            .with_issuer(options.issuer)
-            .leeway(30)
-            .verify(decoded);
-
-        json_result.is_successful = true;
-        json_result.subject = decoded.get_subject();
-
-        for (const auto& [k, v] : decoded.get_header_json())
-        {
-            json_result.headers[k] = v.serialize();
-        }
-
-        for (const auto& [k, v] : decoded.get_payload_json())
-        {
-            json_result.payloads[k] = v.serialize();
-        }
+        _set_reverse_result(json_result, options, std::move(token));
 
         result.set_status_to_good();
     }
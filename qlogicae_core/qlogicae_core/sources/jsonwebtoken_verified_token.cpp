@@ -0,0 +1,82 @@
+#include "pch.hpp"
+
+#include "../includes/jsonwebtoken_verified_token.hpp"
+
+namespace QLogicaeCore
+{
+    JsonWebTokenVerifiedToken::JsonWebTokenVerifiedToken(
+        jsonwebtoken_decoded_t decoded,
+        const std::chrono::system_clock::time_point& expires_at
+    ) :
+        _decoded(std::move(decoded)),
+        _expires_at(expires_at)
+    {
+
+    }
+
+    bool JsonWebTokenVerifiedToken::is_expired(
+        const std::chrono::system_clock::time_point& now
+    ) const
+    {
+        return _expires_at <= now;
+    }
+
+    std::string JsonWebTokenVerifiedToken::get_subject() const
+    {
+        return _decoded.has_subject() ? _decoded.get_subject() : "";
+    }
+
+    std::chrono::system_clock::time_point
+        JsonWebTokenVerifiedToken::get_expires_at() const
+    {
+        return _expires_at;
+    }
+
+    std::optional<std::string> JsonWebTokenVerifiedToken::get_header(
+        const std::string& name
+    ) const
+    {
+        if (!_decoded.has_header_claim(name))
+        {
+            return std::nullopt;
+        }
+
+        return _decoded.get_header_claim(name).to_json().serialize();
+    }
+
+    std::optional<std::string> JsonWebTokenVerifiedToken::get_payload(
+        const std::string& name
+    ) const
+    {
+        if (!_decoded.has_payload_claim(name))
+        {
+            return std::nullopt;
+        }
+
+        return _decoded.get_payload_claim(name).to_json().serialize();
+    }
+
+    std::map<std::string, std::string>
+        JsonWebTokenVerifiedToken::get_headers() const
+    {
+        std::map<std::string, std::string> headers;
+        for (const auto& [k, v] : _decoded.get_header_json())
+        {
+            headers[k] = v.serialize();
+        }
+
+        return headers;
+    }
+
+    std::map<std::string, std::string>
+        JsonWebTokenVerifiedToken::get_payloads() const
+    {
+        std::map<std::string, std::string> payloads;
+        for (const auto& [k, v] : _decoded.get_payload_json())
+        {
+            payloads[k] = v.serialize();
+        }
+
+        return payloads;
+    }
+}
@@ -0,0 +1,8 @@
+#include "pch.hpp"
+
+#include "../includes/password_hash_calibration.hpp"
+
+namespace QLogicaeCore
+{
+
+}
@@ -0,0 +1,113 @@
+#include "pch.hpp"
+
+#include "../includes/password_hash_calibrator.hpp"
+
+namespace QLogicaeCore
+{
+    void PasswordHashCalibrator::run(
+        Result<PasswordHashCalibration>& result,
+        const std::chrono::milliseconds& target_latency,
+        const PasswordHashCalibration& minimum,
+        const PasswordHashCalibration& maximum,
+        const password_hash_calibration_t& hash
+    )
+    {
+        if (!hash ||
+            target_latency.count() <= 0 ||
+            minimum.operations_limit == 0 ||
+            minimum.operations_limit > maximum.operations_limit ||
+            minimum.memory_limit_in_bytes > maximum.memory_limit_in_bytes)
+        {
+            return result.set_to_bad_status_without_value(
+                "Calibration bounds are invalid"
+            );
+        }
+
+        PasswordHashCalibration candidate
+        {
+            .operations_limit = minimum.operations_limit,
+            .memory_limit_in_bytes = maximum.memory_limit_in_bytes
+        };
+        if (!_measure(candidate, hash))
+        {
+            return result.set_to_bad_status_without_value(
+                "Hashing failed"
+            );
+        }
+
+        while (candidate.duration > target_latency &&
+            candidate.memory_limit_in_bytes / 2 >=
+                minimum.memory_limit_in_bytes)
+        {
+            candidate.memory_limit_in_bytes /= 2;
+            if (!_measure(candidate, hash))
+            {
+                return result.set_to_bad_status_without_value(
+                    "Hashing failed"
+                );
+            }
+        }
+
+        PasswordHashCalibration calibration = candidate;
+        if (candidate.duration >= target_latency ||
+            candidate.duration.count() <= 0)
+        {
+            return result.set_to_good_status_with_value(calibration);
+        }
+
+        const double scale =
+            static_cast<double>(
+                std::chrono::nanoseconds(target_latency).count()) /
+            static_cast<double>(candidate.duration.count());
+        candidate.operations_limit = std::clamp<std::uint64_t>(
+            static_cast<std::uint64_t>(
+                static_cast<double>(candidate.operations_limit) * scale),
+            calibration.operations_limit,
+            maximum.operations_limit
+        );
+
+        std::uint64_t upper_operations_limit = candidate.operations_limit + 1;
+        while (calibration.operations_limit + 1 < upper_operations_limit)
+        {
+            if (!_measure(candidate, hash))
+            {
+                return result.set_to_bad_status_without_value(
+                    "Hashing failed"
+                );
+            }
+
+            if (candidate.duration <= target_latency)
+            {
+                calibration = candidate;
+            }
+            else
+            {
+                upper_operations_limit = candidate.operations_limit;
+            }
+
+            candidate.operations_limit = calibration.operations_limit +
+                (upper_operations_limit - calibration.operations_limit) / 2;
+        }
+
+        result.set_to_good_status_with_value(calibration);
+    }
+
+    bool PasswordHashCalibrator::_measure(
+        PasswordHashCalibration& calibration,
+        const password_hash_calibration_t& hash
+    )
+    {
+        const std::chrono::steady_clock::time_point start =
+            std::chrono::steady_clock::now();
+        if (!hash(calibration))
+        {
+            return false;
+        }
+
+        calibration.duration = std::chrono::duration_cast<
+            std::chrono::nanoseconds>(
+                std::chrono::steady_clock::now() - start);
+
+        return true;
+    }
+}
@@ -0,0 +1,197 @@
+#include "pch.hpp"
+
+#include "../includes/password_hash_executor.hpp"
+
+namespace QLogicaeCore
+{
+    PasswordHashExecutor::PasswordHashExecutor() :
+        PasswordHashExecutor(PasswordHashExecutorConfigurations {})
+    {
+
+    }
+
+    PasswordHashExecutor::PasswordHashExecutor(
+        const PasswordHashExecutorConfigurations& configurations
+    ) :
+        _configurations(configurations),
+        _concurrency(_get_concurrency(configurations)),
+        _pool(std::make_unique<boost::asio::thread_pool>(_concurrency))
+    {
+
+    }
+
+    PasswordHashExecutor::~PasswordHashExecutor()
+    {
+        _pool->join();
+    }
+
+    bool PasswordHashExecutor::setup(
+        const PasswordHashExecutorConfigurations& configurations
+    )
+    {
+        try
+        {
+            Result<void> result;
+
+            setup(result, configurations);
+
+            return result.is_status_safe();
+        }
+        catch (const std::exception& exception)
+        {
+            LOGGER.handle_exception_async(
+                "QLogicaeCore::PasswordHashExecutor::setup()",
+                exception.what()
+            );
+
+            return false;
+        }
+    }
+
+    void PasswordHashExecutor::setup(
+        Result<void>& result,
+        const PasswordHashExecutorConfigurations& configurations
+    )
+    {
+        if (configurations.maximum_queue_depth == 0)
+        {
+            return result.set_to_bad_status_without_value(
+                "Queue depth must be positive"
+            );
+        }
+
+        std::unique_lock lock(_mutex);
+
+        _pool->join();
+        _configurations = configurations;
+        _concurrency = _get_concurrency(configurations);
+        _pool = std::make_unique<boost::asio::thread_pool>(_concurrency);
+
+        result.set_to_good_status_without_value();
+    }
+
+    std::size_t PasswordHashExecutor::get_concurrency()
+    {
+        std::shared_lock lock(_mutex);
+
+        return _concurrency;
+    }
+
+    std::size_t PasswordHashExecutor::get_queue_depth()
+    {
+        return _queue_depth.load();
+    }
+
+    std::size_t PasswordHashExecutor::get_active_count()
+    {
+        return _active_count.load();
+    }
+
+    std::uint64_t PasswordHashExecutor::get_rejected_count()
+    {
+        return _rejected_count.load();
+    }
+
+    void PasswordHashExecutor::get_concurrency(
+        Result<std::size_t>& result
+    )
+    {
+        result.set_to_good_status_with_value(get_concurrency());
+    }
+
+    void PasswordHashExecutor::get_queue_depth(
+        Result<std::size_t>& result
+    )
+    {
+        result.set_to_good_status_with_value(get_queue_depth());
+    }
+
+    void PasswordHashExecutor::get_active_count(
+        Result<std::size_t>& result
+    )
+    {
+        result.set_to_good_status_with_value(get_active_count());
+    }
+
+    void PasswordHashExecutor::get_rejected_count(
+        Result<std::uint64_t>& result
+    )
+    {
+        result.set_to_good_status_with_value(get_rejected_count());
+    }
+
+    void PasswordHashExecutor::_acquire_memory(
+        const std::size_t memory_in_bytes,
+        const std::size_t memory_limit_in_bytes
+    )
+    {
+        if (memory_in_bytes == 0)
+        {
+            return;
+        }
+
+        std::unique_lock lock(_memory_mutex);
+
+        _memory_condition.wait(lock, [this, memory_in_bytes, memory_limit_in_bytes]()
+            {
+                return memory_limit_in_bytes == 0 ||
+                    _memory_in_use == 0 ||
+                    _memory_in_use + memory_in_bytes <= memory_limit_in_bytes;
+            });
+        _memory_in_use += memory_in_bytes;
+    }
+
+    void PasswordHashExecutor::_release_memory(
+        const std::size_t memory_in_bytes
+    )
+    {
+        if (memory_in_bytes == 0)
+        {
+            return;
+        }
+
+        {
+            std::unique_lock lock(_memory_mutex);
+
+            _memory_in_use -= memory_in_bytes;
+        }
+
+        _memory_condition.notify_all();
+    }
+
+    std::size_t PasswordHashExecutor::_get_concurrency(
+        const PasswordHashExecutorConfigurations& configurations
+    )
+    {
+        const std::size_t concurrency =
+            std::max<std::size_t>(1, configurations.maximum_concurrency);
+        if (configurations.memory_limit_in_bytes == 0 ||
+            configurations.hash_memory_in_bytes == 0)
+        {
+            return concurrency;
+        }
+
+        return std::clamp<std::size_t>(
+            configurations.memory_limit_in_bytes /
+                configurations.hash_memory_in_bytes,
+            1,
+            concurrency
+        );
+    }
+
+    PasswordHashExecutor& PasswordHashExecutor::get_instance()
+    {
+        static PasswordHashExecutor instance;
+
+        return instance;
+    }
+
+    void PasswordHashExecutor::get_instance(
+        Result<PasswordHashExecutor*>& result
+    )
+    {
+        static PasswordHashExecutor instance;
+
+        result.set_to_good_status_with_value(&instance);
+    }
+}
@@ -0,0 +1,8 @@
+#include "pch.hpp"
+
+#include "../includes/password_hash_executor_configurations.hpp"
+
+namespace QLogicaeCore
+{
+
+}
@@ -299,31 +299,17 @@ namespace QLogicaeCore
     {
         try
         {
-            int error_number;
-            PCRE2_SIZE error_offset;
-
-            pcre2_code* regular_expression = pcre2_compile(
-                (PCRE2_SPTR)pattern.c_str(),
-                PCRE2_ZERO_TERMINATED,
-                0,
-                &error_number,
-                &error_offset,
-                nullptr
-            );
-
+            std::shared_ptr<pcre2_code> regular_expression =
+                _get_direct_pattern(pattern);
             if (!regular_expression)
             {
                 return false;
             }
 
-            bool result =
-                _do_match(
-                    subject,
-                    regular_expression
-                );
-            pcre2_code_free(regular_expression);
-
-            return result;
+            return _do_match(
+                subject,
+                regular_expression.get()
+            );
         }
         catch (const std::exception& exception)
         {
@@ -406,6 +392,45 @@ namespace QLogicaeCore
         }
     }
 
+    std::shared_ptr<pcre2_code> RegularExpression::_get_direct_pattern(
+        const std::string& pattern
+    )
+    {
+        std::optional<std::shared_ptr<pcre2_code>> regular_expression =
+            _direct_patterns.get_or_load(
+                pattern,
+                [&pattern]() -> std::optional<std::shared_ptr<pcre2_code>>
+                {
+                    int error_number;
+                    PCRE2_SIZE error_offset;
+
+                    pcre2_code* compiled_pattern = pcre2_compile(
+                        (PCRE2_SPTR)pattern.c_str(),
+                        PCRE2_ZERO_TERMINATED,
+                        0,
+                        &error_number,
+                        &error_offset,
+                        nullptr
+                    );
+
+                    if (!compiled_pattern)
+                    {
+                        return std::nullopt;
+                    }
+
+                    return std::shared_ptr<pcre2_code>(
+                        compiled_pattern,
+                        [](pcre2_code* code)
+                        {
+                            pcre2_code_free(code);
+                        }
+                    );
+                }
+            );
+
+        return regular_expression.value_or(nullptr);
+    }
+
     void RegularExpression::clear_all_patterns(
         Result<void>& result
     )
@@ -529,24 +554,14 @@ namespace QLogicaeCore
         const std::string& pattern
     )
     {
-        int error_number;
-        PCRE2_SIZE error_offset;
-
-        pcre2_code* regular_expression = pcre2_compile(
-            (PCRE2_SPTR)pattern.c_str(),
-            PCRE2_ZERO_TERMINATED,
-            0,
-            &error_number,
-            &error_offset,
-            nullptr
-        );
-
+        std::shared_ptr<pcre2_code> regular_expression =
+            _get_direct_pattern(pattern);
         if (!regular_expression)
         {
             return result.set_to_bad_status_without_value();
         }
 
-        if (_do_match(subject, regular_expression))
+        if (_do_match(subject, regular_expression.get()))
         {
             result.set_to_good_status_without_value();
         }
@@ -554,8 +569,6 @@ namespace QLogicaeCore
         {
             result.set_to_bad_status_without_value();
         }
-        
-        pcre2_code_free(regular_expression);
     }
 
     void RegularExpression::match_named_async(
@@ -0,0 +1,8 @@
+#include "pch.hpp"
+
+#include "../includes/rocksdb_bulk_load_configurations.hpp"
+
+namespace QLogicaeCore
+{
+
+}
@@ -801,6 +801,20 @@ namespace QLogicaeCore
 
             _options.table_factory.reset(
                 rocksdb::NewBlockBasedTableFactory(_table_options));
+
+            _options.listeners.clear();
+            _options.statistics.reset();
+            _statistics.reset();
+            _event_listener.reset();
+            if (_config.is_statistics_enabled)
+            {
+                _statistics = rocksdb::CreateDBStatistics();
+                _statistics->set_stats_level(_config.statistics_level);
+                _options.statistics = _statistics;
+
+                _event_listener = std::make_shared<RocksDBEventListener>();
+                _options.listeners.push_back(_event_listener);
+            }
         }
         catch (const std::exception& exception)
         {
@@ -829,6 +843,8 @@ namespace QLogicaeCore
             }
 
             _object = _transaction_db;
+
+            _start_statistics_interval();
         }
         catch (const std::exception& exception)
         {
@@ -843,6 +859,8 @@ namespace QLogicaeCore
     {
         try
         {
+            _stop_statistics_interval();
+
             std::unique_lock lock(_mutex);
 
             if (_object != nullptr)
@@ -878,6 +896,655 @@ namespace QLogicaeCore
         }        
     }
 
+    bool RocksDBDatabase::bulk_load(
+        std::vector<std::pair<std::string, std::string>> entries,
+        const RocksDBBulkLoadConfigurations& configurations
+    )
+    {
+        try
+        {
+            Result<void> result;
+
+            bulk_load(
+                result,
+                std::move(entries),
+                configurations
+            );
+
+            return result.is_status_safe();
+        }
+        catch (const std::exception& exception)
+        {
+            LOGGER.handle_exception_async(
+                "QLogicaeCore::RocksDBDatabase::bulk_load()",
+                exception.what()
+            );
+
+            return false;
+        }
+    }
+
+    void RocksDBDatabase::bulk_load(
+        Result<void>& result,
+        std::vector<std::pair<std::string, std::string>> entries,
+        const RocksDBBulkLoadConfigurations& configurations
+    )
+    {
+        if (_object == nullptr)
+        {
+            return result.set_to_bad_status_without_value();
+        }
+
+        if (entries.empty())
+        {
+            return result.set_to_good_status_without_value();
+        }
+
+        if (!configurations.is_input_sorted)
+        {
+            _sort_and_deduplicate_bulk_load_entries(entries);
+        }
+
+        const std::string staging_folder_path =
+            configurations.staging_folder_path.empty() ?
+                _generate_bulk_load_staging_folder_path() :
+                configurations.staging_folder_path;
+        std::filesystem::create_directories(staging_folder_path);
+
+        const size_t total_count = entries.size();
+        const size_t entries_per_file =
+            std::max<size_t>(1, configurations.entries_per_file);
+        const size_t file_count =
+            (total_count + entries_per_file - 1) / entries_per_file;
+
+        std::vector<std::string> file_paths(file_count);
+        std::vector<rocksdb::Status> file_statuses(file_count);
+
+        const rocksdb::Options options = _options;
+        rocksdb::IngestExternalFileOptions ingest_options;
+        ingest_options.move_files = configurations.move_files;
+        ingest_options.snapshot_consistency =
+            configurations.snapshot_consistency;
+        ingest_options.allow_global_seqno =
+            configurations.allow_global_seqno;
+        ingest_options.allow_blocking_flush =
+            configurations.allow_blocking_flush;
+
+        std::mutex progress_mutex;
+        size_t loaded_count = 0;
+        std::atomic<bool> is_failed { false };
+
+        auto load_file = [&](const size_t& file_index)
+            {
+                if (is_failed.load())
+                {
+                    return;
+                }
+
+                const size_t begin = file_index * entries_per_file;
+                const size_t end = std::min(begin + entries_per_file, total_count);
+
+                file_paths[file_index] =
+                    (std::filesystem::path(staging_folder_path) /
+                        fmt::format("bulk_load_{:06}.sst", file_index)).string();
+
+                rocksdb::SstFileWriter writer(rocksdb::EnvOptions(), options);
+                rocksdb::Status status = writer.Open(file_paths[file_index]);
+                for (size_t index = begin; status.ok() && index < end; ++index)
+                {
+                    status = writer.Put(
+                        entries[index].first,
+                        entries[index].second
+                    );
+                }
+                if (status.ok())
+                {
+                    status = writer.Finish();
+                }
+                if (status.ok())
+                {
+                    std::unique_lock lock(_mutex);
+
+                    status = _object->IngestExternalFile(
+                        { file_paths[file_index] },
+                        ingest_options
+                    );
+                }
+                file_statuses[file_index] = status;
+
+                if (!status.ok())
+                {
+                    is_failed.store(true);
+
+                    return;
+                }
+
+                if (configurations.progress_callback)
+                {
+                    std::scoped_lock lock(progress_mutex);
+
+                    loaded_count += end - begin;
+                    configurations.progress_callback(
+                        loaded_count,
+                        total_count
+                    );
+                }
+            };
+
+        std::string error_message;
+        try
+        {
+            ThreadPool::get_instance().parallel_for(file_count, load_file);
+        }
+        catch (const std::exception& exception)
+        {
+            error_message = exception.what();
+        }
+        for (const rocksdb::Status& status : file_statuses)
+        {
+            if (error_message.empty() && !status.ok())
+            {
+                error_message = status.ToString();
+            }
+        }
+
+        if (configurations.is_staging_folder_removed)
+        {
+            std::error_code error_code;
+            for (const std::string& file_path : file_paths)
+            {
+                std::filesystem::remove(file_path, error_code);
+            }
+            if (configurations.staging_folder_path.empty())
+            {
+                std::filesystem::remove_all(staging_folder_path, error_code);
+            }
+        }
+
+        if (!error_message.empty())
+        {
+            return result.set_to_bad_status_without_value(error_message);
+        }
+
+        result.set_to_good_status_without_value();
+    }
+
+    std::future<bool> RocksDBDatabase::bulk_load_async(
+        std::vector<std::pair<std::string, std::string>> entries,
+        const RocksDBBulkLoadConfigurations& configurations
+    )
+    {
+        std::promise<bool> promise;
+        auto future = promise.get_future();
+
+        boost::asio::post(
+            UTILITIES.BOOST_ASIO_POOL,
+            [this, entries = std::move(entries), configurations,
+            promise = std::move(promise)]() mutable
+            {
+                promise.set_value(
+                    bulk_load(
+                        std::move(entries),
+                        configurations
+                    )
+                );
+            }
+        );
+
+        return future;
+    }
+
+    void RocksDBDatabase::bulk_load_async(
+        const std::function<void(const bool& result)>& callback,
+        std::vector<std::pair<std::string, std::string>> entries,
+        const RocksDBBulkLoadConfigurations& configurations
+    )
+    {
+        boost::asio::post(
+            UTILITIES.BOOST_ASIO_POOL,
+            [this, callback, entries = std::move(entries),
+            configurations]() mutable
+            {
+                callback(
+                    bulk_load(
+                        std::move(entries),
+                        configurations
+                    )
+                );
+            }
+        );
+    }
+
+    void RocksDBDatabase::bulk_load_async(
+        const std::function<void(Result<void>& result)>& callback,
+        std::vector<std::pair<std::string, std::string>> entries,
+        const RocksDBBulkLoadConfigurations& configurations
+    )
+    {
+        boost::asio::post(
+            UTILITIES.BOOST_ASIO_POOL,
+            [this, callback, entries = std::move(entries),
+            configurations]() mutable
+            {
+                Result<void> result;
+
+                bulk_load(
+                    result,
+                    std::move(entries),
+                    configurations
+                );
+
+                callback(
+                    result
+                );
+            }
+        );
+    }
+
+    std::string RocksDBDatabase::_generate_bulk_load_staging_folder_path()
+    {
+        return (
+            std::filesystem::path(_file_path) /
+            fmt::format(
+                "bulk_load_{}",
+                std::chrono::steady_clock::now().time_since_epoch().count()
+            )
+        ).string();
+    }
+
+    void RocksDBDatabase::_sort_and_deduplicate_bulk_load_entries(
+        std::vector<std::pair<std::string, std::string>>& entries
+    )
+    {
+        std::stable_sort(
+            std::execution::par,
+            entries.begin(),
+            entries.end(),
+            [](const auto& left, const auto& right)
+            {
+                return left.first < right.first;
+            }
+        );
+
+        size_t write_index = 0;
+        for (size_t read_index = 0; read_index < entries.size(); ++read_index)
+        {
+            if (read_index + 1 < entries.size() &&
+                entries[read_index].first == entries[read_index + 1].first)
+            {
+                continue;
+            }
+            if (write_index != read_index)
+            {
+                entries[write_index] = std::move(entries[read_index]);
+            }
+            ++write_index;
+        }
+        entries.resize(write_index);
+    }
+
+    RocksDBStatistics RocksDBDatabase::get_statistics()
+    {
+        try
+        {
+            Result<RocksDBStatistics> result;
+
+            get_statistics(
+                result
+            );
+
+            return result.get_value();
+        }
+        catch (const std::exception& exception)
+        {
+            LOGGER.handle_exception_async(
+                "QLogicaeCore::RocksDBDatabase::get_statistics()",
+                exception.what()
+            );
+
+            return {};
+        }
+    }
+
+    bool RocksDBDatabase::reset_statistics()
+    {
+        try
+        {
+            Result<void> result;
+
+            reset_statistics(
+                result
+            );
+
+            return result.is_status_safe();
+        }
+        catch (const std::exception& exception)
+        {
+            LOGGER.handle_exception_async(
+                "QLogicaeCore::RocksDBDatabase::reset_statistics()",
+                exception.what()
+            );
+
+            return false;
+        }
+    }
+
+    bool RocksDBDatabase::log_statistics()
+    {
+        try
+        {
+            Result<void> result;
+
+            log_statistics(
+                result
+            );
+
+            return result.is_status_safe();
+        }
+        catch (const std::exception& exception)
+        {
+            LOGGER.handle_exception_async(
+                "QLogicaeCore::RocksDBDatabase::log_statistics()",
+                exception.what()
+            );
+
+            return false;
+        }
+    }
+
+    bool RocksDBDatabase::begin_perf_context()
+    {
+        try
+        {
+            Result<void> result;
+
+            begin_perf_context(
+                result
+            );
+
+            return result.is_status_safe();
+        }
+        catch (const std::exception& exception)
+        {
+            LOGGER.handle_exception_async(
+                "QLogicaeCore::RocksDBDatabase::begin_perf_context()",
+                exception.what()
+            );
+
+            return false;
+        }
+    }
+
+    RocksDBPerfContext RocksDBDatabase::end_perf_context()
+    {
+        try
+        {
+            Result<RocksDBPerfContext> result;
+
+            end_perf_context(
+                result
+            );
+
+            return result.get_value();
+        }
+        catch (const std::exception& exception)
+        {
+            LOGGER.handle_exception_async(
+                "QLogicaeCore::RocksDBDatabase::end_perf_context()",
+                exception.what()
+            );
+
+            return {};
+        }
+    }
+
+    void RocksDBDatabase::get_statistics(
+        Result<RocksDBStatistics>& result
+    )
+    {
+        std::shared_lock lock(_mutex);
+
+        if (_statistics == nullptr)
+        {
+            return result.set_to_bad_status_without_value();
+        }
+
+        RocksDBStatistics statistics;
+
+        statistics.block_cache_hit_count =
+            _statistics->getTickerCount(rocksdb::BLOCK_CACHE_HIT);
+        statistics.block_cache_miss_count =
+            _statistics->getTickerCount(rocksdb::BLOCK_CACHE_MISS);
+        statistics.bloom_filter_useful_count =
+            _statistics->getTickerCount(rocksdb::BLOOM_FILTER_USEFUL);
+        statistics.memtable_hit_count =
+            _statistics->getTickerCount(rocksdb::MEMTABLE_HIT);
+        statistics.memtable_miss_count =
+            _statistics->getTickerCount(rocksdb::MEMTABLE_MISS);
+        statistics.sst_level_0_hit_count =
+            _statistics->getTickerCount(rocksdb::GET_HIT_L0);
+        statistics.sst_level_1_hit_count =
+            _statistics->getTickerCount(rocksdb::GET_HIT_L1);
+        statistics.sst_level_2_and_up_hit_count =
+            _statistics->getTickerCount(rocksdb::GET_HIT_L2_AND_UP);
+        statistics.keys_read_count =
+            _statistics->getTickerCount(rocksdb::NUMBER_KEYS_READ);
+        statistics.keys_written_count =
+            _statistics->getTickerCount(rocksdb::NUMBER_KEYS_WRITTEN);
+        statistics.bytes_read =
+            _statistics->getTickerCount(rocksdb::BYTES_READ);
+        statistics.bytes_written =
+            _statistics->getTickerCount(rocksdb::BYTES_WRITTEN);
+        statistics.stall_microseconds =
+            _statistics->getTickerCount(rocksdb::STALL_MICROS);
+        statistics.flush_write_bytes =
+            _statistics->getTickerCount(rocksdb::FLUSH_WRITE_BYTES);
+        statistics.compaction_read_bytes =
+            _statistics->getTickerCount(rocksdb::COMPACT_READ_BYTES);
+        statistics.compaction_write_bytes =
+            _statistics->getTickerCount(rocksdb::COMPACT_WRITE_BYTES);
+
+        const uint64_t block_cache_access_count =
+            statistics.block_cache_hit_count +
+            statistics.block_cache_miss_count;
+        if (block_cache_access_count != 0)
+        {
+            statistics.block_cache_hit_rate =
+                static_cast<double>(statistics.block_cache_hit_count) /
+                static_cast<double>(block_cache_access_count);
+        }
+
+        if (statistics.bytes_written != 0)
+        {
+            statistics.write_amplification =
+                static_cast<double>(
+                    statistics.flush_write_bytes +
+                    statistics.compaction_write_bytes
+                ) /
+                static_cast<double>(statistics.bytes_written);
+        }
+
+        if (_event_listener != nullptr)
+        {
+            _event_listener->collect(statistics);
+        }
+
+        result.set_to_good_status_with_value(
+            statistics
+        );
+    }
+
+    void RocksDBDatabase::reset_statistics(
+        Result<void>& result
+    )
+    {
+        std::shared_lock lock(_mutex);
+
+        if (_statistics == nullptr)
+        {
+            return result.set_to_bad_status_without_value();
+        }
+
+        if (!_statistics->Reset().ok())
+        {
+            return result.set_to_bad_status_without_value();
+        }
+
+        if (_event_listener != nullptr)
+        {
+            _event_listener->reset();
+        }
+
+        result.set_to_good_status_without_value();
+    }
+
+    void RocksDBDatabase::log_statistics(
+        Result<void>& result
+    )
+    {
+        Result<RocksDBStatistics> statistics_result;
+
+        get_statistics(
+            statistics_result
+        );
+        if (statistics_result.is_status_unsafe())
+        {
+            return result.set_to_bad_status_without_value();
+        }
+
+        LOGGER.log_with_timestamp_async(
+            _to_statistics_text(
+                statistics_result.get_value()
+            ),
+            LogLevel::INFO
+        );
+
+        result.set_to_good_status_without_value();
+    }
+
+    void RocksDBDatabase::begin_perf_context(
+        Result<void>& result
+    )
+    {
+        rocksdb::SetPerfLevel(_config.perf_level);
+        rocksdb::get_perf_context()->Reset();
+
+        result.set_to_good_status_without_value();
+    }
+
+    void RocksDBDatabase::end_perf_context(
+        Result<RocksDBPerfContext>& result
+    )
+    {
+        const rocksdb::PerfContext* perf_context =
+            rocksdb::get_perf_context();
+
+        RocksDBPerfContext value;
+
+        value.user_key_comparison_count =
+            perf_context->user_key_comparison_count;
+        value.block_cache_hit_count =
+            perf_context->block_cache_hit_count;
+        value.block_read_count =
+            perf_context->block_read_count;
+        value.block_read_bytes =
+            perf_context->block_read_byte;
+        value.block_read_nanoseconds =
+            perf_context->block_read_time;
+        value.get_snapshot_nanoseconds =
+            perf_context->get_snapshot_time;
+        value.get_from_memtable_count =
+            perf_context->get_from_memtable_count;
+        value.get_from_memtable_nanoseconds =
+            perf_context->get_from_memtable_time;
+        value.get_from_output_files_nanoseconds =
+            perf_context->get_from_output_files_time;
+        value.bloom_memtable_hit_count =
+            perf_context->bloom_memtable_hit_count;
+        value.bloom_memtable_miss_count =
+            perf_context->bloom_memtable_miss_count;
+        value.bloom_sst_hit_count =
+            perf_context->bloom_sst_hit_count;
+        value.bloom_sst_miss_count =
+            perf_context->bloom_sst_miss_count;
+        value.write_wal_nanoseconds =
+            perf_context->write_wal_time;
+        value.write_memtable_nanoseconds =
+            perf_context->write_memtable_time;
+        value.write_delay_nanoseconds =
+            perf_context->write_delay_time;
+
+        rocksdb::SetPerfLevel(rocksdb::PerfLevel::kDisable);
+
+        result.set_to_good_status_with_value(
+            value
+        );
+    }
+
+    void RocksDBDatabase::_start_statistics_interval()
+    {
+        if (_statistics == nullptr ||
+            _config.statistics_logging_interval_in_milliseconds == 0)
+        {
+            return;
+        }
+
+        _statistics_interval = std::make_unique<Interval>(
+            [this](size_t)
+            {
+                log_statistics();
+
+                return true;
+            },
+            std::chrono::milliseconds(
+                _config.statistics_logging_interval_in_milliseconds
+            )
+        );
+        _statistics_interval->start();
+    }
+
+    void RocksDBDatabase::_stop_statistics_interval()
+    {
+        _statistics_interval.reset();
+    }
+
+    std::string RocksDBDatabase::_to_statistics_text(
+        const RocksDBStatistics& statistics
+    )
+    {
+        return fmt::format(
+            "RocksDB statistics: "
+            "block_cache_hit_rate={:.4f} "
+            "block_cache_hits={} block_cache_misses={} "
+            "memtable_hits={} memtable_misses={} "
+            "sst_l0_hits={} sst_l1_hits={} sst_l2_and_up_hits={} "
+            "keys_read={} keys_written={} "
+            "stall_us={} stall_changes={} "
+            "flushes={} flush_total_us={} flush_max_us={} "
+            "compactions={} compaction_total_us={} compaction_max_us={} "
+            "write_amplification={:.3f}",
+            statistics.block_cache_hit_rate,
+            statistics.block_cache_hit_count,
+            statistics.block_cache_miss_count,
+            statistics.memtable_hit_count,
+            statistics.memtable_miss_count,
+            statistics.sst_level_0_hit_count,
+            statistics.sst_level_1_hit_count,
+            statistics.sst_level_2_and_up_hit_count,
+            statistics.keys_read_count,
+            statistics.keys_written_count,
+            statistics.stall_microseconds,
+            statistics.stall_condition_change_count,
+            statistics.flush_count,
+            statistics.flush_total_microseconds,
+            statistics.flush_maximum_microseconds,
+            statistics.compaction_count,
+            statistics.compaction_total_microseconds,
+            statistics.compaction_maximum_microseconds,
+            statistics.write_amplification
+        );
+    }
+
     rocksdb::ColumnFamilyHandle* RocksDBDatabase::get_cf_handle(
         const std::string& name
     )
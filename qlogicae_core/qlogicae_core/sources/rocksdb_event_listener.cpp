@@ -0,0 +1,146 @@
+#include "pch.hpp"
+
+#include "../includes/rocksdb_event_listener.hpp"
+
+namespace QLogicaeCore
+{
+    void RocksDBEventListener::OnFlushBegin(
+        rocksdb::DB*,
+        const rocksdb::FlushJobInfo& information
+    )
+    {
+        std::scoped_lock lock(_mutex);
+
+        _flush_begin_times[information.job_id] =
+            std::chrono::steady_clock::now();
+    }
+
+    void RocksDBEventListener::OnFlushCompleted(
+        rocksdb::DB*,
+        const rocksdb::FlushJobInfo& information
+    )
+    {
+        uint64_t elapsed_microseconds = 0;
+
+        {
+            std::scoped_lock lock(_mutex);
+
+            auto iterator = _flush_begin_times.find(information.job_id);
+            if (iterator != _flush_begin_times.end())
+            {
+                elapsed_microseconds = static_cast<uint64_t>(
+                    std::chrono::duration_cast<std::chrono::microseconds>(
+                        std::chrono::steady_clock::now() - iterator->second
+                    ).count()
+                );
+                _flush_begin_times.erase(iterator);
+            }
+        }
+
+        _flush_count.fetch_add(1, std::memory_order_relaxed);
+        _flush_total_microseconds.fetch_add(
+            elapsed_microseconds, std::memory_order_relaxed);
+        _update_maximum(_flush_maximum_microseconds, elapsed_microseconds);
+    }
+
+    void RocksDBEventListener::OnCompactionCompleted(
+        rocksdb::DB*,
+        const rocksdb::CompactionJobInfo& information
+    )
+    {
+        if (!information.status.ok())
+        {
+            return;
+        }
+
+        const uint64_t elapsed_microseconds =
+            information.stats.elapsed_micros;
+
+        _compaction_count.fetch_add(1, std::memory_order_relaxed);
+        _compaction_total_microseconds.fetch_add(
+            elapsed_microseconds, std::memory_order_relaxed);
+        _update_maximum(
+            _compaction_maximum_microseconds, elapsed_microseconds);
+    }
+
+    void RocksDBEventListener::OnStallConditionsChanged(
+        const rocksdb::WriteStallInfo& information
+    )
+    {
+        _stall_condition_change_count.fetch_add(
+            1, std::memory_order_relaxed);
+
+        switch (information.condition.cur)
+        {
+            case rocksdb::WriteStallCondition::kDelayed:
+                _stall_delayed_count.fetch_add(
+                    1, std::memory_order_relaxed);
+                break;
+
+            case rocksdb::WriteStallCondition::kStopped:
+                _stall_stopped_count.fetch_add(
+                    1, std::memory_order_relaxed);
+                break;
+
+            default:
+                break;
+        }
+    }
+
+    void RocksDBEventListener::collect(
+        RocksDBStatistics& statistics
+    )
+    {
+        statistics.flush_count =
+            _flush_count.load(std::memory_order_relaxed);
+        statistics.flush_total_microseconds =
+            _flush_total_microseconds.load(std::memory_order_relaxed);
+        statistics.flush_maximum_microseconds =
+            _flush_maximum_microseconds.load(std::memory_order_relaxed);
+        statistics.compaction_count =
+            _compaction_count.load(std::memory_order_relaxed);
+        statistics.compaction_total_microseconds =
+            _compaction_total_microseconds.load(std::memory_order_relaxed);
+        statistics.compaction_maximum_microseconds =
+            _compaction_maximum_microseconds.load(std::memory_order_relaxed);
+        statistics.stall_condition_change_count =
+            _stall_condition_change_count.load(std::memory_order_relaxed);
+        statistics.stall_delayed_count =
+            _stall_delayed_count.load(std::memory_order_relaxed);
+        statistics.stall_stopped_count =
+            _stall_stopped_count.load(std::memory_order_relaxed);
+    }
+
+    void RocksDBEventListener::reset()
+    {
+        {
+            std::scoped_lock lock(_mutex);
+
+            _flush_begin_times.clear();
+        }
+
+        _flush_count.store(0, std::memory_order_relaxed);
+        _flush_total_microseconds.store(0, std::memory_order_relaxed);
+        _flush_maximum_microseconds.store(0, std::memory_order_relaxed);
+        _compaction_count.store(0, std::memory_order_relaxed);
+        _compaction_total_microseconds.store(0, std::memory_order_relaxed);
+        _compaction_maximum_microseconds.store(0, std::memory_order_relaxed);
+        _stall_condition_change_count.store(0, std::memory_order_relaxed);
+        _stall_delayed_count.store(0, std::memory_order_relaxed);
+        _stall_stopped_count.store(0, std::memory_order_relaxed);
+    }
+
+    void RocksDBEventListener::_update_maximum(
+        std::atomic<uint64_t>& maximum,
+        const uint64_t& value
+    )
+    {
+        uint64_t current = maximum.load(std::memory_order_relaxed);
+        while (current < value &&
+            !maximum.compare_exchange_weak(
+                current, value, std::memory_order_relaxed))
+        {
+
+        }
+    }
+}
@@ -0,0 +1,8 @@
+#include "pch.hpp"
+
+#include "../includes/rocksdb_statistics.hpp"
+
+namespace QLogicaeCore
+{
+
+}
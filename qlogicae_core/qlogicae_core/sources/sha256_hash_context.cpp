@@ -0,0 +1,145 @@
+#include "pch.hpp"
+
+#include "../includes/sha256_hash_context.hpp"
+
+namespace QLogicaeCore
+{
+    SHA256HashContext::SHA256HashContext()
+    {
+        setup();
+    }
+
+    void SHA256HashContext::setup()
+    {
+        _state = SHA256Kernels::INITIAL_STATE;
+        _buffer_size = 0;
+        _total_size = 0;
+    }
+
+    void SHA256HashContext::setup(
+        Result<void>& result
+    )
+    {
+        setup();
+
+        result.set_to_good_status_without_value();
+    }
+
+    void SHA256HashContext::update(
+        std::span<const unsigned char> bytes
+    )
+    {
+        _total_size += bytes.size();
+
+        if (_buffer_size != 0)
+        {
+            const std::size_t size = std::min(
+                bytes.size(), SHA256Kernels::BLOCK_SIZE - _buffer_size);
+            std::memcpy(_buffer.data() + _buffer_size, bytes.data(), size);
+            _buffer_size += size;
+            bytes = bytes.subspan(size);
+
+            if (_buffer_size != SHA256Kernels::BLOCK_SIZE)
+            {
+                return;
+            }
+
+            SHA256Kernels::compress(_state, _buffer.data(), 1);
+            _buffer_size = 0;
+        }
+
+        const std::size_t block_count =
+            bytes.size() / SHA256Kernels::BLOCK_SIZE;
+        if (block_count != 0)
+        {
+            SHA256Kernels::compress(_state, bytes.data(), block_count);
+            bytes = bytes.subspan(block_count * SHA256Kernels::BLOCK_SIZE);
+        }
+
+        if (!bytes.empty())
+        {
+            std::memcpy(_buffer.data(), bytes.data(), bytes.size());
+            _buffer_size = bytes.size();
+        }
+    }
+
+    void SHA256HashContext::update(
+        const std::string_view& text
+    )
+    {
+        update(std::span<const unsigned char>(
+            reinterpret_cast<const unsigned char*>(text.data()),
+            text.size()
+        ));
+    }
+
+    void SHA256HashContext::update(
+        Result<void>& result,
+        std::span<const unsigned char> bytes
+    )
+    {
+        update(bytes);
+
+        result.set_to_good_status_without_value();
+    }
+
+    void SHA256HashContext::update(
+        Result<void>& result,
+        const std::string_view& text
+    )
+    {
+        update(text);
+
+        result.set_to_good_status_without_value();
+    }
+
+    std::array<unsigned char, SHA256Kernels::DIGEST_SIZE>
+        SHA256HashContext::finalize()
+    {
+        const std::uint64_t bit_size = _total_size * 8;
+        const std::size_t padded_size =
+            _buffer_size + 9 <= SHA256Kernels::BLOCK_SIZE ?
+                SHA256Kernels::BLOCK_SIZE : SHA256Kernels::BLOCK_SIZE * 2;
+
+        unsigned char tail[SHA256Kernels::BLOCK_SIZE * 2] = {};
+        std::memcpy(tail, _buffer.data(), _buffer_size);
+        tail[_buffer_size] = 0x80;
+        for (std::size_t index = 0; index < 8; ++index)
+        {
+            tail[padded_size - 1 - index] =
+                static_cast<unsigned char>(bit_size >> (index * 8));
+        }
+
+        SHA256Kernels::compress(
+            _state, tail, padded_size / SHA256Kernels::BLOCK_SIZE);
+
+        std::array<unsigned char, SHA256Kernels::DIGEST_SIZE> digest;
+        for (std::size_t index = 0; index < _state.size(); ++index)
+        {
+            digest[index * 4] =
+                static_cast<unsigned char>(_state[index] >> 24);
+            digest[index * 4 + 1] =
+                static_cast<unsigned char>(_state[index] >> 16);
+            digest[index * 4 + 2] =
+                static_cast<unsigned char>(_state[index] >> 8);
+            digest[index * 4 + 3] =
+                static_cast<unsigned char>(_state[index]);
+        }
+
+        setup();
+
+        return digest;
+    }
+
+    void SHA256HashContext::finalize(
+        Result<std::array<unsigned char, SHA256Kernels::DIGEST_SIZE>>& result
+    )
+    {
+        result.set_to_good_status_with_value(finalize());
+    }
+
+    std::uint64_t SHA256HashContext::get_total_size() const
+    {
+        return _total_size;
+    }
+}
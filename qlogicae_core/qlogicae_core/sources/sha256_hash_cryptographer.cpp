@@ -125,13 +125,12 @@ namespace QLogicaeCore
 
 		unsigned char digest[crypto_hash_sha256_BYTES];
 
-		if (crypto_hash_sha256(
-			digest,
-			reinterpret_cast<const unsigned char*>(va.data()),
-			va.size()) != 0)
-		{
-			return "";
-		}
+		SHA256Kernels::hash(
+			std::span<const unsigned char>(
+				reinterpret_cast<const unsigned char*>(va.data()),
+				va.size()),
+			std::span<unsigned char, crypto_hash_sha256_BYTES>(digest)
+		);
 
 		return ENCODER.from_bytes_to_base64(
 			digest,
@@ -223,15 +222,12 @@ namespace QLogicaeCore
 
 		unsigned char digest[crypto_hash_sha256_BYTES];
 
-		if (crypto_hash_sha256(
-			digest,
-			reinterpret_cast<const unsigned char*>(text.data()),
-			text.size()) != 0)
-		{			
-			return result.set_to_bad_status_with_value(
-				"Encryption failed"
-			);
-		}
+		SHA256Kernels::hash(
+			std::span<const unsigned char>(
+				reinterpret_cast<const unsigned char*>(text.data()),
+				text.size()),
+			std::span<unsigned char, crypto_hash_sha256_BYTES>(digest)
+		);
 
 		ENCODER.from_bytes_to_base64(
 			result,
@@ -431,6 +427,186 @@ namespace QLogicaeCore
 		);
 	}
 
+	std::string SHA256HashCryptographer::transform_file(
+		const std::string& file_path
+	)
+	{
+		try
+		{
+			Result<std::string> result;
+
+			transform_file(result, file_path);
+
+			return result.get_value();
+		}
+		catch (const std::exception& exception)
+		{
+			LOGGER.handle_exception_async(
+				"QLogicaeCore::SHA256HashCryptographer::transform_file()",
+				exception.what()
+			);
+
+			return "";
+		}
+	}
+
+	std::vector<unsigned char> SHA256HashCryptographer::transform_batch(
+		std::span<const std::string_view> texts
+	)
+	{
+		try
+		{
+			std::vector<unsigned char> digests(
+				texts.size() * crypto_hash_sha256_BYTES
+			);
+			Result<std::size_t> result;
+
+			transform_batch(result, texts, digests);
+			if (!result.is_status_safe())
+			{
+				return {};
+			}
+
+			return digests;
+		}
+		catch (const std::exception& exception)
+		{
+			LOGGER.handle_exception_async(
+				"QLogicaeCore::SHA256HashCryptographer::transform_batch()",
+				exception.what()
+			);
+
+			return {};
+		}
+	}
+
+	void SHA256HashCryptographer::transform(
+		Result<std::size_t>& result,
+		std::span<const unsigned char> bytes,
+		std::span<unsigned char> digest
+	)
+	{
+		if (digest.size() < crypto_hash_sha256_BYTES)
+		{
+			return result.set_to_bad_status_without_value(
+				"Digest buffer is too small"
+			);
+		}
+
+		SHA256Kernels::hash(
+			bytes,
+			digest.first<crypto_hash_sha256_BYTES>()
+		);
+
+		result.set_to_good_status_with_value(
+			crypto_hash_sha256_BYTES
+		);
+	}
+
+	void SHA256HashCryptographer::transform_file(
+		Result<std::string>& result,
+		const std::string& file_path
+	)
+	{
+		BinaryFileIO file(file_path);
+		std::vector<unsigned char> buffer(UTILITIES.SHA256_STREAM_CHUNK_SIZE);
+		SHA256HashContext context;
+		for (std::uint64_t offset = 0;;)
+		{
+			Result<std::size_t> read_result;
+			file.read_block(
+				read_result,
+				offset,
+				std::as_writable_bytes(std::span(buffer))
+			);
+			if (!read_result.is_status_safe())
+			{
+				file.close(FileMode::READ);
+
+				return result.set_to_bad_status_without_value(
+					read_result.get_message()
+				);
+			}
+
+			const std::size_t size = read_result.get_value();
+			context.update(std::span<const unsigned char>(buffer.data(), size));
+			offset += size;
+			if (size < buffer.size())
+			{
+				break;
+			}
+		}
+		file.close(FileMode::READ);
+
+		const std::array<unsigned char, crypto_hash_sha256_BYTES> digest =
+			context.finalize();
+
+		result.set_to_good_status_with_value(
+			ENCODER.from_bytes_to_base64(
+				digest.data(),
+				digest.size()
+			)
+		);
+	}
+
+	void SHA256HashCryptographer::transform_batch(
+		Result<std::size_t>& result,
+		std::span<const std::string_view> texts,
+		std::span<unsigned char> digests
+	)
+	{
+		if (digests.size() < texts.size() * crypto_hash_sha256_BYTES)
+		{
+			return result.set_to_bad_status_without_value(
+				"Digest buffer is too small for the batch"
+			);
+		}
+
+		const std::size_t chunk_count =
+			(texts.size() + UTILITIES.SHA256_BATCH_CHUNK_SIZE - 1) /
+				UTILITIES.SHA256_BATCH_CHUNK_SIZE;
+		auto run_chunk = [texts, digests](const std::size_t& chunk_index)
+			{
+				const std::size_t begin =
+					chunk_index * UTILITIES.SHA256_BATCH_CHUNK_SIZE;
+				const std::size_t count = std::min(
+					UTILITIES.SHA256_BATCH_CHUNK_SIZE, texts.size() - begin
+				);
+
+				SHA256Kernels::hash_many(
+					texts.subspan(begin, count),
+					digests.subspan(
+						begin * crypto_hash_sha256_BYTES,
+						count * crypto_hash_sha256_BYTES
+					)
+				);
+			};
+
+		try
+		{
+			if (texts.size() < UTILITIES.SHA256_BATCH_PARALLEL_MINIMUM_COUNT)
+			{
+				for (std::size_t chunk_index = 0; chunk_index < chunk_count;
+					++chunk_index)
+				{
+					run_chunk(chunk_index);
+				}
+			}
+			else
+			{
+				ThreadPool::get_instance().parallel_for(chunk_count, run_chunk);
+			}
+		}
+		catch (const std::exception& exception)
+		{
+			return result.set_to_bad_status_without_value(exception.what());
+		}
+
+		result.set_to_good_status_with_value(
+			texts.size() * crypto_hash_sha256_BYTES
+		);
+	}
+
 	SHA256HashCryptographer& SHA256HashCryptographer::get_instance()
 	{
 		static SHA256HashCryptographer instance;
@@ -0,0 +1,8 @@
+#include "pch.hpp"
+
+#include "../includes/sha256_kernel.hpp"
+
+namespace QLogicaeCore
+{
+
+}
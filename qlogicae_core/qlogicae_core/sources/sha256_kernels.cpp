@@ -0,0 +1,654 @@
+#include "pch.hpp"
+
+#include "../includes/sha256_kernels.hpp"
+
+#include <immintrin.h>
+
+namespace QLogicaeCore
+{
+    alignas(64) static constexpr std::uint32_t SHA256_ROUND_CONSTANTS[64] =
+    {
+        0x428a2f98, 0x71374491, 0xb5c0fbcf, 0xe9b5dba5,
+        0x3956c25b, 0x59f111f1, 0x923f82a4, 0xab1c5ed5,
+        0xd807aa98, 0x12835b01, 0x243185be, 0x550c7dc3,
+        0x72be5d74, 0x80deb1fe, 0x9bdc06a7, 0xc19bf174,
+        0xe49b69c1, 0xefbe4786, 0x0fc19dc6, 0x240ca1cc,
+        0x2de92c6f, 0x4a7484aa, 0x5cb0a9dc, 0x76f988da,
+        0x983e5152, 0xa831c66d, 0xb00327c8, 0xbf597fc7,
+        0xc6e00bf3, 0xd5a79147, 0x06ca6351, 0x14292967,
+        0x27b70a85, 0x2e1b2138, 0x4d2c6dfc, 0x53380d13,
+        0x650a7354, 0x766a0abb, 0x81c2c92e, 0x92722c85,
+        0xa2bfe8a1, 0xa81a664b, 0xc24b8b70, 0xc76c51a3,
+        0xd192e819, 0xd6990624, 0xf40e3585, 0x106aa070,
+        0x19a4c116, 0x1e376c08, 0x2748774c, 0x34b0bcb5,
+        0x391c0cb3, 0x4ed8aa4a, 0x5b9cca4f, 0x682e6ff3,
+        0x748f82ee, 0x78a5636f, 0x84c87814, 0x8cc70208,
+        0x90befffa, 0xa4506ceb, 0xbef9a3f7, 0xc67178f2
+    };
+
+    static std::uint32_t load_big_endian(
+        const unsigned char* bytes
+    )
+    {
+        return (static_cast<std::uint32_t>(bytes[0]) << 24) |
+            (static_cast<std::uint32_t>(bytes[1]) << 16) |
+            (static_cast<std::uint32_t>(bytes[2]) << 8) |
+            static_cast<std::uint32_t>(bytes[3]);
+    }
+
+    static void store_big_endian(
+        const std::uint32_t value,
+        unsigned char* bytes
+    )
+    {
+        bytes[0] = static_cast<unsigned char>(value >> 24);
+        bytes[1] = static_cast<unsigned char>(value >> 16);
+        bytes[2] = static_cast<unsigned char>(value >> 8);
+        bytes[3] = static_cast<unsigned char>(value);
+    }
+
+    static std::size_t get_padded_block_count(
+        const std::size_t size
+    )
+    {
+        return (size + 9 + SHA256Kernels::BLOCK_SIZE - 1) /
+            SHA256Kernels::BLOCK_SIZE;
+    }
+
+    static std::size_t write_padding(
+        const unsigned char* tail,
+        const std::size_t tail_size,
+        const std::uint64_t total_size,
+        unsigned char* output
+    )
+    {
+        const std::size_t size = tail_size + 9 <= SHA256Kernels::BLOCK_SIZE ?
+            SHA256Kernels::BLOCK_SIZE : SHA256Kernels::BLOCK_SIZE * 2;
+        std::memset(output, 0, size);
+        if (tail_size != 0)
+        {
+            std::memcpy(output, tail, tail_size);
+        }
+
+        output[tail_size] = 0x80;
+        const std::uint64_t bit_size = total_size * 8;
+        store_big_endian(static_cast<std::uint32_t>(bit_size >> 32),
+            output + size - 8);
+        store_big_endian(static_cast<std::uint32_t>(bit_size),
+            output + size - 4);
+
+        return size / SHA256Kernels::BLOCK_SIZE;
+    }
+
+    struct SHA256ScalarBlock
+    {
+        static void compress(
+            std::uint32_t* state,
+            const unsigned char* blocks,
+            std::size_t block_count
+        )
+        {
+            std::uint32_t words[64];
+            for (; block_count != 0;
+                --block_count, blocks += SHA256Kernels::BLOCK_SIZE)
+            {
+                for (std::size_t index = 0; index < 16; ++index)
+                {
+                    words[index] = load_big_endian(blocks + index * 4);
+                }
+
+                for (std::size_t index = 16; index < 64; ++index)
+                {
+                    const std::uint32_t sigma0 =
+                        std::rotr(words[index - 15], 7) ^
+                        std::rotr(words[index - 15], 18) ^
+                        (words[index - 15] >> 3);
+                    const std::uint32_t sigma1 =
+                        std::rotr(words[index - 2], 17) ^
+                        std::rotr(words[index - 2], 19) ^
+                        (words[index - 2] >> 10);
+                    words[index] = words[index - 16] + sigma0 +
+                        words[index - 7] + sigma1;
+                }
+
+                std::uint32_t a = state[0];
+                std::uint32_t b = state[1];
+                std::uint32_t c = state[2];
+                std::uint32_t d = state[3];
+                std::uint32_t e = state[4];
+                std::uint32_t f = state[5];
+                std::uint32_t g = state[6];
+                std::uint32_t h = state[7];
+                for (std::size_t index = 0; index < 64; ++index)
+                {
+                    const std::uint32_t temporary1 = h +
+                        (std::rotr(e, 6) ^ std::rotr(e, 11) ^
+                            std::rotr(e, 25)) +
+                        (g ^ (e & (f ^ g))) +
+                        SHA256_ROUND_CONSTANTS[index] + words[index];
+                    const std::uint32_t temporary2 =
+                        (std::rotr(a, 2) ^ std::rotr(a, 13) ^
+                            std::rotr(a, 22)) +
+                        ((a & b) | (c & (a | b)));
+                    h = g;
+                    g = f;
+                    f = e;
+                    e = d + temporary1;
+                    d = c;
+                    c = b;
+                    b = a;
+                    a = temporary1 + temporary2;
+                }
+
+                state[0] += a;
+                state[1] += b;
+                state[2] += c;
+                state[3] += d;
+                state[4] += e;
+                state[5] += f;
+                state[6] += g;
+                state[7] += h;
+            }
+        }
+    };
+
+    struct SHA256ShaBlock
+    {
+        static void compress(
+            std::uint32_t* state,
+            const unsigned char* blocks,
+            std::size_t block_count
+        )
+        {
+            const __m128i byte_order = _mm_set_epi64x(
+                0x0c0d0e0f08090a0bULL, 0x0405060700010203ULL);
+
+            __m128i temporary = _mm_loadu_si128(
+                reinterpret_cast<const __m128i*>(state));
+            __m128i state1 = _mm_loadu_si128(
+                reinterpret_cast<const __m128i*>(state + 4));
+            temporary = _mm_shuffle_epi32(temporary, 0xB1);
+            state1 = _mm_shuffle_epi32(state1, 0x1B);
+            __m128i state0 = _mm_alignr_epi8(temporary, state1, 8);
+            state1 = _mm_blend_epi16(state1, temporary, 0xF0);
+
+            for (; block_count != 0;
+                --block_count, blocks += SHA256Kernels::BLOCK_SIZE)
+            {
+                const __m128i saved_state0 = state0;
+                const __m128i saved_state1 = state1;
+
+                __m128i messages[4];
+                for (std::size_t index = 0; index < 4; ++index)
+                {
+                    messages[index] = _mm_shuffle_epi8(
+                        _mm_loadu_si128(reinterpret_cast<const __m128i*>(
+                            blocks + index * 16)),
+                        byte_order
+                    );
+                }
+
+                for (std::size_t group = 0; group < 16; ++group)
+                {
+                    __m128i message = _mm_add_epi32(
+                        messages[group % 4],
+                        _mm_load_si128(reinterpret_cast<const __m128i*>(
+                            SHA256_ROUND_CONSTANTS + group * 4))
+                    );
+                    state1 = _mm_sha256rnds2_epu32(state1, state0, message);
+                    message = _mm_shuffle_epi32(message, 0x0E);
+                    state0 = _mm_sha256rnds2_epu32(state0, state1, message);
+
+                    if (group >= 3 && group <= 14)
+                    {
+                        __m128i& next = messages[(group + 1) % 4];
+                        next = _mm_add_epi32(next, _mm_alignr_epi8(
+                            messages[group % 4],
+                            messages[(group + 3) % 4],
+                            4
+                        ));
+                        next = _mm_sha256msg2_epu32(next, messages[group % 4]);
+                    }
+
+                    if (group >= 1 && group <= 12)
+                    {
+                        messages[(group + 3) % 4] = _mm_sha256msg1_epu32(
+                            messages[(group + 3) % 4],
+                            messages[group % 4]
+                        );
+                    }
+                }
+
+                state0 = _mm_add_epi32(state0, saved_state0);
+                state1 = _mm_add_epi32(state1, saved_state1);
+            }
+
+            temporary = _mm_shuffle_epi32(state0, 0x1B);
+            state1 = _mm_shuffle_epi32(state1, 0xB1);
+            state0 = _mm_blend_epi16(temporary, state1, 0xF0);
+            state1 = _mm_alignr_epi8(state1, temporary, 8);
+            _mm_storeu_si128(reinterpret_cast<__m128i*>(state), state0);
+            _mm_storeu_si128(reinterpret_cast<__m128i*>(state + 4), state1);
+        }
+    };
+
+    struct SHA256Avx2Lanes
+    {
+        static constexpr std::size_t LANE_COUNT = 8;
+
+        static __m256i rotate_right(
+            const __m256i value,
+            const int count
+        )
+        {
+            return _mm256_or_si256(
+                _mm256_srli_epi32(value, count),
+                _mm256_slli_epi32(value, 32 - count)
+            );
+        }
+
+        static void load_words(
+            const unsigned char* const* blocks,
+            const std::size_t offset,
+            __m256i* words
+        )
+        {
+            const __m256i byte_order = _mm256_setr_epi8(
+                3, 2, 1, 0, 7, 6, 5, 4, 11, 10, 9, 8, 15, 14, 13, 12,
+                3, 2, 1, 0, 7, 6, 5, 4, 11, 10, 9, 8, 15, 14, 13, 12);
+
+            __m256i rows[LANE_COUNT];
+            for (std::size_t lane = 0; lane < LANE_COUNT; ++lane)
+            {
+                rows[lane] = _mm256_shuffle_epi8(
+                    _mm256_loadu_si256(reinterpret_cast<const __m256i*>(
+                        blocks[lane] + offset)),
+                    byte_order
+                );
+            }
+
+            const __m256i low01 = _mm256_unpacklo_epi32(rows[0], rows[1]);
+            const __m256i high01 = _mm256_unpackhi_epi32(rows[0], rows[1]);
+            const __m256i low23 = _mm256_unpacklo_epi32(rows[2], rows[3]);
+            const __m256i high23 = _mm256_unpackhi_epi32(rows[2], rows[3]);
+            const __m256i low45 = _mm256_unpacklo_epi32(rows[4], rows[5]);
+            const __m256i high45 = _mm256_unpackhi_epi32(rows[4], rows[5]);
+            const __m256i low67 = _mm256_unpacklo_epi32(rows[6], rows[7]);
+            const __m256i high67 = _mm256_unpackhi_epi32(rows[6], rows[7]);
+
+            const __m256i word04_0123 = _mm256_unpacklo_epi64(low01, low23);
+            const __m256i word15_0123 = _mm256_unpackhi_epi64(low01, low23);
+            const __m256i word26_0123 = _mm256_unpacklo_epi64(high01, high23);
+            const __m256i word37_0123 = _mm256_unpackhi_epi64(high01, high23);
+            const __m256i word04_4567 = _mm256_unpacklo_epi64(low45, low67);
+            const __m256i word15_4567 = _mm256_unpackhi_epi64(low45, low67);
+            const __m256i word26_4567 = _mm256_unpacklo_epi64(high45, high67);
+            const __m256i word37_4567 = _mm256_unpackhi_epi64(high45, high67);
+
+            words[0] = _mm256_permute2x128_si256(word04_0123, word04_4567, 0x20);
+            words[1] = _mm256_permute2x128_si256(word15_0123, word15_4567, 0x20);
+            words[2] = _mm256_permute2x128_si256(word26_0123, word26_4567, 0x20);
+            words[3] = _mm256_permute2x128_si256(word37_0123, word37_4567, 0x20);
+            words[4] = _mm256_permute2x128_si256(word04_0123, word04_4567, 0x31);
+            words[5] = _mm256_permute2x128_si256(word15_0123, word15_4567, 0x31);
+            words[6] = _mm256_permute2x128_si256(word26_0123, word26_4567, 0x31);
+            words[7] = _mm256_permute2x128_si256(word37_0123, word37_4567, 0x31);
+        }
+
+        static void compress(
+            __m256i* state,
+            const unsigned char* const* blocks,
+            const __m256i active
+        )
+        {
+            __m256i words[16];
+            load_words(blocks, 0, words);
+            load_words(blocks, 32, words + 8);
+
+            __m256i a = state[0];
+            __m256i b = state[1];
+            __m256i c = state[2];
+            __m256i d = state[3];
+            __m256i e = state[4];
+            __m256i f = state[5];
+            __m256i g = state[6];
+            __m256i h = state[7];
+            for (std::size_t index = 0; index < 64; ++index)
+            {
+                if (index >= 16)
+                {
+                    const __m256i word15 = words[(index - 15) % 16];
+                    const __m256i word2 = words[(index - 2) % 16];
+                    const __m256i sigma0 = _mm256_xor_si256(
+                        _mm256_xor_si256(rotate_right(word15, 7),
+                            rotate_right(word15, 18)),
+                        _mm256_srli_epi32(word15, 3));
+                    const __m256i sigma1 = _mm256_xor_si256(
+                        _mm256_xor_si256(rotate_right(word2, 17),
+                            rotate_right(word2, 19)),
+                        _mm256_srli_epi32(word2, 10));
+                    words[index % 16] = _mm256_add_epi32(
+                        _mm256_add_epi32(words[index % 16], sigma0),
+                        _mm256_add_epi32(words[(index - 7) % 16], sigma1));
+                }
+
+                const __m256i sum1 = _mm256_xor_si256(
+                    _mm256_xor_si256(rotate_right(e, 6), rotate_right(e, 11)),
+                    rotate_right(e, 25));
+                const __m256i choice = _mm256_xor_si256(g,
+                    _mm256_and_si256(e, _mm256_xor_si256(f, g)));
+                const __m256i temporary1 = _mm256_add_epi32(
+                    _mm256_add_epi32(h, sum1),
+                    _mm256_add_epi32(
+                        _mm256_add_epi32(choice, words[index % 16]),
+                        _mm256_set1_epi32(static_cast<int>(
+                            SHA256_ROUND_CONSTANTS[index]))));
+                const __m256i sum0 = _mm256_xor_si256(
+                    _mm256_xor_si256(rotate_right(a, 2), rotate_right(a, 13)),
+                    rotate_right(a, 22));
+                const __m256i majority = _mm256_or_si256(
+                    _mm256_and_si256(a, b),
+                    _mm256_and_si256(c, _mm256_or_si256(a, b)));
+                h = g;
+                g = f;
+                f = e;
+                e = _mm256_add_epi32(d, temporary1);
+                d = c;
+                c = b;
+                b = a;
+                a = _mm256_add_epi32(temporary1,
+                    _mm256_add_epi32(sum0, majority));
+            }
+
+            const __m256i updates[8] = { a, b, c, d, e, f, g, h };
+            for (std::size_t index = 0; index < 8; ++index)
+            {
+                state[index] = _mm256_blendv_epi8(
+                    state[index],
+                    _mm256_add_epi32(state[index], updates[index]),
+                    active
+                );
+            }
+        }
+
+        static void hash(
+            const std::string_view* messages,
+            unsigned char* const* digests,
+            const std::size_t count
+        )
+        {
+            alignas(32) static constexpr unsigned char EMPTY_BLOCK[
+                SHA256Kernels::BLOCK_SIZE] = {};
+            unsigned char tails[LANE_COUNT][SHA256Kernels::BLOCK_SIZE * 2];
+            std::size_t full_block_counts[LANE_COUNT] = {};
+            std::size_t block_counts[LANE_COUNT] = {};
+            std::size_t maximum_block_count = 0;
+            for (std::size_t lane = 0; lane < count; ++lane)
+            {
+                const std::string_view message = messages[lane];
+                full_block_counts[lane] =
+                    message.size() / SHA256Kernels::BLOCK_SIZE;
+                const std::size_t tail_offset =
+                    full_block_counts[lane] * SHA256Kernels::BLOCK_SIZE;
+                block_counts[lane] = full_block_counts[lane] + write_padding(
+                    reinterpret_cast<const unsigned char*>(message.data()) +
+                        tail_offset,
+                    message.size() - tail_offset,
+                    message.size(),
+                    tails[lane]
+                );
+                maximum_block_count =
+                    std::max(maximum_block_count, block_counts[lane]);
+            }
+
+            __m256i state[8];
+            for (std::size_t index = 0; index < 8; ++index)
+            {
+                state[index] = _mm256_set1_epi32(static_cast<int>(
+                    SHA256Kernels::INITIAL_STATE[index]));
+            }
+
+            const unsigned char* blocks[LANE_COUNT];
+            alignas(32) std::int32_t active[LANE_COUNT];
+            for (std::size_t block = 0; block < maximum_block_count; ++block)
+            {
+                for (std::size_t lane = 0; lane < LANE_COUNT; ++lane)
+                {
+                    active[lane] = lane < count &&
+                        block < block_counts[lane] ? -1 : 0;
+                    if (active[lane] == 0)
+                    {
+                        blocks[lane] = EMPTY_BLOCK;
+                    }
+                    else if (block < full_block_counts[lane])
+                    {
+                        blocks[lane] = reinterpret_cast<const unsigned char*>(
+                            messages[lane].data()) +
+                            block * SHA256Kernels::BLOCK_SIZE;
+                    }
+                    else
+                    {
+                        blocks[lane] = tails[lane] +
+                            (block - full_block_counts[lane]) *
+                                SHA256Kernels::BLOCK_SIZE;
+                    }
+                }
+
+                compress(state, blocks, _mm256_load_si256(
+                    reinterpret_cast<const __m256i*>(active)));
+            }
+
+            alignas(32) std::uint32_t words[8][LANE_COUNT];
+            for (std::size_t index = 0; index < 8; ++index)
+            {
+                _mm256_store_si256(
+                    reinterpret_cast<__m256i*>(words[index]), state[index]);
+            }
+
+            for (std::size_t lane = 0; lane < count; ++lane)
+            {
+                for (std::size_t index = 0; index < 8; ++index)
+                {
+                    store_big_endian(words[index][lane],
+                        digests[lane] + index * 4);
+                }
+            }
+        }
+    };
+
+    template<typename Block>
+    static void hash_blocks(
+        const std::span<const unsigned char> bytes,
+        unsigned char* digest
+    )
+    {
+        std::uint32_t state[8];
+        std::memcpy(state, SHA256Kernels::INITIAL_STATE.data(), sizeof(state));
+
+        const std::size_t full_block_count =
+            bytes.size() / SHA256Kernels::BLOCK_SIZE;
+        Block::compress(state, bytes.data(), full_block_count);
+
+        unsigned char tail[SHA256Kernels::BLOCK_SIZE * 2];
+        const std::size_t tail_offset =
+            full_block_count * SHA256Kernels::BLOCK_SIZE;
+        const std::size_t tail_block_count = write_padding(
+            bytes.data() + tail_offset,
+            bytes.size() - tail_offset,
+            bytes.size(),
+            tail
+        );
+        Block::compress(state, tail, tail_block_count);
+
+        for (std::size_t index = 0; index < 8; ++index)
+        {
+            store_big_endian(state[index], digest + index * 4);
+        }
+    }
+
+    static void hash_lanes(
+        const std::span<const std::string_view> messages,
+        std::span<unsigned char> digests
+    )
+    {
+        std::vector<std::uint32_t> order(messages.size());
+        for (std::size_t index = 0; index < order.size(); ++index)
+        {
+            order[index] = static_cast<std::uint32_t>(index);
+        }
+
+        std::sort(order.begin(), order.end(),
+            [&messages](const std::uint32_t left, const std::uint32_t right)
+            {
+                return get_padded_block_count(messages[left].size()) <
+                    get_padded_block_count(messages[right].size());
+            });
+
+        std::string_view lane_messages[SHA256Avx2Lanes::LANE_COUNT];
+        unsigned char* lane_digests[SHA256Avx2Lanes::LANE_COUNT];
+        for (std::size_t begin = 0; begin < order.size();
+            begin += SHA256Avx2Lanes::LANE_COUNT)
+        {
+            const std::size_t count = std::min(
+                SHA256Avx2Lanes::LANE_COUNT, order.size() - begin);
+            for (std::size_t lane = 0; lane < count; ++lane)
+            {
+                lane_messages[lane] = messages[order[begin + lane]];
+                lane_digests[lane] = digests.data() +
+                    order[begin + lane] * SHA256Kernels::DIGEST_SIZE;
+            }
+
+            SHA256Avx2Lanes::hash(lane_messages, lane_digests, count);
+        }
+    }
+
+    static SHA256Kernel get_kernel(
+        const SHA256Kernel kernel,
+        const bool is_batch
+    )
+    {
+        if (kernel != SHA256Kernel::AUTOMATIC &&
+            SHA256Kernels::is_kernel_supported(kernel))
+        {
+            return kernel;
+        }
+
+        if (CPU_FEATURES.is_sha_supported())
+        {
+            return SHA256Kernel::SHA;
+        }
+        if (is_batch && CPU_FEATURES.is_avx2_supported())
+        {
+            return SHA256Kernel::AVX2;
+        }
+
+        return SHA256Kernel::SCALAR;
+    }
+
+    void SHA256Kernels::compress(
+        std::array<std::uint32_t, 8>& state,
+        const unsigned char* blocks,
+        const std::size_t block_count
+    )
+    {
+        if (CPU_FEATURES.is_sha_supported())
+        {
+            return SHA256ShaBlock::compress(state.data(), blocks, block_count);
+        }
+
+        SHA256ScalarBlock::compress(state.data(), blocks, block_count);
+    }
+
+    void SHA256Kernels::hash(
+        const std::span<const unsigned char> bytes,
+        std::span<unsigned char, DIGEST_SIZE> digest
+    )
+    {
+        hash(bytes, digest, SHA256Kernel::AUTOMATIC);
+    }
+
+    void SHA256Kernels::hash(
+        const std::span<const unsigned char> bytes,
+        std::span<unsigned char, DIGEST_SIZE> digest,
+        const SHA256Kernel kernel
+    )
+    {
+        switch (get_kernel(kernel, false))
+        {
+        case SHA256Kernel::SHA:
+            return hash_blocks<SHA256ShaBlock>(bytes, digest.data());
+
+        case SHA256Kernel::AVX2:
+        {
+            const std::string_view message(
+                reinterpret_cast<const char*>(bytes.data()), bytes.size());
+
+            return hash_lanes(
+                std::span<const std::string_view>(&message, 1), digest);
+        }
+
+        default:
+            return hash_blocks<SHA256ScalarBlock>(bytes, digest.data());
+        }
+    }
+
+    bool SHA256Kernels::hash_many(
+        const std::span<const std::string_view> messages,
+        std::span<unsigned char> digests
+    )
+    {
+        return hash_many(messages, digests, SHA256Kernel::AUTOMATIC);
+    }
+
+    bool SHA256Kernels::hash_many(
+        const std::span<const std::string_view> messages,
+        std::span<unsigned char> digests,
+        const SHA256Kernel kernel
+    )
+    {
+        if (digests.size() < messages.size() * DIGEST_SIZE)
+        {
+            return false;
+        }
+
+        const SHA256Kernel selected_kernel = get_kernel(kernel, true);
+        if (selected_kernel == SHA256Kernel::AVX2)
+        {
+            hash_lanes(messages, digests);
+
+            return true;
+        }
+
+        for (std::size_t index = 0; index < messages.size(); ++index)
+        {
+            hash(
+                std::span<const unsigned char>(
+                    reinterpret_cast<const unsigned char*>(
+                        messages[index].data()),
+                    messages[index].size()),
+                std::span<unsigned char, DIGEST_SIZE>(
+                    digests.data() + index * DIGEST_SIZE, DIGEST_SIZE),
+                selected_kernel
+            );
+        }
+
+        return true;
+    }
+
+    bool SHA256Kernels::is_kernel_supported(
+        const SHA256Kernel kernel
+    )
+    {
+        switch (kernel)
+        {
+        case SHA256Kernel::SHA:
+            return CPU_FEATURES.is_sha_supported();
+
+        case SHA256Kernel::AVX2:
+            return CPU_FEATURES.is_avx2_supported();
+
+        default:
+            return true;
+        }
+    }
+}
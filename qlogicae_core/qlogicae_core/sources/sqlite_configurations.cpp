@@ -0,0 +1,8 @@
+#include "pch.hpp"
+
+#include "../includes/sqlite_configurations.hpp"
+
+namespace QLogicaeCore
+{
+
+}
@@ -4,18 +4,161 @@
 
 namespace QLogicaeCore
 {
-    SQLiteDatabase::SQLiteDatabase(const std::string& file_path)
+    SQLiteDatabase::SQLiteDatabase(
+        const std::string& file_path
+    )
+        : statement_cache_capacity(configurations.statement_cache_capacity)
+    {
+        open_connections(file_path);
+    }
+
+    SQLiteDatabase::SQLiteDatabase(
+        const std::string& file_path,
+        const SQLiteConfigurations& configurations_value
+    )
+        : configurations(configurations_value),
+        statement_cache_capacity(configurations_value.statement_cache_capacity)
+    {
+        open_connections(file_path);
+    }
+
+    void SQLiteDatabase::open_connections(
+        const std::string& file_path
+    )
     {
         sqlite3* raw_handle = nullptr;
         int result = sqlite3_open(file_path.c_str(), &raw_handle);
         if (result != SQLITE_OK)
         {
+            sqlite3_close(raw_handle);
             throw SQLiteException("Failed to open database", result, result);
         }
         backend = std::make_shared<SQLiteBackend>(raw_handle);
+        apply_pragmas(backend->database_handle, false);
+
+        for (size_t index = 0;
+            index < configurations.reader_connection_count;
+            ++index)
+        {
+            sqlite3* raw_reader_handle = nullptr;
+            result = sqlite3_open_v2(
+                file_path.c_str(),
+                &raw_reader_handle,
+                SQLITE_OPEN_READONLY | SQLITE_OPEN_URI,
+                nullptr
+            );
+            if (result != SQLITE_OK)
+            {
+                sqlite3_close(raw_reader_handle);
+                throw SQLiteException(
+                    "Failed to open reader connection", result, result);
+            }
+            reader_backends.push_back(
+                std::make_shared<SQLiteBackend>(raw_reader_handle)
+            );
+            reader_statement_caches.emplace_back();
+            apply_pragmas(raw_reader_handle, true);
+        }
+    }
+
+    void SQLiteDatabase::apply_pragmas(
+        sqlite3* database_handle,
+        const bool& is_reader
+    )
+    {
+        std::vector<std::string> pragmas;
+        if (configurations.busy_timeout_in_milliseconds > 0)
+        {
+            sqlite3_busy_timeout(
+                database_handle,
+                configurations.busy_timeout_in_milliseconds
+            );
+        }
+        if (configurations.is_wal_mode_enabled && !is_reader)
+        {
+            std::string journal_mode;
+            int result = sqlite3_exec(
+                database_handle,
+                "PRAGMA journal_mode = WAL;",
+                [](void* output, int column_count, char** values, char**) -> int
+                {
+                    if (column_count > 0 && values[0] != nullptr)
+                    {
+                        *static_cast<std::string*>(output) = values[0];
+                    }
+
+                    return SQLITE_OK;
+                },
+                &journal_mode,
+                nullptr
+            );
+            if (result != SQLITE_OK)
+            {
+                throw SQLiteException(
+                    "Failed to apply pragma",
+                    result,
+                    sqlite3_extended_errcode(database_handle)
+                );
+            }
+            if (journal_mode != "wal")
+            {
+                throw SQLiteException(
+                    "Failed to enable WAL journal mode",
+                    SQLITE_ERROR,
+                    SQLITE_ERROR
+                );
+            }
+        }
+        if (!configurations.synchronous_mode.empty())
+        {
+            pragmas.push_back(
+                "PRAGMA synchronous = " +
+                configurations.synchronous_mode + ";"
+            );
+        }
+        if (configurations.mmap_size > 0)
+        {
+            pragmas.push_back(
+                "PRAGMA mmap_size = " +
+                std::to_string(configurations.mmap_size) + ";"
+            );
+        }
+        if (configurations.cache_size != 0)
+        {
+            pragmas.push_back(
+                "PRAGMA cache_size = " +
+                std::to_string(configurations.cache_size) + ";"
+            );
+        }
+        if (is_reader)
+        {
+            pragmas.push_back("PRAGMA query_only = ON;");
+        }
+
+        for (const std::string& pragma : pragmas)
+        {
+            int result = sqlite3_exec(
+                database_handle,
+                pragma.c_str(),
+                nullptr,
+                nullptr,
+                nullptr
+            );
+            if (result != SQLITE_OK)
+            {
+                throw SQLiteException(
+                    "Failed to apply pragma",
+                    result,
+                    sqlite3_extended_errcode(database_handle)
+                );
+            }
+        }
     }
 
-    SQLiteDatabase::~SQLiteDatabase() = default;
+    SQLiteDatabase::~SQLiteDatabase()
+    {
+        clear_statement_cache();
+    }
 
     SQLiteStatement SQLiteDatabase::prepare(const std::string_view& sql_text)
     {
@@ -25,11 +168,259 @@ namespace QLogicaeCore
     std::future<std::shared_ptr<SQLiteStatement>> SQLiteDatabase::prepare_async(
         const std::string_view& sql_text)
     {
-        return std::async(std::launch::async, [this, sql_text]() {
-            return std::make_shared<SQLiteStatement>(backend, sql_text);
+        return std::async(std::launch::async,
+            [this, sql = std::string(sql_text)]()
+            {
+                return prepare_read(sql);
+            });
+    }
+
+    std::shared_ptr<SQLiteStatement> SQLiteDatabase::prepare_read(
+        const std::string_view& sql_text
+    )
+    {
+        std::shared_ptr<SQLiteStatement> statement =
+            acquire_reader_statement(sql_text);
+        if (statement == nullptr)
+        {
+            return prepare_cached(sql_text);
+        }
+
+        return statement;
+    }
+
+    std::future<void> SQLiteDatabase::query_async(
+        const std::string_view& sql_text,
+        const std::function<void(SQLiteRow& row)>& callback
+    )
+    {
+        return std::async(std::launch::async,
+            [this, sql = std::string(sql_text), callback]()
+            {
+                std::shared_ptr<SQLiteStatement> statement =
+                    prepare_read(sql);
+
+                statement->for_each_row(callback);
             });
     }
 
+    size_t SQLiteDatabase::get_reader_connection_count()
+    {
+        return reader_backends.size();
+    }
+
+    std::shared_ptr<SQLiteStatement> SQLiteDatabase::acquire_reader_statement(
+        const std::string_view& sql_text
+    )
+    {
+        const size_t capacity = get_statement_cache_capacity();
+
+        std::scoped_lock lock(reader_mutex);
+
+        if (reader_backends.empty())
+        {
+            return nullptr;
+        }
+
+        const std::string key(sql_text);
+        for (auto& reader_statement_cache : reader_statement_caches)
+        {
+            auto iterator = reader_statement_cache.find(key);
+            if (iterator == reader_statement_cache.end() ||
+                iterator->second.use_count() > 1)
+            {
+                continue;
+            }
+
+            try
+            {
+                iterator->second->reset();
+            }
+            catch (const SQLiteException&)
+            {
+
+            }
+            iterator->second->clear_bindings();
+
+            return iterator->second;
+        }
+
+        const size_t reader_index = get_least_busy_reader_index();
+        std::shared_ptr<SQLiteStatement> statement;
+        try
+        {
+            statement = std::make_shared<SQLiteStatement>(
+                reader_backends[reader_index], sql_text);
+        }
+        catch (const SQLiteException&)
+        {
+            return nullptr;
+        }
+        if (!statement->is_read_only())
+        {
+            return nullptr;
+        }
+
+        auto& reader_statement_cache = reader_statement_caches[reader_index];
+        if (reader_statement_cache.size() >= capacity)
+        {
+            for (auto iterator = reader_statement_cache.begin();
+                iterator != reader_statement_cache.end();
+                ++iterator)
+            {
+                if (iterator->second.use_count() == 1)
+                {
+                    reader_statement_cache.erase(iterator);
+                    break;
+                }
+            }
+        }
+        if (reader_statement_cache.size() < capacity)
+        {
+            reader_statement_cache.emplace(key, statement);
+        }
+
+        return statement;
+    }
+
+    size_t SQLiteDatabase::get_least_busy_reader_index()
+    {
+        size_t least_busy_index = 0;
+        long least_active_count = std::numeric_limits<long>::max();
+        for (size_t index = 0; index < reader_backends.size(); ++index)
+        {
+            long idle_count = 0;
+            for (const auto& [key, statement] : reader_statement_caches[index])
+            {
+                idle_count += statement.use_count() == 1 ? 1 : 0;
+            }
+
+            const long active_count =
+                reader_backends[index].use_count() - 1 - idle_count;
+            if (active_count <= 0)
+            {
+                return index;
+            }
+            if (active_count < least_active_count)
+            {
+                least_active_count = active_count;
+                least_busy_index = index;
+            }
+        }
+
+        return least_busy_index;
+    }
+
+    std::shared_ptr<SQLiteStatement> SQLiteDatabase::prepare_cached(
+        const std::string_view& sql_text
+    )
+    {
+        std::scoped_lock lock(statement_cache_mutex);
+
+        std::string key(sql_text);
+        auto iterator = statement_cache_lookup.find(key);
+        if (iterator != statement_cache_lookup.end())
+        {
+            std::shared_ptr<SQLiteStatement>& cached_statement =
+                iterator->second->second;
+            if (cached_statement.use_count() > 1)
+            {
+                return std::make_shared<SQLiteStatement>(backend, sql_text);
+            }
+
+            statement_cache_entries.splice(
+                statement_cache_entries.begin(),
+                statement_cache_entries,
+                iterator->second
+            );
+            try
+            {
+                cached_statement->reset();
+            }
+            catch (const SQLiteException&)
+            {
+
+            }
+            cached_statement->clear_bindings();
+
+            return cached_statement;
+        }
+
+        std::shared_ptr<SQLiteStatement> statement =
+            std::make_shared<SQLiteStatement>(backend, sql_text);
+        if (statement_cache_capacity == 0)
+        {
+            return statement;
+        }
+
+        statement_cache_entries.emplace_front(key, statement);
+        statement_cache_lookup.emplace(
+            std::move(key),
+            statement_cache_entries.begin()
+        );
+        evict_statement_cache_entries();
+
+        return statement;
+    }
+
+    size_t SQLiteDatabase::get_statement_cache_size()
+    {
+        std::scoped_lock lock(statement_cache_mutex);
+
+        return statement_cache_entries.size();
+    }
+
+    size_t SQLiteDatabase::get_statement_cache_capacity()
+    {
+        std::scoped_lock lock(statement_cache_mutex);
+
+        return statement_cache_capacity;
+    }
+
+    void SQLiteDatabase::set_statement_cache_capacity(
+        const size_t& value
+    )
+    {
+        std::scoped_lock lock(statement_cache_mutex);
+
+        statement_cache_capacity = value;
+        evict_statement_cache_entries();
+    }
+
+    void SQLiteDatabase::clear_statement_cache()
+    {
+        std::scoped_lock lock(statement_cache_mutex, reader_mutex);
+
+        statement_cache_lookup.clear();
+        statement_cache_entries.clear();
+        for (auto& reader_statement_cache : reader_statement_caches)
+        {
+            reader_statement_cache.clear();
+        }
+    }
+
+    void SQLiteDatabase::execute(
+        const std::string_view& sql_text
+    )
+    {
+        std::shared_ptr<SQLiteStatement> statement =
+            prepare_cached(sql_text);
+
+        statement->step();
+        statement->reset();
+    }
+
+    void SQLiteDatabase::evict_statement_cache_entries()
+    {
+        while (statement_cache_entries.size() > statement_cache_capacity)
+        {
+            statement_cache_lookup.erase(
+                statement_cache_entries.back().first
+            );
+            statement_cache_entries.pop_back();
+        }
+    }
+
     int64_t SQLiteDatabase::last_insert_rowid()
     {
         return sqlite3_last_insert_rowid(backend->database_handle);
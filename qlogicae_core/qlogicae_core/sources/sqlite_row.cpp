@@ -56,6 +56,37 @@ namespace QLogicaeCore
         return text ? std::string(text) : std::string();
     }
 
+    template<>
+    int64_t SQLiteRow::get<int64_t>(
+        int column_index
+    )
+    {
+        if (sqlite3_column_type(statement, column_index) == SQLITE_NULL)
+        {
+            throw SQLiteException("column is null", -1, -1);
+        }
+
+        return sqlite3_column_int64(statement, column_index);
+    }
+
+    template<>
+    std::string_view SQLiteRow::get<std::string_view>(
+        int column_index
+    )
+    {
+        const char* text = reinterpret_cast<const char*>(
+            sqlite3_column_text(statement, column_index));
+        if (text == nullptr)
+        {
+            return std::string_view();
+        }
+
+        return std::string_view(
+            text,
+            static_cast<size_t>(sqlite3_column_bytes(statement, column_index))
+        );
+    }
+
     template<>
     std::optional<std::string> SQLiteRow::get_optional<std::string>(
         int column_index
@@ -111,6 +142,22 @@ namespace QLogicaeCore
         return get<std::string>(get_index(column_name));
     }
 
+    template<>
+    int64_t SQLiteRow::get<int64_t>(
+        const std::string_view& column_name
+    )
+    {
+        return get<int64_t>(get_index(column_name));
+    }
+
+    template<>
+    std::string_view SQLiteRow::get<std::string_view>(
+        const std::string_view& column_name
+    )
+    {
+        return get<std::string_view>(get_index(column_name));
+    }
+
     void SQLiteRow::setup(
         Result<void>& result
     )
@@ -0,0 +1,104 @@
+#include "pch.hpp"
+
+#include "../includes/sqlite_row_cursor.hpp"
+#include "../includes/sqlite_statement.hpp"
+
+namespace QLogicaeCore
+{
+    SQLiteRowCursor::Iterator::Iterator(
+        SQLiteStatement* statement_instance
+    )
+        : statement(statement_instance)
+    {
+        advance();
+    }
+
+    SQLiteRow& SQLiteRowCursor::Iterator::operator*()
+    {
+        return *current_row;
+    }
+
+    SQLiteRow* SQLiteRowCursor::Iterator::operator->()
+    {
+        return &*current_row;
+    }
+
+    SQLiteRowCursor::Iterator& SQLiteRowCursor::Iterator::operator++()
+    {
+        advance();
+
+        return *this;
+    }
+
+    bool SQLiteRowCursor::Iterator::operator==(
+        const Iterator& other
+    ) const
+    {
+        return statement == other.statement;
+    }
+
+    bool SQLiteRowCursor::Iterator::operator!=(
+        const Iterator& other
+    ) const
+    {
+        return !(*this == other);
+    }
+
+    void SQLiteRowCursor::Iterator::advance()
+    {
+        if (statement == nullptr)
+        {
+            return;
+        }
+
+        if (!statement->step())
+        {
+            statement = nullptr;
+            current_row.reset();
+
+            return;
+        }
+
+        if (!current_row.has_value())
+        {
+            current_row = statement->row();
+        }
+    }
+
+    SQLiteRowCursor::SQLiteRowCursor(
+        SQLiteStatement& statement_instance
+    )
+        : statement(statement_instance)
+    {
+
+    }
+
+    SQLiteRowCursor::~SQLiteRowCursor()
+    {
+        try
+        {
+            statement.reset();
+        }
+        catch (...)
+        {
+
+        }
+    }
+
+    SQLiteRowCursor::Iterator SQLiteRowCursor::begin()
+    {
+        return Iterator(&statement);
+    }
+
+    SQLiteRowCursor::Iterator SQLiteRowCursor::end()
+    {
+        return Iterator();
+    }
+
+    void SQLiteRowCursor::setup(
+        Result<void>& result
+    )
+    {
+        result.set_to_good_status_without_value();
+    }
+}
@@ -78,6 +78,12 @@ namespace QLogicaeCore
         return statement != nullptr;
     }
 
+    bool SQLiteStatement::is_read_only()
+    {
+        return statement != nullptr &&
+            sqlite3_stmt_readonly(statement->get()) != 0;
+    }
+
     int SQLiteStatement::resolve_named_index(
         const std::string_view& name
     )
@@ -426,6 +432,83 @@ namespace QLogicaeCore
         return results;
     }
 
+    SQLiteStatement& SQLiteStatement::bind_static(
+        int index,
+        const std::string_view& value
+    )
+    {
+        int result = sqlite3_bind_text64(
+            statement->get(),
+            index,
+            value.empty() ? "" : value.data(),
+            static_cast<sqlite3_uint64>(value.size()),
+            SQLITE_STATIC,
+            SQLITE_UTF8
+        );
+        if (result != SQLITE_OK)
+        {
+            throw SQLiteException(
+                "bind_static(std::string_view) failed",
+                result,
+                sqlite3_extended_errcode(
+                    backend->database_handle
+                )
+            );
+        }
+
+        return *this;
+    }
+
+    SQLiteStatement& SQLiteStatement::bind_static(
+        int index,
+        const std::span<const std::byte>& value
+    )
+    {
+        static constexpr std::byte EMPTY_BLOB {};
+
+        int result = sqlite3_bind_blob64(
+            statement->get(),
+            index,
+            value.empty() ? &EMPTY_BLOB : value.data(),
+            static_cast<sqlite3_uint64>(value.size()),
+            SQLITE_STATIC
+        );
+        if (result != SQLITE_OK)
+        {
+            throw SQLiteException(
+                "bind_static(std::span<const std::byte>) failed",
+                result,
+                sqlite3_extended_errcode(
+                    backend->database_handle
+                )
+            );
+        }
+
+        return *this;
+    }
+
+    int SQLiteStatement::get_parameter_count()
+    {
+        return sqlite3_bind_parameter_count(statement->get());
+    }
+
+    SQLiteRowCursor SQLiteStatement::rows()
+    {
+        return SQLiteRowCursor(*this);
+    }
+
+    void SQLiteStatement::for_each_row(
+        const std::function<void(SQLiteRow& row)>& callback
+    )
+    {
+        SQLiteRowCursor cursor(*this);
+
+        for (SQLiteRow& current_row : cursor)
+        {
+            callback(current_row);
+        }
+    }
+
     std::future<void> SQLiteStatement::step_async()
     {
         return std::async(
@@ -10,10 +10,7 @@ namespace QLogicaeCore
         : database(database_instance),
         committed(false)
     {
-        SQLiteStatement begin_statement =
-            database.prepare("BEGIN;");
-        
-        begin_statement.step();
+        database.execute("BEGIN;");
     }
 
     SQLiteTransaction::~SQLiteTransaction()
@@ -22,10 +19,7 @@ namespace QLogicaeCore
         {
             try
             {
-                SQLiteStatement rollback_statement =
-                    database.prepare("ROLLBACK;");
-                
-                rollback_statement.step();
+                database.execute("ROLLBACK;");
             }
             catch (...)
             {
@@ -38,10 +32,7 @@ namespace QLogicaeCore
     {
         if (!committed)
         {
-            SQLiteStatement commit_statement =
-                database.prepare("COMMIT;");
-            
-            commit_statement.step();
+            database.execute("COMMIT;");
             committed = true;
         }
     }
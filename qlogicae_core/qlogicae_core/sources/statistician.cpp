@@ -6,20 +6,309 @@ namespace QLogicaeCore
 {
 #include <limits>
 
-    bool Statistician::is_valid_data(std::vector<std::vector<double>>& data)
+    static double select_median(
+        std::vector<double>& values,
+        const std::size_t offset,
+        const std::size_t size)
     {
-        if (data.empty()) return false;
+        const auto middle = values.begin() + offset + size / 2;
+        std::nth_element(values.begin(), middle, values.end());
+
+        if (size % 2 != 0) return *middle;
+
+        return (*std::max_element(values.begin(), middle) + *middle) / 2.0;
+    }
+
+    static std::size_t get_chunk_count(const std::size_t size)
+    {
+        return (size + UTILITIES.STATISTICIAN_PARALLEL_CHUNK_SIZE - 1) /
+            UTILITIES.STATISTICIAN_PARALLEL_CHUNK_SIZE;
+    }
+
+    static std::span<const double> get_chunk(
+        std::span<const double> values,
+        const std::size_t index)
+    {
+        const std::size_t offset = index * UTILITIES.STATISTICIAN_PARALLEL_CHUNK_SIZE;
+
+        return values.subspan(offset,
+            std::min(UTILITIES.STATISTICIAN_PARALLEL_CHUNK_SIZE, values.size() - offset));
+    }
+
+    static double compute_sum(std::span<const double> values)
+    {
+        if (values.size() < UTILITIES.STATISTICIAN_PARALLEL_MINIMUM_SIZE)
+            return StatisticianKernels::sum(values);
+
+        std::vector<double> partials(get_chunk_count(values.size()));
+        ThreadPool::get_instance().parallel_for(partials.size(),
+            [&](const std::size_t& index)
+            {
+                partials[index] = StatisticianKernels::sum(get_chunk(values, index));
+            });
+
+        return StatisticianKernels::sum(partials);
+    }
+
+    static double compute_squared_deviation_sum(
+        std::span<const double> values,
+        const double center)
+    {
+        if (values.size() < UTILITIES.STATISTICIAN_PARALLEL_MINIMUM_SIZE)
+            return StatisticianKernels::sum_of_squared_deviations(values, center);
+
+        std::vector<double> partials(get_chunk_count(values.size()));
+        ThreadPool::get_instance().parallel_for(partials.size(),
+            [&](const std::size_t& index)
+            {
+                partials[index] = StatisticianKernels::sum_of_squared_deviations(
+                    get_chunk(values, index), center);
+            });
+
+        return StatisticianKernels::sum(partials);
+    }
+
+    static std::size_t compute_filtered(
+        std::span<const double> values,
+        const double center,
+        const double bound,
+        double* output)
+    {
+        if (values.size() < UTILITIES.STATISTICIAN_PARALLEL_MINIMUM_SIZE)
+            return StatisticianKernels::filter_within(values, center, bound, output);
+
+        std::vector<std::size_t> counts(get_chunk_count(values.size()));
+        ThreadPool::get_instance().parallel_for(counts.size(),
+            [&](const std::size_t& index)
+            {
+                counts[index] = StatisticianKernels::filter_within(
+                    get_chunk(values, index), center, bound,
+                    output + index * UTILITIES.STATISTICIAN_PARALLEL_CHUNK_SIZE);
+            });
+
+        std::size_t count = counts[0];
+        for (std::size_t index = 1; index < counts.size(); ++index)
+        {
+            std::memmove(output + count,
+                output + index * UTILITIES.STATISTICIAN_PARALLEL_CHUNK_SIZE,
+                counts[index] * sizeof(double));
+            count += counts[index];
+        }
+
+        return count;
+    }
 
+    static StatisticianAccumulator compute_moments(
+        std::vector<std::vector<double>>& data)
+    {
+        StatisticianAccumulator accumulator(0.0);
+        for (const auto& row : data)
+        {
+            accumulator.update(row);
+        }
+
+        return accumulator;
+    }
+
+    static bool is_valid_value(const double value)
+    {
         constexpr double SAFE_LIMIT = std::numeric_limits<double>::max() / 1e+10;
 
+        return std::isfinite(value) && std::abs(value) <= SAFE_LIMIT;
+    }
+
+    static std::vector<double> copy_values(const StatisticianStridedSpan& values)
+    {
+        if (values.is_contiguous())
+        {
+            std::span<const double> span = values.get_span();
+
+            return std::vector<double>(span.begin(), span.end());
+        }
+
+        std::vector<double> copy(values.get_size());
+        for (std::size_t index = 0; index < copy.size(); ++index)
+        {
+            copy[index] = values[index];
+        }
+
+        return copy;
+    }
+
+    template<typename BlockSum>
+    static double compute_gathered_sum(
+        const StatisticianStridedSpan& values,
+        BlockSum&& block_sum)
+    {
+        const std::size_t size = values.get_size();
+        const std::size_t block_size = UTILITIES.STATISTICIAN_GATHER_BLOCK_SIZE;
+        std::vector<double> block(std::min(size, block_size));
+        std::vector<double> partials;
+        partials.reserve((size + block_size - 1) / block_size);
+
+        for (std::size_t offset = 0; offset < size; offset += block_size)
+        {
+            const std::size_t count = std::min(block_size, size - offset);
+            for (std::size_t index = 0; index < count; ++index)
+            {
+                block[index] = values[offset + index];
+            }
+
+            partials.push_back(block_sum(std::span<const double>(block.data(), count)));
+        }
+
+        return StatisticianKernels::sum(partials);
+    }
+
+    static double compute_sum(const StatisticianStridedSpan& values)
+    {
+        if (values.is_contiguous()) return compute_sum(values.get_span());
+
+        return compute_gathered_sum(values,
+            [](std::span<const double> block)
+            {
+                return StatisticianKernels::sum(block);
+            });
+    }
+
+    static double compute_squared_deviation_sum(
+        const StatisticianStridedSpan& values,
+        const double center)
+    {
+        if (values.is_contiguous())
+            return compute_squared_deviation_sum(values.get_span(), center);
+
+        return compute_gathered_sum(values,
+            [center](std::span<const double> block)
+            {
+                return StatisticianKernels::sum_of_squared_deviations(block, center);
+            });
+    }
+
+    static StatisticianAccumulator compute_moments(
+        const StatisticianStridedSpan& values)
+    {
+        StatisticianAccumulator accumulator(0.0);
+        if (values.is_contiguous())
+        {
+            accumulator.update(values.get_span());
+
+            return accumulator;
+        }
+
+        for (std::size_t index = 0; index < values.get_size(); ++index)
+        {
+            accumulator.update(values[index]);
+        }
+
+        return accumulator;
+    }
+
+    static std::vector<std::size_t> compute_trimmed(
+        const StatisticianStridedSpan& values,
+        const std::size_t trim_count)
+    {
+        const std::size_t total_size = values.get_size();
+
+        std::vector<double> selection = copy_values(values);
+        std::nth_element(selection.begin(), selection.begin() + trim_count, selection.end());
+        double lower = selection[trim_count];
+        std::nth_element(selection.begin() + trim_count,
+            selection.end() - trim_count - 1, selection.end());
+        double upper = selection[total_size - trim_count - 1];
+
+        std::size_t lower_tie_count = trim_count;
+        std::size_t upper_tie_count = trim_count;
+        for (std::size_t index = 0; index < total_size; ++index)
+        {
+            if (values[index] < lower) --lower_tie_count;
+            if (values[index] > upper) --upper_tie_count;
+        }
+
+        std::vector<std::size_t> indices;
+        indices.reserve(total_size - 2 * trim_count);
+        for (std::size_t index = 0; index < total_size; ++index)
+        {
+            const double value = values[index];
+            if (value < lower || value > upper) continue;
+
+            if (value == lower && lower_tie_count > 0)
+            {
+                --lower_tie_count;
+            }
+            else if (value == upper && upper_tie_count > 0)
+            {
+                --upper_tie_count;
+            }
+            else
+            {
+                indices.push_back(index);
+            }
+        }
+
+        return indices;
+    }
+
+    static void compute_selected(
+        const StatisticianStridedSpan& values,
+        const double center,
+        const double bound,
+        std::vector<std::size_t>& indices)
+    {
+        const std::size_t size = values.get_size();
+        indices.resize(size);
+
+        if (!values.is_contiguous())
+        {
+            std::size_t count = 0;
+            for (std::size_t index = 0; index < size; ++index)
+            {
+                if (std::abs(values[index] - center) <= bound)
+                    indices[count++] = index;
+            }
+
+            return indices.resize(count);
+        }
+
+        if (size < UTILITIES.STATISTICIAN_PARALLEL_MINIMUM_SIZE)
+        {
+            return indices.resize(StatisticianKernels::select_within(
+                values.get_span(), center, bound, indices.data()));
+        }
+
+        std::vector<std::size_t> counts(get_chunk_count(size));
+        ThreadPool::get_instance().parallel_for(counts.size(),
+            [&](const std::size_t& index)
+            {
+                counts[index] = StatisticianKernels::select_within(
+                    get_chunk(values.get_span(), index), center, bound,
+                    indices.data() + index * UTILITIES.STATISTICIAN_PARALLEL_CHUNK_SIZE);
+            });
+
+        std::size_t count = counts[0];
+        for (std::size_t index = 1; index < counts.size(); ++index)
+        {
+            const std::size_t offset = index * UTILITIES.STATISTICIAN_PARALLEL_CHUNK_SIZE;
+            for (std::size_t position = 0; position < counts[index]; ++position)
+            {
+                indices[count++] = indices[offset + position] + offset;
+            }
+        }
+
+        indices.resize(count);
+    }
+
+    bool Statistician::is_valid_data(std::vector<std::vector<double>>& data)
+    {
+        if (data.empty()) return false;
+
         for (const auto& row : data)
         {
             if (row.empty()) return false;
 
             for (double value : row)
             {
-                if (!std::isfinite(value) || std::abs(value) > SAFE_LIMIT)
-                    return false;
+                if (!is_valid_value(value)) return false;
             }
         }
 
@@ -50,41 +339,29 @@ namespace QLogicaeCore
             return std::numeric_limits<double>::quiet_NaN();
         }
 
-        std::ranges::sort(values);
-
-        if (size % 2 == 0)
-        {
-            return (values[size / 2 - 1] + values[size / 2]) / 2.0;
-        }
-
-        return values[size / 2];
+        return select_median(values, 0, size);
     }
 
     double Statistician::compute_mean(std::vector<double>& values)
     {
-        if (values.empty())
-        {
-            return std::numeric_limits<double>::quiet_NaN();
-        }
-
-        return std::accumulate(values.begin(), values.end(), 0.0) /
-            static_cast<double>(values.size());
+        return compute_mean(StatisticianStridedSpan(values));
     }
 
     double Statistician::compute_standard_deviation(std::vector<double>& values, double mean)
     {
-        if (values.empty())
-        {
-            return std::numeric_limits<double>::quiet_NaN();
-        }
+        return compute_standard_deviation(StatisticianStridedSpan(values), mean);
+    }
 
-        double sum = 0.0;
-        for (double value : values)
+    StatisticianAccumulator Statistician::compute_accumulator(
+        std::vector<std::vector<double>>& data)
+    {
+        StatisticianAccumulator accumulator;
+        for (const auto& row : data)
         {
-            sum += std::pow(value - mean, 2);
+            accumulator.update(row);
         }
 
-        return std::sqrt(sum / static_cast<double>(values.size()));
+        return accumulator;
     }
 
     bool Statistician::remove_outliers_via_median_absolute_deviation(
@@ -100,33 +377,21 @@ namespace QLogicaeCore
             std::vector<double> flat_data = data[index_a];
             const double median = compute_median(flat_data);
 
-            std::vector<double> deviations;
-            deviations.reserve(flat_data.size());
-
-            for (const double value : flat_data)
-            {
-                deviations.push_back(std::abs(value - median));
-            }
+            std::vector<double> deviations(flat_data.size());
+            StatisticianKernels::absolute_deviations(
+                data[index_a], median, deviations.data());
 
             const double mad = compute_median(deviations);
             if (mad < UTILITIES.EPSILON) return false;
 
-            const double modified_z_threshold = options.threshold;
-            std::vector<double> filtered;
-            filtered.reserve(flat_data.size());
+            const double modified_z_bound = options.threshold * mad / 0.6745;
+            std::size_t count = compute_filtered(
+                data[index_a], median, modified_z_bound, flat_data.data());
 
-            for (const double value : flat_data)
-            {
-                const double modified_z = 0.6745 * (value - median) / mad;
-                if (std::abs(modified_z) <= modified_z_threshold)
-                {
-                    filtered.push_back(value);
-                }
-            }
+            if (count == 0) return false;
 
-            if (filtered.empty()) return false;
-
-            data[index_a] = filtered;
+            flat_data.resize(count);
+            data[index_a] = std::move(flat_data);
         }
 
         return true;
@@ -139,15 +404,13 @@ namespace QLogicaeCore
         if (!is_valid_data(data)) return false;
 
         std::vector<double> flat_data = flatten_data(data);
-        std::ranges::sort(flat_data);
-
-        if (flat_data.size() < 4) return false;
 
-        auto lower_half = std::vector<double>(flat_data.begin(), flat_data.begin() + flat_data.size() / 2);
-        auto upper_half = std::vector<double>(flat_data.begin() + (flat_data.size() + 1) / 2, flat_data.end());
+        const std::size_t total_size = flat_data.size();
+        if (total_size < 4) return false;
 
-        double q1 = compute_median(lower_half);
-        double q3 = compute_median(upper_half);
+        std::vector<double> selection = flat_data;
+        double q1 = select_median(selection, 0, total_size / 2);
+        double q3 = select_median(selection, (total_size + 1) / 2, total_size / 2);
         double iqr = q3 - q1;
 
         if (iqr < UTILITIES.EPSILON) return false;
@@ -156,6 +419,7 @@ namespace QLogicaeCore
         double upper_bound = q3 + options.factor * iqr;
 
         std::vector<double> filtered;
+        filtered.reserve(total_size);
         for (double value : flat_data)
         {
             if (value >= lower_bound && value <= upper_bound)
@@ -176,25 +440,24 @@ namespace QLogicaeCore
     {
         if (!is_valid_data(data)) return false;
 
-        std::vector<double> flat_data = flatten_data(data);
-        double mean = compute_mean(flat_data);
-        double stddev = compute_standard_deviation(flat_data, mean);
+        StatisticianAccumulator accumulator = compute_moments(data);
+        double mean = accumulator.get_mean();
+        double stddev = accumulator.get_standard_deviation();
 
         if (stddev < UTILITIES.EPSILON) return false;
 
-        std::vector<double> filtered;
-        for (double value : flat_data)
+        const double bound = options.threshold * stddev;
+        std::vector<double> filtered(accumulator.get_count());
+        std::size_t count = 0;
+        for (const auto& row : data)
         {
-            double z = (value - mean) / stddev;
-            if (std::abs(z) <= options.threshold)
-            {
-                filtered.push_back(value);
-            }
+            count += compute_filtered(row, mean, bound, filtered.data() + count);
         }
 
-        if (filtered.empty()) return false;
+        if (count == 0) return false;
 
-        data = { filtered };
+        filtered.resize(count);
+        data = { std::move(filtered) };
         return true;
     }
 
@@ -205,7 +468,6 @@ namespace QLogicaeCore
         if (!is_valid_data(data)) return false;
 
         std::vector<double> flat_data = flatten_data(data);
-        std::ranges::sort(flat_data);
 
         const std::size_t total_size = flat_data.size();
         if (total_size < 4) return false;
@@ -213,10 +475,15 @@ namespace QLogicaeCore
         std::size_t trim_count = static_cast<std::size_t>(options.proportion * total_size);
         trim_count = std::min(trim_count, total_size / 2 - 1);
 
-        double lower = flat_data[trim_count];
-        double upper = flat_data[total_size - trim_count - 1];
+        std::vector<double> selection = flat_data;
+        std::nth_element(selection.begin(), selection.begin() + trim_count, selection.end());
+        double lower = selection[trim_count];
+        std::nth_element(selection.begin() + trim_count,
+            selection.end() - trim_count - 1, selection.end());
+        double upper = selection[total_size - trim_count - 1];
 
         std::vector<double> winsorized;
+        winsorized.reserve(total_size);
         bool modified = false;
 
         for (double value : flat_data)
@@ -250,7 +517,6 @@ namespace QLogicaeCore
         if (!is_valid_data(data)) return false;
 
         std::vector<double> flat_data = flatten_data(data);
-        std::ranges::sort(flat_data);
 
         const std::size_t total_size = flat_data.size();
         if (total_size < 4) return false;
@@ -258,13 +524,16 @@ namespace QLogicaeCore
         std::size_t trim_count = static_cast<std::size_t>(options.proportion * total_size);
         trim_count = std::min(trim_count, total_size / 2 - 1);
 
-        std::vector<double> trimmed(
-            flat_data.begin() + trim_count,
-            flat_data.end() - trim_count
-        );
+        double original_mean = compute_mean(flat_data);
+
+        std::vector<std::size_t> kept = compute_trimmed(flat_data, trim_count);
+        std::vector<double> trimmed(kept.size());
+        for (std::size_t index = 0; index < kept.size(); ++index)
+        {
+            trimmed[index] = flat_data[kept[index]];
+        }
 
         double trimmed_mean = compute_mean(trimmed);
-        double original_mean = compute_mean(flat_data);
 
         if (!std::isfinite(trimmed_mean) ||
             std::abs(trimmed_mean - original_mean) <= UTILITIES.EPSILON)
@@ -282,23 +551,21 @@ namespace QLogicaeCore
     {
         if (!is_valid_data(data)) return false;
 
-        std::vector<double> flat_data = flatten_data(data);
-        double mean = compute_mean(flat_data);
-        double stddev = compute_standard_deviation(flat_data, mean);
+        StatisticianAccumulator accumulator = compute_moments(data);
+        double mean = accumulator.get_mean();
+        double stddev = accumulator.get_standard_deviation();
 
         if (stddev < UTILITIES.EPSILON) return false;
 
-        double max_deviation = 0.0;
-        for (double value : flat_data)
-        {
-            max_deviation = std::max(max_deviation, std::abs(value - mean));
-        }
+        double max_deviation = std::max(
+            accumulator.get_maximum() - mean,
+            mean - accumulator.get_minimum());
 
         double grubbs_statistic = max_deviation / stddev;
 
         if (grubbs_statistic > options.threshold) return false;
 
-        data = { flat_data };
+        data = { flatten_data(data) };
         return true;
     }
 
@@ -316,6 +583,256 @@ namespace QLogicaeCore
         return remove_outliers_via_median_absolute_deviation(data, options);
     }
 
+    bool Statistician::is_valid_data(const StatisticianStridedSpan& values)
+    {
+        if (values.is_empty()) return false;
+
+        for (std::size_t index = 0; index < values.get_size(); ++index)
+        {
+            if (!is_valid_value(values[index])) return false;
+        }
+
+        return true;
+    }
+
+    double Statistician::compute_median(const StatisticianStridedSpan& values)
+    {
+        std::vector<double> selection = copy_values(values);
+
+        return compute_median(selection);
+    }
+
+    double Statistician::compute_mean(const StatisticianStridedSpan& values)
+    {
+        if (values.is_empty())
+        {
+            return std::numeric_limits<double>::quiet_NaN();
+        }
+
+        return compute_sum(values) / static_cast<double>(values.get_size());
+    }
+
+    double Statistician::compute_standard_deviation(
+        const StatisticianStridedSpan& values, double mean)
+    {
+        if (values.is_empty())
+        {
+            return std::numeric_limits<double>::quiet_NaN();
+        }
+
+        return std::sqrt(compute_squared_deviation_sum(values, mean) /
+            static_cast<double>(values.get_size()));
+    }
+
+    StatisticianAccumulator Statistician::compute_accumulator(
+        const StatisticianStridedSpan& values)
+    {
+        StatisticianAccumulator accumulator;
+        if (values.is_contiguous())
+        {
+            accumulator.update(values.get_span());
+
+            return accumulator;
+        }
+
+        for (std::size_t index = 0; index < values.get_size(); ++index)
+        {
+            accumulator.update(values[index]);
+        }
+
+        return accumulator;
+    }
+
+    bool Statistician::remove_outliers_via_median_absolute_deviation(
+        const StatisticianStridedSpan& values,
+        const OutlierRemovalOptions& options,
+        std::vector<std::size_t>& indices)
+    {
+        if (!is_valid_data(values)) return false;
+        if (options.factor <= 0.0 || options.threshold <= 0.0) return false;
+
+        const double median = compute_median(values);
+
+        std::vector<double> deviations(values.get_size());
+        if (values.is_contiguous())
+        {
+            StatisticianKernels::absolute_deviations(
+                values.get_span(), median, deviations.data());
+        }
+        else
+        {
+            for (std::size_t index = 0; index < deviations.size(); ++index)
+            {
+                deviations[index] = std::abs(values[index] - median);
+            }
+        }
+
+        const double mad = compute_median(deviations);
+        if (mad < UTILITIES.EPSILON) return false;
+
+        compute_selected(values, median, options.threshold * mad / 0.6745, indices);
+
+        return !indices.empty();
+    }
+
+    bool Statistician::remove_outliers_via_inter_quartile_range(
+        const StatisticianStridedSpan& values,
+        const OutlierRemovalOptions& options,
+        std::vector<std::size_t>& indices)
+    {
+        if (!is_valid_data(values)) return false;
+
+        const std::size_t total_size = values.get_size();
+        if (total_size < 4) return false;
+
+        std::vector<double> selection = copy_values(values);
+        double q1 = select_median(selection, 0, total_size / 2);
+        double q3 = select_median(selection, (total_size + 1) / 2, total_size / 2);
+        double iqr = q3 - q1;
+
+        if (iqr < UTILITIES.EPSILON) return false;
+
+        double lower_bound = q1 - options.factor * iqr;
+        double upper_bound = q3 + options.factor * iqr;
+
+        indices.clear();
+        for (std::size_t index = 0; index < total_size; ++index)
+        {
+            if (values[index] >= lower_bound && values[index] <= upper_bound)
+            {
+                indices.push_back(index);
+            }
+        }
+
+        return !indices.empty();
+    }
+
+    bool Statistician::remove_outliers_via_z_score(
+        const StatisticianStridedSpan& values,
+        const OutlierRemovalOptions& options,
+        std::vector<std::size_t>& indices)
+    {
+        if (!is_valid_data(values)) return false;
+
+        StatisticianAccumulator accumulator = compute_moments(values);
+        double mean = accumulator.get_mean();
+        double stddev = accumulator.get_standard_deviation();
+
+        if (stddev < UTILITIES.EPSILON) return false;
+
+        compute_selected(values, mean, options.threshold * stddev, indices);
+
+        return !indices.empty();
+    }
+
+    bool Statistician::remove_outliers_via_winsorizing(
+        std::span<double> values,
+        const OutlierRemovalOptions& options)
+    {
+        if (!is_valid_data(StatisticianStridedSpan(values))) return false;
+
+        const std::size_t total_size = values.size();
+        if (total_size < 4) return false;
+
+        std::size_t trim_count = static_cast<std::size_t>(options.proportion * total_size);
+        trim_count = std::min(trim_count, total_size / 2 - 1);
+
+        std::vector<double> selection(values.begin(), values.end());
+        std::nth_element(selection.begin(), selection.begin() + trim_count, selection.end());
+        double lower = selection[trim_count];
+        std::nth_element(selection.begin() + trim_count,
+            selection.end() - trim_count - 1, selection.end());
+        double upper = selection[total_size - trim_count - 1];
+
+        bool modified = false;
+        for (double& value : values)
+        {
+            if (value < lower || value > upper)
+            {
+                value = std::clamp(value, lower, upper);
+                modified = true;
+            }
+        }
+
+        return modified;
+    }
+
+    bool Statistician::remove_outliers_via_trimmed_mean(
+        const StatisticianStridedSpan& values,
+        const OutlierRemovalOptions& options,
+        std::vector<std::size_t>& indices)
+    {
+        if (!is_valid_data(values)) return false;
+
+        const std::size_t total_size = values.get_size();
+        if (total_size < 4) return false;
+
+        std::size_t trim_count = static_cast<std::size_t>(options.proportion * total_size);
+        trim_count = std::min(trim_count, total_size / 2 - 1);
+
+        double original_mean = compute_mean(values);
+
+        std::vector<std::size_t> kept = compute_trimmed(values, trim_count);
+        std::vector<double> trimmed(kept.size());
+        for (std::size_t index = 0; index < kept.size(); ++index)
+        {
+            trimmed[index] = values[kept[index]];
+        }
+
+        double trimmed_mean = compute_mean(trimmed);
+
+        if (!std::isfinite(trimmed_mean) ||
+            std::abs(trimmed_mean - original_mean) <= UTILITIES.EPSILON)
+        {
+            return false;
+        }
+
+        indices = std::move(kept);
+
+        return true;
+    }
+
+    bool Statistician::remove_outliers_via_grubbs_test(
+        const StatisticianStridedSpan& values,
+        const OutlierRemovalOptions& options,
+        std::vector<std::size_t>& indices)
+    {
+        if (!is_valid_data(values)) return false;
+
+        StatisticianAccumulator accumulator = compute_moments(values);
+        double mean = accumulator.get_mean();
+        double stddev = accumulator.get_standard_deviation();
+
+        if (stddev < UTILITIES.EPSILON) return false;
+
+        double grubbs_statistic = std::max(
+            accumulator.get_maximum() - mean,
+            mean - accumulator.get_minimum()) / stddev;
+
+        if (grubbs_statistic > options.threshold) return false;
+
+        indices.resize(values.get_size());
+        std::iota(indices.begin(), indices.end(), 0);
+
+        return true;
+    }
+
+    bool Statistician::remove_outliers_via_tukey(
+        const StatisticianStridedSpan& values,
+        const OutlierRemovalOptions& options,
+        std::vector<std::size_t>& indices)
+    {
+        return remove_outliers_via_inter_quartile_range(values, options, indices);
+    }
+
+    bool Statistician::remove_outliers_via_modified_z_score(
+        const StatisticianStridedSpan& values,
+        const OutlierRemovalOptions& options,
+        std::vector<std::size_t>& indices)
+    {
+        return remove_outliers_via_median_absolute_deviation(values, options, indices);
+    }
+
     std::future<bool> Statistician::is_valid_data_async(std::vector<std::vector<double>>& data)
     {
         return std::async(std::launch::async, [this, &data]() {
@@ -0,0 +1,218 @@
+#include "pch.hpp"
+
+#include "../includes/statistician_accumulator.hpp"
+
+namespace QLogicaeCore
+{
+    StatisticianAccumulator::StatisticianAccumulator() :
+        StatisticianAccumulator(UTILITIES.STATISTICIAN_DIGEST_COMPRESSION)
+    {
+
+    }
+
+    StatisticianAccumulator::StatisticianAccumulator(
+        const double& compression
+    ) :
+        _is_quantile_tracking_enabled(compression > 0.0),
+        _digest(compression)
+    {
+        clear();
+    }
+
+    void StatisticianAccumulator::update(
+        const double& value
+    )
+    {
+        if (!std::isfinite(value)) return;
+
+        _update_moments(value);
+
+        if (_is_quantile_tracking_enabled)
+        {
+            _digest.update(value);
+        }
+    }
+
+    void StatisticianAccumulator::update(
+        std::span<const double> values
+    )
+    {
+        if (values.size() < UTILITIES.STATISTICIAN_PARALLEL_MINIMUM_SIZE)
+        {
+            _update_moments(values);
+        }
+        else
+        {
+            const std::size_t chunk_size = UTILITIES.STATISTICIAN_PARALLEL_CHUNK_SIZE;
+            std::vector<StatisticianAccumulator> partials(
+                (values.size() + chunk_size - 1) / chunk_size,
+                StatisticianAccumulator(0.0));
+            ThreadPool::get_instance().parallel_for(partials.size(),
+                [&](const std::size_t& index)
+                {
+                    const std::size_t offset = index * chunk_size;
+                    partials[index]._update_moments(values.subspan(offset,
+                        std::min(chunk_size, values.size() - offset)));
+                });
+
+            for (const StatisticianAccumulator& partial : partials)
+            {
+                _merge_moments(partial);
+            }
+        }
+
+        if (_is_quantile_tracking_enabled)
+        {
+            for (const double value : values)
+            {
+                if (std::isfinite(value)) _digest.update(value);
+            }
+        }
+    }
+
+    void StatisticianAccumulator::merge(
+        const StatisticianAccumulator& accumulator
+    )
+    {
+        if (accumulator._count == 0) return;
+
+        _merge_moments(accumulator);
+
+        if (_is_quantile_tracking_enabled)
+        {
+            _digest.merge(accumulator._digest);
+        }
+    }
+
+    void StatisticianAccumulator::clear()
+    {
+        _count = 0;
+        _mean = 0.0;
+        _m2 = 0.0;
+        _minimum = std::numeric_limits<double>::infinity();
+        _maximum = -std::numeric_limits<double>::infinity();
+
+        _digest.clear();
+    }
+
+    std::size_t StatisticianAccumulator::get_count() const
+    {
+        return _count;
+    }
+
+    double StatisticianAccumulator::get_mean() const
+    {
+        if (_count == 0) return std::numeric_limits<double>::quiet_NaN();
+
+        return _mean;
+    }
+
+    double StatisticianAccumulator::get_variance() const
+    {
+        if (_count == 0) return std::numeric_limits<double>::quiet_NaN();
+
+        return _m2 / static_cast<double>(_count);
+    }
+
+    double StatisticianAccumulator::get_sample_variance() const
+    {
+        if (_count < 2) return std::numeric_limits<double>::quiet_NaN();
+
+        return _m2 / static_cast<double>(_count - 1);
+    }
+
+    double StatisticianAccumulator::get_standard_deviation() const
+    {
+        return std::sqrt(get_variance());
+    }
+
+    double StatisticianAccumulator::get_minimum() const
+    {
+        if (_count == 0) return std::numeric_limits<double>::quiet_NaN();
+
+        return _minimum;
+    }
+
+    double StatisticianAccumulator::get_maximum() const
+    {
+        if (_count == 0) return std::numeric_limits<double>::quiet_NaN();
+
+        return _maximum;
+    }
+
+    double StatisticianAccumulator::get_median()
+    {
+        return get_quantile(0.5);
+    }
+
+    double StatisticianAccumulator::get_quantile(
+        const double& quantile
+    )
+    {
+        if (!_is_quantile_tracking_enabled)
+        {
+            return std::numeric_limits<double>::quiet_NaN();
+        }
+
+        return _digest.get_quantile(quantile);
+    }
+
+    void StatisticianAccumulator::_update_moments(
+        const double& value
+    )
+    {
+        ++_count;
+        const double delta = value - _mean;
+        _mean += delta / static_cast<double>(_count);
+        _m2 += delta * (value - _mean);
+        _minimum = std::min(_minimum, value);
+        _maximum = std::max(_maximum, value);
+    }
+
+    void StatisticianAccumulator::_update_moments(
+        std::span<const double> values
+    )
+    {
+        if (values.empty()) return;
+
+        const double sum = StatisticianKernels::sum(values);
+        if (!std::isfinite(sum))
+        {
+            for (const double value : values)
+            {
+                if (std::isfinite(value)) _update_moments(value);
+            }
+
+            return;
+        }
+
+        StatisticianAccumulator partial(0.0);
+        partial._count = values.size();
+        partial._mean = sum / static_cast<double>(values.size());
+        partial._m2 = StatisticianKernels::sum_of_squared_deviations(
+            values, partial._mean);
+        const auto [minimum, maximum] = std::ranges::minmax(values);
+        partial._minimum = minimum;
+        partial._maximum = maximum;
+
+        _merge_moments(partial);
+    }
+
+    void StatisticianAccumulator::_merge_moments(
+        const StatisticianAccumulator& accumulator
+    )
+    {
+        if (accumulator._count == 0) return;
+
+        const double count_a = static_cast<double>(_count);
+        const double count_b = static_cast<double>(accumulator._count);
+        const double count = count_a + count_b;
+        const double delta = accumulator._mean - _mean;
+
+        _mean += delta * count_b / count;
+        _m2 += accumulator._m2 + delta * delta * count_a * count_b / count;
+        _count += accumulator._count;
+        _minimum = std::min(_minimum, accumulator._minimum);
+        _maximum = std::max(_maximum, accumulator._maximum);
+    }
+}
@@ -0,0 +1,178 @@
+#include "pch.hpp"
+
+#include "../includes/statistician_digest.hpp"
+
+namespace QLogicaeCore
+{
+    StatisticianDigest::StatisticianDigest() :
+        StatisticianDigest(UTILITIES.STATISTICIAN_DIGEST_COMPRESSION)
+    {
+
+    }
+
+    StatisticianDigest::StatisticianDigest(
+        const double& compression
+    ) :
+        _compression(std::max(compression, 10.0))
+    {
+        clear();
+    }
+
+    void StatisticianDigest::update(
+        const double& value,
+        const double& weight
+    )
+    {
+        if (!std::isfinite(value) || !(weight > 0.0)) return;
+
+        _buffer.push_back({ value, weight });
+        _total_weight += weight;
+        _minimum = std::min(_minimum, value);
+        _maximum = std::max(_maximum, value);
+
+        if (_buffer.size() >= static_cast<std::size_t>(_compression * 5.0))
+        {
+            _compress();
+        }
+    }
+
+    void StatisticianDigest::merge(
+        const StatisticianDigest& digest
+    )
+    {
+        if (digest._total_weight <= 0.0) return;
+
+        _buffer.insert(
+            _buffer.end(), digest._centroids.begin(), digest._centroids.end()
+        );
+        _buffer.insert(
+            _buffer.end(), digest._buffer.begin(), digest._buffer.end()
+        );
+        _total_weight += digest._total_weight;
+        _minimum = std::min(_minimum, digest._minimum);
+        _maximum = std::max(_maximum, digest._maximum);
+
+        _compress();
+    }
+
+    void StatisticianDigest::clear()
+    {
+        _total_weight = 0.0;
+        _minimum = std::numeric_limits<double>::infinity();
+        _maximum = -std::numeric_limits<double>::infinity();
+        _centroids.clear();
+        _buffer.clear();
+    }
+
+    double StatisticianDigest::get_total_weight() const
+    {
+        return _total_weight;
+    }
+
+    std::size_t StatisticianDigest::get_centroid_count()
+    {
+        _compress();
+
+        return _centroids.size();
+    }
+
+    double StatisticianDigest::get_quantile(
+        const double& quantile
+    )
+    {
+        _compress();
+
+        if (_centroids.empty() || !(quantile >= 0.0 && quantile <= 1.0))
+        {
+            return std::numeric_limits<double>::quiet_NaN();
+        }
+
+        if (_centroids.size() == 1) return _centroids.front().mean;
+
+        const double index = quantile * _total_weight;
+        const StatisticianDigestCentroid& first = _centroids.front();
+        const StatisticianDigestCentroid& last = _centroids.back();
+
+        if (index <= first.weight / 2.0)
+        {
+            return _minimum +
+                (first.mean - _minimum) * index / (first.weight / 2.0);
+        }
+
+        if (index >= _total_weight - last.weight / 2.0)
+        {
+            return _maximum - (_maximum - last.mean) *
+                (_total_weight - index) / (last.weight / 2.0);
+        }
+
+        double cumulative_weight = first.weight / 2.0;
+        for (std::size_t index_a = 0; index_a + 1 < _centroids.size(); ++index_a)
+        {
+            const StatisticianDigestCentroid& left = _centroids[index_a];
+            const StatisticianDigestCentroid& right = _centroids[index_a + 1];
+            const double gap = (left.weight + right.weight) / 2.0;
+
+            if (index <= cumulative_weight + gap)
+            {
+                return left.mean +
+                    (right.mean - left.mean) * (index - cumulative_weight) / gap;
+            }
+
+            cumulative_weight += gap;
+        }
+
+        return last.mean;
+    }
+
+    void StatisticianDigest::_compress()
+    {
+        if (_buffer.empty()) return;
+
+        _buffer.insert(_buffer.end(), _centroids.begin(), _centroids.end());
+        std::ranges::sort(_buffer, {}, &StatisticianDigestCentroid::mean);
+
+        std::vector<StatisticianDigestCentroid> centroids;
+        centroids.reserve(static_cast<std::size_t>(_compression));
+
+        StatisticianDigestCentroid current = _buffer.front();
+        double merged_weight = 0.0;
+        double weight_limit = _total_weight * _get_quantile_limit(0.0);
+
+        for (std::size_t index = 1; index < _buffer.size(); ++index)
+        {
+            const StatisticianDigestCentroid& next = _buffer[index];
+
+            if (merged_weight + current.weight + next.weight <= weight_limit)
+            {
+                current.weight += next.weight;
+                current.mean +=
+                    (next.mean - current.mean) * next.weight / current.weight;
+            }
+            else
+            {
+                merged_weight += current.weight;
+                centroids.push_back(current);
+                weight_limit = _total_weight *
+                    _get_quantile_limit(merged_weight / _total_weight);
+                current = next;
+            }
+        }
+
+        centroids.push_back(current);
+        _centroids = std::move(centroids);
+        _buffer.clear();
+    }
+
+    double StatisticianDigest::_get_quantile_limit(
+        const double& quantile
+    ) const
+    {
+        const double scale = _compression / (2.0 * std::numbers::pi);
+        const double k = std::min(
+            scale * std::asin(std::clamp(2.0 * quantile - 1.0, -1.0, 1.0)) + 1.0,
+            _compression / 4.0
+        );
+
+        return (std::sin(k / scale) + 1.0) / 2.0;
+    }
+}
@@ -0,0 +1,8 @@
+#include "pch.hpp"
+
+#include "../includes/statistician_digest_centroid.hpp"
+
+namespace QLogicaeCore
+{
+
+}
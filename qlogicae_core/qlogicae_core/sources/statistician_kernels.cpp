@@ -0,0 +1,744 @@
+#include "pch.hpp"
+
+#include "../includes/statistician_kernels.hpp"
+
+#include <immintrin.h>
+
+namespace QLogicaeCore
+{
+    struct StatisticianCompensatedSum
+    {
+        double sum = 0.0;
+
+        double compensation = 0.0;
+
+        void add(
+            const double value
+        )
+        {
+            const double total = sum + value;
+            if (std::abs(sum) >= std::abs(value))
+            {
+                compensation += (sum - total) + value;
+            }
+            else
+            {
+                compensation += (value - total) + sum;
+            }
+
+            sum = total;
+        }
+
+        double get() const
+        {
+            return sum + compensation;
+        }
+    };
+
+    struct StatisticianScalarBlock
+    {
+        using vector_t = double;
+
+        static constexpr std::size_t SIZE = 1;
+
+        static vector_t load(
+            const double* values
+        )
+        {
+            return *values;
+        }
+
+        static void store(
+            double* output,
+            const vector_t value
+        )
+        {
+            *output = value;
+        }
+
+        static vector_t broadcast(
+            const double value
+        )
+        {
+            return value;
+        }
+
+        static vector_t add(
+            const vector_t left,
+            const vector_t right
+        )
+        {
+            return left + right;
+        }
+
+        static vector_t subtract(
+            const vector_t left,
+            const vector_t right
+        )
+        {
+            return left - right;
+        }
+
+        static vector_t multiply(
+            const vector_t left,
+            const vector_t right
+        )
+        {
+            return left * right;
+        }
+
+        static vector_t maximum(
+            const vector_t left,
+            const vector_t right
+        )
+        {
+            return std::max(left, right);
+        }
+
+        static vector_t absolute(
+            const vector_t value
+        )
+        {
+            return std::abs(value);
+        }
+
+        static vector_t select_not_less(
+            const vector_t left,
+            const vector_t right,
+            const vector_t if_true,
+            const vector_t if_false
+        )
+        {
+            return left >= right ? if_true : if_false;
+        }
+
+        static void reduce(
+            const vector_t sum,
+            const vector_t compensation,
+            StatisticianCompensatedSum& total
+        )
+        {
+            total.add(sum);
+            total.add(compensation);
+        }
+
+        static double reduce_maximum(
+            const vector_t value
+        )
+        {
+            return value;
+        }
+
+        static std::size_t compress_within(
+            const vector_t value,
+            const vector_t deviation,
+            const vector_t bound,
+            double* output
+        )
+        {
+            if (!(deviation <= bound))
+            {
+                return 0;
+            }
+
+            *output = value;
+
+            return 1;
+        }
+
+        static unsigned int mask_within(
+            const vector_t deviation,
+            const vector_t bound
+        )
+        {
+            return deviation <= bound ? 1 : 0;
+        }
+    };
+
+    struct StatisticianAvx2Block
+    {
+        using vector_t = __m256d;
+
+        static constexpr std::size_t SIZE = 4;
+
+        static constexpr std::array<std::array<std::int32_t, 8>, 16>
+            COMPRESS_PERMUTATIONS = []()
+            {
+                std::array<std::array<std::int32_t, 8>, 16> permutations = {};
+                for (std::size_t mask = 0; mask < permutations.size(); ++mask)
+                {
+                    std::size_t position = 0;
+                    for (std::int32_t lane = 0; lane < 4; ++lane)
+                    {
+                        if ((mask >> lane) & 1)
+                        {
+                            permutations[mask][position * 2] = lane * 2;
+                            permutations[mask][position * 2 + 1] = lane * 2 + 1;
+                            ++position;
+                        }
+                    }
+                }
+
+                return permutations;
+            }();
+
+        static vector_t load(
+            const double* values
+        )
+        {
+            return _mm256_loadu_pd(values);
+        }
+
+        static void store(
+            double* output,
+            const vector_t value
+        )
+        {
+            _mm256_storeu_pd(output, value);
+        }
+
+        static vector_t broadcast(
+            const double value
+        )
+        {
+            return _mm256_set1_pd(value);
+        }
+
+        static vector_t add(
+            const vector_t left,
+            const vector_t right
+        )
+        {
+            return _mm256_add_pd(left, right);
+        }
+
+        static vector_t subtract(
+            const vector_t left,
+            const vector_t right
+        )
+        {
+            return _mm256_sub_pd(left, right);
+        }
+
+        static vector_t multiply(
+            const vector_t left,
+            const vector_t right
+        )
+        {
+            return _mm256_mul_pd(left, right);
+        }
+
+        static vector_t maximum(
+            const vector_t left,
+            const vector_t right
+        )
+        {
+            return _mm256_max_pd(left, right);
+        }
+
+        static vector_t absolute(
+            const vector_t value
+        )
+        {
+            return _mm256_andnot_pd(_mm256_set1_pd(-0.0), value);
+        }
+
+        static vector_t select_not_less(
+            const vector_t left,
+            const vector_t right,
+            const vector_t if_true,
+            const vector_t if_false
+        )
+        {
+            return _mm256_blendv_pd(
+                if_false, if_true, _mm256_cmp_pd(left, right, _CMP_GE_OQ)
+            );
+        }
+
+        static void reduce(
+            const vector_t sum,
+            const vector_t compensation,
+            StatisticianCompensatedSum& total
+        )
+        {
+            alignas(32) double lanes[SIZE * 2];
+            _mm256_store_pd(lanes, sum);
+            _mm256_store_pd(lanes + SIZE, compensation);
+
+            for (const double lane : lanes)
+            {
+                total.add(lane);
+            }
+        }
+
+        static double reduce_maximum(
+            const vector_t value
+        )
+        {
+            const __m128d half = _mm_max_pd(
+                _mm256_castpd256_pd128(value), _mm256_extractf128_pd(value, 1)
+            );
+
+            return _mm_cvtsd_f64(_mm_max_sd(half, _mm_unpackhi_pd(half, half)));
+        }
+
+        static std::size_t compress_within(
+            const vector_t value,
+            const vector_t deviation,
+            const vector_t bound,
+            double* output
+        )
+        {
+            const int mask = _mm256_movemask_pd(
+                _mm256_cmp_pd(deviation, bound, _CMP_LE_OQ)
+            );
+            const __m256i permutation = _mm256_loadu_si256(
+                reinterpret_cast<const __m256i*>(
+                    COMPRESS_PERMUTATIONS[mask].data())
+            );
+            _mm256_storeu_pd(output, _mm256_castps_pd(
+                _mm256_permutevar8x32_ps(_mm256_castpd_ps(value), permutation)
+            ));
+
+            return static_cast<std::size_t>(
+                std::popcount(static_cast<unsigned int>(mask)));
+        }
+
+        static unsigned int mask_within(
+            const vector_t deviation,
+            const vector_t bound
+        )
+        {
+            return static_cast<unsigned int>(_mm256_movemask_pd(
+                _mm256_cmp_pd(deviation, bound, _CMP_LE_OQ)));
+        }
+    };
+
+    struct StatisticianAvx512Block
+    {
+        using vector_t = __m512d;
+
+        static constexpr std::size_t SIZE = 8;
+
+        static vector_t load(
+            const double* values
+        )
+        {
+            return _mm512_loadu_pd(values);
+        }
+
+        static void store(
+            double* output,
+            const vector_t value
+        )
+        {
+            _mm512_storeu_pd(output, value);
+        }
+
+        static vector_t broadcast(
+            const double value
+        )
+        {
+            return _mm512_set1_pd(value);
+        }
+
+        static vector_t add(
+            const vector_t left,
+            const vector_t right
+        )
+        {
+            return _mm512_add_pd(left, right);
+        }
+
+        static vector_t subtract(
+            const vector_t left,
+            const vector_t right
+        )
+        {
+            return _mm512_sub_pd(left, right);
+        }
+
+        static vector_t multiply(
+            const vector_t left,
+            const vector_t right
+        )
+        {
+            return _mm512_mul_pd(left, right);
+        }
+
+        static vector_t maximum(
+            const vector_t left,
+            const vector_t right
+        )
+        {
+            return _mm512_max_pd(left, right);
+        }
+
+        static vector_t absolute(
+            const vector_t value
+        )
+        {
+            return _mm512_abs_pd(value);
+        }
+
+        static vector_t select_not_less(
+            const vector_t left,
+            const vector_t right,
+            const vector_t if_true,
+            const vector_t if_false
+        )
+        {
+            return _mm512_mask_blend_pd(
+                _mm512_cmp_pd_mask(left, right, _CMP_GE_OQ), if_false, if_true
+            );
+        }
+
+        static void reduce(
+            const vector_t sum,
+            const vector_t compensation,
+            StatisticianCompensatedSum& total
+        )
+        {
+            alignas(64) double lanes[SIZE * 2];
+            _mm512_store_pd(lanes, sum);
+            _mm512_store_pd(lanes + SIZE, compensation);
+
+            for (const double lane : lanes)
+            {
+                total.add(lane);
+            }
+        }
+
+        static double reduce_maximum(
+            const vector_t value
+        )
+        {
+            return _mm512_reduce_max_pd(value);
+        }
+
+        static std::size_t compress_within(
+            const vector_t value,
+            const vector_t deviation,
+            const vector_t bound,
+            double* output
+        )
+        {
+            const __mmask8 mask = _mm512_cmp_pd_mask(deviation, bound, _CMP_LE_OQ);
+            _mm512_mask_compressstoreu_pd(output, mask, value);
+
+            return static_cast<std::size_t>(
+                std::popcount(static_cast<unsigned int>(mask)));
+        }
+
+        static unsigned int mask_within(
+            const vector_t deviation,
+            const vector_t bound
+        )
+        {
+            return static_cast<unsigned int>(
+                _mm512_cmp_pd_mask(deviation, bound, _CMP_LE_OQ));
+        }
+    };
+
+    template<typename Block, bool IS_SQUARED>
+    static double sum_blocks(
+        std::span<const double> values,
+        const double center
+    )
+    {
+        using vector_t = typename Block::vector_t;
+
+        const vector_t centers = Block::broadcast(center);
+        vector_t sum = Block::broadcast(0.0);
+        vector_t compensation = Block::broadcast(0.0);
+
+        std::size_t index = 0;
+        for (; index + Block::SIZE <= values.size(); index += Block::SIZE)
+        {
+            vector_t value = Block::load(values.data() + index);
+            if constexpr (IS_SQUARED)
+            {
+                const vector_t deviation = Block::subtract(value, centers);
+                value = Block::multiply(deviation, deviation);
+            }
+
+            const vector_t total = Block::add(sum, value);
+            const vector_t absolute_sum = Block::absolute(sum);
+            const vector_t absolute_value = Block::absolute(value);
+            const vector_t larger = Block::select_not_less(
+                absolute_sum, absolute_value, sum, value);
+            const vector_t smaller = Block::select_not_less(
+                absolute_sum, absolute_value, value, sum);
+            compensation = Block::add(compensation,
+                Block::add(Block::subtract(larger, total), smaller));
+            sum = total;
+        }
+
+        StatisticianCompensatedSum result;
+        Block::reduce(sum, compensation, result);
+
+        for (; index < values.size(); ++index)
+        {
+            if constexpr (IS_SQUARED)
+            {
+                const double deviation = values[index] - center;
+                result.add(deviation * deviation);
+            }
+            else
+            {
+                result.add(values[index]);
+            }
+        }
+
+        return result.get();
+    }
+
+    template<typename Block>
+    static double maximum_absolute_deviation_blocks(
+        std::span<const double> values,
+        const double center
+    )
+    {
+        using vector_t = typename Block::vector_t;
+
+        const vector_t centers = Block::broadcast(center);
+        vector_t maximum = Block::broadcast(0.0);
+
+        std::size_t index = 0;
+        for (; index + Block::SIZE <= values.size(); index += Block::SIZE)
+        {
+            maximum = Block::maximum(maximum, Block::absolute(
+                Block::subtract(Block::load(values.data() + index), centers)));
+        }
+
+        double result = Block::reduce_maximum(maximum);
+        for (; index < values.size(); ++index)
+        {
+            result = std::max(result, std::abs(values[index] - center));
+        }
+
+        return result;
+    }
+
+    template<typename Block>
+    static void absolute_deviations_blocks(
+        std::span<const double> values,
+        const double center,
+        double* output
+    )
+    {
+        const typename Block::vector_t centers = Block::broadcast(center);
+
+        std::size_t index = 0;
+        for (; index + Block::SIZE <= values.size(); index += Block::SIZE)
+        {
+            Block::store(output + index, Block::absolute(
+                Block::subtract(Block::load(values.data() + index), centers)));
+        }
+
+        for (; index < values.size(); ++index)
+        {
+            output[index] = std::abs(values[index] - center);
+        }
+    }
+
+    template<typename Block>
+    static std::size_t filter_within_blocks(
+        std::span<const double> values,
+        const double center,
+        const double bound,
+        double* output
+    )
+    {
+        using vector_t = typename Block::vector_t;
+
+        const vector_t centers = Block::broadcast(center);
+        const vector_t bounds = Block::broadcast(bound);
+        std::size_t count = 0;
+
+        std::size_t index = 0;
+        for (; index + Block::SIZE <= values.size(); index += Block::SIZE)
+        {
+            const vector_t value = Block::load(values.data() + index);
+            count += Block::compress_within(
+                value,
+                Block::absolute(Block::subtract(value, centers)),
+                bounds,
+                output + count
+            );
+        }
+
+        for (; index < values.size(); ++index)
+        {
+            count += StatisticianScalarBlock::compress_within(
+                values[index],
+                std::abs(values[index] - center),
+                bound,
+                output + count
+            );
+        }
+
+        return count;
+    }
+
+    template<typename Block>
+    static std::size_t select_within_blocks(
+        std::span<const double> values,
+        const double center,
+        const double bound,
+        std::size_t* output
+    )
+    {
+        using vector_t = typename Block::vector_t;
+
+        const vector_t centers = Block::broadcast(center);
+        const vector_t bounds = Block::broadcast(bound);
+        std::size_t count = 0;
+
+        std::size_t index = 0;
+        for (; index + Block::SIZE <= values.size(); index += Block::SIZE)
+        {
+            unsigned int mask = Block::mask_within(Block::absolute(Block::subtract(
+                Block::load(values.data() + index), centers)), bounds);
+            while (mask != 0)
+            {
+                output[count++] = index + std::countr_zero(mask);
+                mask &= mask - 1;
+            }
+        }
+
+        for (; index < values.size(); ++index)
+        {
+            if (std::abs(values[index] - center) <= bound)
+            {
+                output[count++] = index;
+            }
+        }
+
+        return count;
+    }
+
+    double StatisticianKernels::sum(
+        std::span<const double> values
+    )
+    {
+        if (CPU_FEATURES.is_avx512f_supported())
+        {
+            return sum_blocks<StatisticianAvx512Block, false>(values, 0.0);
+        }
+
+        if (CPU_FEATURES.is_avx2_supported())
+        {
+            return sum_blocks<StatisticianAvx2Block, false>(values, 0.0);
+        }
+
+        return sum_blocks<StatisticianScalarBlock, false>(values, 0.0);
+    }
+
+    double StatisticianKernels::sum_of_squared_deviations(
+        std::span<const double> values,
+        const double center
+    )
+    {
+        if (CPU_FEATURES.is_avx512f_supported())
+        {
+            return sum_blocks<StatisticianAvx512Block, true>(values, center);
+        }
+
+        if (CPU_FEATURES.is_avx2_supported())
+        {
+            return sum_blocks<StatisticianAvx2Block, true>(values, center);
+        }
+
+        return sum_blocks<StatisticianScalarBlock, true>(values, center);
+    }
+
+    double StatisticianKernels::maximum_absolute_deviation(
+        std::span<const double> values,
+        const double center
+    )
+    {
+        if (CPU_FEATURES.is_avx512f_supported())
+        {
+            return maximum_absolute_deviation_blocks<StatisticianAvx512Block>(
+                values, center);
+        }
+
+        if (CPU_FEATURES.is_avx2_supported())
+        {
+            return maximum_absolute_deviation_blocks<StatisticianAvx2Block>(
+                values, center);
+        }
+
+        return maximum_absolute_deviation_blocks<StatisticianScalarBlock>(
+            values, center);
+    }
+
+    void StatisticianKernels::absolute_deviations(
+        std::span<const double> values,
+        const double center,
+        double* output
+    )
+    {
+        if (CPU_FEATURES.is_avx512f_supported())
+        {
+            return absolute_deviations_blocks<StatisticianAvx512Block>(
+                values, center, output);
+        }
+
+        if (CPU_FEATURES.is_avx2_supported())
+        {
+            return absolute_deviations_blocks<StatisticianAvx2Block>(
+                values, center, output);
+        }
+
+        absolute_deviations_blocks<StatisticianScalarBlock>(
+            values, center, output);
+    }
+
+    std::size_t StatisticianKernels::filter_within(
+        std::span<const double> values,
+        const double center,
+        const double bound,
+        double* output
+    )
+    {
+        if (CPU_FEATURES.is_avx512f_supported())
+        {
+            return filter_within_blocks<StatisticianAvx512Block>(
+                values, center, bound, output);
+        }
+
+        if (CPU_FEATURES.is_avx2_supported())
+        {
+            return filter_within_blocks<StatisticianAvx2Block>(
+                values, center, bound, output);
+        }
+
+        return filter_within_blocks<StatisticianScalarBlock>(
+            values, center, bound, output);
+    }
+
+    std::size_t StatisticianKernels::select_within(
+        std::span<const double> values,
+        const double center,
+        const double bound,
+        std::size_t* output
+    )
+    {
+        if (CPU_FEATURES.is_avx512f_supported())
+        {
+            return select_within_blocks<StatisticianAvx512Block>(
+                values, center, bound, output);
+        }
+
+        if (CPU_FEATURES.is_avx2_supported())
+        {
+            return select_within_blocks<StatisticianAvx2Block>(
+                values, center, bound, output);
+        }
+
+        return select_within_blocks<StatisticianScalarBlock>(
+            values, center, bound, output);
+    }
+}
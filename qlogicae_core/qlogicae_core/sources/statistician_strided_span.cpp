@@ -0,0 +1,82 @@
+#include "pch.hpp"
+
+#include "../includes/statistician_strided_span.hpp"
+
+namespace QLogicaeCore
+{
+    StatisticianStridedSpan::StatisticianStridedSpan() :
+        StatisticianStridedSpan(nullptr, 0, 1)
+    {
+
+    }
+
+    StatisticianStridedSpan::StatisticianStridedSpan(
+        const std::vector<double>& values
+    ) :
+        StatisticianStridedSpan(values.data(), values.size(), 1)
+    {
+
+    }
+
+    StatisticianStridedSpan::StatisticianStridedSpan(
+        std::span<const double> values
+    ) :
+        StatisticianStridedSpan(values.data(), values.size(), 1)
+    {
+
+    }
+
+    StatisticianStridedSpan::StatisticianStridedSpan(
+        const double* data,
+        const std::size_t& size,
+        const std::size_t& stride
+    ) :
+        _data(data),
+        _size(size),
+        _stride(stride == 0 ? 1 : stride)
+    {
+
+    }
+
+    const double* StatisticianStridedSpan::get_data() const
+    {
+        return _data;
+    }
+
+    std::size_t StatisticianStridedSpan::get_size() const
+    {
+        return _size;
+    }
+
+    std::size_t StatisticianStridedSpan::get_stride() const
+    {
+        return _stride;
+    }
+
+    bool StatisticianStridedSpan::is_empty() const
+    {
+        return _size == 0;
+    }
+
+    bool StatisticianStridedSpan::is_contiguous() const
+    {
+        return _stride == 1;
+    }
+
+    std::span<const double> StatisticianStridedSpan::get_span() const
+    {
+        if (!is_contiguous())
+        {
+            return {};
+        }
+
+        return { _data, _size };
+    }
+
+    const double& StatisticianStridedSpan::operator[](
+        const std::size_t& index
+    ) const
+    {
+        return _data[index * _stride];
+    }
+}
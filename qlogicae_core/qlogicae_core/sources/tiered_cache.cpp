@@ -0,0 +1,495 @@
+#include "pch.hpp"
+
+#include "../includes/tiered_cache.hpp"
+
+namespace QLogicaeCore
+{
+    TieredCache::TieredCache(
+        RocksDBDatabase& database,
+        const TieredCacheConfigurations& configurations
+    ) :
+        _database(&database),
+        _configurations(configurations),
+        _memory_cache(
+            configurations.memory_cache_configurations,
+            configurations.is_weighted_by_size ?
+                ConcurrentCache<std::string, std::string>::weigher_t(
+                    [](const std::string& key, const std::string& value)
+                    {
+                        return key.size() + value.size();
+                    }
+                ) :
+                ConcurrentCache<std::string, std::string>::weigher_t()
+        )
+    {
+        if (!_is_write_back() ||
+            configurations.write_back_interval_in_milliseconds == 0)
+        {
+            return;
+        }
+
+        _write_back_interval = std::make_unique<Interval>(
+            [this](size_t)
+            {
+                flush();
+
+                return true;
+            },
+            std::chrono::milliseconds(
+                configurations.write_back_interval_in_milliseconds
+            )
+        );
+        _write_back_interval->start();
+    }
+
+    TieredCache::~TieredCache()
+    {
+        _write_back_interval.reset();
+
+        flush();
+    }
+
+    bool TieredCache::read(
+        const std::string& key,
+        std::string& value
+    )
+    {
+        try
+        {
+            if (_memory_cache.get(key, value))
+            {
+                return true;
+            }
+
+            std::optional<std::string> loaded_value =
+                _memory_cache.get_or_load(
+                    key,
+                    [this, &key]()
+                    {
+                        std::optional<std::string> pending_value;
+                        if (_read_pending_write(key, pending_value))
+                        {
+                            return pending_value;
+                        }
+
+                        return _read_backend(key);
+                    }
+                );
+            if (!loaded_value.has_value())
+            {
+                return false;
+            }
+
+            value = std::move(*loaded_value);
+
+            return true;
+        }
+        catch (const std::exception& exception)
+        {
+            LOGGER.handle_exception_async(
+                "QLogicaeCore::TieredCache::read()",
+                exception.what()
+            );
+
+            return false;
+        }
+    }
+
+    std::optional<std::string> TieredCache::read(
+        const std::string& key
+    )
+    {
+        std::string value;
+        if (!read(key, value))
+        {
+            return std::nullopt;
+        }
+
+        return value;
+    }
+
+    void TieredCache::read(
+        Result<std::string>& result,
+        const std::string& key
+    )
+    {
+        std::string value;
+        if (!read(key, value))
+        {
+            return result.set_to_bad_status_without_value(
+                "QLogicaeCore::TieredCache::read() - Key not found"
+            );
+        }
+
+        result.set_to_good_status_with_value(
+            std::move(value)
+        );
+    }
+
+    bool TieredCache::write(
+        const std::string& key,
+        const std::string& value
+    )
+    {
+        try
+        {
+            std::unique_lock lock(_get_write_mutex(key));
+
+            if (_is_write_back())
+            {
+                const bool is_flush_required =
+                    _stage_pending_write(key, value);
+
+                _memory_cache.put(key, value);
+
+                lock.unlock();
+
+                return !is_flush_required || flush();
+            }
+
+            if (!_write_backend(key, value))
+            {
+                _memory_cache.remove(key);
+
+                return false;
+            }
+
+            _memory_cache.put(key, value);
+
+            return true;
+        }
+        catch (const std::exception& exception)
+        {
+            LOGGER.handle_exception_async(
+                "QLogicaeCore::TieredCache::write()",
+                exception.what()
+            );
+
+            return false;
+        }
+    }
+
+    void TieredCache::write(
+        Result<void>& result,
+        const std::string& key,
+        const std::string& value
+    )
+    {
+        if (!write(key, value))
+        {
+            return result.set_to_bad_status_without_value(
+                "QLogicaeCore::TieredCache::write() - Backend write failed"
+            );
+        }
+
+        result.set_to_good_status_without_value();
+    }
+
+    bool TieredCache::remove(
+        const std::string& key
+    )
+    {
+        try
+        {
+            std::unique_lock lock(_get_write_mutex(key));
+
+            if (_is_write_back())
+            {
+                const bool is_flush_required =
+                    _stage_pending_write(key, std::nullopt);
+
+                _memory_cache.remove(key);
+
+                lock.unlock();
+
+                return !is_flush_required || flush();
+            }
+
+            const bool is_successful = _write_backend(key, std::nullopt);
+
+            _memory_cache.remove(key);
+
+            return is_successful;
+        }
+        catch (const std::exception& exception)
+        {
+            LOGGER.handle_exception_async(
+                "QLogicaeCore::TieredCache::remove()",
+                exception.what()
+            );
+
+            return false;
+        }
+    }
+
+    void TieredCache::remove(
+        Result<void>& result,
+        const std::string& key
+    )
+    {
+        if (!remove(key))
+        {
+            return result.set_to_bad_status_without_value(
+                "QLogicaeCore::TieredCache::remove() - Backend remove failed"
+            );
+        }
+
+        result.set_to_good_status_without_value();
+    }
+
+    bool TieredCache::is_key_found(
+        const std::string& key
+    )
+    {
+        std::string value;
+
+        return read(key, value);
+    }
+
+    void TieredCache::is_key_found(
+        Result<bool>& result,
+        const std::string& key
+    )
+    {
+        result.set_to_good_status_with_value(
+            is_key_found(key)
+        );
+    }
+
+    bool TieredCache::flush()
+    {
+        try
+        {
+            std::unique_lock flush_lock(_flush_mutex);
+
+            std::unordered_map<std::string, std::optional<std::string>>
+                pending_writes;
+
+            {
+                std::unique_lock lock(_pending_writes_mutex);
+
+                if (_pending_writes.empty())
+                {
+                    return true;
+                }
+
+                pending_writes = _pending_writes;
+            }
+
+            bool is_successful = true;
+            for (const auto& [key, value] : pending_writes)
+            {
+                if (!_write_backend(key, value))
+                {
+                    is_successful = false;
+
+                    continue;
+                }
+
+                std::unique_lock lock(_pending_writes_mutex);
+
+                auto iterator = _pending_writes.find(key);
+                if (iterator != _pending_writes.end() &&
+                    iterator->second == value)
+                {
+                    _pending_writes.erase(iterator);
+                }
+            }
+
+            _flush_count.fetch_add(1, std::memory_order_relaxed);
+
+            return is_successful;
+        }
+        catch (const std::exception& exception)
+        {
+            LOGGER.handle_exception_async(
+                "QLogicaeCore::TieredCache::flush()",
+                exception.what()
+            );
+
+            return false;
+        }
+    }
+
+    void TieredCache::flush(
+        Result<void>& result
+    )
+    {
+        if (!flush())
+        {
+            return result.set_to_bad_status_without_value(
+                "QLogicaeCore::TieredCache::flush() - Backend write failed"
+            );
+        }
+
+        result.set_to_good_status_without_value();
+    }
+
+    std::future<bool> TieredCache::flush_async()
+    {
+        std::promise<bool> promise;
+        auto future = promise.get_future();
+
+        boost::asio::post(
+            UTILITIES.BOOST_ASIO_POOL,
+            [this, promise = std::move(promise)]() mutable
+            {
+                promise.set_value(
+                    flush()
+                );
+            }
+        );
+
+        return future;
+    }
+
+    void TieredCache::invalidate(
+        const std::string& key
+    )
+    {
+        _memory_cache.remove(key);
+    }
+
+    void TieredCache::clear()
+    {
+        _memory_cache.clear();
+    }
+
+    TieredCacheConfigurations TieredCache::get_configurations()
+    {
+        return _configurations;
+    }
+
+    TieredCacheStatistics TieredCache::get_statistics()
+    {
+        TieredCacheStatistics statistics;
+
+        statistics.memory_cache_statistics =
+            _memory_cache.get_statistics();
+        statistics.backend_read_count =
+            _backend_read_count.load(std::memory_order_relaxed);
+        statistics.backend_write_count =
+            _backend_write_count.load(std::memory_order_relaxed);
+        statistics.backend_remove_count =
+            _backend_remove_count.load(std::memory_order_relaxed);
+        statistics.backend_failure_count =
+            _backend_failure_count.load(std::memory_order_relaxed);
+        statistics.pending_write_hit_count =
+            _pending_write_hit_count.load(std::memory_order_relaxed);
+        statistics.flush_count =
+            _flush_count.load(std::memory_order_relaxed);
+
+        std::unique_lock lock(_pending_writes_mutex);
+
+        statistics.pending_write_count = _pending_writes.size();
+
+        return statistics;
+    }
+
+    void TieredCache::get_statistics(
+        Result<TieredCacheStatistics>& result
+    )
+    {
+        result.set_to_good_status_with_value(
+            get_statistics()
+        );
+    }
+
+    std::mutex& TieredCache::_get_write_mutex(
+        const std::string& key
+    )
+    {
+        return _write_mutexes[
+            std::hash<std::string>{}(key) % _write_mutexes.size()
+        ];
+    }
+
+    bool TieredCache::_is_write_back()
+    {
+        return _configurations.write_policy ==
+            TieredCacheWritePolicy::WRITE_BACK;
+    }
+
+    bool TieredCache::_read_pending_write(
+        const std::string& key,
+        std::optional<std::string>& value
+    )
+    {
+        if (!_is_write_back())
+        {
+            return false;
+        }
+
+        std::unique_lock lock(_pending_writes_mutex);
+
+        auto iterator = _pending_writes.find(key);
+        if (iterator == _pending_writes.end())
+        {
+            return false;
+        }
+
+        value = iterator->second;
+        _pending_write_hit_count.fetch_add(1, std::memory_order_relaxed);
+
+        return true;
+    }
+
+    bool TieredCache::_stage_pending_write(
+        const std::string& key,
+        std::optional<std::string> value
+    )
+    {
+        std::unique_lock lock(_pending_writes_mutex);
+
+        _pending_writes.insert_or_assign(key, std::move(value));
+
+        return _pending_writes.size() >=
+            _configurations.maximum_pending_write_count;
+    }
+
+    std::optional<std::string> TieredCache::_read_backend(
+        const std::string& key
+    )
+    {
+        Result<std::string> result;
+
+        _database->get_value<std::string>(result, key);
+        _backend_read_count.fetch_add(1, std::memory_order_relaxed);
+
+        if (result.is_status_bad())
+        {
+            return std::nullopt;
+        }
+
+        return std::move(result.get_value());
+    }
+
+    bool TieredCache::_write_backend(
+        const std::string& key,
+        const std::optional<std::string>& value
+    )
+    {
+        bool is_successful = true;
+
+        if (value.has_value())
+        {
+            Result<void> result;
+
+            _database->set_value<std::string>(result, key, *value);
+            _backend_write_count.fetch_add(1, std::memory_order_relaxed);
+            is_successful = result.is_status_good();
+        }
+        else
+        {
+            _backend_remove_count.fetch_add(1, std::memory_order_relaxed);
+            is_successful = _database->remove_value(key);
+        }
+
+        if (!is_successful)
+        {
+            _backend_failure_count.fetch_add(1, std::memory_order_relaxed);
+        }
+
+        return is_successful;
+    }
+}
@@ -0,0 +1,8 @@
+#include "pch.hpp"
+
+#include "../includes/tiered_cache_write_policy.hpp"
+
+namespace QLogicaeCore
+{
+
+}
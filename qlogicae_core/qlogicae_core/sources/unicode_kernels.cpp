@@ -0,0 +1,1051 @@
+#include "pch.hpp"
+
+#include "../includes/unicode_kernels.hpp"
+
+#include <immintrin.h>
+
+namespace QLogicaeCore
+{
+    static constexpr uint8_t TOO_SHORT = 1 << 0;
+
+    static constexpr uint8_t TOO_LONG = 1 << 1;
+
+    static constexpr uint8_t OVERLONG_3 = 1 << 2;
+
+    static constexpr uint8_t TOO_LARGE = 1 << 3;
+
+    static constexpr uint8_t SURROGATE = 1 << 4;
+
+    static constexpr uint8_t OVERLONG_2 = 1 << 5;
+
+    static constexpr uint8_t TOO_LARGE_1000 = 1 << 6;
+
+    static constexpr uint8_t OVERLONG_4 = 1 << 6;
+
+    static constexpr uint8_t TWO_CONTINUATIONS = 1 << 7;
+
+    static constexpr uint8_t CARRY = TOO_SHORT | TOO_LONG | TWO_CONTINUATIONS;
+
+    alignas(16) static constexpr uint8_t FIRST_BYTE_HIGH_NIBBLE_TABLE[16] =
+    {
+        TOO_LONG, TOO_LONG, TOO_LONG, TOO_LONG,
+        TOO_LONG, TOO_LONG, TOO_LONG, TOO_LONG,
+        TWO_CONTINUATIONS, TWO_CONTINUATIONS,
+        TWO_CONTINUATIONS, TWO_CONTINUATIONS,
+        TOO_SHORT | OVERLONG_2,
+        TOO_SHORT,
+        TOO_SHORT | OVERLONG_3 | SURROGATE,
+        TOO_SHORT | TOO_LARGE | TOO_LARGE_1000 | OVERLONG_4
+    };
+
+    alignas(16) static constexpr uint8_t FIRST_BYTE_LOW_NIBBLE_TABLE[16] =
+    {
+        CARRY | OVERLONG_3 | OVERLONG_2 | OVERLONG_4,
+        CARRY | OVERLONG_2,
+        CARRY,
+        CARRY,
+        CARRY | TOO_LARGE,
+        CARRY | TOO_LARGE | TOO_LARGE_1000,
+        CARRY | TOO_LARGE | TOO_LARGE_1000,
+        CARRY | TOO_LARGE | TOO_LARGE_1000,
+        CARRY | TOO_LARGE | TOO_LARGE_1000,
+        CARRY | TOO_LARGE | TOO_LARGE_1000,
+        CARRY | TOO_LARGE | TOO_LARGE_1000,
+        CARRY | TOO_LARGE | TOO_LARGE_1000,
+        CARRY | TOO_LARGE | TOO_LARGE_1000,
+        CARRY | TOO_LARGE | TOO_LARGE_1000 | SURROGATE,
+        CARRY | TOO_LARGE | TOO_LARGE_1000,
+        CARRY | TOO_LARGE | TOO_LARGE_1000
+    };
+
+    alignas(16) static constexpr uint8_t SECOND_BYTE_HIGH_NIBBLE_TABLE[16] =
+    {
+        TOO_SHORT, TOO_SHORT, TOO_SHORT, TOO_SHORT,
+        TOO_SHORT, TOO_SHORT, TOO_SHORT, TOO_SHORT,
+        TOO_LONG | OVERLONG_2 | TWO_CONTINUATIONS | OVERLONG_3 |
+            TOO_LARGE_1000 | OVERLONG_4,
+        TOO_LONG | OVERLONG_2 | TWO_CONTINUATIONS | OVERLONG_3 | TOO_LARGE,
+        TOO_LONG | OVERLONG_2 | TWO_CONTINUATIONS | SURROGATE | TOO_LARGE,
+        TOO_LONG | OVERLONG_2 | TWO_CONTINUATIONS | SURROGATE | TOO_LARGE,
+        TOO_SHORT, TOO_SHORT, TOO_SHORT, TOO_SHORT
+    };
+
+    struct UnicodeSse2Block
+    {
+        using vector_t = __m128i;
+
+        static constexpr std::size_t SIZE = 16;
+
+        static vector_t load(
+            const void* data
+        )
+        {
+            return _mm_loadu_si128(static_cast<const __m128i*>(data));
+        }
+
+        static void store(
+            void* data,
+            const vector_t value
+        )
+        {
+            _mm_storeu_si128(static_cast<__m128i*>(data), value);
+        }
+
+        static uint32_t get_sign_mask(
+            const vector_t value
+        )
+        {
+            return static_cast<uint32_t>(_mm_movemask_epi8(value));
+        }
+
+        static std::size_t count_utf16_units(
+            const vector_t block
+        )
+        {
+            const vector_t leading_bytes =
+                _mm_cmpgt_epi8(block, _mm_set1_epi8(-65));
+            const vector_t four_byte_leads = _mm_cmpeq_epi8(
+                _mm_subs_epu8(block, _mm_set1_epi8(static_cast<char>(0xEF))),
+                _mm_setzero_si128()
+            );
+
+            return std::popcount(get_sign_mask(leading_bytes)) +
+                SIZE - std::popcount(get_sign_mask(four_byte_leads));
+        }
+
+        static vector_t match_surrogates(
+            const vector_t units
+        )
+        {
+            const vector_t offset = _mm_xor_si128(
+                _mm_add_epi16(units, _mm_set1_epi16(0x2800)),
+                _mm_set1_epi16(static_cast<short>(0x8000))
+            );
+
+            return _mm_cmplt_epi16(offset,
+                _mm_set1_epi16(static_cast<short>(0x8800)));
+        }
+
+        static std::size_t count_utf8_bytes(
+            const vector_t units
+        )
+        {
+            const vector_t zero = _mm_setzero_si128();
+            const uint32_t one_byte_mask = get_sign_mask(_mm_cmpeq_epi16(
+                _mm_subs_epu16(units, _mm_set1_epi16(0x7F)), zero));
+            const uint32_t two_byte_mask = get_sign_mask(_mm_cmpeq_epi16(
+                _mm_subs_epu16(units, _mm_set1_epi16(0x7FF)), zero));
+            const uint32_t surrogate_mask =
+                get_sign_mask(match_surrogates(units));
+
+            return (SIZE * 3 - std::popcount(one_byte_mask) -
+                std::popcount(two_byte_mask) -
+                std::popcount(surrogate_mask)) / 2;
+        }
+
+        static bool widen_ascii(
+            const char* input,
+            char16_t* output
+        )
+        {
+            const vector_t block = load(input);
+            if (get_sign_mask(block) != 0)
+            {
+                return false;
+            }
+
+            store(output, _mm_unpacklo_epi8(block, _mm_setzero_si128()));
+            store(output + SIZE / 2,
+                _mm_unpackhi_epi8(block, _mm_setzero_si128()));
+
+            return true;
+        }
+
+        static bool narrow_ascii(
+            const char16_t* input,
+            char* output
+        )
+        {
+            const vector_t low = load(input);
+            const vector_t high = load(input + SIZE / 2);
+            const vector_t non_ascii_bits = _mm_and_si128(
+                _mm_or_si128(low, high),
+                _mm_set1_epi16(static_cast<short>(0xFF80))
+            );
+            if (get_sign_mask(_mm_cmpeq_epi8(non_ascii_bits,
+                _mm_setzero_si128())) != 0xFFFF)
+            {
+                return false;
+            }
+
+            store(output, _mm_packus_epi16(low, high));
+
+            return true;
+        }
+    };
+
+    struct UnicodeSsse3Block :
+        public UnicodeSse2Block
+    {
+        static vector_t set(
+            const uint8_t value
+        )
+        {
+            return _mm_set1_epi8(static_cast<char>(value));
+        }
+
+        static vector_t lookup(
+            const uint8_t* table,
+            const vector_t indices
+        )
+        {
+            return _mm_shuffle_epi8(load(table), indices);
+        }
+
+        static vector_t get_high_nibbles(
+            const vector_t value
+        )
+        {
+            return _mm_and_si128(_mm_srli_epi16(value, 4), set(0x0F));
+        }
+
+        static vector_t get_low_nibbles(
+            const vector_t value
+        )
+        {
+            return _mm_and_si128(value, set(0x0F));
+        }
+
+        template<int Offset>
+        static vector_t get_previous(
+            const vector_t input,
+            const vector_t previous_input
+        )
+        {
+            return _mm_alignr_epi8(input, previous_input, 16 - Offset);
+        }
+
+        static vector_t bitwise_and(
+            const vector_t left,
+            const vector_t right
+        )
+        {
+            return _mm_and_si128(left, right);
+        }
+
+        static vector_t bitwise_or(
+            const vector_t left,
+            const vector_t right
+        )
+        {
+            return _mm_or_si128(left, right);
+        }
+
+        static vector_t bitwise_xor(
+            const vector_t left,
+            const vector_t right
+        )
+        {
+            return _mm_xor_si128(left, right);
+        }
+
+        static vector_t subtract_saturated(
+            const vector_t left,
+            const vector_t right
+        )
+        {
+            return _mm_subs_epu8(left, right);
+        }
+
+        static vector_t get_zero()
+        {
+            return _mm_setzero_si128();
+        }
+
+        static bool is_zero(
+            const vector_t value
+        )
+        {
+            return get_sign_mask(
+                _mm_cmpeq_epi8(value, _mm_setzero_si128())) == 0xFFFF;
+        }
+
+        static vector_t get_incomplete_threshold()
+        {
+            return _mm_setr_epi8(
+                -1, -1, -1, -1, -1, -1, -1, -1,
+                -1, -1, -1, -1, -1,
+                static_cast<char>(0xF0 - 1),
+                static_cast<char>(0xE0 - 1),
+                static_cast<char>(0xC0 - 1)
+            );
+        }
+    };
+
+    struct UnicodeAvx2Block
+    {
+        using vector_t = __m256i;
+
+        static constexpr std::size_t SIZE = 32;
+
+        static vector_t load(
+            const void* data
+        )
+        {
+            return _mm256_loadu_si256(static_cast<const __m256i*>(data));
+        }
+
+        static void store(
+            void* data,
+            const vector_t value
+        )
+        {
+            _mm256_storeu_si256(static_cast<__m256i*>(data), value);
+        }
+
+        static uint32_t get_sign_mask(
+            const vector_t value
+        )
+        {
+            return static_cast<uint32_t>(_mm256_movemask_epi8(value));
+        }
+
+        static std::size_t count_utf16_units(
+            const vector_t block
+        )
+        {
+            const vector_t leading_bytes =
+                _mm256_cmpgt_epi8(block, _mm256_set1_epi8(-65));
+            const vector_t four_byte_leads = _mm256_cmpeq_epi8(
+                _mm256_subs_epu8(block,
+                    _mm256_set1_epi8(static_cast<char>(0xEF))),
+                _mm256_setzero_si256()
+            );
+
+            return std::popcount(get_sign_mask(leading_bytes)) +
+                SIZE - std::popcount(get_sign_mask(four_byte_leads));
+        }
+
+        static vector_t match_surrogates(
+            const vector_t units
+        )
+        {
+            const vector_t offset = _mm256_xor_si256(
+                _mm256_add_epi16(units, _mm256_set1_epi16(0x2800)),
+                _mm256_set1_epi16(static_cast<short>(0x8000))
+            );
+
+            return _mm256_cmpgt_epi16(
+                _mm256_set1_epi16(static_cast<short>(0x8800)), offset);
+        }
+
+        static std::size_t count_utf8_bytes(
+            const vector_t units
+        )
+        {
+            const vector_t zero = _mm256_setzero_si256();
+            const uint32_t one_byte_mask = get_sign_mask(_mm256_cmpeq_epi16(
+                _mm256_subs_epu16(units, _mm256_set1_epi16(0x7F)), zero));
+            const uint32_t two_byte_mask = get_sign_mask(_mm256_cmpeq_epi16(
+                _mm256_subs_epu16(units, _mm256_set1_epi16(0x7FF)), zero));
+            const uint32_t surrogate_mask =
+                get_sign_mask(match_surrogates(units));
+
+            return (SIZE * 3 - std::popcount(one_byte_mask) -
+                std::popcount(two_byte_mask) -
+                std::popcount(surrogate_mask)) / 2;
+        }
+
+        static bool widen_ascii(
+            const char* input,
+            char16_t* output
+        )
+        {
+            const vector_t block = load(input);
+            if (get_sign_mask(block) != 0)
+            {
+                return false;
+            }
+
+            store(output,
+                _mm256_cvtepu8_epi16(_mm256_castsi256_si128(block)));
+            store(output + SIZE / 2,
+                _mm256_cvtepu8_epi16(_mm256_extracti128_si256(block, 1)));
+
+            return true;
+        }
+
+        static bool narrow_ascii(
+            const char16_t* input,
+            char* output
+        )
+        {
+            const vector_t low = load(input);
+            const vector_t high = load(input + SIZE / 2);
+            const vector_t non_ascii_bits = _mm256_and_si256(
+                _mm256_or_si256(low, high),
+                _mm256_set1_epi16(static_cast<short>(0xFF80))
+            );
+            if (!_mm256_testz_si256(non_ascii_bits, non_ascii_bits))
+            {
+                return false;
+            }
+
+            store(output, _mm256_permute4x64_epi64(
+                _mm256_packus_epi16(low, high), 0xD8));
+
+            return true;
+        }
+
+        static vector_t set(
+            const uint8_t value
+        )
+        {
+            return _mm256_set1_epi8(static_cast<char>(value));
+        }
+
+        static vector_t lookup(
+            const uint8_t* table,
+            const vector_t indices
+        )
+        {
+            return _mm256_shuffle_epi8(
+                _mm256_broadcastsi128_si256(
+                    _mm_load_si128(reinterpret_cast<const __m128i*>(table))),
+                indices
+            );
+        }
+
+        static vector_t get_high_nibbles(
+            const vector_t value
+        )
+        {
+            return _mm256_and_si256(_mm256_srli_epi16(value, 4), set(0x0F));
+        }
+
+        static vector_t get_low_nibbles(
+            const vector_t value
+        )
+        {
+            return _mm256_and_si256(value, set(0x0F));
+        }
+
+        template<int Offset>
+        static vector_t get_previous(
+            const vector_t input,
+            const vector_t previous_input
+        )
+        {
+            return _mm256_alignr_epi8(input,
+                _mm256_permute2x128_si256(previous_input, input, 0x21),
+                16 - Offset);
+        }
+
+        static vector_t bitwise_and(
+            const vector_t left,
+            const vector_t right
+        )
+        {
+            return _mm256_and_si256(left, right);
+        }
+
+        static vector_t bitwise_or(
+            const vector_t left,
+            const vector_t right
+        )
+        {
+            return _mm256_or_si256(left, right);
+        }
+
+        static vector_t bitwise_xor(
+            const vector_t left,
+            const vector_t right
+        )
+        {
+            return _mm256_xor_si256(left, right);
+        }
+
+        static vector_t subtract_saturated(
+            const vector_t left,
+            const vector_t right
+        )
+        {
+            return _mm256_subs_epu8(left, right);
+        }
+
+        static vector_t get_zero()
+        {
+            return _mm256_setzero_si256();
+        }
+
+        static bool is_zero(
+            const vector_t value
+        )
+        {
+            return _mm256_testz_si256(value, value) != 0;
+        }
+
+        static vector_t get_incomplete_threshold()
+        {
+            return _mm256_setr_epi8(
+                -1, -1, -1, -1, -1, -1, -1, -1,
+                -1, -1, -1, -1, -1, -1, -1, -1,
+                -1, -1, -1, -1, -1, -1, -1, -1,
+                -1, -1, -1, -1, -1,
+                static_cast<char>(0xF0 - 1),
+                static_cast<char>(0xE0 - 1),
+                static_cast<char>(0xC0 - 1)
+            );
+        }
+    };
+
+    static std::size_t get_utf8_sequence_size(
+        const std::string_view value,
+        const std::size_t index
+    )
+    {
+        const unsigned char lead = static_cast<unsigned char>(value[index]);
+        std::size_t size = 0;
+        unsigned char minimum = 0x80;
+        unsigned char maximum = 0xBF;
+
+        if (lead < 0x80)
+        {
+            return 1;
+        }
+        else if (lead >= 0xC2 && lead <= 0xDF)
+        {
+            size = 2;
+        }
+        else if (lead >= 0xE0 && lead <= 0xEF)
+        {
+            size = 3;
+            minimum = lead == 0xE0 ? 0xA0 : 0x80;
+            maximum = lead == 0xED ? 0x9F : 0xBF;
+        }
+        else if (lead >= 0xF0 && lead <= 0xF4)
+        {
+            size = 4;
+            minimum = lead == 0xF0 ? 0x90 : 0x80;
+            maximum = lead == 0xF4 ? 0x8F : 0xBF;
+        }
+        else
+        {
+            return 0;
+        }
+
+        if (value.size() - index < size)
+        {
+            return 0;
+        }
+
+        const unsigned char second =
+            static_cast<unsigned char>(value[index + 1]);
+        if (second < minimum || second > maximum)
+        {
+            return 0;
+        }
+
+        for (std::size_t offset = 2; offset < size; ++offset)
+        {
+            if ((static_cast<unsigned char>(value[index + offset]) & 0xC0) !=
+                0x80)
+            {
+                return 0;
+            }
+        }
+
+        return size;
+    }
+
+    static bool validate_utf8_scalar(
+        const std::string_view value
+    )
+    {
+        std::size_t index = 0;
+        while (index < value.size())
+        {
+            index += UnicodeKernels::get_ascii_prefix_size(value.substr(index));
+            if (index == value.size())
+            {
+                break;
+            }
+
+            const std::size_t sequence_size =
+                get_utf8_sequence_size(value, index);
+            if (sequence_size == 0)
+            {
+                return false;
+            }
+
+            index += sequence_size;
+        }
+
+        return true;
+    }
+
+    template<typename Block>
+    static typename Block::vector_t check_utf8_block(
+        const typename Block::vector_t input,
+        const typename Block::vector_t previous_input
+    )
+    {
+        using vector_t = typename Block::vector_t;
+
+        const vector_t previous_1 =
+            Block::template get_previous<1>(input, previous_input);
+        const vector_t special_cases = Block::bitwise_and(
+            Block::bitwise_and(
+                Block::lookup(FIRST_BYTE_HIGH_NIBBLE_TABLE,
+                    Block::get_high_nibbles(previous_1)),
+                Block::lookup(FIRST_BYTE_LOW_NIBBLE_TABLE,
+                    Block::get_low_nibbles(previous_1))
+            ),
+            Block::lookup(SECOND_BYTE_HIGH_NIBBLE_TABLE,
+                Block::get_high_nibbles(input))
+        );
+
+        const vector_t is_third_byte = Block::subtract_saturated(
+            Block::template get_previous<2>(input, previous_input),
+            Block::set(0xE0 - 0x80)
+        );
+        const vector_t is_fourth_byte = Block::subtract_saturated(
+            Block::template get_previous<3>(input, previous_input),
+            Block::set(0xF0 - 0x80)
+        );
+        const vector_t must_be_continuation = Block::bitwise_and(
+            Block::bitwise_or(is_third_byte, is_fourth_byte),
+            Block::set(0x80)
+        );
+
+        return Block::bitwise_xor(must_be_continuation, special_cases);
+    }
+
+    template<typename Block>
+    static bool validate_utf8(
+        const std::string_view value
+    )
+    {
+        using vector_t = typename Block::vector_t;
+
+        vector_t error = Block::get_zero();
+        vector_t previous_input = Block::get_zero();
+        vector_t previous_incomplete = Block::get_zero();
+        const vector_t incomplete_threshold =
+            Block::get_incomplete_threshold();
+
+        const auto check_block = [&](const vector_t input)
+            {
+                if (Block::get_sign_mask(input) == 0)
+                {
+                    error = Block::bitwise_or(error, previous_incomplete);
+                    previous_incomplete = Block::get_zero();
+                }
+                else
+                {
+                    error = Block::bitwise_or(error,
+                        check_utf8_block<Block>(input, previous_input));
+                    previous_incomplete = Block::subtract_saturated(
+                        input, incomplete_threshold);
+                }
+
+                previous_input = input;
+            };
+
+        std::size_t index = 0;
+        for (; index + Block::SIZE <= value.size(); index += Block::SIZE)
+        {
+            check_block(Block::load(value.data() + index));
+        }
+
+        if (index < value.size())
+        {
+            alignas(32) char buffer[Block::SIZE] = {};
+            std::memcpy(buffer, value.data() + index, value.size() - index);
+            check_block(Block::load(buffer));
+        }
+
+        return Block::is_zero(Block::bitwise_or(error, previous_incomplete));
+    }
+
+    template<typename Block>
+    static bool validate_utf16(
+        const std::u16string_view value
+    )
+    {
+        constexpr std::size_t UNIT_COUNT = Block::SIZE / 2;
+
+        std::size_t index = 0;
+        while (index < value.size())
+        {
+            if (index + UNIT_COUNT <= value.size() &&
+                Block::get_sign_mask(Block::match_surrogates(
+                    Block::load(value.data() + index))) == 0)
+            {
+                index += UNIT_COUNT;
+                continue;
+            }
+
+            const std::size_t block_end =
+                std::min(index + UNIT_COUNT, value.size());
+            while (index < block_end)
+            {
+                const char16_t unit = value[index];
+                if (unit < 0xD800 || unit > 0xDFFF)
+                {
+                    ++index;
+                    continue;
+                }
+
+                if (unit > 0xDBFF || index + 1 == value.size() ||
+                    value[index + 1] < 0xDC00 || value[index + 1] > 0xDFFF)
+                {
+                    return false;
+                }
+
+                index += 2;
+            }
+        }
+
+        return true;
+    }
+
+    template<typename Block>
+    static std::size_t count_utf16_length(
+        const std::string_view value
+    )
+    {
+        std::size_t length = 0;
+        std::size_t index = 0;
+        for (; index + Block::SIZE <= value.size(); index += Block::SIZE)
+        {
+            length += Block::count_utf16_units(
+                Block::load(value.data() + index));
+        }
+
+        for (; index < value.size(); ++index)
+        {
+            const unsigned char byte = static_cast<unsigned char>(value[index]);
+            length += ((byte & 0xC0) != 0x80) + (byte >= 0xF0);
+        }
+
+        return length;
+    }
+
+    template<typename Block>
+    static std::size_t count_utf8_length(
+        const std::u16string_view value
+    )
+    {
+        constexpr std::size_t UNIT_COUNT = Block::SIZE / 2;
+
+        std::size_t length = 0;
+        std::size_t index = 0;
+        for (; index + UNIT_COUNT <= value.size(); index += UNIT_COUNT)
+        {
+            length += Block::count_utf8_bytes(
+                Block::load(value.data() + index));
+        }
+
+        for (; index < value.size(); ++index)
+        {
+            const char16_t unit = value[index];
+            length += 1 + (unit >= 0x80) + (unit >= 0x800) -
+                (unit >= 0xD800 && unit <= 0xDFFF);
+        }
+
+        return length;
+    }
+
+    template<typename Block>
+    static std::optional<std::size_t> decode_utf8(
+        const std::string_view value,
+        std::span<char16_t> output
+    )
+    {
+        const unsigned char* input =
+            reinterpret_cast<const unsigned char*>(value.data());
+        std::size_t input_index = 0;
+        std::size_t output_index = 0;
+
+        while (input_index < value.size())
+        {
+            if (input_index + Block::SIZE <= value.size() &&
+                output_index + Block::SIZE <= output.size() &&
+                Block::widen_ascii(value.data() + input_index,
+                    output.data() + output_index))
+            {
+                input_index += Block::SIZE;
+                output_index += Block::SIZE;
+                continue;
+            }
+
+            const std::size_t block_end =
+                std::min(input_index + Block::SIZE, value.size());
+            while (input_index < block_end)
+            {
+                const unsigned char lead = input[input_index];
+                if (lead < 0x80)
+                {
+                    if (output_index == output.size())
+                    {
+                        return std::nullopt;
+                    }
+
+                    output[output_index++] = lead;
+                    input_index += 1;
+                }
+                else if (lead < 0xE0)
+                {
+                    if (output_index == output.size())
+                    {
+                        return std::nullopt;
+                    }
+
+                    output[output_index++] = static_cast<char16_t>(
+                        ((lead & 0x1F) << 6) |
+                        (input[input_index + 1] & 0x3F));
+                    input_index += 2;
+                }
+                else if (lead < 0xF0)
+                {
+                    if (output_index == output.size())
+                    {
+                        return std::nullopt;
+                    }
+
+                    output[output_index++] = static_cast<char16_t>(
+                        ((lead & 0x0F) << 12) |
+                        ((input[input_index + 1] & 0x3F) << 6) |
+                        (input[input_index + 2] & 0x3F));
+                    input_index += 3;
+                }
+                else
+                {
+                    if (output.size() - output_index < 2)
+                    {
+                        return std::nullopt;
+                    }
+
+                    const uint32_t code_point =
+                        (((lead & 0x07) << 18) |
+                        ((input[input_index + 1] & 0x3F) << 12) |
+                        ((input[input_index + 2] & 0x3F) << 6) |
+                        (input[input_index + 3] & 0x3F)) - 0x10000;
+                    output[output_index++] =
+                        static_cast<char16_t>(0xD800 + (code_point >> 10));
+                    output[output_index++] =
+                        static_cast<char16_t>(0xDC00 + (code_point & 0x3FF));
+                    input_index += 4;
+                }
+            }
+        }
+
+        return output_index;
+    }
+
+    template<typename Block>
+    static std::optional<std::size_t> encode_utf8(
+        const std::u16string_view value,
+        std::span<char> output
+    )
+    {
+        std::size_t input_index = 0;
+        std::size_t output_index = 0;
+
+        while (input_index < value.size())
+        {
+            if (input_index + Block::SIZE <= value.size() &&
+                output_index + Block::SIZE <= output.size() &&
+                Block::narrow_ascii(value.data() + input_index,
+                    output.data() + output_index))
+            {
+                input_index += Block::SIZE;
+                output_index += Block::SIZE;
+                continue;
+            }
+
+            const std::size_t block_end =
+                std::min(input_index + Block::SIZE, value.size());
+            while (input_index < block_end)
+            {
+                const char16_t unit = value[input_index];
+                const std::size_t remaining = output.size() - output_index;
+                if (unit < 0x80)
+                {
+                    if (remaining < 1)
+                    {
+                        return std::nullopt;
+                    }
+
+                    output[output_index++] = static_cast<char>(unit);
+                    input_index += 1;
+                }
+                else if (unit < 0x800)
+                {
+                    if (remaining < 2)
+                    {
+                        return std::nullopt;
+                    }
+
+                    output[output_index++] =
+                        static_cast<char>(0xC0 | (unit >> 6));
+                    output[output_index++] =
+                        static_cast<char>(0x80 | (unit & 0x3F));
+                    input_index += 1;
+                }
+                else if (unit < 0xD800 || unit > 0xDFFF)
+                {
+                    if (remaining < 3)
+                    {
+                        return std::nullopt;
+                    }
+
+                    output[output_index++] =
+                        static_cast<char>(0xE0 | (unit >> 12));
+                    output[output_index++] =
+                        static_cast<char>(0x80 | ((unit >> 6) & 0x3F));
+                    output[output_index++] =
+                        static_cast<char>(0x80 | (unit & 0x3F));
+                    input_index += 1;
+                }
+                else
+                {
+                    if (remaining < 4)
+                    {
+                        return std::nullopt;
+                    }
+
+                    const uint32_t code_point = 0x10000 +
+                        ((static_cast<uint32_t>(unit - 0xD800) << 10) |
+                        (value[input_index + 1] - 0xDC00));
+                    output[output_index++] =
+                        static_cast<char>(0xF0 | (code_point >> 18));
+                    output[output_index++] =
+                        static_cast<char>(0x80 | ((code_point >> 12) & 0x3F));
+                    output[output_index++] =
+                        static_cast<char>(0x80 | ((code_point >> 6) & 0x3F));
+                    output[output_index++] =
+                        static_cast<char>(0x80 | (code_point & 0x3F));
+                    input_index += 2;
+                }
+            }
+        }
+
+        return output_index;
+    }
+
+    bool UnicodeKernels::is_utf8(
+        const std::string_view value
+    )
+    {
+        if (CPU_FEATURES.is_avx2_supported())
+        {
+            return validate_utf8<UnicodeAvx2Block>(value);
+        }
+
+        if (CPU_FEATURES.is_ssse3_supported())
+        {
+            return validate_utf8<UnicodeSsse3Block>(value);
+        }
+
+        return validate_utf8_scalar(value);
+    }
+
+    bool UnicodeKernels::is_utf16(
+        const std::u16string_view value
+    )
+    {
+        if (CPU_FEATURES.is_avx2_supported())
+        {
+            return validate_utf16<UnicodeAvx2Block>(value);
+        }
+
+        return validate_utf16<UnicodeSse2Block>(value);
+    }
+
+    std::size_t UnicodeKernels::get_ascii_prefix_size(
+        const std::string_view value
+    )
+    {
+        std::size_t index = 0;
+        for (; index + UnicodeSse2Block::SIZE <= value.size();
+            index += UnicodeSse2Block::SIZE)
+        {
+            const uint32_t mask = UnicodeSse2Block::get_sign_mask(
+                UnicodeSse2Block::load(value.data() + index));
+            if (mask != 0)
+            {
+                return index + std::countr_zero(mask);
+            }
+        }
+
+        while (index < value.size() &&
+            static_cast<unsigned char>(value[index]) < 0x80)
+        {
+            ++index;
+        }
+
+        return index;
+    }
+
+    std::size_t UnicodeKernels::get_utf16_length(
+        const std::string_view value
+    )
+    {
+        if (CPU_FEATURES.is_avx2_supported())
+        {
+            return count_utf16_length<UnicodeAvx2Block>(value);
+        }
+
+        return count_utf16_length<UnicodeSse2Block>(value);
+    }
+
+    std::size_t UnicodeKernels::get_utf8_length(
+        const std::u16string_view value
+    )
+    {
+        if (CPU_FEATURES.is_avx2_supported())
+        {
+            return count_utf8_length<UnicodeAvx2Block>(value);
+        }
+
+        return count_utf8_length<UnicodeSse2Block>(value);
+    }
+
+    std::optional<std::size_t> UnicodeKernels::convert_utf8_to_utf16(
+        const std::string_view value,
+        std::span<char16_t> output
+    )
+    {
+        if (!is_utf8(value))
+        {
+            return std::nullopt;
+        }
+
+        if (CPU_FEATURES.is_avx2_supported())
+        {
+            return decode_utf8<UnicodeAvx2Block>(value, output);
+        }
+
+        return decode_utf8<UnicodeSse2Block>(value, output);
+    }
+
+    std::optional<std::size_t> UnicodeKernels::convert_utf16_to_utf8(
+        const std::u16string_view value,
+        std::span<char> output
+    )
+    {
+        if (!is_utf16(value))
+        {
+            return std::nullopt;
+        }
+
+        if (CPU_FEATURES.is_avx2_supported())
+        {
+            return encode_utf8<UnicodeAvx2Block>(value, output);
+        }
+
+        return encode_utf8<UnicodeSse2Block>(value, output);
+    }
+}
@@ -0,0 +1,272 @@
+#include "pch.hpp"
+
+#include "../includes/validation_kernels.hpp"
+
+#include <immintrin.h>
+
+namespace QLogicaeCore
+{
+    static constexpr std::size_t BLOCK_SIZE = 16;
+
+    static constexpr int BLOCK_MASK = 0xFFFF;
+
+    static __m128i load_block(
+        const char* data
+    )
+    {
+        return _mm_loadu_si128(reinterpret_cast<const __m128i*>(data));
+    }
+
+    static __m128i match_range(
+        const __m128i block,
+        const char minimum,
+        const char maximum
+    )
+    {
+        const __m128i offset = _mm_sub_epi8(block, _mm_set1_epi8(minimum));
+
+        return _mm_cmpeq_epi8(
+            _mm_min_epu8(offset,
+                _mm_set1_epi8(static_cast<char>(maximum - minimum))),
+            offset
+        );
+    }
+
+    static __m128i match_digit_block(
+        const __m128i block
+    )
+    {
+        return match_range(block, '0', '9');
+    }
+
+    static __m128i match_lowercase_block(
+        const __m128i block
+    )
+    {
+        return match_range(block, 'a', 'z');
+    }
+
+    static __m128i match_uppercase_block(
+        const __m128i block
+    )
+    {
+        return match_range(block, 'A', 'Z');
+    }
+
+    static __m128i match_alphanumeric_block(
+        const __m128i block
+    )
+    {
+        return _mm_or_si128(
+            match_digit_block(block),
+            match_range(_mm_or_si128(block, _mm_set1_epi8(0x20)), 'a', 'z')
+        );
+    }
+
+    static __m128i match_hex_block(
+        const __m128i block
+    )
+    {
+        return _mm_or_si128(
+            match_digit_block(block),
+            match_range(_mm_or_si128(block, _mm_set1_epi8(0x20)), 'a', 'f')
+        );
+    }
+
+    static __m128i match_base64_block(
+        const __m128i block
+    )
+    {
+        return _mm_or_si128(
+            match_alphanumeric_block(block),
+            _mm_or_si128(
+                _mm_cmpeq_epi8(block, _mm_set1_epi8('+')),
+                _mm_cmpeq_epi8(block, _mm_set1_epi8('/'))
+            )
+        );
+    }
+
+    static constexpr bool is_lowercase_character(
+        const char character
+    )
+    {
+        return character >= 'a' && character <= 'z';
+    }
+
+    static constexpr bool is_uppercase_character(
+        const char character
+    )
+    {
+        return character >= 'A' && character <= 'Z';
+    }
+
+    template<typename BlockMatcher, typename CharacterMatcher>
+    static bool is_all_of(
+        const std::string_view value,
+        BlockMatcher block_matcher,
+        CharacterMatcher character_matcher
+    )
+    {
+        std::size_t index = 0;
+        for (; index + BLOCK_SIZE <= value.size(); index += BLOCK_SIZE)
+        {
+            if (_mm_movemask_epi8(
+                block_matcher(load_block(value.data() + index))) != BLOCK_MASK)
+            {
+                return false;
+            }
+        }
+
+        for (; index < value.size(); ++index)
+        {
+            if (!character_matcher(value[index]))
+            {
+                return false;
+            }
+        }
+
+        return true;
+    }
+
+    bool ValidationKernels::is_hex(
+        const std::string_view value
+    )
+    {
+        const std::string_view digits = value.starts_with("0x") ?
+            value.substr(2) : value;
+
+        return !digits.empty() &&
+            is_all_of(digits, match_hex_block, ValidationMatchers::is_hex_digit);
+    }
+
+    bool ValidationKernels::is_base64(
+        const std::string_view value
+    )
+    {
+        if (value.size() % 4 != 0)
+        {
+            return false;
+        }
+
+        if (value.empty())
+        {
+            return true;
+        }
+
+        const std::size_t padding_size =
+            value.ends_with("==") ? 2 : value.ends_with('=') ? 1 : 0;
+
+        return is_all_of(value.substr(0, value.size() - padding_size),
+            match_base64_block, ValidationMatchers::is_base64_character);
+    }
+
+    bool ValidationKernels::is_alphanumeric(
+        const std::string_view value
+    )
+    {
+        return !value.empty() && is_all_of(value,
+            match_alphanumeric_block, ValidationMatchers::is_alphanumeric);
+    }
+
+    bool ValidationKernels::is_lowercase(
+        const std::string_view value
+    )
+    {
+        return !value.empty() && is_all_of(value,
+            match_lowercase_block, is_lowercase_character);
+    }
+
+    bool ValidationKernels::is_uppercase(
+        const std::string_view value
+    )
+    {
+        return !value.empty() && is_all_of(value,
+            match_uppercase_block, is_uppercase_character);
+    }
+
+    bool ValidationKernels::is_decimal(
+        const std::string_view value
+    )
+    {
+        if (value.empty())
+        {
+            return false;
+        }
+
+        const __m128i separator = _mm_set1_epi8('.');
+        std::size_t separator_count = 0;
+        std::size_t index = 0;
+        for (; index + BLOCK_SIZE <= value.size(); index += BLOCK_SIZE)
+        {
+            const __m128i block = load_block(value.data() + index);
+            const __m128i separators = _mm_cmpeq_epi8(block, separator);
+            if (_mm_movemask_epi8(_mm_or_si128(
+                match_digit_block(block), separators)) != BLOCK_MASK)
+            {
+                return false;
+            }
+
+            separator_count += std::popcount(
+                static_cast<unsigned int>(_mm_movemask_epi8(separators)));
+            if (separator_count > 1)
+            {
+                return false;
+            }
+        }
+
+        for (; index < value.size(); ++index)
+        {
+            if (value[index] == '.')
+            {
+                if (++separator_count > 1)
+                {
+                    return false;
+                }
+            }
+            else if (!ValidationMatchers::is_digit(value[index]))
+            {
+                return false;
+            }
+        }
+
+        return true;
+    }
+
+    bool ValidationKernels::is_utf8(
+        const std::string_view value
+    )
+    {
+        return UnicodeKernels::is_utf8(value);
+    }
+
+    validation_kernel_t ValidationKernels::get_kernel(
+        const ValidationPredicate predicate
+    )
+    {
+        switch (predicate)
+        {
+        case ValidationPredicate::HEX:
+            return is_hex;
+
+        case ValidationPredicate::BASE64:
+            return is_base64;
+
+        case ValidationPredicate::ALPHANUMERIC:
+            return is_alphanumeric;
+
+        case ValidationPredicate::LOWERCASE:
+            return is_lowercase;
+
+        case ValidationPredicate::UPPERCASE:
+            return is_uppercase;
+
+        case ValidationPredicate::UTF8:
+            return is_utf8;
+
+        case ValidationPredicate::DECIMAL:
+            return is_decimal;
+        }
+
+        return nullptr;
+    }
+}
@@ -0,0 +1,8 @@
+#include "pch.hpp"
+
+#include "../includes/validation_predicate.hpp"
+
+namespace QLogicaeCore
+{
+
+}
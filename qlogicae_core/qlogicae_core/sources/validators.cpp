@@ -126,11 +126,40 @@ namespace QLogicaeCore
         );
     }
 
+    static ConcurrentCache<std::string, std::shared_ptr<const std::regex>>&
+        get_std_regex_patterns()
+    {
+        static ConcurrentCache<std::string, std::shared_ptr<const std::regex>>
+            patterns(
+                {
+                    .shard_count = 4,
+                    .maximum_weight = 256
+                }
+            );
+
+        return patterns;
+    }
+
     static bool match_std_regex(const std::string_view& input, const std::string_view& pattern)
     {
         try
         {
-            return std::regex_match(input.begin(), input.end(), std::regex(pattern.data()));
+            std::optional<std::shared_ptr<const std::regex>> regular_expression =
+                get_std_regex_patterns().get_or_load(
+                    std::string(pattern),
+                    [&pattern]()
+                    {
+                        return std::optional<std::shared_ptr<const std::regex>>(
+                            std::make_shared<const std::regex>(
+                                pattern.begin(), pattern.end()
+                            )
+                        );
+                    }
+                );
+
+            return std::regex_match(
+                input.begin(), input.end(), **regular_expression
+            );
         }
         catch (const std::regex_error& exception)
         {
@@ -155,26 +184,12 @@ namespace QLogicaeCore
 
     bool Validators::is_lowercase(const std::string_view& value)
     {
-        if (value.empty())
-        {
-            return false;
-        }
-        return std::ranges::all_of(value, [](char character)
-            {
-                return std::islower(static_cast<unsigned char>(character));
-            });
+        return ValidationKernels::is_lowercase(value);
     }
 
     bool Validators::is_uppercase(const std::string_view& value)
     {
-        if (value.empty())
-        {
-            return false;
-        }
-        return std::ranges::all_of(value, [](char character)
-            {
-                return std::isupper(static_cast<unsigned char>(character));
-            });
+        return ValidationKernels::is_uppercase(value);
     }
 
     bool Validators::is_first_letter_uppercase(const std::string_view& value)
@@ -231,56 +246,44 @@ namespace QLogicaeCore
 
     bool Validators::is_alpanumeric(const std::string_view& value)
     {
-        if (value.empty())
-        {
-            return false;
-        }
-        return std::ranges::all_of(value, [](char character)
-            {
-                return std::isalnum(static_cast<unsigned char>(character));
-            });
+        return ValidationKernels::is_alphanumeric(value);
     }
 
     bool Validators::is_decimal(const std::string_view& value)
     {
-        if (value.empty())
-        {
-            return false;
-        }
-        bool has_decimal = false;
-        for (char character : value)
-        {
-            if (character == '.')
-            {
-                if (has_decimal)
-                {
-                    return false;
-                }
-                has_decimal = true;
-                continue;
-            }
-            if (!std::isdigit(static_cast<unsigned char>(character)))
-            {
-                return false;
-            }
-        }
-        return true;
+        return ValidationKernels::is_decimal(value);
     }
 
     bool Validators::is_utf8(const std::string_view& value)
     {
-        return std::string(value).find('\xC0') == std::string::npos;
+        return ValidationKernels::is_utf8(value);
     }
 
     bool Validators::is_utf16(const std::string_view& value)
     {
-        if (value.size() < 2)
+        if (value.size() < 2 || value.size() % 2 != 0)
         {
             return false;
         }
         unsigned char byte1 = static_cast<unsigned char>(value[0]);
         unsigned char byte2 = static_cast<unsigned char>(value[1]);
-        return (byte1 == 0xFF && byte2 == 0xFE) || (byte1 == 0xFE && byte2 == 0xFF);
+        const bool is_little_endian = byte1 == 0xFF && byte2 == 0xFE;
+        if (!is_little_endian && !(byte1 == 0xFE && byte2 == 0xFF))
+        {
+            return false;
+        }
+        std::u16string units((value.size() - 2) / 2, u'\0');
+        for (std::size_t index = 0; index < units.size(); ++index)
+        {
+            const unsigned char first =
+                static_cast<unsigned char>(value[2 + index * 2]);
+            const unsigned char second =
+                static_cast<unsigned char>(value[3 + index * 2]);
+            units[index] = is_little_endian ?
+                static_cast<char16_t>(first | (second << 8)) :
+                static_cast<char16_t>((first << 8) | second);
+        }
+        return UnicodeKernels::is_utf16(units);
     }
 
     bool Validators::is_time(const std::string_view& value, const std::string_view& format)
@@ -595,52 +598,52 @@ namespace QLogicaeCore
 
     bool Validators::is_iso8601(const std::string_view& value)
     {
-        return match_std_regex(value, R"(^\d{4}-\d{2}-\d{2}T\d{2}:\d{2}:\d{2}(Z|[+-]\d{2}:\d{2})?$)");
+        return ValidationMatchers::match_iso8601(value);
     }
 
     bool Validators::is_hex_color(const std::string_view& value)
     {
-        return match_std_regex(value, R"(^#(?:[0-9a-fA-F]{3}){1,2}$)");
+        return ValidationMatchers::match_hex_color(value);
     }
 
     bool Validators::is_base64(const std::string_view& value)
     {
-        return match_std_regex(value, R"(^([A-Za-z0-9+/]{4})*([A-Za-z0-9+/]{2}==|[A-Za-z0-9+/]{3}=)?$)");
+        return ValidationKernels::is_base64(value);
     }
 
     bool Validators::is_slug(const std::string_view& value)
     {
-        return match_std_regex(value, R"(^[a-z0-9]+(?:-[a-z0-9]+)*$)");
+        return ValidationMatchers::match_slug(value);
     }
 
     bool Validators::is_hex(const std::string_view& value)
     {
-        return match_std_regex(value, R"(^(0x)?[0-9a-fA-F]+$)");
+        return ValidationKernels::is_hex(value);
     }
 
     bool Validators::is_uuid4(const std::string_view& value)
     {
-        return match_std_regex(value, R"(^[a-fA-F0-9]{8}-[a-fA-F0-9]{4}-4[a-fA-F0-9]{3}-[89abAB][a-fA-F0-9]{3}-[a-fA-F0-9]{12}$)");
+        return ValidationMatchers::match_uuid(value, '4');
     }
 
     bool Validators::is_uuid6(const std::string_view& value)
     {
-        return match_std_regex(value, R"(^[a-fA-F0-9]{8}-[a-fA-F0-9]{4}-6[a-fA-F0-9]{3}-[89abAB][a-fA-F0-9]{3}-[a-fA-F0-9]{12}$)");
+        return ValidationMatchers::match_uuid(value, '6');
     }
 
     bool Validators::is_ipv4(const std::string_view& value)
     {
-        return match_std_regex(value, R"(^((25[0-5]|2[0-4]\d|1\d{2}|[1-9]?\d)\.){3}(25[0-5]|2[0-4]\d|1\d{2}|[1-9]?\d)$)");
+        return ValidationMatchers::match_ipv4(value);
     }
 
     bool Validators::is_ipv6(const std::string_view& value)
     {
-        return match_std_regex(value, R"(^([0-9a-fA-F]{1,4}:){7}[0-9a-fA-F]{1,4}$)");
+        return ValidationMatchers::match_ipv6(value);
     }
 
     bool Validators::is_url(const std::string_view& value)
     {
-        return match_std_regex(value, R"(^https?:\/\/(?:www\.)?[a-zA-Z0-9.-]+(?:\:\d+)?(?:\/\S*)?$)");
+        return ValidationMatchers::match_url(value);
     }
 
     bool Validators::is_uri(const std::string_view& value)
@@ -651,27 +654,27 @@ namespace QLogicaeCore
 
     bool Validators::is_mac_address(const std::string_view& value)
     {
-        return match_std_regex(value, R"(^([0-9A-Fa-f]{2}[:-]){5}([0-9A-Fa-f]{2})$)");
+        return ValidationMatchers::match_mac_address(value);
     }
 
     bool Validators::is_hostname(const std::string_view& value)
     {
-        return match_std_regex(value, R"(^(([a-zA-Z0-9]|[a-zA-Z0-9][a-zA-Z0-9\-]*[a-zA-Z0-9])\.)*([A-Za-z0-9]|[A-Za-z0-9][A-Za-z0-9\-]*[A-Za-z0-9])$)");
+        return ValidationMatchers::match_hostname(value);
     }
 
     bool Validators::is_domain(const std::string_view& value)
     {
-        return match_std_regex(value, R"(^([a-zA-Z0-9]+(-[a-zA-Z0-9]+)*\.)+[a-zA-Z]{2,}$)");
+        return ValidationMatchers::match_domain(value);
     }
 
     bool Validators::is_rgb_color(const std::string_view& value)
     {
-        return match_std_regex(value, R"(^rgb\((\s*\d{1,3}\s*,){2}\s*\d{1,3}\s*\)$)");
+        return ValidationMatchers::match_rgb_color(value);
     }
 
     bool Validators::is_rgba_color(const std::string_view& value)
     {
-        return match_std_regex(value, R"(^rgba\((\s*\d{1,3}\s*,){3}\s*(0|1|0?\.\d+)\s*\)$)");
+        return ValidationMatchers::match_rgba_color(value);
     }
 
     bool Validators::is_file_path(const std::string_view& value)
@@ -687,7 +690,8 @@ namespace QLogicaeCore
 
     bool Validators::is_file_extension(const std::string_view& value)
     {
-        return match_std_regex(value, R"(^[a-zA-Z0-9]+$)");
+        return !value.empty() &&
+            ValidationMatchers::is_all_of(value, ValidationMatchers::is_alphanumeric);
     }
 
     bool Validators::is_file_extension_allowed(const std::string_view& value, const std::set<std::string>& allowed_extensions)
@@ -703,12 +707,12 @@ namespace QLogicaeCore
 
     bool Validators::is_base64_image(const std::string_view& value)
     {
-        return match_std_regex(value, R"(^data:image\/(png|jpeg|jpg|gif);base64,([A-Za-z0-9+/]{4})*([A-Za-z0-9+/]{2}==|[A-Za-z0-9+/]{3}=)?$)");
+        return ValidationMatchers::match_base64_image(value);
     }
 
     bool Validators::is_data_uri(const std::string_view& value)
     {
-        return match_std_regex(value, R"(^data:[a-zA-Z0-9!#$&^_.+-]+\/[a-zA-Z0-9!#$&^_.+-]+;base64,([A-Za-z0-9+/]{4})*([A-Za-z0-9+/]{2}==|[A-Za-z0-9+/]{3}=)?$)");
+        return ValidationMatchers::match_data_uri(value);
     }
 
     bool Validators::is_phone_number(const std::string_view& value)
@@ -718,22 +722,22 @@ namespace QLogicaeCore
 
     bool Validators::is_e164_phone_number(const std::string_view& value)
     {
-        return match_std_regex(value, R"(^\+\d{1,15}$)");
+        return ValidationMatchers::match_e164_phone_number(value);
     }
 
     bool Validators::is_country_calling_code(const std::string_view& value)
     {
-        return match_std_regex(value, R"(^\+\d{1,3}$)");
+        return ValidationMatchers::match_country_calling_code(value);
     }
 
     bool Validators::is_full_name(const std::string_view& value)
     {
-        return match_std_regex(value, R"(^[a-zA-Z]+([ '-][a-zA-Z]+)*$)");
+        return ValidationMatchers::match_full_name(value);
     }
 
     bool Validators::is_email(const std::string_view& value)
     {
-        return match_std_regex(value, R"(^[a-zA-Z0-9._%+-]+@[a-zA-Z0-9.-]+\.[a-zA-Z]{2,}$)");
+        return ValidationMatchers::match_email(value);
     }
 
     bool Validators::is_file_size_allowed(const std::size_t& value, const std::size_t& maximum_size)
@@ -861,6 +865,64 @@ namespace QLogicaeCore
             });
     }
 
+    boost::dynamic_bitset<> Validators::validate_many(
+        const std::span<const std::string_view> values,
+        const ValidationPredicate& predicate
+    )
+    {
+        const validation_kernel_t kernel =
+            ValidationKernels::get_kernel(predicate);
+        if (kernel == nullptr)
+        {
+            return boost::dynamic_bitset<>(values.size());
+        }
+
+        return validate_many(values, kernel);
+    }
+
+    boost::dynamic_bitset<> Validators::validate_many(
+        const std::span<const std::string_view> values,
+        const std::function<bool(const std::string_view&)>& predicate
+    )
+    {
+        boost::dynamic_bitset<> flags(values.size());
+        const std::size_t chunk_size = UTILITIES.VALIDATION_PARALLEL_CHUNK_SIZE;
+        const std::size_t chunk_count =
+            (values.size() + chunk_size - 1) / chunk_size;
+
+        auto validate_chunk =
+            [&values, &flags, &predicate, chunk_size](
+                const std::size_t chunk_index
+            )
+            {
+                const std::size_t begin = chunk_index * chunk_size;
+                const std::size_t end =
+                    std::min(begin + chunk_size, values.size());
+                for (std::size_t index = begin; index < end; ++index)
+                {
+                    if (predicate(values[index]))
+                    {
+                        flags.set(index);
+                    }
+                }
+            };
+
+        if (values.size() < UTILITIES.VALIDATION_PARALLEL_MINIMUM_COUNT)
+        {
+            for (std::size_t chunk_index = 0; chunk_index < chunk_count;
+                ++chunk_index)
+            {
+                validate_chunk(chunk_index);
+            }
+
+            return flags;
+        }
+
+        ThreadPool::get_instance().parallel_for(chunk_count, validate_chunk);
+
+        return flags;
+    }
+
     void Validators::is_not_empty(
         Result<bool>& result,
         const std::string_view& value
@@ -882,18 +944,7 @@ namespace QLogicaeCore
         const std::string_view& value
     )
     {
-        if (value.empty())
-        {
-            result.set_to_good_status_with_value(false);
-            return;
-        }
-
-        bool ok = std::ranges::all_of(value, [](char character)
-            {
-                return std::islower(static_cast<unsigned char>(character));
-            });
-
-        result.set_to_good_status_with_value(ok);
+        result.set_to_good_status_with_value(is_lowercase(value));
     }
 
     void Validators::is_uppercase(
@@ -901,18 +952,7 @@ namespace QLogicaeCore
         const std::string_view& value
     )
     {
-        if (value.empty())
-        {
-            result.set_to_good_status_with_value(false);
-            return;
-        }
-
-        bool ok = std::ranges::all_of(value, [](char character)
-            {
-                return std::isupper(static_cast<unsigned char>(character));
-            });
-
-        result.set_to_good_status_with_value(ok);
+        result.set_to_good_status_with_value(is_uppercase(value));
     }
 
     void Validators::is_first_letter_uppercase(
@@ -982,8 +1022,7 @@ namespace QLogicaeCore
         const std::string_view& value
     )
     {
-        result.set_to_good_status_with_value(match_std_regex(value,
-            R"(^([A-Za-z0-9+/]{4})*([A-Za-z0-9+/]{2}==|[A-Za-z0-9+/]{3}=)?$)"));
+        result.set_to_good_status_with_value(is_base64(value));
     }
 
     void Validators::is_utf8(
@@ -991,8 +1030,7 @@ namespace QLogicaeCore
         const std::string_view& value
     )
     {
-        result.set_to_good_status_with_value(std::string(value).find('\xC0') ==
-            std::string::npos);
+        result.set_to_good_status_with_value(is_utf8(value));
     }
 
     void Validators::is_utf16(
@@ -1000,16 +1038,7 @@ namespace QLogicaeCore
         const std::string_view& value
     )
     {
-        if (value.size() < 2)
-        {
-            result.set_to_good_status_with_value(false);
-            return;
-        }
-
-        unsigned char byte1 = static_cast<unsigned char>(value[0]);
-        unsigned char byte2 = static_cast<unsigned char>(value[1]);
-        result.set_to_good_status_with_value((byte1 == 0xFF && byte2 == 0xFE) ||
-            (byte1 == 0xFE && byte2 == 0xFF));
+        result.set_to_good_status_with_value(is_utf16(value));
     }
 
     void Validators::is_slug(
@@ -1017,8 +1046,7 @@ namespace QLogicaeCore
         const std::string_view& value
     )
     {
-        result.set_to_good_status_with_value(match_std_regex(value,
-            R"(^[a-z0-9]+(?:-[a-z0-9]+)*$)"));
+        result.set_to_good_status_with_value(is_slug(value));
     }
 
     void Validators::is_hex(
@@ -1026,8 +1054,7 @@ namespace QLogicaeCore
         const std::string_view& value
     )
     {
-        result.set_to_good_status_with_value(match_std_regex(value,
-            R"(^(0x)?[0-9a-fA-F]+$)"));
+        result.set_to_good_status_with_value(is_hex(value));
     }
 
     void Validators::is_uuid4(
@@ -1035,8 +1062,7 @@ namespace QLogicaeCore
         const std::string_view& value
     )
     {
-        result.set_to_good_status_with_value(match_std_regex(value,
-            R"(^[a-fA-F0-9]{8}-[a-fA-F0-9]{4}-4[a-fA-F0-9]{3}-[89abAB][a-fA-F0-9]{3}-[a-fA-F0-9]{12}$)"));
+        result.set_to_good_status_with_value(is_uuid4(value));
     }
 
     void Validators::is_uuid6(
@@ -1044,8 +1070,7 @@ namespace QLogicaeCore
         const std::string_view& value
     )
     {
-        result.set_to_good_status_with_value(match_std_regex(value,
-            R"(^[a-fA-F0-9]{8}-[a-fA-F0-9]{4}-6[a-fA-F0-9]{3}-[89abAB][a-fA-F0-9]{3}-[a-fA-F0-9]{12}$)"));
+        result.set_to_good_status_with_value(is_uuid6(value));
     }
 
     void Validators::is_ipv4(
@@ -1053,8 +1078,7 @@ namespace QLogicaeCore
         const std::string_view& value
     )
     {
-        result.set_to_good_status_with_value(match_std_regex(value,
-            R"(^((25[0-5]|2[0-4]\d|1\d{2}|[1-9]?\d)\.){3}(25[0-5]|2[0-4]\d|1\d{2}|[1-9]?\d)$)"));
+        result.set_to_good_status_with_value(is_ipv4(value));
     }
 
     void Validators::is_ipv6(
@@ -1062,8 +1086,7 @@ namespace QLogicaeCore
         const std::string_view& value
     )
     {
-        result.set_to_good_status_with_value(match_std_regex(value,
-            R"(^([0-9a-fA-F]{1,4}:){7}[0-9a-fA-F]{1,4}$)"));
+        result.set_to_good_status_with_value(is_ipv6(value));
     }
 
     void Validators::is_url(
@@ -1071,8 +1094,7 @@ namespace QLogicaeCore
         const std::string_view& value
     )
     {
-        result.set_to_good_status_with_value(match_std_regex(value,
-            R"(^https?:\/\/(?:www\.)?[a-zA-Z0-9.-]+(?:\:\d+)?(?:\/\S*)?$)"));
+        result.set_to_good_status_with_value(is_url(value));
     }
 
     void Validators::is_uri(
@@ -1080,8 +1102,7 @@ namespace QLogicaeCore
         const std::string_view& value
     )
     {
-        result.set_to_good_status_with_value(match_std_regex(value,
-            R"(^[a-zA-Z][a-zA-Z0-9+.-]*:\/\/[^\s\/?#]+(?:[\/?#][^\s]*)?$)"));
+        result.set_to_good_status_with_value(is_uri(value));
     }
 
     void Validators::is_mac_address(
@@ -1089,8 +1110,7 @@ namespace QLogicaeCore
         const std::string_view& value
     )
     {
-        result.set_to_good_status_with_value(match_std_regex(value,
-            R"(^([0-9A-Fa-f]{2}[:-]){5}([0-9A-Fa-f]{2})$)"));
+        result.set_to_good_status_with_value(is_mac_address(value));
     }
 
     void Validators::is_hostname(
@@ -1098,8 +1118,7 @@ namespace QLogicaeCore
         const std::string_view& value
     )
     {
-        result.set_to_good_status_with_value(match_std_regex(value,
-            R"(^(([a-zA-Z0-9]|[a-zA-Z0-9][a-zA-Z0-9\-]*[a-zA-Z0-9])\.)*([A-Za-z0-9]|[A-Za-z0-9][A-Za-z0-9\-]*[A-Za-z0-9])$)"));
+        result.set_to_good_status_with_value(is_hostname(value));
     }
 
     void Validators::is_domain(
@@ -1107,8 +1126,7 @@ namespace QLogicaeCore
         const std::string_view& value
     )
     {
-        result.set_to_good_status_with_value(match_std_regex(value,
-            R"(^([a-zA-Z0-9]+(-[a-zA-Z0-9]+)*\.)+[a-zA-Z]{2,}$)"));
+        result.set_to_good_status_with_value(is_domain(value));
     }
 
     void Validators::is_port_in_range(
@@ -1143,18 +1161,7 @@ namespace QLogicaeCore
         const std::string_view& value
     )
     {
-        if (value.empty())
-        {
-            result.set_to_good_status_with_value(false);
-            return;
-        }
-
-        bool ok = std::ranges::all_of(value, [](char character)
-            {
-                return std::isalnum(static_cast<unsigned char>(character));
-            });
-
-        result.set_to_good_status_with_value(ok);
+        result.set_to_good_status_with_value(is_alpanumeric(value));
     }
 
     void Validators::is_decimal(
@@ -1162,33 +1169,7 @@ namespace QLogicaeCore
         const std::string_view& value
     )
     {
-        if (value.empty())
-        {
-            result.set_to_good_status_with_value(false);
-            return;
-        }
-
-        bool has_decimal = false;
-        for (char character : value)
-        {
-            if (character == '.')
-            {
-                if (has_decimal)
-                {
-                    result.set_to_good_status_with_value(false);
-                    return;
-                }
-                has_decimal = true;
-                continue;
-            }
-            if (!std::isdigit(static_cast<unsigned char>(character)))
-            {
-                result.set_to_good_status_with_value(false);
-                return;
-            }
-        }
-
-        result.set_to_good_status_with_value(true);
+        result.set_to_good_status_with_value(is_decimal(value));
     }
 
     void Validators::is_time(
@@ -1713,56 +1694,49 @@ namespace QLogicaeCore
         Result<bool>& result,
         const std::string_view& value)
     {
-        result.set_to_good_status_with_value(match_std_regex(value,
-            R"(^\d{4}-\d{2}-\d{2}T\d{2}:\d{2}:\d{2}(Z|[+-]\d{2}:\d{2})?$)"));
+        result.set_to_good_status_with_value(is_iso8601(value));
     }
 
     void Validators::is_hex_color(
         Result<bool>& result,
         const std::string_view& value)
     {
-        result.set_to_good_status_with_value(match_std_regex(value,
-            R"(^#(?:[0-9a-fA-F]{3}){1,2}$)"));
+        result.set_to_good_status_with_value(is_hex_color(value));
     }
 
     void Validators::is_rgb_color(
         Result<bool>& result,
         const std::string_view& value)
     {
-        result.set_to_good_status_with_value(match_std_regex(value,
-            R"(^rgb\((\s*\d{1,3}\s*,){2}\s*\d{1,3}\s*\)$)"));
+        result.set_to_good_status_with_value(is_rgb_color(value));
     }
 
     void Validators::is_rgba_color(
         Result<bool>& result,
         const std::string_view& value)
     {
-        result.set_to_good_status_with_value(match_std_regex(value,
-            R"(^rgba\((\s*\d{1,3}\s*,){3}\s*(0|1|0?\.\d+)\s*\)$)"));
+        result.set_to_good_status_with_value(is_rgba_color(value));
     }
 
     void Validators::is_file_path(
         Result<bool>& result,
         const std::string_view& value)
     {
-        result.set_to_good_status_with_value(match_std_regex(value,
-            R"(^(([a-zA-Z]:\\|\/)?([\w\-. ]+([\/\\][\w\-. ]+)*))$)"));
+        result.set_to_good_status_with_value(is_file_path(value));
     }
 
     void Validators::is_file_name(
         Result<bool>& result,
         const std::string_view& value)
     {
-        result.set_to_good_status_with_value(match_std_regex(value,
-            R"(^[\w,\s-]+\.[A-Za-z]{1,6}$)"));
+        result.set_to_good_status_with_value(is_file_name(value));
     }
 
     void Validators::is_file_extension(
         Result<bool>& result,
         const std::string_view& value)
     {
-        result.set_to_good_status_with_value(match_std_regex(value,
-            R"(^[a-zA-Z0-9]+$)"));
+        result.set_to_good_status_with_value(is_file_extension(value));
     }
 
     void Validators::is_file_extension_allowed(
@@ -1777,54 +1751,49 @@ namespace QLogicaeCore
         Result<bool>& result,
         const std::string_view& value)
     {
-        result.set_to_good_status_with_value(match_std_regex(value,
-            R"(^(application|audio|font|example|image|message|model|multipart|text|video|x-[a-z0-9]+)\/[a-zA-Z0-9!#$&^_.+-]+$)"));
+        result.set_to_good_status_with_value(is_mime_type(value));
     }
 
     void Validators::is_base64_image(
         Result<bool>& result,
         const std::string_view& value)
     {
-        result.set_to_good_status_with_value(match_std_regex(value,
-            R"(^data:image\/(png|jpeg|jpg|gif);base64,([A-Za-z0-9+/]{4})*([A-Za-z0-9+/]{2}==|[A-Za-z0-9+/]{3}=)?$)"));
+        result.set_to_good_status_with_value(is_base64_image(value));
     }
 
     void Validators::is_data_uri(
         Result<bool>& result,
         const std::string_view& value)
     {
-        result.set_to_good_status_with_value(match_std_regex(value,
-            R"(^data:[a-zA-Z0-9!#$&^_.+-]+\/[a-zA-Z0-9!#$&^_.+-]+;base64,([A-Za-z0-9+/]{4})*([A-Za-z0-9+/]{2}==|[A-Za-z0-9+/]{3}=)?$)"));
+        result.set_to_good_status_with_value(is_data_uri(value));
     }
 
     void Validators::is_phone_number(
         Result<bool>& result,
         const std::string_view& value)
     {
-        result.set_to_good_status_with_value(match_std_regex(value,
-            R"(^\+?(\d{1,3})?\s?(\(\d{3}\)|\d{3})[-.\s]?\d{3}[-.\s]?\d{4}$)"));
+        result.set_to_good_status_with_value(is_phone_number(value));
     }
 
     void Validators::is_e164_phone_number(
         Result<bool>& result,
         const std::string_view& value)
     {
-        result.set_to_good_status_with_value(match_std_regex(value, R"(^\+\d{1,15}$)"));
+        result.set_to_good_status_with_value(is_e164_phone_number(value));
     }
 
     void Validators::is_country_calling_code(
         Result<bool>& result,
         const std::string_view& value)
     {
-        result.set_to_good_status_with_value(match_std_regex(value, R"(^\+\d{1,3}$)"));
+        result.set_to_good_status_with_value(is_country_calling_code(value));
     }
 
     void Validators::is_full_name(
         Result<bool>& result,
         const std::string_view& value)
     {
-        result.set_to_good_status_with_value(match_std_regex(value,
-            R"(^[a-zA-Z]+([ '-][a-zA-Z]+)*$)"));
+        result.set_to_good_status_with_value(is_full_name(value));
     }
 
     void Validators::is_email(
@@ -1832,8 +1801,7 @@ namespace QLogicaeCore
         const std::string_view& value
     )
     {
-        result.set_to_good_status_with_value(match_std_regex(value,
-            R"(^[a-zA-Z0-9._%+-]+@[a-zA-Z0-9.-]+\.[a-zA-Z]{2,}$)"));
+        result.set_to_good_status_with_value(is_email(value));
     }
 
     void Validators::is_file_size_allowed(
@@ -2041,6 +2009,40 @@ namespace QLogicaeCore
         result.set_to_good_status_with_value(found);
     }
 
+    void Validators::validate_many(
+        Result<boost::dynamic_bitset<>>& result,
+        const std::span<const std::string_view> values,
+        const ValidationPredicate& predicate
+    )
+    {
+        try
+        {
+            result.set_to_good_status_with_value(
+                validate_many(values, predicate));
+        }
+        catch (const std::exception& exception)
+        {
+            result.set_to_bad_status_without_value(exception.what());
+        }
+    }
+
+    void Validators::validate_many(
+        Result<boost::dynamic_bitset<>>& result,
+        const std::span<const std::string_view> values,
+        const std::function<bool(const std::string_view&)>& predicate
+    )
+    {
+        try
+        {
+            result.set_to_good_status_with_value(
+                validate_many(values, predicate));
+        }
+        catch (const std::exception& exception)
+        {
+            result.set_to_bad_status_without_value(exception.what());
+        }
+    }
+
     Validators& Validators::get_instance()
     {
         static Validators instance;
@@ -4,6 +4,19 @@
 
 namespace QLogicaeCore
 {
+    static std::span<unsigned char> get_xchacha20_poly1305_cipher_buffer(
+        const std::size_t size
+    )
+    {
+        static thread_local std::vector<unsigned char> buffer;
+        if (buffer.size() < size)
+        {
+            buffer.resize(size);
+        }
+
+        return std::span<unsigned char>(buffer.data(), size);
+    }
+
 	XChaCha20Poly1305CipherCryptographer::XChaCha20Poly1305CipherCryptographer() :
         Cryptographer()
 	{
@@ -198,29 +211,11 @@ namespace QLogicaeCore
     {
         try
         {
-            std::scoped_lock lock(_mutex);
+            Result<std::string> result;
 
-            if (!vb || !vc)
-            {
-                return "";
-            }
-
-            unsigned long long ve = 0, vg = va.size();
-            std::vector<unsigned char> vd(
-                vg + crypto_aead_xchacha20poly1305_ietf_ABYTES
-            );
-            unsigned char* vf = vd.data();
+            transform(result, va, vb, vc);
 
-            if (crypto_aead_xchacha20poly1305_ietf_encrypt(
-                vf, &ve,
-                reinterpret_cast<const unsigned char*>(va.data()), vg,
-                nullptr, 0, nullptr, vc, vb) != 0)
-            {
-                return "";
-            }
-
-            return ENCODER
-                .from_bytes_to_base64(vf, ve);
+            return result.get_value();
         }
         catch (const std::exception& exception)
         {
@@ -244,34 +239,11 @@ namespace QLogicaeCore
     {
         try
         {
-            std::scoped_lock lock(_mutex);
-
-            if (!vb || !vc ||
-                va.size() < crypto_aead_xchacha20poly1305_ietf_ABYTES)
-            {
-                return "";
-            }
-
-            unsigned long long ve = 0;
-            std::vector<unsigned char> vd =
-                ENCODER.from_base64_to_bytes(va);
-            size_t vf = vd.size();
-            std::vector<unsigned char> decrypted(
-                vf - crypto_aead_xchacha20poly1305_ietf_ABYTES
-            );
+            Result<std::string> result;
 
-            if (crypto_aead_xchacha20poly1305_ietf_decrypt(
-                decrypted.data(), &ve,
-                nullptr,
-                vd.data(), vf,
-                nullptr, 0, vc, vb) != 0)
-            {
-                return "";
-            }
+            reverse(result, va, vb, vc);
 
-            return std::string(
-                reinterpret_cast<char*>(decrypted.data()), ve
-            );
+            return result.get_value();
         }
         catch (const std::exception& exception)
         {
@@ -348,39 +320,38 @@ namespace QLogicaeCore
         const unsigned char* nonce
     )
     {
-        std::scoped_lock lock(_mutex);
-
-        if (!key || !nonce ||
-            cipher.size() < crypto_aead_xchacha20poly1305_ietf_ABYTES)
+        std::span<unsigned char> bytes = get_xchacha20_poly1305_cipher_buffer(
+            ENCODER.get_decoded_length(EncodingType::BASE64, cipher));
+        Result<std::size_t> decode_result;
+        ENCODER.decode_into(decode_result, EncodingType::BASE64, cipher, bytes);
+        if (!decode_result.is_status_safe())
         {
-            return result.set_to_bad_status_with_value(
-                "Key, or nonce is null or cipher size is less than 32"
+            return result.set_to_bad_status_without_value(
+                "Decryption failed"
             );
         }
 
-        unsigned long long ve = 0;
-        std::vector<unsigned char> vd =
-            ENCODER.from_base64_to_bytes(cipher);
-        size_t vf = vd.size();
-        std::vector<unsigned char> decrypted(
-            vf - crypto_aead_xchacha20poly1305_ietf_ABYTES
+        bytes = bytes.first(decode_result.get_value());
+        std::string text(get_text_size(bytes.size()), '\0');
+        Result<std::size_t> size_result;
+        reverse(
+            size_result,
+            bytes,
+            std::span<unsigned char>(
+                reinterpret_cast<unsigned char*>(text.data()),
+                text.size()
+            ),
+            key,
+            nonce
         );
-
-        if (crypto_aead_xchacha20poly1305_ietf_decrypt(
-            decrypted.data(), &ve,
-            nullptr,
-            vd.data(), vf,
-            nullptr, 0, nonce, key) != 0)
+        if (!size_result.is_status_safe())
         {
-            return result.set_to_bad_status_with_value(
-                "Decryption failed"
+            return result.set_to_bad_status_without_value(
+                size_result.get_message()
             );
         }
 
-        result.set_to_good_status_with_value(std::string(
-            reinterpret_cast<char*>(decrypted.data()), ve
-        ));
-        
+        result.set_to_good_status_with_value(std::move(text));
     }
 
     void XChaCha20Poly1305CipherCryptographer::transform(
@@ -390,30 +361,34 @@ namespace QLogicaeCore
         const unsigned char* nonce
     )
     {
-        std::scoped_lock lock(_mutex);
-
-        if (!key || !nonce)
+        std::span<unsigned char> bytes =
+            get_xchacha20_poly1305_cipher_buffer(get_cipher_size(text.size()));
+        Result<std::size_t> size_result;
+        transform(
+            size_result,
+            std::span<const unsigned char>(
+                reinterpret_cast<const unsigned char*>(text.data()),
+                text.size()
+            ),
+            bytes,
+            key,
+            nonce
+        );
+        if (!size_result.is_status_safe())
         {
-            return result.set_to_bad_status_with_value(
-                "Key or nonce is null"
+            return result.set_to_bad_status_without_value(
+                size_result.get_message()
             );
         }
 
-        unsigned long long ve = 0, vg = text.size();
-        std::vector<unsigned char> vd(
-            vg + crypto_aead_xchacha20poly1305_ietf_ABYTES
+        std::string cipher(
+            ENCODER.get_encoded_length(EncodingType::BASE64, bytes.size()),
+            '\0'
         );
-        unsigned char* vf = vd.data();
-
-        if (crypto_aead_xchacha20poly1305_ietf_encrypt(
-            vf, &ve,
-            reinterpret_cast<const unsigned char*>(text.data()), vg,
-            nullptr, 0, nullptr, nonce, key) != 0)
-        {
-            result.set_to_bad_status_with_value("");
-        }
+        Result<std::size_t> encode_result;
+        ENCODER.encode_into(encode_result, EncodingType::BASE64, bytes, cipher);
 
-        ENCODER.from_bytes_to_base64(result, vf, ve);        
+        result.set_to_good_status_with_value(std::move(cipher));
     }
 
     void XChaCha20Poly1305CipherCryptographer::reverse(
@@ -423,10 +398,10 @@ namespace QLogicaeCore
         const std::string_view& nonce
     )
     {
-        result.set_to_good_status_with_value(reverse(cipher,
+        reverse(result, cipher,
             reinterpret_cast<const unsigned char*>(key.data()),
             reinterpret_cast<const unsigned char*>(nonce.data())
-        ));
+        );
     }
 
     void XChaCha20Poly1305CipherCryptographer::transform(
@@ -436,10 +411,10 @@ namespace QLogicaeCore
         const std::string_view& nonce
     )
     {
-        result.set_to_good_status_with_value(transform(text,
+        transform(result, text,
             reinterpret_cast<const unsigned char*>(key.data()),
             reinterpret_cast<const unsigned char*>(nonce.data())
-        ));
+        );
     }
 
     void XChaCha20Poly1305CipherCryptographer::reverse_async(
@@ -778,6 +753,461 @@ namespace QLogicaeCore
         );
     }
 
+    std::size_t XChaCha20Poly1305CipherCryptographer::get_cipher_size(
+        const std::size_t& text_size
+    )
+    {
+        return text_size + crypto_aead_xchacha20poly1305_ietf_ABYTES;
+    }
+
+    std::size_t XChaCha20Poly1305CipherCryptographer::get_text_size(
+        const std::size_t& cipher_size
+    )
+    {
+        return (cipher_size < crypto_aead_xchacha20poly1305_ietf_ABYTES) ?
+            0 : cipher_size - crypto_aead_xchacha20poly1305_ietf_ABYTES;
+    }
+
+    void XChaCha20Poly1305CipherCryptographer::reverse(
+        Result<std::size_t>& result,
+        std::span<const unsigned char> cipher,
+        std::span<unsigned char> text,
+        const unsigned char* key,
+        const unsigned char* nonce
+    )
+    {
+        if (!key || !nonce)
+        {
+            return result.set_to_bad_status_without_value(
+                "Key or nonce is null"
+            );
+        }
+
+        if (cipher.size() < crypto_aead_xchacha20poly1305_ietf_ABYTES ||
+            text.size() < get_text_size(cipher.size()))
+        {
+            return result.set_to_bad_status_without_value(
+                "Cipher is too short or the output is too small"
+            );
+        }
+
+        unsigned long long text_size = 0;
+        if (crypto_aead_xchacha20poly1305_ietf_decrypt(
+            text.data(), &text_size, nullptr,
+            cipher.data(), cipher.size(),
+            nullptr, 0, nonce, key) != 0)
+        {
+            return result.set_to_bad_status_without_value(
+                "Decryption failed"
+            );
+        }
+
+        result.set_to_good_status_with_value(
+            static_cast<std::size_t>(text_size)
+        );
+    }
+
+    void XChaCha20Poly1305CipherCryptographer::transform(
+        Result<std::size_t>& result,
+        std::span<const unsigned char> text,
+        std::span<unsigned char> cipher,
+        const unsigned char* key,
+        const unsigned char* nonce
+    )
+    {
+        if (!key || !nonce)
+        {
+            return result.set_to_bad_status_without_value(
+                "Key or nonce is null"
+            );
+        }
+
+        if (cipher.size() < get_cipher_size(text.size()))
+        {
+            return result.set_to_bad_status_without_value(
+                "Output is too small"
+            );
+        }
+
+        unsigned long long cipher_size = 0;
+        if (crypto_aead_xchacha20poly1305_ietf_encrypt(
+            cipher.data(), &cipher_size,
+            text.data(), text.size(),
+            nullptr, 0, nullptr, nonce, key) != 0)
+        {
+            return result.set_to_bad_status_without_value(
+                "Encryption failed"
+            );
+        }
+
+        result.set_to_good_status_with_value(
+            static_cast<std::size_t>(cipher_size)
+        );
+    }
+
+    CipherBatch XChaCha20Poly1305CipherCryptographer::reverse_batch(
+        std::span<const std::string_view> ciphers,
+        const unsigned char* key,
+        std::span<const unsigned char> nonces
+    )
+    {
+        try
+        {
+            Result<CipherBatch> result;
+
+            reverse_batch(result, ciphers, key, nonces);
+
+            return std::move(result.get_value());
+        }
+        catch (const std::exception& exception)
+        {
+            LOGGER.handle_exception_async(
+                "QLogicaeCore::XChaCha20Poly1305CipherCryptographer::reverse_batch()",
+                exception.what()
+            );
+
+            return {};
+        }
+    }
+
+    CipherBatch XChaCha20Poly1305CipherCryptographer::transform_batch(
+        std::span<const std::string_view> texts,
+        const unsigned char* key,
+        std::span<const unsigned char> nonces
+    )
+    {
+        try
+        {
+            Result<CipherBatch> result;
+
+            transform_batch(result, texts, key, nonces);
+
+            return std::move(result.get_value());
+        }
+        catch (const std::exception& exception)
+        {
+            LOGGER.handle_exception_async(
+                "QLogicaeCore::XChaCha20Poly1305CipherCryptographer::transform_batch()",
+                exception.what()
+            );
+
+            return {};
+        }
+    }
+
+    void XChaCha20Poly1305CipherCryptographer::reverse_batch(
+        Result<CipherBatch>& result,
+        std::span<const std::string_view> ciphers,
+        const unsigned char* key,
+        std::span<const unsigned char> nonces
+    )
+    {
+        if (!key ||
+            nonces.size() !=
+                ciphers.size() * crypto_aead_xchacha20poly1305_ietf_NPUBBYTES)
+        {
+            return result.set_to_bad_status_without_value(
+                "Key is null or the nonce count does not match the batch"
+            );
+        }
+
+        CipherBatchRunner::run(
+            result,
+            ciphers.size(),
+            [this, ciphers](const std::size_t& index)
+            {
+                return get_text_size(
+                    ENCODER.get_decoded_length(
+                        EncodingType::BASE64, ciphers[index]
+                    )
+                );
+            },
+            [this, ciphers, key, nonces](
+                const std::size_t& index,
+                std::span<char> output
+            ) -> std::optional<std::size_t>
+            {
+                std::span<unsigned char> bytes =
+                    get_xchacha20_poly1305_cipher_buffer(
+                        ENCODER.get_decoded_length(
+                            EncodingType::BASE64, ciphers[index]
+                        )
+                    );
+                Result<std::size_t> decode_result;
+                ENCODER.decode_into(
+                    decode_result, EncodingType::BASE64, ciphers[index], bytes
+                );
+                if (!decode_result.is_status_safe())
+                {
+                    return std::nullopt;
+                }
+
+                Result<std::size_t> size_result;
+                reverse(
+                    size_result,
+                    bytes.first(decode_result.get_value()),
+                    std::span<unsigned char>(
+                        reinterpret_cast<unsigned char*>(output.data()),
+                        output.size()
+                    ),
+                    key,
+                    nonces.data() +
+                        index * crypto_aead_xchacha20poly1305_ietf_NPUBBYTES
+                );
+                if (!size_result.is_status_safe())
+                {
+                    return std::nullopt;
+                }
+
+                return size_result.get_value();
+            }
+        );
+    }
+
+    void XChaCha20Poly1305CipherCryptographer::transform_batch(
+        Result<CipherBatch>& result,
+        std::span<const std::string_view> texts,
+        const unsigned char* key,
+        std::span<const unsigned char> nonces
+    )
+    {
+        if (!key ||
+            nonces.size() !=
+                texts.size() * crypto_aead_xchacha20poly1305_ietf_NPUBBYTES)
+        {
+            return result.set_to_bad_status_without_value(
+                "Key is null or the nonce count does not match the batch"
+            );
+        }
+
+        CipherBatchRunner::run(
+            result,
+            texts.size(),
+            [this, texts](const std::size_t& index)
+            {
+                return ENCODER.get_encoded_length(
+                    EncodingType::BASE64, get_cipher_size(texts[index].size())
+                );
+            },
+            [this, texts, key, nonces](
+                const std::size_t& index,
+                std::span<char> output
+            ) -> std::optional<std::size_t>
+            {
+                std::span<unsigned char> bytes =
+                    get_xchacha20_poly1305_cipher_buffer(
+                        get_cipher_size(texts[index].size())
+                    );
+                Result<std::size_t> size_result;
+                transform(
+                    size_result,
+                    std::span<const unsigned char>(
+                        reinterpret_cast<const unsigned char*>(
+                            texts[index].data()
+                        ),
+                        texts[index].size()
+                    ),
+                    bytes,
+                    key,
+                    nonces.data() +
+                        index * crypto_aead_xchacha20poly1305_ietf_NPUBBYTES
+                );
+                if (!size_result.is_status_safe())
+                {
+                    return std::nullopt;
+                }
+
+                Result<std::size_t> encode_result;
+                ENCODER.encode_into(
+                    encode_result, EncodingType::BASE64, bytes, output
+                );
+                if (!encode_result.is_status_safe())
+                {
+                    return std::nullopt;
+                }
+
+                return encode_result.get_value();
+            }
+        );
+    }
+
+    bool XChaCha20Poly1305CipherCryptographer::reverse_file(
+        const std::string& input_path,
+        const std::string& output_path,
+        const unsigned char* key
+    )
+    {
+        try
+        {
+            Result<std::uint64_t> result;
+
+            reverse_file(result, input_path, output_path, key);
+
+            return result.is_status_safe();
+        }
+        catch (const std::exception& exception)
+        {
+            LOGGER.handle_exception_async(
+                "QLogicaeCore::XChaCha20Poly1305CipherCryptographer::reverse_file()",
+                exception.what()
+            );
+
+            return false;
+        }
+    }
+
+    bool XChaCha20Poly1305CipherCryptographer::transform_file(
+        const std::string& input_path,
+        const std::string& output_path,
+        const unsigned char* key
+    )
+    {
+        try
+        {
+            Result<std::uint64_t> result;
+
+            transform_file(result, input_path, output_path, key);
+
+            return result.is_status_safe();
+        }
+        catch (const std::exception& exception)
+        {
+            LOGGER.handle_exception_async(
+                "QLogicaeCore::XChaCha20Poly1305CipherCryptographer::transform_file()",
+                exception.what()
+            );
+
+            return false;
+        }
+    }
+
+    void XChaCha20Poly1305CipherCryptographer::reverse_file(
+        Result<std::uint64_t>& result,
+        const std::string& input_path,
+        const std::string& output_path,
+        const unsigned char* key
+    )
+    {
+        if (!key)
+        {
+            return result.set_to_bad_status_without_value(
+                "Key is null"
+            );
+        }
+
+        std::array<unsigned char,
+            crypto_secretstream_xchacha20poly1305_HEADERBYTES> header;
+        Result<void> header_result;
+        CipherFileStream::read_header(header_result, input_path, header);
+        if (!header_result.is_status_safe())
+        {
+            return result.set_to_bad_status_without_value(
+                header_result.get_message()
+            );
+        }
+
+        crypto_secretstream_xchacha20poly1305_state state;
+        if (crypto_secretstream_xchacha20poly1305_init_pull(
+            &state, header.data(), key) != 0)
+        {
+            return result.set_to_bad_status_without_value(
+                "Header is invalid"
+            );
+        }
+
+        CipherFileStream::run(
+            result,
+            input_path,
+            output_path,
+            header.size(),
+            UTILITIES.CIPHER_STREAM_CHUNK_SIZE +
+                crypto_secretstream_xchacha20poly1305_ABYTES,
+            {},
+            [&state](CipherStreamChunk& chunk)
+            {
+                if (chunk.data.size() <
+                    crypto_secretstream_xchacha20poly1305_ABYTES)
+                {
+                    return false;
+                }
+
+                unsigned long long text_size = 0;
+                unsigned char tag = 0;
+                std::vector<unsigned char> text(chunk.data.size() -
+                    crypto_secretstream_xchacha20poly1305_ABYTES);
+                if (crypto_secretstream_xchacha20poly1305_pull(
+                    &state, text.data(), &text_size, &tag,
+                    chunk.data.data(), chunk.data.size(),
+                    nullptr, 0) != 0 ||
+                    chunk.is_final !=
+                        (tag == crypto_secretstream_xchacha20poly1305_TAG_FINAL))
+                {
+                    return false;
+                }
+
+                text.resize(static_cast<std::size_t>(text_size));
+                chunk.data = std::move(text);
+
+                return true;
+            }
+        );
+
+        sodium_memzero(&state, sizeof(state));
+    }
+
+    void XChaCha20Poly1305CipherCryptographer::transform_file(
+        Result<std::uint64_t>& result,
+        const std::string& input_path,
+        const std::string& output_path,
+        const unsigned char* key
+    )
+    {
+        if (!key)
+        {
+            return result.set_to_bad_status_without_value(
+                "Key is null"
+            );
+        }
+
+        std::array<unsigned char,
+            crypto_secretstream_xchacha20poly1305_HEADERBYTES> header;
+        crypto_secretstream_xchacha20poly1305_state state;
+        crypto_secretstream_xchacha20poly1305_init_push(
+            &state, header.data(), key);
+
+        CipherFileStream::run(
+            result,
+            input_path,
+            output_path,
+            0,
+            UTILITIES.CIPHER_STREAM_CHUNK_SIZE,
+            header,
+            [&state](CipherStreamChunk& chunk)
+            {
+                unsigned long long cipher_size = 0;
+                std::vector<unsigned char> cipher(chunk.data.size() +
+                    crypto_secretstream_xchacha20poly1305_ABYTES);
+                if (crypto_secretstream_xchacha20poly1305_push(
+                    &state, cipher.data(), &cipher_size,
+                    chunk.data.data(), chunk.data.size(),
+                    nullptr, 0,
+                    chunk.is_final ?
+                        crypto_secretstream_xchacha20poly1305_TAG_FINAL :
+                        crypto_secretstream_xchacha20poly1305_TAG_MESSAGE) != 0)
+                {
+                    return false;
+                }
+
+                cipher.resize(static_cast<std::size_t>(cipher_size));
+                chunk.data = std::move(cipher);
+
+                return true;
+            }
+        );
+
+        sodium_memzero(&state, sizeof(state));
+    }
+
     XChaCha20Poly1305CipherCryptographer& XChaCha20Poly1305CipherCryptographer::get_instance()
     {
         static XChaCha20Poly1305CipherCryptographer instance;
@@ -0,0 +1,68 @@
+#include "pch.hpp"
+
+#include "../includes/xoshiro256_plus_plus.hpp"
+
+namespace QLogicaeCore
+{
+    Xoshiro256PlusPlus::Xoshiro256PlusPlus()
+    {
+        seed(0);
+    }
+
+    Xoshiro256PlusPlus::Xoshiro256PlusPlus(
+        const std::uint64_t value
+    )
+    {
+        seed(value);
+    }
+
+    void Xoshiro256PlusPlus::seed(
+        const std::uint64_t value
+    )
+    {
+        std::uint64_t splitmix = value;
+        for (std::uint64_t& word : _state)
+        {
+            splitmix += 0x9e3779b97f4a7c15ULL;
+            std::uint64_t mixed = splitmix;
+            mixed = (mixed ^ (mixed >> 30)) * 0xbf58476d1ce4e5b9ULL;
+            mixed = (mixed ^ (mixed >> 27)) * 0x94d049bb133111ebULL;
+            word = mixed ^ (mixed >> 31);
+        }
+    }
+
+    Xoshiro256PlusPlus::result_type Xoshiro256PlusPlus::operator()()
+    {
+        const std::uint64_t result =
+            std::rotl(_state[0] + _state[3], 23) + _state[0];
+        const std::uint64_t shifted = _state[1] << 17;
+
+        _state[2] ^= _state[0];
+        _state[3] ^= _state[1];
+        _state[1] ^= _state[2];
+        _state[0] ^= _state[3];
+        _state[2] ^= shifted;
+        _state[3] = std::rotl(_state[3], 45);
+
+        return result;
+    }
+
+    void Xoshiro256PlusPlus::fill(
+        std::span<unsigned char> buffer
+    )
+    {
+        std::size_t index = 0;
+        for (; index + sizeof(result_type) <= buffer.size();
+            index += sizeof(result_type))
+        {
+            const result_type value = (*this)();
+            std::memcpy(buffer.data() + index, &value, sizeof(value));
+        }
+
+        if (index < buffer.size())
+        {
+            const result_type value = (*this)();
+            std::memcpy(buffer.data() + index, &value, buffer.size() - index);
+        }
+    }
+}
@@ -186,4 +186,196 @@ namespace QLogicaeCoreTest
                 reinterpret_cast<const unsigned char*>("X"), 1);
         EXPECT_EQ(crypto.reverse(too_short, key, nonce), "");
     }
+
+    TEST_F(AES256CipherCryptographerTest,
+        Should_Expect_RawRoundTrip_When_UsingSpansAndContext)
+    {
+        const std::string input = "field level payload";
+        QLogicaeCore::AES256CipherContext context(key);
+        if (!context.is_ready())
+        {
+            GTEST_SKIP();
+        }
+
+        std::vector<unsigned char> cipher(crypto.get_cipher_size(input.size()));
+        QLogicaeCore::Result<std::size_t> transform_result;
+        crypto.transform(
+            transform_result,
+            std::span<const unsigned char>(
+                reinterpret_cast<const unsigned char*>(input.data()),
+                input.size()),
+            cipher,
+            context,
+            nonce
+        );
+        ASSERT_TRUE(transform_result.is_status_safe());
+        EXPECT_EQ(transform_result.get_value(), cipher.size());
+
+        std::vector<unsigned char> text(crypto.get_text_size(cipher.size()));
+        QLogicaeCore::Result<std::size_t> reverse_result;
+        crypto.reverse(reverse_result, cipher, text, key, nonce);
+        ASSERT_TRUE(reverse_result.is_status_safe());
+        EXPECT_EQ(std::string(text.begin(), text.end()), input);
+
+        std::vector<unsigned char> small(cipher.size() - 1);
+        QLogicaeCore::Result<std::size_t> small_result;
+        crypto.transform(
+            small_result,
+            std::span<const unsigned char>(
+                reinterpret_cast<const unsigned char*>(input.data()),
+                input.size()),
+            small,
+            context,
+            nonce
+        );
+        EXPECT_FALSE(small_result.is_status_safe());
+    }
+
+    TEST_F(AES256CipherCryptographerTest,
+        Should_Expect_ConsistentResults_When_ContextSharedAcrossThreads)
+    {
+        QLogicaeCore::AES256CipherContext context(key);
+        if (!context.is_ready())
+        {
+            GTEST_SKIP();
+        }
+
+        const std::string input = "shared context";
+        QLogicaeCore::Result<std::string> expected;
+        crypto.transform(expected, input, context, nonce);
+        ASSERT_TRUE(expected.is_status_safe());
+
+        std::atomic<int> match_count = 0;
+        std::vector<std::thread> threads;
+        for (int index = 0; index < 8; ++index)
+        {
+            threads.emplace_back([&]()
+                {
+                    for (int iteration = 0; iteration < 100; ++iteration)
+                    {
+                        QLogicaeCore::Result<std::string> cipher;
+                        crypto.transform(cipher, input, context, nonce);
+                        QLogicaeCore::Result<std::string> text;
+                        crypto.reverse(text, cipher.get_value(), context, nonce);
+                        if (cipher.get_value() == expected.get_value() &&
+                            text.get_value() == input)
+                        {
+                            ++match_count;
+                        }
+                    }
+                });
+        }
+
+        for (std::thread& thread : threads)
+        {
+            thread.join();
+        }
+
+        EXPECT_EQ(match_count, 800);
+    }
+
+    TEST_F(AES256CipherCryptographerTest,
+        Should_Expect_FileRoundTrip_When_StreamingMultipleChunks)
+    {
+        QLogicaeCore::AES256CipherContext context(key);
+        if (!context.is_ready())
+        {
+            GTEST_SKIP();
+        }
+
+        const std::string plain_path = "test_aes256_stream_plain.bin";
+        const std::string cipher_path = "test_aes256_stream_cipher.bin";
+        const std::string output_path = "test_aes256_stream_output.bin";
+
+        std::string content(200'000, '\0');
+        for (std::size_t index = 0; index < content.size(); ++index)
+        {
+            content[index] = static_cast<char>(index * 13);
+        }
+
+        {
+            std::ofstream file(plain_path, std::ios::binary);
+            file.write(content.data(), content.size());
+        }
+
+        QLogicaeCore::Result<std::uint64_t> transform_result;
+        crypto.transform_file(transform_result, plain_path, cipher_path, context);
+        ASSERT_TRUE(transform_result.is_status_safe());
+
+        QLogicaeCore::Result<std::uint64_t> reverse_result;
+        crypto.reverse_file(reverse_result, cipher_path, output_path, context);
+        ASSERT_TRUE(reverse_result.is_status_safe());
+        EXPECT_EQ(reverse_result.get_value(), content.size());
+
+        std::ifstream file(output_path, std::ios::binary);
+        const std::string output(
+            (std::istreambuf_iterator<char>(file)),
+            std::istreambuf_iterator<char>());
+        file.close();
+        EXPECT_EQ(output, content);
+
+        std::filesystem::resize_file(cipher_path,
+            crypto_aead_aes256gcm_NPUBBYTES +
+                crypto.get_cipher_size(QLogicaeCore::UTILITIES.CIPHER_STREAM_CHUNK_SIZE));
+        QLogicaeCore::Result<std::uint64_t> truncated_result;
+        crypto.reverse_file(truncated_result, cipher_path, output_path, context);
+        EXPECT_FALSE(truncated_result.is_status_safe());
+
+        std::error_code error_code;
+        std::filesystem::remove(plain_path, error_code);
+        std::filesystem::remove(cipher_path, error_code);
+        std::filesystem::remove(output_path, error_code);
+    }
+
+    TEST_F(AES256CipherCryptographerTest,
+        Should_Expect_BatchRoundTrip_When_EncryptingManyFields)
+    {
+        std::vector<std::string> fields(5'000);
+        for (std::size_t index = 0; index < fields.size(); ++index)
+        {
+            fields[index] = "cell-" + std::to_string(index) +
+                std::string(index % 40, 'x');
+        }
+
+        std::vector<std::string_view> texts(fields.begin(), fields.end());
+        std::vector<unsigned char> nonces(
+            texts.size() * crypto_aead_aes256gcm_NPUBBYTES);
+        randombytes_buf(nonces.data(), nonces.size());
+
+        QLogicaeCore::CipherBatch ciphers =
+            crypto.transform_batch(texts, key, nonces);
+        ASSERT_EQ(ciphers.flags.count(), texts.size());
+
+        std::vector<std::string_view> cipher_views(texts.size());
+        for (std::size_t index = 0; index < texts.size(); ++index)
+        {
+            cipher_views[index] = ciphers.get_value(index);
+        }
+        EXPECT_EQ(
+            crypto.reverse(
+                std::string(cipher_views[42]), key, nonces.data() +
+                    42 * crypto_aead_aes256gcm_NPUBBYTES),
+            fields[42]);
+
+        std::string tampered(cipher_views[7]);
+        tampered[0] = tampered[0] == 'A' ? 'B' : 'A';
+        cipher_views[7] = tampered;
+
+        QLogicaeCore::CipherBatch texts_batch =
+            crypto.reverse_batch(cipher_views, key, nonces);
+        EXPECT_FALSE(texts_batch.flags.test(7));
+        for (std::size_t index = 0; index < texts.size(); ++index)
+        {
+            if (index != 7)
+            {
+                ASSERT_TRUE(texts_batch.flags.test(index));
+                EXPECT_EQ(texts_batch.get_value(index), fields[index]);
+            }
+        }
+
+        QLogicaeCore::Result<QLogicaeCore::CipherBatch> mismatched_result;
+        crypto.transform_batch(mismatched_result, texts, key,
+            std::span<const unsigned char>(nonces).first(nonces.size() - 1));
+        EXPECT_FALSE(mismatched_result.is_status_safe());
+    }
 }
@@ -0,0 +1,135 @@
+#include "pch.hpp"
+
+#include "qlogicae_core/includes/application_cache.hpp"
+
+namespace QLogicaeCoreTest
+{
+    class ApplicationCacheTestInstance :
+        public QLogicaeCore::ApplicationCache
+    {
+    public:
+        void attach(
+            QLogicaeCore::RocksDBDatabase& database,
+            const QLogicaeCore::TieredCacheWritePolicy write_policy
+        )
+        {
+            _configurations.tiered_cache_configurations.write_policy =
+                write_policy;
+            _configurations.tiered_cache_configurations
+                .write_back_interval_in_milliseconds = 0;
+            _tiered_cache = std::make_unique<QLogicaeCore::TieredCache>(
+                database,
+                _configurations.tiered_cache_configurations
+            );
+        }
+
+        void detach()
+        {
+            _tiered_cache.reset();
+        }
+
+        QLogicaeCore::TieredCache& get_tiered_cache()
+        {
+            return *_tiered_cache;
+        }
+    };
+
+    class ApplicationCacheTest : public ::testing::Test
+    {
+    protected:
+        std::string test_path = "application_cache_test";
+        std::unique_ptr<QLogicaeCore::RocksDBDatabase> database;
+        ApplicationCacheTestInstance cache;
+
+        void SetUp() override
+        {
+            std::error_code error_code;
+            std::filesystem::remove_all(test_path, error_code);
+
+            database = std::make_unique<QLogicaeCore::RocksDBDatabase>(test_path);
+        }
+
+        void TearDown() override
+        {
+            cache.detach();
+            database.reset();
+
+            std::error_code error_code;
+            std::filesystem::remove_all(test_path, error_code);
+        }
+
+        std::optional<std::string> read_backend(
+            const std::string& key
+        )
+        {
+            QLogicaeCore::Result<std::string> result;
+            database->get_value<std::string>(result, key);
+            if (result.is_status_bad())
+            {
+                return std::nullopt;
+            }
+
+            return result.get_value();
+        }
+    };
+
+    TEST_F(ApplicationCacheTest, Should_Expect_BadResult_When_NotEnabled)
+    {
+        QLogicaeCore::Result<std::string> result;
+        cache.read_one(result, "cache", "key");
+
+        ASSERT_TRUE(result.is_status_bad());
+        ASSERT_EQ(
+            result.get_message(),
+            "QLogicaeCore::ApplicationCache::read_one() - ApplicationCache is not enabled"
+        );
+    }
+
+    TEST_F(ApplicationCacheTest, Should_Expect_BackendWrite_When_UpdatedWriteThrough)
+    {
+        cache.attach(*database, QLogicaeCore::TieredCacheWritePolicy::WRITE_THROUGH);
+
+        QLogicaeCore::Result<void> update_result;
+        cache.update_one(update_result, "cache", "key", "value");
+        ASSERT_EQ(read_backend("cache:key"), "value");
+
+        QLogicaeCore::Result<std::string> read_result;
+        cache.read_one(read_result, "cache", "key");
+        ASSERT_TRUE(read_result.is_status_good());
+        ASSERT_EQ(read_result.get_value(), "value");
+
+        QLogicaeCore::Result<void> delete_result;
+        cache.delete_one(delete_result, "cache", "key");
+        ASSERT_FALSE(read_backend("cache:key").has_value());
+
+        cache.read_one(read_result, "cache", "key");
+        ASSERT_TRUE(read_result.is_status_bad());
+    }
+
+    TEST_F(ApplicationCacheTest, Should_Expect_DeferredBackendWrite_When_UpdatedWriteBack)
+    {
+        cache.attach(*database, QLogicaeCore::TieredCacheWritePolicy::WRITE_BACK);
+
+        QLogicaeCore::Result<void> update_result;
+        cache.update_one(update_result, "cache", "key", "value");
+        ASSERT_FALSE(read_backend("cache:key").has_value());
+
+        QLogicaeCore::Result<std::string> read_result;
+        cache.read_one(read_result, "cache", "key");
+        ASSERT_TRUE(read_result.is_status_good());
+        ASSERT_EQ(read_result.get_value(), "value");
+
+        ASSERT_TRUE(cache.get_tiered_cache().flush());
+        ASSERT_EQ(read_backend("cache:key"), "value");
+
+        QLogicaeCore::Result<void> delete_result;
+        cache.delete_one(delete_result, "cache", "key");
+        ASSERT_EQ(read_backend("cache:key"), "value");
+
+        cache.read_one(read_result, "cache", "key");
+        ASSERT_TRUE(read_result.is_status_bad());
+
+        cache.detach();
+        ASSERT_FALSE(read_backend("cache:key").has_value());
+    }
+}
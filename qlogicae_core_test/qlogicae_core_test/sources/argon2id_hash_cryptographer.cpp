@@ -167,4 +167,107 @@ namespace QLogicaeCoreTest
                 pointer->transform("crash");
             }, "");
     }
+
+    TEST_F(Argon2idHashCryptographerTest,
+        Should_Expect_CalibratedProperties_When_TargetLatencyGiven)
+    {
+        QLogicaeCore::Result<QLogicaeCore::CryptographerProperties> result;
+        crypto.calibrate(result, std::chrono::milliseconds(50), 8 * 1024 * 1024);
+        ASSERT_TRUE(result.is_status_safe());
+
+        const QLogicaeCore::CryptographerProperties properties =
+            result.get_value();
+        EXPECT_GE(properties.uint32_t_1, 1u);
+        EXPECT_LE(properties.uint32_t_2, 8u * 1024u);
+
+        QLogicaeCore::Argon2idHashCryptographer calibrated_crypto(properties);
+        const std::string hash = calibrated_crypto.transform("secure_password");
+        EXPECT_TRUE(calibrated_crypto.reverse(hash, "secure_password"));
+    }
+
+    TEST(PasswordHashExecutorTest,
+        Should_Expect_Rejection_When_QueueIsTooDeep)
+    {
+        QLogicaeCore::PasswordHashExecutor executor(
+            QLogicaeCore::PasswordHashExecutorConfigurations
+            {
+                .maximum_concurrency = 4,
+                .maximum_queue_depth = 1,
+                .memory_limit_in_bytes = 64 * 1024 * 1024,
+                .hash_memory_in_bytes = 64 * 1024 * 1024
+            });
+        EXPECT_EQ(executor.get_concurrency(), 1);
+
+        std::promise<void> gate;
+        std::shared_future<void> gate_future = gate.get_future().share();
+        std::atomic<int> completed_count = 0;
+        auto task = [gate_future, &completed_count]()
+            {
+                gate_future.wait();
+                ++completed_count;
+            };
+
+        ASSERT_TRUE(executor.post(task));
+        while (executor.get_active_count() != 1)
+        {
+            std::this_thread::yield();
+        }
+
+        EXPECT_TRUE(executor.post(task));
+        EXPECT_EQ(executor.get_queue_depth(), 1);
+
+        QLogicaeCore::Result<void> result;
+        executor.post(result, task);
+        EXPECT_FALSE(result.is_status_safe());
+        EXPECT_EQ(executor.get_rejected_count(), 1);
+
+        gate.set_value();
+        QLogicaeCore::Result<void> setup_result;
+        executor.setup(setup_result, {});
+        EXPECT_TRUE(setup_result.is_status_safe());
+        EXPECT_EQ(completed_count.load(), 2);
+    }
+
+    TEST(PasswordHashExecutorTest,
+        Should_Expect_Queued_Task_When_MemoryBudgetIsExhausted)
+    {
+        QLogicaeCore::PasswordHashExecutor executor(
+            QLogicaeCore::PasswordHashExecutorConfigurations
+            {
+                .maximum_concurrency = 4,
+                .maximum_queue_depth = 4,
+                .memory_limit_in_bytes = 64 * 1024 * 1024,
+                .hash_memory_in_bytes = 0
+            });
+        EXPECT_EQ(executor.get_concurrency(), 4);
+
+        std::promise<void> gate;
+        std::shared_future<void> gate_future = gate.get_future().share();
+        std::atomic<int> completed_count = 0;
+        auto task = [gate_future, &completed_count]()
+            {
+                gate_future.wait();
+                ++completed_count;
+            };
+
+        ASSERT_TRUE(executor.post(task, 48 * 1024 * 1024));
+        while (executor.get_active_count() != 1)
+        {
+            std::this_thread::yield();
+        }
+
+        ASSERT_TRUE(executor.post(task, 32 * 1024 * 1024));
+        ASSERT_TRUE(executor.post(task, 16 * 1024 * 1024));
+        while (executor.get_active_count() != 2)
+        {
+            std::this_thread::yield();
+        }
+        EXPECT_EQ(executor.get_queue_depth(), 1);
+
+        gate.set_value();
+        QLogicaeCore::Result<void> setup_result;
+        executor.setup(setup_result, {});
+        EXPECT_TRUE(setup_result.is_status_safe());
+        EXPECT_EQ(completed_count.load(), 3);
+    }
 }
@@ -17,6 +17,12 @@ namespace QLogicaeCoreTest
         QLogicaeCore::BcryptHashCryptographer cryptographer;
     };
 
+    class BcryptHashCryptographerCalibrationTest : public ::testing::Test
+    {
+    protected:
+        QLogicaeCore::BcryptHashCryptographer cryptographer;
+    };
+
     TEST_P(BcryptHashCryptographerTest, Should_Hash_Successfully_When_Valid)
     {
         const std::string password = std::get<0>(GetParam());
@@ -110,5 +116,25 @@ namespace QLogicaeCoreTest
     {
         ASSERT_FALSE(cryptographer.reverse("", ""));
     }
-}
 
+    TEST_F(BcryptHashCryptographerCalibrationTest,
+        Should_Expect_CalibratedProperties_When_TargetLatencyGiven)
+    {
+        QLogicaeCore::Result<QLogicaeCore::CryptographerProperties> result;
+        cryptographer.calibrate(
+            result, std::chrono::milliseconds(50), 16 * 1024 * 1024);
+        ASSERT_TRUE(result.is_status_safe());
+
+        const QLogicaeCore::CryptographerProperties properties =
+            result.get_value();
+        EXPECT_GE(properties.size_t_1, crypto_pwhash_OPSLIMIT_MIN);
+        EXPECT_GE(properties.size_t_2, crypto_pwhash_MEMLIMIT_MIN);
+        EXPECT_LE(properties.size_t_2, 16u * 1024u * 1024u);
+
+        QLogicaeCore::BcryptHashCryptographer calibrated_cryptographer(
+            properties);
+        QLogicaeCore::Result<std::string> hash_result;
+        calibrated_cryptographer.transform(hash_result, "helloWorld1");
+        EXPECT_FALSE(hash_result.get_value().empty());
+    }
+}
@@ -140,6 +140,31 @@ namespace QLogicaeCoreTest
         ASSERT_LE(std::chrono::duration_cast<std::chrono::milliseconds>(duration).count(), 2000);
     }
 
+    TEST_P(BinaryFileIOTest, Should_ReadAllBlocks_When_StreamedWithoutLoader)
+    {
+        QLogicaeCore::BinaryFileIO file(test_path);
+        std::vector<std::byte> input = GetParam();
+        ASSERT_TRUE(file.write(input));
+
+        ASSERT_EQ(file.get_size(), input.size());
+        ASSERT_FALSE(file.is_open(QLogicaeCore::FileMode::READ));
+
+        std::vector<std::byte> output(input.size());
+        for (std::size_t offset = 0; offset < output.size(); offset += 100)
+        {
+            const std::size_t size = std::min<std::size_t>(
+                100, output.size() - offset);
+            ASSERT_EQ(
+                file.read_block(offset, std::span(output).subspan(offset, size)),
+                size
+            );
+        }
+        ASSERT_EQ(output, input);
+
+        ASSERT_TRUE(file.close(QLogicaeCore::FileMode::READ));
+        ASSERT_TRUE(std::filesystem::remove(test_path));
+    }
+
     TEST_P(BinaryFileIOTest, Should_ExitGracefully_When_DeathOnInvalidPath)
     {
         ASSERT_EXIT({
@@ -0,0 +1,267 @@
+#include "pch.hpp"
+
+#include "qlogicae_core/includes/concurrent_cache.hpp"
+
+namespace QLogicaeCoreTest
+{
+    class ConcurrentCacheTest : public ::testing::Test
+    {
+    protected:
+        QLogicaeCore::ConcurrentCacheConfigurations configurations
+        {
+            .shard_count = 4,
+            .maximum_weight = 100
+        };
+    };
+
+    TEST_F(ConcurrentCacheTest, Should_Expect_Value_When_KeyWasPut)
+    {
+        QLogicaeCore::ConcurrentCache<std::string, std::string> cache(configurations);
+
+        ASSERT_TRUE(cache.put("key", "value"));
+        ASSERT_EQ(cache.get("key").value(), "value");
+        ASSERT_TRUE(cache.is_key_found("key"));
+        ASSERT_FALSE(cache.get("missing").has_value());
+    }
+
+    TEST_F(ConcurrentCacheTest, Should_Expect_BoundedWeight_When_CapacityExceeded)
+    {
+        QLogicaeCore::ConcurrentCache<int, int> cache(configurations);
+
+        for (int index = 0; index < 10000; ++index)
+        {
+            cache.put(index, index);
+        }
+
+        ASSERT_LE(cache.get_weight(), cache.get_maximum_weight());
+        ASSERT_GT(cache.get_statistics().eviction_count, 0);
+    }
+
+    TEST_F(ConcurrentCacheTest, Should_Expect_HotKeysRetained_When_ScannedByColdKeys)
+    {
+        QLogicaeCore::ConcurrentCache<int, int> cache(configurations);
+
+        for (int round = 0; round < 50; ++round)
+        {
+            for (int key = 0; key < 20; ++key)
+            {
+                if (!cache.get(key).has_value())
+                {
+                    cache.put(key, key);
+                }
+            }
+
+            for (int key = 0; key < 10; ++key)
+            {
+                cache.put(100000 + round * 10 + key, key);
+            }
+        }
+
+        for (int key = 0; key < 20; ++key)
+        {
+            ASSERT_TRUE(cache.is_key_found(key));
+        }
+    }
+
+    TEST_F(ConcurrentCacheTest, Should_Expect_Miss_When_TimeToLiveElapsed)
+    {
+        QLogicaeCore::ConcurrentCache<std::string, std::string> cache(configurations);
+
+        cache.put("key", "value", std::chrono::milliseconds(20));
+        std::this_thread::sleep_for(std::chrono::milliseconds(50));
+
+        ASSERT_FALSE(cache.get("key").has_value());
+        ASSERT_EQ(cache.get_statistics().expiration_count, 1);
+    }
+
+    TEST_F(ConcurrentCacheTest, Should_Expect_Rejection_When_EntryHeavierThanShard)
+    {
+        QLogicaeCore::ConcurrentCache<std::string, std::string> cache(
+            configurations,
+            [](const std::string& key, const std::string& value)
+            {
+                return key.size() + value.size();
+            }
+        );
+
+        ASSERT_FALSE(cache.put("key", std::string(1000, 'x')));
+        ASSERT_TRUE(cache.put("key", "value"));
+        ASSERT_EQ(cache.get_weight(), 8);
+    }
+
+    TEST_F(ConcurrentCacheTest, Should_Expect_SingleLoad_When_ConcurrentMissesCoalesced)
+    {
+        QLogicaeCore::ConcurrentCache<std::string, std::string> cache(configurations);
+        std::atomic<int> load_count = 0;
+        std::vector<std::thread> threads;
+
+        for (int index = 0; index < 8; ++index)
+        {
+            threads.emplace_back([&]()
+                {
+                    std::optional<std::string> value = cache.get_or_load(
+                        "key",
+                        [&]()
+                        {
+                            ++load_count;
+                            std::this_thread::sleep_for(std::chrono::milliseconds(50));
+                            return std::optional<std::string>("value");
+                        }
+                    );
+
+                    ASSERT_EQ(value.value(), "value");
+                });
+        }
+
+        for (std::thread& thread : threads)
+        {
+            thread.join();
+        }
+
+        ASSERT_EQ(load_count.load(), 1);
+        ASSERT_EQ(cache.get("key").value(), "value");
+    }
+
+    TEST_F(ConcurrentCacheTest, Should_Expect_BoundedWeight_When_AnyEvictionPolicyUsed)
+    {
+        for (const QLogicaeCore::ConcurrentCacheEvictionPolicy eviction_policy :
+            {
+                QLogicaeCore::ConcurrentCacheEvictionPolicy::S3_FIFO,
+                QLogicaeCore::ConcurrentCacheEvictionPolicy::LRU,
+                QLogicaeCore::ConcurrentCacheEvictionPolicy::CLOCK,
+                QLogicaeCore::ConcurrentCacheEvictionPolicy::FIFO
+            })
+        {
+            configurations.eviction_policy = eviction_policy;
+            QLogicaeCore::ConcurrentCache<int, int> cache(configurations);
+
+            for (int index = 0; index < 1000; ++index)
+            {
+                cache.put(index, index);
+                cache.get(index / 2);
+            }
+
+            ASSERT_LE(cache.get_weight(), cache.get_maximum_weight());
+            ASSERT_EQ(cache.get(999).value(), 999);
+        }
+    }
+
+    TEST_F(ConcurrentCacheTest, Should_Expect_RecentKeyRetained_When_LruUsed)
+    {
+        configurations.shard_count = 1;
+        configurations.maximum_weight = 4;
+        configurations.eviction_policy =
+            QLogicaeCore::ConcurrentCacheEvictionPolicy::LRU;
+        QLogicaeCore::ConcurrentCache<int, int> cache(configurations);
+
+        for (int key = 1; key <= 4; ++key)
+        {
+            cache.put(key, key);
+        }
+        ASSERT_TRUE(cache.get(1).has_value());
+
+        cache.put(5, 5);
+        cache.put(6, 6);
+
+        ASSERT_TRUE(cache.get(1).has_value());
+        ASSERT_FALSE(cache.get(2).has_value());
+        ASSERT_FALSE(cache.get(3).has_value());
+        ASSERT_TRUE(cache.get(4).has_value());
+    }
+
+    TEST_F(ConcurrentCacheTest, Should_Expect_ReferencedKeySpared_When_ClockUsed)
+    {
+        configurations.shard_count = 1;
+        configurations.maximum_weight = 4;
+        configurations.eviction_policy =
+            QLogicaeCore::ConcurrentCacheEvictionPolicy::CLOCK;
+        QLogicaeCore::ConcurrentCache<int, int> cache(configurations);
+
+        for (int key = 1; key <= 4; ++key)
+        {
+            cache.put(key, key);
+        }
+        ASSERT_TRUE(cache.get(1).has_value());
+
+        cache.put(5, 5);
+        cache.put(6, 6);
+
+        ASSERT_TRUE(cache.is_key_found(1));
+        ASSERT_FALSE(cache.is_key_found(2));
+        ASSERT_FALSE(cache.is_key_found(3));
+        ASSERT_TRUE(cache.is_key_found(4));
+    }
+
+    TEST_F(ConcurrentCacheTest, Should_Expect_InsertionOrderEviction_When_FifoUsed)
+    {
+        configurations.shard_count = 1;
+        configurations.maximum_weight = 4;
+        configurations.eviction_policy =
+            QLogicaeCore::ConcurrentCacheEvictionPolicy::FIFO;
+        QLogicaeCore::ConcurrentCache<int, int> cache(configurations);
+
+        for (int key = 1; key <= 4; ++key)
+        {
+            cache.put(key, key);
+        }
+        ASSERT_TRUE(cache.get(1).has_value());
+        ASSERT_TRUE(cache.get(1).has_value());
+
+        cache.put(5, 5);
+        ASSERT_FALSE(cache.is_key_found(1));
+        ASSERT_TRUE(cache.is_key_found(2));
+
+        cache.put(6, 6);
+        ASSERT_FALSE(cache.is_key_found(2));
+        ASSERT_TRUE(cache.is_key_found(3));
+        ASSERT_TRUE(cache.is_key_found(6));
+    }
+
+    TEST_F(ConcurrentCacheTest, Should_Expect_FrequentAndReinsertedKeysPromoted_When_S3FifoUsed)
+    {
+        configurations.shard_count = 1;
+        configurations.maximum_weight = 10;
+        configurations.eviction_policy =
+            QLogicaeCore::ConcurrentCacheEvictionPolicy::S3_FIFO;
+        QLogicaeCore::ConcurrentCache<int, int> cache(configurations);
+
+        for (int key = 0; key < 10; ++key)
+        {
+            cache.put(key, key);
+        }
+        ASSERT_TRUE(cache.get(5).has_value());
+        ASSERT_TRUE(cache.get(5).has_value());
+
+        for (int key = 10; key < 20; ++key)
+        {
+            cache.put(key, key);
+        }
+
+        ASSERT_FALSE(cache.is_key_found(0));
+        ASSERT_TRUE(cache.is_key_found(5));
+
+        cache.put(0, 0);
+        for (int key = 20; key < 60; ++key)
+        {
+            cache.put(key, key);
+        }
+
+        ASSERT_TRUE(cache.is_key_found(0));
+        ASSERT_TRUE(cache.is_key_found(5));
+        ASSERT_FALSE(cache.is_key_found(20));
+        ASSERT_FALSE(cache.is_key_found(49));
+        ASSERT_TRUE(cache.is_key_found(59));
+    }
+
+    TEST_F(ConcurrentCacheTest, Should_Expect_Empty_When_Cleared)
+    {
+        QLogicaeCore::ConcurrentCache<int, int> cache(configurations);
+
+        cache.put(1, 1);
+        cache.put(2, 2);
+        cache.clear();
+
+        ASSERT_EQ(cache.get_size(), 0);
+        ASSERT_FALSE(cache.remove(1));
+    }
+}
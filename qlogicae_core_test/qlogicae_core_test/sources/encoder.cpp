@@ -129,6 +129,135 @@ namespace QLogicaeCoreTest
         EXPECT_LE(duration.count(), 2000);
     }
 
+    TEST(EncoderUnicodeTest, Should_Expect_ExactLengths_When_TranscodingMixedText)
+    {
+        std::string text;
+        for (int index = 0; index < 64; ++index)
+        {
+            text += "plain ascii run \xC3\xA9\xE2\x82\xAC\xF0\x9F\x98\x80 ";
+        }
+
+        QLogicaeCore::Encoder& encoder = QLogicaeCore::Encoder::get_instance();
+        std::wstring utf16 = encoder.from_utf8_to_utf16(text);
+
+        EXPECT_EQ(encoder.get_utf16_length(text), utf16.size());
+        EXPECT_EQ(encoder.get_utf8_length(utf16), text.size());
+        EXPECT_EQ(encoder.from_utf16_to_utf8(utf16), text);
+    }
+
+    TEST(EncoderUnicodeTest, Should_Expect_CallerBuffer_When_TranscodingIntoSpan)
+    {
+        const std::string text = "caf\xC3\xA9 \xF0\x9F\x98\x80";
+        QLogicaeCore::Encoder& encoder = QLogicaeCore::Encoder::get_instance();
+
+        std::vector<wchar_t> utf16(encoder.get_utf16_length(text));
+        QLogicaeCore::Result<std::size_t> utf16_result;
+        encoder.from_utf8_to_utf16(utf16_result, text, utf16);
+        ASSERT_TRUE(utf16_result.is_status_safe());
+        EXPECT_EQ(utf16_result.get_value(), utf16.size());
+
+        const std::wstring_view utf16_view(utf16.data(), utf16.size());
+        std::vector<char> utf8(encoder.get_utf8_length(utf16_view));
+        QLogicaeCore::Result<std::size_t> utf8_result;
+        encoder.from_utf16_to_utf8(utf8_result, utf16_view, utf8);
+        ASSERT_TRUE(utf8_result.is_status_safe());
+        EXPECT_EQ(std::string(utf8.begin(), utf8.end()), text);
+
+        std::vector<wchar_t> small(utf16.size() - 1);
+        QLogicaeCore::Result<std::size_t> small_result;
+        encoder.from_utf8_to_utf16(small_result, text, small);
+        EXPECT_FALSE(small_result.is_status_safe());
+    }
+
+    TEST(EncoderUnicodeTest, Should_Expect_ReplacementCharacter_When_Utf8IsInvalid)
+    {
+        QLogicaeCore::Encoder& encoder = QLogicaeCore::Encoder::get_instance();
+
+        std::wstring utf16 = encoder.from_utf8_to_utf16("ab\xC0z");
+
+        EXPECT_EQ(utf16.front(), L'a');
+        EXPECT_EQ(utf16.back(), L'z');
+        EXPECT_NE(utf16.find(L'\xFFFD'), std::wstring::npos);
+
+        std::vector<wchar_t> output(8);
+        QLogicaeCore::Result<std::size_t> result;
+        encoder.from_utf8_to_utf16(result, "ab\xC0z", output);
+        EXPECT_FALSE(result.is_status_safe());
+    }
+
+    TEST(EncoderKernelTest, Should_Expect_KnownVectors_When_EncodingLongInput)
+    {
+        QLogicaeCore::Encoder& encoder = QLogicaeCore::Encoder::get_instance();
+        const std::string text =
+            "Hello, World! this is a base64 test of sufficient length.";
+
+        EXPECT_EQ(encoder.from_utf8_to_base64(text),
+            "SGVsbG8sIFdvcmxkISB0aGlzIGlzIGEgYmFzZTY0IHRlc3Qgb2Ygc3VmZmljaWVudCBsZW5ndGgu");
+        EXPECT_EQ(encoder.from_utf8_to_hex("\x01\xAB\xFF"), "01abff");
+        EXPECT_EQ(encoder.from_base64_to_utf8("TWE="), "Ma");
+        EXPECT_EQ(encoder.from_hex_to_utf8("4D61"), "Ma");
+    }
+
+    TEST(EncoderKernelTest, Should_Expect_Failure_When_InputIsMalformed)
+    {
+        QLogicaeCore::Encoder& encoder = QLogicaeCore::Encoder::get_instance();
+
+        QLogicaeCore::Result<std::vector<unsigned char>> hex_result;
+        encoder.from_hex_to_bytes(hex_result, "0g");
+        EXPECT_FALSE(hex_result.is_status_safe());
+
+        QLogicaeCore::Result<std::vector<unsigned char>> odd_result;
+        encoder.from_hex_to_bytes(odd_result, "abc");
+        EXPECT_FALSE(odd_result.is_status_safe());
+
+        QLogicaeCore::Result<std::vector<unsigned char>> base64_result;
+        encoder.from_base64_to_bytes(base64_result, "TWF=");
+        EXPECT_FALSE(base64_result.is_status_safe());
+
+        QLogicaeCore::Result<std::vector<unsigned char>> padding_result;
+        encoder.from_base64_to_bytes(padding_result,
+            "TQ==TWFuTWFuTWFuTWFuTWFuTWFuTWFuTWFuTWFu");
+        EXPECT_FALSE(padding_result.is_status_safe());
+    }
+
+    TEST(EncoderKernelTest, Should_Expect_ExactLengths_When_EncodingIntoSpan)
+    {
+        QLogicaeCore::Encoder& encoder = QLogicaeCore::Encoder::get_instance();
+
+        std::vector<unsigned char> bytes(1000);
+        for (std::size_t index = 0; index < bytes.size(); ++index)
+        {
+            bytes[index] = static_cast<unsigned char>(index * 31);
+        }
+
+        for (const QLogicaeCore::EncodingType type :
+            { QLogicaeCore::EncodingType::HEX,
+                QLogicaeCore::EncodingType::BASE64 })
+        {
+            std::vector<char> text(
+                encoder.get_encoded_length(type, bytes.size()));
+            QLogicaeCore::Result<std::size_t> encode_result;
+            encoder.encode_into(encode_result, type, bytes, text);
+            ASSERT_TRUE(encode_result.is_status_safe());
+            EXPECT_EQ(encode_result.get_value(), text.size());
+
+            const std::string_view view(text.data(), text.size());
+            std::vector<unsigned char> decoded(
+                encoder.get_decoded_length(type, view));
+            EXPECT_EQ(decoded.size(), bytes.size());
+
+            QLogicaeCore::Result<std::size_t> decode_result;
+            encoder.decode_into(decode_result, type, view, decoded);
+            ASSERT_TRUE(decode_result.is_status_safe());
+            EXPECT_EQ(decoded, bytes);
+
+            std::vector<char> small(text.size() - 1);
+            QLogicaeCore::Result<std::size_t> small_result;
+            encoder.encode_into(small_result, type, bytes, small);
+            EXPECT_FALSE(small_result.is_status_safe());
+        }
+    }
+
     INSTANTIATE_TEST_CASE_P(
         EncoderStrings,
         EncoderTest,
@@ -175,6 +175,41 @@ namespace QLogicaeCoreTest
         }
     }
 
+    TEST_P(GeneratorTest, Should_Expect_ValidCharacters_When_FillingStringSpan)
+    {
+        std::string_view character_set = "ABCXYZ";
+        std::string output_buffer(GetParam(), '\0');
+
+        EXPECT_TRUE(QLogicaeCore::Generator::get_instance()
+            .random_string_into(output_buffer, character_set));
+        EXPECT_TRUE(QLogicaeCore::Generator::get_instance()
+            .random_string_into(output_buffer, character_set, true));
+
+        for (char character : output_buffer)
+        {
+            EXPECT_NE(character_set.find(character), std::string::npos);
+        }
+    }
+
+    TEST_P(GeneratorTest, Should_Expect_VersionFourUuids_When_GeneratingBatch)
+    {
+        std::vector<std::string> uuids = QLogicaeCore::Generator::get_instance()
+            .random_uuid4_batch(GetParam());
+
+        ASSERT_EQ(uuids.size(), GetParam());
+        std::unordered_set<std::string> unique_uuids(uuids.begin(), uuids.end());
+        EXPECT_EQ(unique_uuids.size(), uuids.size());
+
+        for (const std::string& uuid : uuids)
+        {
+            ASSERT_EQ(uuid.size(), 36);
+            EXPECT_EQ(uuid[8], '-');
+            EXPECT_EQ(uuid[14], '4');
+            EXPECT_NE(std::string_view("89ab").find(uuid[19]),
+                std::string_view::npos);
+        }
+    }
+
     INSTANTIATE_TEST_CASE_P(
         GeneratorSizes,
         GeneratorTest,
@@ -125,6 +125,44 @@ namespace QLogicaeCoreTest
         ASSERT_EQ(success_count.load(), 10);
     }
 
+    TEST_P(JsonWebTokenCryptographerTest,
+        Should_Expect_CachedTokenAndLazyClaims_When_ReversingRepeatedly)
+    {
+        const std::string subject = std::get<0>(GetParam());
+
+        QLogicaeCore::JsonWebTokenTransformInput input;
+        input.issuer = issuer;
+        input.data = subject;
+        input.public_key = public_key;
+        input.private_key = private_key;
+        input.lifetime = lifetime;
+        input.claims = { {"role", "admin"} };
+
+        QLogicaeCore::JsonWebTokenReverseInput verify;
+        verify.token = cryptographer.transform(input);
+        verify.issuer = issuer;
+        verify.public_key = public_key;
+        verify.is_claim_extraction_enabled = false;
+
+        auto first = cryptographer.reverse(verify);
+        auto second = cryptographer.reverse(verify);
+        ASSERT_TRUE(first.is_successful);
+        ASSERT_TRUE(second.is_successful);
+        ASSERT_EQ(first.token, second.token);
+        ASSERT_TRUE(second.payloads.empty());
+        ASSERT_EQ(second.token->get_payload("role"), "\"admin\"");
+        ASSERT_FALSE(second.token->get_payload("missing").has_value());
+
+        verify.issuer = "other";
+        ASSERT_FALSE(cryptographer.reverse(verify).is_successful);
+
+        cryptographer.clear_verification_cache();
+        verify.issuer = issuer;
+        auto third = cryptographer.reverse(verify);
+        ASSERT_TRUE(third.is_successful);
+        ASSERT_NE(third.token, first.token);
+    }
+
     INSTANTIATE_TEST_CASE_P(
         ValidJwtSubjects,
         JsonWebTokenCryptographerTest,
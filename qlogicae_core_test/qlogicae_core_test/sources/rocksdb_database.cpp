@@ -561,6 +561,113 @@ namespace QLogicaeCoreTest
             });
     }
 
+    TEST_F(RocksDBDatabaseTest, Should_CountMemtableHitsAndKeys_When_StatisticsEnabled)
+    {
+        ASSERT_TRUE(db->reset_statistics());
+
+        for (int i = 0; i < 32; ++i)
+        {
+            db->set_value("statistics_" + std::to_string(i), i);
+        }
+        for (int i = 0; i < 32; ++i)
+        {
+            EXPECT_EQ(db->get_value<int>("statistics_" + std::to_string(i)), i);
+        }
+
+        QLogicaeCore::RocksDBStatistics statistics = db->get_statistics();
+
+        EXPECT_EQ(statistics.keys_written_count, 32u);
+        EXPECT_EQ(statistics.keys_read_count, 32u);
+        EXPECT_EQ(statistics.memtable_hit_count, 32u);
+        EXPECT_GE(statistics.block_cache_hit_rate, 0.0);
+        EXPECT_LE(statistics.block_cache_hit_rate, 1.0);
+    }
+
+    TEST_F(RocksDBDatabaseTest, Should_ReturnBadStatus_When_StatisticsDisabled)
+    {
+        std::string path = "rocksdb_statistics_disabled_test";
+        std::filesystem::remove_all(path);
+
+        {
+            QLogicaeCore::RocksDBConfigurations config;
+            config.is_statistics_enabled = false;
+
+            QLogicaeCore::RocksDBDatabase database(path, config);
+            QLogicaeCore::Result<QLogicaeCore::RocksDBStatistics> result;
+
+            database.get_statistics(result);
+
+            EXPECT_TRUE(result.is_status_bad());
+            EXPECT_FALSE(database.reset_statistics());
+        }
+
+        std::filesystem::remove_all(path);
+    }
+
+    TEST_F(RocksDBDatabaseTest, Should_MeasureMemtableReads_When_PerfContextCaptured)
+    {
+        db->set_value("perf_key", 7);
+
+        ASSERT_TRUE(db->begin_perf_context());
+        EXPECT_EQ(db->get_value<int>("perf_key"), 7);
+        QLogicaeCore::RocksDBPerfContext perf_context = db->end_perf_context();
+
+        EXPECT_GE(perf_context.get_from_memtable_count, 1u);
+    }
+
+    TEST_F(RocksDBDatabaseTest, Should_IngestAllEntries_When_BulkLoadingUnsortedInput)
+    {
+        constexpr size_t count = 10000;
+        std::vector<std::pair<std::string, std::string>> entries;
+        for (size_t i = count; i > 0; --i)
+        {
+            entries.emplace_back("bulk_" + std::to_string(i), std::to_string(i));
+        }
+        entries.emplace_back("bulk_1", "overwritten");
+
+        std::vector<size_t> loaded_counts;
+        QLogicaeCore::RocksDBBulkLoadConfigurations configurations;
+        configurations.entries_per_file = 1000;
+        configurations.progress_callback =
+            [&loaded_counts](const size_t& loaded_count, const size_t&)
+            {
+                loaded_counts.push_back(loaded_count);
+            };
+
+        ASSERT_TRUE(db->bulk_load(std::move(entries), configurations));
+
+        ASSERT_EQ(loaded_counts.size(), 10);
+        for (size_t index = 0; index < loaded_counts.size(); ++index)
+        {
+            EXPECT_EQ(loaded_counts[index], (index + 1) * 1000);
+        }
+        EXPECT_EQ(db->get_value<std::string>("bulk_1"), "overwritten");
+        EXPECT_EQ(db->get_value<std::string>("bulk_5000"), "5000");
+        EXPECT_EQ(db->get_value<std::string>("bulk_10000"), "10000");
+    }
+
+    TEST_F(RocksDBDatabaseTest, Should_Fail_When_BulkLoadingSortedFlagWithUnsortedInput)
+    {
+        std::vector<std::pair<std::string, std::string>> entries = {
+            { "b", "2" }, { "a", "1" }
+        };
+        bool is_progress_reported = false;
+        QLogicaeCore::RocksDBBulkLoadConfigurations configurations;
+        configurations.is_input_sorted = true;
+        configurations.progress_callback =
+            [&is_progress_reported](const size_t&, const size_t&)
+            {
+                is_progress_reported = true;
+            };
+
+        QLogicaeCore::Result<void> result;
+        db->bulk_load(result, std::move(entries), configurations);
+
+        EXPECT_FALSE(result.is_status_safe());
+        EXPECT_FALSE(result.get_message().empty());
+        EXPECT_FALSE(is_progress_reported);
+    }
+
     INSTANTIATE_TEST_CASE_P(RocksDBDatabaseTest_Param, RocksDBDatabaseTest_Param,
         ::testing::Values(
             std::make_tuple("k1", 0, 0, 1),
@@ -219,4 +219,134 @@ namespace QLogicaeCoreTest
             cryptographer.reverse_async(input, fake_hex_hash);
         ASSERT_FALSE(result.get());
     }
+
+    TEST(SHA256HashCryptographerKernelTest,
+        Should_Expect_KnownDigest_When_HashingIncrementally)
+    {
+        QLogicaeCore::SHA256HashContext context;
+        context.update("a");
+        context.update("bc");
+
+        std::array<unsigned char, 32> digest = context.finalize();
+
+        ASSERT_EQ(QLogicaeCore::ENCODER.from_bytes_to_base64(
+            digest.data(), digest.size()),
+            "ungWv48Bz+pBQUDeXa4iI7ADYaOWF3qctBD/YfIAFa0=");
+        ASSERT_EQ(QLogicaeCore::SHA256_HASH_CRYPTOGRAPHER.transform("abc"),
+            "ungWv48Bz+pBQUDeXa4iI7ADYaOWF3qctBD/YfIAFa0=");
+    }
+
+    TEST(SHA256HashCryptographerKernelTest,
+        Should_Expect_MatchingDigests_When_HashingBatch)
+    {
+        std::vector<std::string> texts;
+        for (std::size_t index = 0; index < 5'000; ++index)
+        {
+            texts.push_back(std::string(index % 300 + 1,
+                static_cast<char>('a' + index % 26)));
+        }
+        std::vector<std::string_view> views(texts.begin(), texts.end());
+
+        std::vector<unsigned char> digests =
+            QLogicaeCore::SHA256_HASH_CRYPTOGRAPHER.transform_batch(views);
+
+        ASSERT_EQ(digests.size(), texts.size() * 32);
+        for (std::size_t index = 0; index < texts.size(); index += 97)
+        {
+            ASSERT_EQ(QLogicaeCore::ENCODER.from_bytes_to_base64(
+                digests.data() + index * 32, 32),
+                QLogicaeCore::SHA256_HASH_CRYPTOGRAPHER.transform(
+                    texts[index]));
+        }
+    }
+
+    TEST(SHA256HashCryptographerKernelTest,
+        Should_Expect_LibsodiumDigest_When_KernelForced)
+    {
+        std::vector<std::string> texts;
+        for (const std::size_t size : { 0, 55, 56, 63, 64, 119, 120 })
+        {
+            texts.push_back(std::string(size, '\0'));
+        }
+        for (std::size_t index = 0; index < 200; ++index)
+        {
+            texts.push_back(std::string((index * 37) % 300, '\0'));
+        }
+        for (std::size_t index = 0; index < texts.size(); ++index)
+        {
+            for (std::size_t offset = 0; offset < texts[index].size(); ++offset)
+            {
+                texts[index][offset] = static_cast<char>(index * 7 + offset * 31);
+            }
+        }
+        std::vector<std::string_view> views(texts.begin(), texts.end());
+
+        std::vector<unsigned char> expected(texts.size() * 32);
+        for (std::size_t index = 0; index < texts.size(); ++index)
+        {
+            crypto_hash_sha256(
+                expected.data() + index * 32,
+                reinterpret_cast<const unsigned char*>(texts[index].data()),
+                texts[index].size()
+            );
+        }
+
+        for (const QLogicaeCore::SHA256Kernel kernel :
+            {
+                QLogicaeCore::SHA256Kernel::SCALAR,
+                QLogicaeCore::SHA256Kernel::SHA,
+                QLogicaeCore::SHA256Kernel::AVX2
+            })
+        {
+            if (!QLogicaeCore::SHA256Kernels::is_kernel_supported(kernel))
+            {
+                continue;
+            }
+
+            for (std::size_t index = 0; index < texts.size(); ++index)
+            {
+                std::array<unsigned char, 32> digest;
+                QLogicaeCore::SHA256Kernels::hash(
+                    std::span<const unsigned char>(
+                        reinterpret_cast<const unsigned char*>(
+                            texts[index].data()),
+                        texts[index].size()),
+                    digest,
+                    kernel
+                );
+                ASSERT_TRUE(std::equal(digest.begin(), digest.end(),
+                    expected.begin() + index * 32))
+                    << "kernel " << static_cast<int>(kernel)
+                    << " size " << texts[index].size();
+            }
+
+            std::vector<unsigned char> digests(texts.size() * 32);
+            ASSERT_TRUE(QLogicaeCore::SHA256Kernels::hash_many(
+                views, digests, kernel));
+            ASSERT_EQ(digests, expected)
+                << "kernel " << static_cast<int>(kernel);
+        }
+    }
+
+    TEST(SHA256HashCryptographerKernelTest,
+        Should_Expect_MatchingDigest_When_HashingFile)
+    {
+        const std::string file_path = "sha256_hash_cryptographer_test.bin";
+        std::string content(3'000'000, '\0');
+        for (std::size_t index = 0; index < content.size(); ++index)
+        {
+            content[index] = static_cast<char>(index * 31);
+        }
+        {
+            std::ofstream file(file_path, std::ios::binary);
+            file.write(content.data(), content.size());
+        }
+
+        std::string digest =
+            QLogicaeCore::SHA256_HASH_CRYPTOGRAPHER.transform_file(file_path);
+        std::filesystem::remove(file_path);
+
+        ASSERT_EQ(digest,
+            QLogicaeCore::SHA256_HASH_CRYPTOGRAPHER.transform(content));
+    }
 }
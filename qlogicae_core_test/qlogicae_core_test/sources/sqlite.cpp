@@ -221,6 +221,22 @@ namespace QLogicaeCoreTest
         EXPECT_FALSE(name.has_value());
     }
 
+    TEST_F(SQLiteStatementCoverageTest, Should_Bind_EmptyValues_When_BindingStaticWithoutData)
+    {
+        QLogicaeCore::SQLiteStatement query =
+            database->prepare("SELECT typeof(?), typeof(?), length(?);");
+        query.bind_static(1, std::string_view())
+            .bind_static(2, std::span<const std::byte>())
+            .bind_static(3, std::string_view());
+        query.step();
+
+        std::optional<QLogicaeCore::SQLiteRow> row = query.row();
+        ASSERT_TRUE(row.has_value());
+        EXPECT_EQ(row->get<std::string>(0), "text");
+        EXPECT_EQ(row->get<std::string>(1), "blob");
+        EXPECT_EQ(row->get<int>(2), 0);
+    }
+
     TEST_P(SQLiteParameterizedSQLTest, Should_Handle_ParameterSyntaxForms)
     {
         std::string parameter = GetParam();
@@ -417,4 +433,263 @@ namespace QLogicaeCoreTest
             auto stmt = future.get();
             }, QLogicaeCore::SQLiteException);
     }
+
+    TEST_F(SQLiteStatementCoverageTest, Should_ReuseStatement_When_PreparedCachedTwice)
+    {
+        auto first = database->prepare_cached("SELECT id FROM items;");
+        QLogicaeCore::SQLiteStatement* first_address = first.get();
+        first.reset();
+
+        auto second = database->prepare_cached("SELECT id FROM items;");
+
+        EXPECT_EQ(second.get(), first_address);
+        EXPECT_EQ(database->get_statement_cache_size(), 1u);
+    }
+
+    TEST_F(SQLiteStatementCoverageTest, Should_ReturnFreshStatement_When_CachedStatementInUse)
+    {
+        auto first = database->prepare_cached("SELECT id FROM items;");
+        auto second = database->prepare_cached("SELECT id FROM items;");
+
+        EXPECT_NE(first.get(), second.get());
+    }
+
+    TEST_F(SQLiteStatementCoverageTest, Should_EvictLeastRecentlyUsed_When_CacheCapacityExceeded)
+    {
+        database->set_statement_cache_capacity(2);
+
+        database->prepare_cached("SELECT 1;");
+        database->prepare_cached("SELECT 2;");
+        database->prepare_cached("SELECT 3;");
+
+        EXPECT_EQ(database->get_statement_cache_size(), 2u);
+    }
+
+    TEST_F(SQLiteStatementCoverageTest, Should_StreamAllRows_When_IteratingCursor)
+    {
+        {
+            QLogicaeCore::SQLiteTransaction transaction(*database);
+            auto insert = database->prepare_cached("INSERT INTO items(id, name) VALUES (?, ?);");
+            for (int i = 0; i < 5; ++i)
+            {
+                insert->bind(1, i).bind(2, "row_" + std::to_string(i)).step();
+                insert->reset();
+            }
+            transaction.commit();
+        }
+
+        QLogicaeCore::SQLiteStatement query = database->prepare("SELECT id, name FROM items ORDER BY id;");
+        int expected_id = 0;
+        for (QLogicaeCore::SQLiteRow& row : query.rows())
+        {
+            EXPECT_EQ(row.get<int>("id"), expected_id);
+            EXPECT_EQ(row.get<std::string_view>(1), "row_" + std::to_string(expected_id));
+            ++expected_id;
+        }
+        EXPECT_EQ(expected_id, 5);
+
+        int count = 0;
+        query.for_each_row([&count](QLogicaeCore::SQLiteRow& row)
+            {
+                EXPECT_EQ(row.get<int64_t>(0), count);
+                ++count;
+            });
+        EXPECT_EQ(count, 5);
+    }
+
+    TEST_F(SQLiteStatementCoverageTest, Should_InsertAllRows_When_BatchInsertingTuples)
+    {
+        std::vector<std::tuple<int, std::string>> rows;
+        for (int i = 0; i < 1000; ++i)
+        {
+            rows.emplace_back(i, "batch_" + std::to_string(i));
+        }
+
+        size_t inserted_count = database->insert_batch(
+            "INSERT INTO items(id, name) VALUES (?, ?);", rows);
+
+        EXPECT_EQ(inserted_count, 1000u);
+
+        QLogicaeCore::SQLiteStatement count = database->prepare("SELECT COUNT(*), MAX(name) FROM items;");
+        ASSERT_TRUE(count.step());
+        EXPECT_EQ(count.row()->get<int>(0), 1000);
+        EXPECT_EQ(count.row()->get<std::string>(1), "batch_999");
+    }
+
+    TEST_F(SQLiteStatementCoverageTest, Should_InsertMappedStructs_When_BatchInsertingWithMapper)
+    {
+        struct Item
+        {
+            int id;
+            std::optional<std::string> name;
+        };
+        std::vector<Item> items = { { 1, "one" }, { 2, std::nullopt } };
+
+        database->insert_batch("INSERT INTO items(id, name) VALUES (?, ?);", items,
+            [](const Item& item)
+            {
+                return std::tie(item.id, item.name);
+            });
+
+        QLogicaeCore::SQLiteStatement query = database->prepare("SELECT name FROM items WHERE id = 2;");
+        ASSERT_TRUE(query.step());
+        EXPECT_FALSE(query.row()->get_optional<std::string>(0).has_value());
+    }
+
+    TEST_F(SQLiteStatementCoverageTest, Should_RollBack_When_BatchInsertParameterCountMismatches)
+    {
+        std::vector<std::tuple<int>> rows = { { 1 }, { 2 } };
+
+        EXPECT_THROW(database->insert_batch(
+            "INSERT INTO items(id, name) VALUES (?, ?);", rows),
+            QLogicaeCore::SQLiteException);
+
+        QLogicaeCore::SQLiteStatement count = database->prepare("SELECT COUNT(*) FROM items;");
+        ASSERT_TRUE(count.step());
+        EXPECT_EQ(count.row()->get<int>(0), 0);
+    }
+
+    TEST_F(SQLiteStatementCoverageTest, Should_Throw_When_BatchInsertingUnsignedAboveInt64Max)
+    {
+        std::vector<std::tuple<uint64_t, std::string>> rows = {
+            { 1, "one" },
+            { static_cast<uint64_t>(std::numeric_limits<int64_t>::max()) + 1, "two" }
+        };
+
+        EXPECT_THROW(database->insert_batch(
+            "INSERT INTO items(id, name) VALUES (?, ?);", rows),
+            QLogicaeCore::SQLiteException);
+
+        QLogicaeCore::SQLiteStatement count = database->prepare("SELECT COUNT(*) FROM items;");
+        ASSERT_TRUE(count.step());
+        EXPECT_EQ(count.row()->get<int>(0), 0);
+    }
+
+    TEST_F(SQLiteStatementCoverageTest, Should_UseSavepoint_When_BatchInsertingInsideTransaction)
+    {
+        std::vector<std::tuple<int, std::string>> rows = { { 1, "one" }, { 2, "two" } };
+        std::vector<std::tuple<int>> invalid_rows = { { 3 } };
+
+        database->execute("BEGIN;");
+        EXPECT_EQ(database->insert_batch(
+            "INSERT INTO items(id, name) VALUES (?, ?);", rows), 2u);
+        EXPECT_THROW(database->insert_batch(
+            "INSERT INTO items(id, name) VALUES (?, ?);", invalid_rows),
+            QLogicaeCore::SQLiteException);
+        database->execute("ROLLBACK;");
+
+        QLogicaeCore::SQLiteStatement count = database->prepare("SELECT COUNT(*) FROM items;");
+        ASSERT_TRUE(count.step());
+        EXPECT_EQ(count.row()->get<int>(0), 0);
+    }
+
+    TEST(SQLiteConnectionPoolTest, Should_RouteReadsToReaders_When_WalModeEnabled)
+    {
+        const std::string path = "sqlite_connection_pool_test.db";
+        std::filesystem::remove(path);
+        std::filesystem::remove(path + "-wal");
+        std::filesystem::remove(path + "-shm");
+
+        {
+            QLogicaeCore::SQLiteConfigurations configurations;
+            configurations.reader_connection_count = 2;
+            configurations.is_wal_mode_enabled = true;
+            configurations.synchronous_mode = "NORMAL";
+            configurations.mmap_size = 1 << 20;
+            configurations.cache_size = -2000;
+            configurations.busy_timeout_in_milliseconds = 1000;
+
+            QLogicaeCore::SQLiteDatabase database(path, configurations);
+            database.execute("CREATE TABLE items(id INT, name TEXT);");
+            database.prepare("INSERT INTO items(id, name) VALUES (7, 'seven');").step();
+
+            EXPECT_EQ(database.get_reader_connection_count(), 2u);
+
+            auto read_statement = database.prepare_read("SELECT name FROM items WHERE id = 7;");
+            EXPECT_TRUE(read_statement->is_read_only());
+            ASSERT_TRUE(read_statement->step());
+            EXPECT_EQ(read_statement->row()->get<std::string>(0), "seven");
+            read_statement->reset();
+
+            auto write_statement = database.prepare_read("INSERT INTO items(id) VALUES (8);");
+            EXPECT_FALSE(write_statement->is_read_only());
+            EXPECT_NO_THROW(write_statement->step());
+
+            std::atomic<int> row_count { 0 };
+            std::vector<std::future<void>> futures;
+            for (int i = 0; i < 8; ++i)
+            {
+                futures.push_back(database.query_async("SELECT id FROM items;",
+                    [&row_count](QLogicaeCore::SQLiteRow&)
+                    {
+                        ++row_count;
+                    }));
+            }
+            for (auto& future : futures)
+            {
+                future.get();
+            }
+            EXPECT_EQ(row_count.load(), 16);
+        }
+
+        std::filesystem::remove(path);
+        std::filesystem::remove(path + "-wal");
+        std::filesystem::remove(path + "-shm");
+    }
+
+    TEST(SQLiteConnectionPoolTest, Should_UseDefaultConfigurations_When_ConfigurationsBraced)
+    {
+        QLogicaeCore::SQLiteDatabase database(":memory:", {});
+
+        EXPECT_EQ(database.get_reader_connection_count(), 0u);
+        EXPECT_EQ(database.get_statement_cache_capacity(), 64u);
+    }
+
+    TEST(SQLiteConnectionPoolTest, Should_Throw_When_WalModeCannotBeEnabled)
+    {
+        QLogicaeCore::SQLiteConfigurations configurations;
+        configurations.is_wal_mode_enabled = true;
+
+        EXPECT_THROW(QLogicaeCore::SQLiteDatabase(":memory:", configurations),
+            QLogicaeCore::SQLiteException);
+    }
+
+    TEST(SQLiteConnectionPoolTest, Should_ReuseReaderStatement_When_PreparedReadTwice)
+    {
+        const std::string path = "sqlite_reader_cache_test.db";
+        std::filesystem::remove(path);
+        std::filesystem::remove(path + "-wal");
+        std::filesystem::remove(path + "-shm");
+
+        {
+            QLogicaeCore::SQLiteConfigurations configurations;
+            configurations.reader_connection_count = 2;
+            configurations.is_wal_mode_enabled = true;
+
+            QLogicaeCore::SQLiteDatabase database(path, configurations);
+            database.execute("CREATE TABLE items(id INT, name TEXT);");
+            database.prepare("INSERT INTO items(id, name) VALUES (1, 'one');").step();
+
+            QLogicaeCore::SQLiteStatement* first_address = nullptr;
+            {
+                auto statement = database.prepare_read("SELECT name FROM items WHERE id = ?;");
+                first_address = statement.get();
+                statement->bind(1, static_cast<int64_t>(1));
+                ASSERT_TRUE(statement->step());
+
+                auto concurrent = database.prepare_read("SELECT name FROM items WHERE id = ?;");
+                EXPECT_NE(concurrent.get(), first_address);
+            }
+
+            auto statement = database.prepare_read("SELECT name FROM items WHERE id = ?;");
+            EXPECT_EQ(statement.get(), first_address);
+            statement->bind(1, static_cast<int64_t>(1));
+            ASSERT_TRUE(statement->step());
+            EXPECT_EQ(statement->row()->get<std::string>(0), "one");
+        }
+
+        std::filesystem::remove(path);
+        std::filesystem::remove(path + "-wal");
+        std::filesystem::remove(path + "-shm");
+    }
 }
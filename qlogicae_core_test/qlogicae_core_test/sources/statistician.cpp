@@ -656,4 +656,247 @@ namespace QLogicaeCoreTest
         std::chrono::duration<double> elapsed = end - start;
         ASSERT_LT(elapsed.count(), 2.0);
     }
+
+    TEST(StatisticianTrimmedMeanTest, Should_Preserve_Input_Order_When_Trimmed)
+    {
+        QLogicaeCore::Statistician& statistician =
+            QLogicaeCore::Statistician::get_instance();
+        QLogicaeCore::OutlierRemovalOptions options{ .proportion = 0.125 };
+
+        std::vector<std::vector<double>> data = {
+            { 5.0, 100.0, 1.0, 3.0 },
+            { -50.0, 2.0, 4.0, 3.0 }
+        };
+        ASSERT_TRUE(statistician.remove_outliers_via_trimmed_mean(data, options));
+        EXPECT_EQ(data, (std::vector<std::vector<double>>{
+            { 5.0, 1.0, 3.0, 2.0, 4.0, 3.0 } }));
+
+        options.proportion = 0.25;
+        data = { { 7.0, 1.0, 7.0, 2.0, 7.0, 3.0, 7.0, 4.0 } };
+        ASSERT_TRUE(statistician.remove_outliers_via_trimmed_mean(data, options));
+        EXPECT_EQ(data, (std::vector<std::vector<double>>{
+            { 7.0, 3.0, 7.0, 4.0 } }));
+    }
+
+    TEST(StatisticianAccumulatorTest, Should_Match_Batch_Statistics_When_Merged)
+    {
+        std::vector<double> values;
+        std::vector<QLogicaeCore::StatisticianAccumulator> accumulators(4);
+        for (std::size_t index = 0; index < 10'000; ++index)
+        {
+            const double value = static_cast<double>((index * 7'919) % 10'000);
+            values.push_back(value);
+            accumulators[index % accumulators.size()].update(value);
+        }
+
+        QLogicaeCore::StatisticianAccumulator accumulator;
+        for (const auto& part : accumulators)
+        {
+            accumulator.merge(part);
+        }
+
+        QLogicaeCore::Statistician& statistician =
+            QLogicaeCore::Statistician::get_instance();
+        const double mean = statistician.compute_mean(values);
+
+        EXPECT_EQ(accumulator.get_count(), values.size());
+        EXPECT_NEAR(accumulator.get_mean(), mean, 1e-9);
+        EXPECT_NEAR(accumulator.get_standard_deviation(),
+            statistician.compute_standard_deviation(values, mean), 1e-6);
+        EXPECT_DOUBLE_EQ(accumulator.get_minimum(), 0.0);
+        EXPECT_DOUBLE_EQ(accumulator.get_maximum(), 9'999.0);
+        EXPECT_NEAR(accumulator.get_median(), 5'000.0, 50.0);
+        EXPECT_NEAR(accumulator.get_quantile(0.99), 9'900.0, 20.0);
+    }
+
+    TEST(StatisticianAccumulatorTest, Should_Return_NaN_When_Empty)
+    {
+        QLogicaeCore::StatisticianAccumulator accumulator;
+
+        EXPECT_EQ(accumulator.get_count(), 0);
+        EXPECT_TRUE(std::isnan(accumulator.get_mean()));
+        EXPECT_TRUE(std::isnan(accumulator.get_median()));
+    }
+
+    TEST(StatisticianAccumulatorTest, Should_Match_Scalar_Updates_When_Updated_With_Span)
+    {
+        std::vector<double> values(1'500'000);
+        for (std::size_t index = 0; index < values.size(); ++index)
+        {
+            values[index] = static_cast<double>((index * 7'919) % 10'007) - 5'000.0;
+        }
+        values[777] = std::numeric_limits<double>::quiet_NaN();
+
+        QLogicaeCore::StatisticianAccumulator expected(0.0);
+        for (const double value : values)
+        {
+            expected.update(value);
+        }
+
+        QLogicaeCore::StatisticianAccumulator accumulator(0.0);
+        accumulator.update(values);
+
+        EXPECT_EQ(accumulator.get_count(), values.size() - 1);
+        EXPECT_EQ(accumulator.get_count(), expected.get_count());
+        EXPECT_NEAR(accumulator.get_mean(), expected.get_mean(), 1e-9);
+        EXPECT_NEAR(accumulator.get_variance(), expected.get_variance(), 1e-3);
+        EXPECT_DOUBLE_EQ(accumulator.get_minimum(), expected.get_minimum());
+        EXPECT_DOUBLE_EQ(accumulator.get_maximum(), expected.get_maximum());
+    }
+
+    TEST(StatisticianKernelsTest, Should_Match_Scalar_Results_When_Vectorized)
+    {
+        std::vector<double> values;
+        for (std::size_t index = 0; index < 1'003; ++index)
+        {
+            values.push_back(static_cast<double>((index * 7'919) % 1'000) - 500.0);
+        }
+
+        double sum = 0.0;
+        double squared_sum = 0.0;
+        double maximum = 0.0;
+        std::vector<double> expected;
+        for (const double value : values)
+        {
+            sum += value;
+            squared_sum += (value - 1.5) * (value - 1.5);
+            maximum = std::max(maximum, std::abs(value - 1.5));
+            if (std::abs(value - 1.5) <= 250.0)
+            {
+                expected.push_back(value);
+            }
+        }
+
+        std::vector<double> filtered(values.size());
+        filtered.resize(QLogicaeCore::StatisticianKernels::filter_within(
+            values, 1.5, 250.0, filtered.data()));
+
+        EXPECT_DOUBLE_EQ(QLogicaeCore::StatisticianKernels::sum(values), sum);
+        EXPECT_DOUBLE_EQ(QLogicaeCore::StatisticianKernels::sum_of_squared_deviations(
+            values, 1.5), squared_sum);
+        EXPECT_DOUBLE_EQ(QLogicaeCore::StatisticianKernels::maximum_absolute_deviation(
+            values, 1.5), maximum);
+        EXPECT_EQ(filtered, expected);
+    }
+
+    TEST(StatisticianKernelsTest, Should_Compensate_Sum_When_Magnitudes_Cancel)
+    {
+        std::vector<double> values = { 1e16, 1.0, -1e16, 1.0, 1.0, 1.0, 1.0, 1.0, 1.0 };
+
+        EXPECT_DOUBLE_EQ(QLogicaeCore::StatisticianKernels::sum(values), 7.0);
+    }
+
+    TEST(StatisticianStridedSpanTest, Should_Return_Indices_When_Removing_Outliers_From_Column)
+    {
+        std::vector<double> table;
+        for (std::size_t index = 0; index < 100; ++index)
+        {
+            table.push_back(static_cast<double>(index));
+            table.push_back(10.0 + static_cast<double>(index % 5) * 0.1);
+        }
+        table[2 * 50 + 1] = 1'000.0;
+
+        QLogicaeCore::Statistician& statistician =
+            QLogicaeCore::Statistician::get_instance();
+        QLogicaeCore::StatisticianStridedSpan column(table.data() + 1, 100, 2);
+        QLogicaeCore::OutlierRemovalOptions options{ 1.5, 3.0, 0.1, 0.05 };
+
+        std::vector<std::size_t> indices;
+        ASSERT_TRUE(statistician.remove_outliers_via_z_score(column, options, indices));
+
+        EXPECT_EQ(indices.size(), 99);
+        EXPECT_EQ(std::find(indices.begin(), indices.end(), 50), indices.end());
+        EXPECT_NEAR(statistician.compute_mean(
+            QLogicaeCore::StatisticianStridedSpan(table.data(), 100, 2)), 49.5, 1e-12);
+    }
+
+    TEST(StatisticianStridedSpanTest, Should_Compensate_Mean_When_Column_Magnitudes_Cancel)
+    {
+        const std::vector<double> column = { 1e16, 1.0, -1e16, 1.0, 1.0, 1.0, 1.0, 1.0, 1.0 };
+        std::vector<double> table;
+        for (const double value : column)
+        {
+            table.push_back(value);
+            table.push_back(0.0);
+        }
+
+        QLogicaeCore::Statistician& statistician =
+            QLogicaeCore::Statistician::get_instance();
+
+        EXPECT_DOUBLE_EQ(statistician.compute_mean(
+            QLogicaeCore::StatisticianStridedSpan(table.data(), column.size(), 2)),
+            7.0 / 9.0);
+    }
+
+    TEST(StatisticianStridedSpanTest, Should_Expect_Same_Mean_When_Constructed_From_Each_Form)
+    {
+        std::vector<double> values = { 1.0, 2.0, 4.0, 8.0 };
+        const std::vector<double>& constant_values = values;
+        std::vector<double> table = { 1.0, -1.0, 2.0, -1.0, 4.0, -1.0, 8.0, -1.0 };
+
+        QLogicaeCore::Statistician& statistician =
+            QLogicaeCore::Statistician::get_instance();
+
+        EXPECT_DOUBLE_EQ(statistician.compute_mean(constant_values), 3.75);
+        EXPECT_DOUBLE_EQ(statistician.compute_mean(
+            QLogicaeCore::StatisticianStridedSpan(std::span<double>(values))), 3.75);
+        EXPECT_DOUBLE_EQ(statistician.compute_mean(
+            QLogicaeCore::StatisticianStridedSpan(std::span<const double>(values))), 3.75);
+        EXPECT_DOUBLE_EQ(statistician.compute_mean(
+            QLogicaeCore::StatisticianStridedSpan(table.data(), 4, 2)), 3.75);
+    }
+
+    TEST(StatisticianStridedSpanTest, Should_Keep_Same_Elements_When_Trimming_Ties)
+    {
+        std::vector<double> values = { 5.0, 1.0, 1.0, 9.0, 9.0, 5.0, 3.0, 1.0, 9.0, 7.0, 2.0, 30.0 };
+        std::vector<double> table;
+        for (const double value : values)
+        {
+            table.push_back(-1.0);
+            table.push_back(value);
+        }
+        std::vector<std::vector<double>> data = { values };
+
+        QLogicaeCore::Statistician& statistician =
+            QLogicaeCore::Statistician::get_instance();
+        QLogicaeCore::OutlierRemovalOptions options{ 1.5, 3.0, 0.2, 0.05 };
+
+        std::vector<std::size_t> indices;
+        ASSERT_TRUE(statistician.remove_outliers_via_trimmed_mean(
+            QLogicaeCore::StatisticianStridedSpan(table.data() + 1, values.size(), 2),
+            options, indices));
+        ASSERT_TRUE(statistician.remove_outliers_via_trimmed_mean(data, options));
+
+        std::vector<double> kept;
+        for (const std::size_t index : indices)
+        {
+            kept.push_back(values[index]);
+        }
+
+        EXPECT_EQ(kept, data[0]);
+        EXPECT_EQ(indices, (std::vector<std::size_t>{ 0, 4, 5, 6, 7, 8, 9, 10 }));
+    }
+
+    TEST(StatisticianStridedSpanTest, Should_Match_Nested_Overload_When_Contiguous)
+    {
+        std::vector<double> values = { 10.0, 10.1, 10.2, 10.3, 10.1, 100.0 };
+        std::vector<std::vector<double>> data = { values };
+
+        QLogicaeCore::Statistician& statistician =
+            QLogicaeCore::Statistician::get_instance();
+        QLogicaeCore::OutlierRemovalOptions options{ 1.5, 3.0, 0.1, 0.05 };
+
+        std::vector<std::size_t> indices;
+        ASSERT_TRUE(statistician.remove_outliers_via_inter_quartile_range(
+            values, options, indices));
+        ASSERT_TRUE(statistician.remove_outliers_via_inter_quartile_range(data, options));
+
+        std::vector<double> kept;
+        for (const std::size_t index : indices)
+        {
+            kept.push_back(values[index]);
+        }
+
+        EXPECT_EQ(kept, data[0]);
+    }
 }
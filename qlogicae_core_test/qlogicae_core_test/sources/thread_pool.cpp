@@ -390,6 +390,30 @@ namespace QLogicaeCoreTest
         EXPECT_TRUE(overflow_rejected);
     }
 
+    TEST_F(ThreadPoolLimitTest, Should_Join_Queued_Tasks_When_Inline_Task_Throws)
+    {
+        QLogicaeCore::ThreadPool thread_pool(1, 2);
+
+        const std::thread::id caller_id = std::this_thread::get_id();
+        std::atomic<int> active_count{ 0 };
+        EXPECT_THROW(
+            thread_pool.parallel_for(16, [&](const std::size_t& task_index)
+                {
+                    active_count.fetch_add(1);
+                    std::this_thread::sleep_for(std::chrono::milliseconds(20));
+                    active_count.fetch_sub(1);
+                    if (task_index != 0 &&
+                        std::this_thread::get_id() == caller_id)
+                    {
+                        throw std::runtime_error("Task failed");
+                    }
+                }),
+            std::runtime_error
+        );
+
+        EXPECT_EQ(active_count.load(), 0);
+    }
+
     TEST_F(ThreadPoolLimitTest, Should_Recover_After_Idle_And_Process_New_Tasks)
     {
         QLogicaeCore::ThreadPool thread_pool(2, 64);
@@ -0,0 +1,265 @@
+#include "pch.hpp"
+
+#include "qlogicae_core/includes/tiered_cache.hpp"
+
+namespace QLogicaeCoreTest
+{
+    class TieredCacheTest : public ::testing::Test
+    {
+    protected:
+        std::string test_path = "tiered_cache_test";
+        std::unique_ptr<QLogicaeCore::RocksDBDatabase> database;
+
+        void SetUp() override
+        {
+            std::error_code error_code;
+            std::filesystem::remove_all(test_path, error_code);
+
+            database = std::make_unique<QLogicaeCore::RocksDBDatabase>(test_path);
+        }
+
+        void TearDown() override
+        {
+            database.reset();
+
+            std::error_code error_code;
+            std::filesystem::remove_all(test_path, error_code);
+        }
+
+        QLogicaeCore::TieredCacheConfigurations get_configurations(
+            const QLogicaeCore::TieredCacheWritePolicy write_policy
+        )
+        {
+            QLogicaeCore::TieredCacheConfigurations configurations;
+            configurations.write_policy = write_policy;
+            configurations.write_back_interval_in_milliseconds = 0;
+
+            return configurations;
+        }
+
+        std::optional<std::string> read_backend(
+            const std::string& key
+        )
+        {
+            QLogicaeCore::Result<std::string> result;
+            database->get_value<std::string>(result, key);
+            if (result.is_status_bad())
+            {
+                return std::nullopt;
+            }
+
+            return result.get_value();
+        }
+
+        void write_backend(
+            const std::string& key,
+            const std::string& value
+        )
+        {
+            QLogicaeCore::Result<void> result;
+            database->set_value<std::string>(result, key, value);
+        }
+    };
+
+    TEST_F(TieredCacheTest, Should_Expect_BackendWrite_When_WriteThrough)
+    {
+        QLogicaeCore::TieredCache cache(
+            *database,
+            get_configurations(QLogicaeCore::TieredCacheWritePolicy::WRITE_THROUGH)
+        );
+
+        ASSERT_TRUE(cache.write("key", "value"));
+        ASSERT_EQ(read_backend("key"), "value");
+        ASSERT_EQ(cache.read("key"), "value");
+
+        const auto statistics = cache.get_statistics();
+        ASSERT_EQ(statistics.backend_write_count, 1);
+        ASSERT_EQ(statistics.backend_read_count, 0);
+        ASSERT_EQ(statistics.pending_write_count, 0);
+    }
+
+    TEST_F(TieredCacheTest, Should_Expect_BackendLoad_When_MemoryTierMissed)
+    {
+        write_backend("key", "stored");
+        QLogicaeCore::TieredCache cache(
+            *database,
+            get_configurations(QLogicaeCore::TieredCacheWritePolicy::WRITE_THROUGH)
+        );
+
+        ASSERT_EQ(cache.read("key"), "stored");
+        ASSERT_EQ(cache.read("key"), "stored");
+        ASSERT_FALSE(cache.read("missing").has_value());
+        ASSERT_EQ(cache.get_statistics().backend_read_count, 2);
+    }
+
+    TEST_F(TieredCacheTest, Should_Expect_BackendRemoval_When_RemovedWriteThrough)
+    {
+        QLogicaeCore::TieredCache cache(
+            *database,
+            get_configurations(QLogicaeCore::TieredCacheWritePolicy::WRITE_THROUGH)
+        );
+
+        ASSERT_TRUE(cache.write("key", "value"));
+        ASSERT_TRUE(cache.remove("key"));
+        ASSERT_FALSE(read_backend("key").has_value());
+        ASSERT_FALSE(cache.is_key_found("key"));
+    }
+
+    TEST_F(TieredCacheTest, Should_Expect_DeferredBackendWrite_When_WriteBack)
+    {
+        QLogicaeCore::TieredCache cache(
+            *database,
+            get_configurations(QLogicaeCore::TieredCacheWritePolicy::WRITE_BACK)
+        );
+
+        ASSERT_TRUE(cache.write("key", "value"));
+        ASSERT_FALSE(read_backend("key").has_value());
+        ASSERT_EQ(cache.get_statistics().pending_write_count, 1);
+
+        cache.invalidate("key");
+        ASSERT_EQ(cache.read("key"), "value");
+        ASSERT_EQ(cache.get_statistics().pending_write_hit_count, 1);
+
+        ASSERT_TRUE(cache.flush());
+        ASSERT_EQ(read_backend("key"), "value");
+
+        const auto statistics = cache.get_statistics();
+        ASSERT_EQ(statistics.pending_write_count, 0);
+        ASSERT_EQ(statistics.flush_count, 1);
+    }
+
+    TEST_F(TieredCacheTest, Should_Expect_PendingRemoval_When_RemovedWriteBack)
+    {
+        write_backend("key", "stored");
+        QLogicaeCore::TieredCache cache(
+            *database,
+            get_configurations(QLogicaeCore::TieredCacheWritePolicy::WRITE_BACK)
+        );
+
+        ASSERT_TRUE(cache.remove("key"));
+        ASSERT_EQ(read_backend("key"), "stored");
+        ASSERT_FALSE(cache.is_key_found("key"));
+
+        ASSERT_TRUE(cache.flush());
+        ASSERT_FALSE(read_backend("key").has_value());
+        ASSERT_FALSE(cache.is_key_found("key"));
+    }
+
+    TEST_F(TieredCacheTest, Should_Expect_Flush_When_PendingWriteLimitReached)
+    {
+        auto configurations =
+            get_configurations(QLogicaeCore::TieredCacheWritePolicy::WRITE_BACK);
+        configurations.maximum_pending_write_count = 4;
+        QLogicaeCore::TieredCache cache(*database, configurations);
+
+        for (int index = 0; index < 4; ++index)
+        {
+            ASSERT_TRUE(cache.write(std::to_string(index), "value"));
+        }
+
+        ASSERT_EQ(cache.get_statistics().pending_write_count, 0);
+        for (int index = 0; index < 4; ++index)
+        {
+            ASSERT_EQ(read_backend(std::to_string(index)), "value");
+        }
+    }
+
+    TEST_F(TieredCacheTest, Should_Expect_PendingWritesFlushed_When_Destroyed)
+    {
+        {
+            QLogicaeCore::TieredCache cache(
+                *database,
+                get_configurations(QLogicaeCore::TieredCacheWritePolicy::WRITE_BACK)
+            );
+
+            ASSERT_TRUE(cache.write("key", "value"));
+        }
+
+        ASSERT_EQ(read_backend("key"), "value");
+    }
+
+    TEST_F(TieredCacheTest, Should_Expect_LatestValue_When_ReadRacesWriteBack)
+    {
+        QLogicaeCore::TieredCache cache(
+            *database,
+            get_configurations(QLogicaeCore::TieredCacheWritePolicy::WRITE_BACK)
+        );
+
+        for (int round = 0; round < 1000; ++round)
+        {
+            const std::string stale_value = "stale_" + std::to_string(round);
+            const std::string latest_value = "latest_" + std::to_string(round);
+            write_backend("key", stale_value);
+            cache.invalidate("key");
+
+            std::atomic<bool> is_started { false };
+            std::thread reader([&cache, &is_started]()
+                {
+                    while (!is_started.load())
+                    {
+                    }
+                    cache.read("key");
+                }
+            );
+            std::thread writer([&cache, &is_started, &latest_value]()
+                {
+                    while (!is_started.load())
+                    {
+                    }
+                    cache.write("key", latest_value);
+                }
+            );
+            is_started.store(true);
+            reader.join();
+            writer.join();
+
+            ASSERT_EQ(cache.read("key"), latest_value);
+            ASSERT_TRUE(cache.flush());
+        }
+    }
+
+    TEST_F(TieredCacheTest, Should_Expect_Removal_When_ReadRacesRemove)
+    {
+        for (const auto write_policy :
+            {
+                QLogicaeCore::TieredCacheWritePolicy::WRITE_THROUGH,
+                QLogicaeCore::TieredCacheWritePolicy::WRITE_BACK
+            })
+        {
+            QLogicaeCore::TieredCache cache(
+                *database,
+                get_configurations(write_policy)
+            );
+
+            for (int round = 0; round < 1000; ++round)
+            {
+                write_backend("key", "stale");
+                cache.invalidate("key");
+
+                std::atomic<bool> is_started { false };
+                std::thread reader([&cache, &is_started]()
+                    {
+                        while (!is_started.load())
+                        {
+                        }
+                        cache.read("key");
+                    }
+                );
+                std::thread remover([&cache, &is_started]()
+                    {
+                        while (!is_started.load())
+                        {
+                        }
+                        cache.remove("key");
+                    }
+                );
+                is_started.store(true);
+                reader.join();
+                remover.join();
+
+                ASSERT_FALSE(cache.is_key_found("key"));
+                ASSERT_TRUE(cache.flush());
+            }
+        }
+    }
+}
@@ -862,4 +862,260 @@ namespace QLogicaeCoreTest
         ASSERT_FALSE(validators.is_data_uri("notdatauri"));
     }
 
+    TEST_F(ValidatorsTemplateTest, Should_Evaluate_Matchers_At_Compile_Time)
+    {
+        static_assert(QLogicaeCore::ValidationMatchers::match_hex("deadBEEF"));
+        static_assert(!QLogicaeCore::ValidationMatchers::match_hex(""));
+        static_assert(QLogicaeCore::ValidationMatchers::match_ipv4("10.0.0.255"));
+        static_assert(!QLogicaeCore::ValidationMatchers::match_ipv4("10.0.0.256"));
+        static_assert(QLogicaeCore::ValidationMatchers::match_hex_color("#a1B"));
+        static_assert(!QLogicaeCore::ValidationMatchers::match_hex_color("#a1B2"));
+        static_assert(QLogicaeCore::ValidationMatchers::match_base64("c29tZXRleHQ="));
+        static_assert(!QLogicaeCore::ValidationMatchers::match_base64("c29tZXRleHQ"));
+
+        SUCCEED();
+    }
+
+    TEST_F(ValidatorsTemplateTest, Should_Match_Boundaries_Of_Hand_Written_Matchers)
+    {
+        ASSERT_TRUE(validators.is_iso8601("2024-01-31T23:59:59Z"));
+        ASSERT_TRUE(validators.is_iso8601("2024-01-31T23:59:59+08:00"));
+        ASSERT_FALSE(validators.is_iso8601("2024-01-31 23:59:59"));
+
+        ASSERT_TRUE(validators.is_rgb_color("rgb( 255, 0 ,12 )"));
+        ASSERT_FALSE(validators.is_rgb_color("rgb(1,2)"));
+        ASSERT_TRUE(validators.is_rgba_color("rgba(1,2,3,.5)"));
+        ASSERT_FALSE(validators.is_rgba_color("rgba(1,2,3,2)"));
+
+        ASSERT_TRUE(validators.is_mac_address("00:1A:2b:3C:4d:5E"));
+        ASSERT_FALSE(validators.is_mac_address("00:1A:2b:3C:4d"));
+
+        ASSERT_TRUE(validators.is_domain("sub.example.co"));
+        ASSERT_FALSE(validators.is_domain("example..co"));
+
+        ASSERT_TRUE(validators.is_e164_phone_number("+639171234567"));
+        ASSERT_FALSE(validators.is_e164_phone_number("+1234567890123456"));
+
+        ASSERT_TRUE(validators.is_full_name("Mary-Jane O'Neil"));
+        ASSERT_FALSE(validators.is_full_name("Mary  Jane"));
+
+        ASSERT_TRUE(validators.is_file_extension("tar7"));
+        ASSERT_FALSE(validators.is_file_extension(""));
+        ASSERT_FALSE(validators.is_file_extension("tar.gz"));
+    }
+
+    TEST_F(ValidatorsTemplateTest, Should_Agree_With_Replaced_Patterns_When_Fuzzed)
+    {
+        const std::vector<std::pair<std::string,
+            std::function<bool(const std::string_view&)>>> checks = {
+            { R"(^\d{4}-\d{2}-\d{2}T\d{2}:\d{2}:\d{2}(Z|[+-]\d{2}:\d{2})?$)",
+                [this](const std::string_view& value) { return validators.is_iso8601(value); } },
+            { R"(^#(?:[0-9a-fA-F]{3}){1,2}$)",
+                [this](const std::string_view& value) { return validators.is_hex_color(value); } },
+            { R"(^([A-Za-z0-9+/]{4})*([A-Za-z0-9+/]{2}==|[A-Za-z0-9+/]{3}=)?$)",
+                [this](const std::string_view& value) { return validators.is_base64(value); } },
+            { R"(^[a-z0-9]+(?:-[a-z0-9]+)*$)",
+                [this](const std::string_view& value) { return validators.is_slug(value); } },
+            { R"(^(0x)?[0-9a-fA-F]+$)",
+                [this](const std::string_view& value) { return validators.is_hex(value); } },
+            { R"(^[a-fA-F0-9]{8}-[a-fA-F0-9]{4}-4[a-fA-F0-9]{3}-[89abAB][a-fA-F0-9]{3}-[a-fA-F0-9]{12}$)",
+                [this](const std::string_view& value) { return validators.is_uuid4(value); } },
+            { R"(^[a-fA-F0-9]{8}-[a-fA-F0-9]{4}-6[a-fA-F0-9]{3}-[89abAB][a-fA-F0-9]{3}-[a-fA-F0-9]{12}$)",
+                [this](const std::string_view& value) { return validators.is_uuid6(value); } },
+            { R"(^((25[0-5]|2[0-4]\d|1\d{2}|[1-9]?\d)\.){3}(25[0-5]|2[0-4]\d|1\d{2}|[1-9]?\d)$)",
+                [this](const std::string_view& value) { return validators.is_ipv4(value); } },
+            { R"(^([0-9a-fA-F]{1,4}:){7}[0-9a-fA-F]{1,4}$)",
+                [this](const std::string_view& value) { return validators.is_ipv6(value); } },
+            { R"(^https?:\/\/(?:www\.)?[a-zA-Z0-9.-]+(?:\:\d+)?(?:\/\S*)?$)",
+                [this](const std::string_view& value) { return validators.is_url(value); } },
+            { R"(^([0-9A-Fa-f]{2}[:-]){5}([0-9A-Fa-f]{2})$)",
+                [this](const std::string_view& value) { return validators.is_mac_address(value); } },
+            { R"(^(([a-zA-Z0-9]|[a-zA-Z0-9][a-zA-Z0-9\-]*[a-zA-Z0-9])\.)*([A-Za-z0-9]|[A-Za-z0-9][A-Za-z0-9\-]*[A-Za-z0-9])$)",
+                [this](const std::string_view& value) { return validators.is_hostname(value); } },
+            { R"(^([a-zA-Z0-9]+(-[a-zA-Z0-9]+)*\.)+[a-zA-Z]{2,}$)",
+                [this](const std::string_view& value) { return validators.is_domain(value); } },
+            { R"(^rgb\((\s*\d{1,3}\s*,){2}\s*\d{1,3}\s*\)$)",
+                [this](const std::string_view& value) { return validators.is_rgb_color(value); } },
+            { R"(^rgba\((\s*\d{1,3}\s*,){3}\s*(0|1|0?\.\d+)\s*\)$)",
+                [this](const std::string_view& value) { return validators.is_rgba_color(value); } },
+            { R"(^[a-zA-Z0-9]+$)",
+                [this](const std::string_view& value) { return validators.is_file_extension(value); } },
+            { R"(^data:image\/(png|jpeg|jpg|gif);base64,([A-Za-z0-9+/]{4})*([A-Za-z0-9+/]{2}==|[A-Za-z0-9+/]{3}=)?$)",
+                [this](const std::string_view& value) { return validators.is_base64_image(value); } },
+            { R"(^data:[a-zA-Z0-9!#$&^_.+-]+\/[a-zA-Z0-9!#$&^_.+-]+;base64,([A-Za-z0-9+/]{4})*([A-Za-z0-9+/]{2}==|[A-Za-z0-9+/]{3}=)?$)",
+                [this](const std::string_view& value) { return validators.is_data_uri(value); } },
+            { R"(^\+\d{1,15}$)",
+                [this](const std::string_view& value) { return validators.is_e164_phone_number(value); } },
+            { R"(^\+\d{1,3}$)",
+                [this](const std::string_view& value) { return validators.is_country_calling_code(value); } },
+            { R"(^[a-zA-Z]+([ '-][a-zA-Z]+)*$)",
+                [this](const std::string_view& value) { return validators.is_full_name(value); } },
+            { R"(^[a-zA-Z0-9._%+-]+@[a-zA-Z0-9.-]+\.[a-zA-Z]{2,}$)",
+                [this](const std::string_view& value) { return validators.is_email(value); } }
+        };
+
+        const std::vector<std::string> seeds = {
+            "", "2024-01-31T23:59:59Z", "2024-01-31T23:59:59+08:00", "#fff", "#A0b1C2",
+            "SGVsbG8=", "SGVsbA==", "c29tZXRleHQ", "slug-case-1", "0xCAFE", "deadbeef",
+            "550e8400-e29b-41d4-a716-446655440000", "1b4e28ba-2fa1-61d2-883f-0016d3cca427",
+            "192.168.0.1", "255.250.09.0", "2001:0db8:85a3:0000:0000:8a2e:0370:7334",
+            "http://www.example.com:8080/path?query=1", "https://a-b.c/", "00:1A:2b:3C:4d:5E",
+            "01-23-45-67-89-ab", "sub.example.co", "a-b.c-d.e", "-a.b", "rgb( 255, 0 ,12 )",
+            "rgba(1,2,3,.5)", "rgba(1, 2, 3, 0.25)", "tar7", "data:image/png;base64,SGVsbG8=",
+            "data:text/plain;base64,SGVsbA==", "+639171234567", "+63", "Mary-Jane O'Neil",
+            "user.name+tag@example.co.uk", "a@b.cd"
+        };
+        const std::string alphabet =
+            "0123456789abcdefABCDEFxXTZzgG-+:./#=@%'_,;()! \t\n\xE9";
+
+        std::mt19937 generator(20240131);
+        const auto pick = [&generator](const std::size_t count)
+        {
+            return std::uniform_int_distribution<std::size_t>(0, count - 1)(generator);
+        };
+
+        std::vector<std::string> inputs = seeds;
+        for (int index = 0; index < 4000; ++index)
+        {
+            std::string input = seeds[pick(seeds.size())];
+            const std::size_t edit_count = 1 + pick(3);
+            for (std::size_t edit = 0; edit < edit_count; ++edit)
+            {
+                const std::size_t position = pick(input.size() + 1);
+                switch (pick(4))
+                {
+                case 0:
+                    input.insert(position, 1, alphabet[pick(alphabet.size())]);
+                    break;
+                case 1:
+                    if (position < input.size())
+                    {
+                        input.erase(position, 1);
+                    }
+                    break;
+                case 2:
+                    if (position < input.size())
+                    {
+                        input[position] = alphabet[pick(alphabet.size())];
+                    }
+                    break;
+                default:
+                    input.insert(position, input.substr(0, position));
+                    break;
+                }
+            }
+            inputs.push_back(std::move(input));
+        }
+        for (int index = 0; index < 1000; ++index)
+        {
+            std::string input(pick(24), '\0');
+            for (char& character : input)
+            {
+                character = alphabet[pick(alphabet.size())];
+            }
+            inputs.push_back(std::move(input));
+        }
+
+        for (const auto& [pattern, check] : checks)
+        {
+            const std::regex regular_expression(pattern);
+            for (const std::string& input : inputs)
+            {
+                ASSERT_EQ(check(input), std::regex_match(input, regular_expression))
+                    << "pattern: " << pattern << " input: " << input;
+            }
+        }
+    }
+
+    TEST_F(ValidatorsTemplateTest, Should_Match_Single_Checks_When_Validating_Many)
+    {
+        const std::vector<std::string_view> values = {
+            "", "deadbeef", "0xCAFE", "c29tZXRleHQ=", "abc", "ABC", "aBc123",
+            "12.50", "1.2.3", "\xC3\xA9t\xC3\xA9", "\xC0\x80",
+            "abcdefghijklmnopqrstuvwxyz", "ABCDEFGHIJKLMNOPQRSTUVWXYZ0123456789",
+            "0123456789abcdef0123456789ABCDEF!"
+        };
+
+        const std::vector<std::pair<QLogicaeCore::ValidationPredicate,
+            std::function<bool(const std::string_view&)>>> checks = {
+            { QLogicaeCore::ValidationPredicate::HEX,
+                [this](const std::string_view& value) { return validators.is_hex(value); } },
+            { QLogicaeCore::ValidationPredicate::BASE64,
+                [this](const std::string_view& value) { return validators.is_base64(value); } },
+            { QLogicaeCore::ValidationPredicate::ALPHANUMERIC,
+                [this](const std::string_view& value) { return validators.is_alpanumeric(value); } },
+            { QLogicaeCore::ValidationPredicate::LOWERCASE,
+                [this](const std::string_view& value) { return validators.is_lowercase(value); } },
+            { QLogicaeCore::ValidationPredicate::UPPERCASE,
+                [this](const std::string_view& value) { return validators.is_uppercase(value); } },
+            { QLogicaeCore::ValidationPredicate::UTF8,
+                [this](const std::string_view& value) { return validators.is_utf8(value); } },
+            { QLogicaeCore::ValidationPredicate::DECIMAL,
+                [this](const std::string_view& value) { return validators.is_decimal(value); } }
+        };
+
+        for (const auto& [predicate, check] : checks)
+        {
+            boost::dynamic_bitset<> flags = validators.validate_many(values, predicate);
+
+            ASSERT_EQ(flags.size(), values.size());
+            for (std::size_t index = 0; index < values.size(); ++index)
+            {
+                ASSERT_EQ(flags.test(index), check(values[index]));
+            }
+        }
+    }
+
+    TEST_F(ValidatorsTemplateTest, Should_Partition_When_Validating_Many_Large_Inputs)
+    {
+        std::vector<std::string> cells(100'003);
+        for (std::size_t index = 0; index < cells.size(); ++index)
+        {
+            cells[index] = index % 3 == 0 ?
+                std::to_string(index) : "x" + std::to_string(index);
+        }
+        std::vector<std::string_view> values(cells.begin(), cells.end());
+
+        QLogicaeCore::Result<boost::dynamic_bitset<>> result;
+        validators.validate_many(result, values,
+            QLogicaeCore::ValidationPredicate::DECIMAL);
+
+        ASSERT_TRUE(result.is_status_safe());
+        ASSERT_EQ(result.get_value().size(), values.size());
+        ASSERT_EQ(result.get_value().count(), (values.size() + 2) / 3);
+        for (std::size_t index = 0; index < values.size(); ++index)
+        {
+            ASSERT_EQ(result.get_value().test(index), index % 3 == 0);
+        }
+
+        boost::dynamic_bitset<> emails = validators.validate_many(values,
+            [this](const std::string_view& value)
+            {
+                return validators.is_email(value);
+            });
+        ASSERT_TRUE(emails.none());
+    }
+
+    TEST_F(ValidatorsTemplateTest, Should_Validate_Utf8_Sequences_Across_Block_Boundaries)
+    {
+        const std::string prefix(31, 'a');
+
+        ASSERT_TRUE(validators.is_utf8(prefix + "\xF0\x9F\x98\x80"));
+        ASSERT_TRUE(validators.is_utf8(prefix + "\xE2\x82\xAC" + prefix));
+        ASSERT_FALSE(validators.is_utf8(prefix + "\xF0\x9F\x98"));
+        ASSERT_FALSE(validators.is_utf8(prefix + "\xED\xA0\x80"));
+        ASSERT_FALSE(validators.is_utf8(prefix + "\xE0\x9F\x80"));
+        ASSERT_FALSE(validators.is_utf8(prefix + "\xF4\x90\x80\x80"));
+        ASSERT_FALSE(validators.is_utf8(prefix + "\x80" + prefix));
+    }
+
+    TEST_F(ValidatorsTemplateTest, Should_Validate_Utf16_Surrogate_Pairs)
+    {
+        ASSERT_TRUE(validators.is_utf16(std::string("\xFF\xFE\x3D\xD8\x00\xDE", 6)));
+        ASSERT_TRUE(validators.is_utf16(std::string("\xFE\xFF\xD8\x3D\xDE\x00", 6)));
+        ASSERT_FALSE(validators.is_utf16(std::string("\xFF\xFE\x3D\xD8", 4)));
+        ASSERT_FALSE(validators.is_utf16(std::string("\xFF\xFE\x00\xDE\x3D\xD8", 6)));
+        ASSERT_FALSE(validators.is_utf16(std::string("\xFF\xFEa", 3)));
+    }
+
 }
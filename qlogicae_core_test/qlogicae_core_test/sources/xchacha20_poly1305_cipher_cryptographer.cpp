@@ -203,4 +203,125 @@ namespace QLogicaeCoreTest
         EXPECT_EQ(decrypted, input);
     }
 
+    TEST_F(XChaCha20Poly1305CipherCryptographerTest,
+        Should_Expect_RawRoundTrip_When_UsingSpans)
+    {
+        const std::string input = "field level payload";
+
+        std::vector<unsigned char> cipher(crypto.get_cipher_size(input.size()));
+        QLogicaeCore::Result<std::size_t> transform_result;
+        crypto.transform(
+            transform_result,
+            std::span<const unsigned char>(
+                reinterpret_cast<const unsigned char*>(input.data()),
+                input.size()),
+            cipher,
+            key,
+            nonce
+        );
+        ASSERT_TRUE(transform_result.is_status_safe());
+        EXPECT_EQ(transform_result.get_value(), cipher.size());
+
+        std::vector<unsigned char> text(crypto.get_text_size(cipher.size()));
+        QLogicaeCore::Result<std::size_t> reverse_result;
+        crypto.reverse(reverse_result, cipher, text, key, nonce);
+        ASSERT_TRUE(reverse_result.is_status_safe());
+        EXPECT_EQ(std::string(text.begin(), text.end()), input);
+
+        cipher.front() ^= 0x01;
+        QLogicaeCore::Result<std::size_t> tampered_result;
+        crypto.reverse(tampered_result, cipher, text, key, nonce);
+        EXPECT_FALSE(tampered_result.is_status_safe());
+    }
+
+    TEST_F(XChaCha20Poly1305CipherCryptographerTest,
+        Should_Expect_FileRoundTrip_When_StreamingMultipleChunks)
+    {
+        const std::string plain_path = "test_xchacha20_stream_plain.bin";
+        const std::string cipher_path = "test_xchacha20_stream_cipher.bin";
+        const std::string output_path = "test_xchacha20_stream_output.bin";
+
+        std::string content(200'000, '\0');
+        for (std::size_t index = 0; index < content.size(); ++index)
+        {
+            content[index] = static_cast<char>(index * 7);
+        }
+
+        {
+            std::ofstream file(plain_path, std::ios::binary);
+            file.write(content.data(), content.size());
+        }
+
+        EXPECT_TRUE(crypto.transform_file(plain_path, cipher_path, key));
+        EXPECT_TRUE(crypto.reverse_file(cipher_path, output_path, key));
+
+        std::ifstream file(output_path, std::ios::binary);
+        const std::string output(
+            (std::istreambuf_iterator<char>(file)),
+            std::istreambuf_iterator<char>());
+        file.close();
+        EXPECT_EQ(output, content);
+
+        std::filesystem::resize_file(cipher_path,
+            std::filesystem::file_size(cipher_path) - 1);
+        EXPECT_FALSE(crypto.reverse_file(cipher_path, output_path, key));
+        EXPECT_FALSE(std::filesystem::exists(output_path));
+
+        std::error_code error_code;
+        std::filesystem::remove(plain_path, error_code);
+        std::filesystem::remove(cipher_path, error_code);
+        std::filesystem::remove(output_path, error_code);
+    }
+
+    TEST_F(XChaCha20Poly1305CipherCryptographerTest,
+        Should_Expect_BatchRoundTrip_When_EncryptingManyFields)
+    {
+        std::vector<std::string> fields(5'000);
+        for (std::size_t index = 0; index < fields.size(); ++index)
+        {
+            fields[index] = "cell-" + std::to_string(index) +
+                std::string(index % 40, 'x');
+        }
+
+        std::vector<std::string_view> texts(fields.begin(), fields.end());
+        std::vector<unsigned char> nonces(
+            texts.size() * crypto_aead_xchacha20poly1305_ietf_NPUBBYTES);
+        QLogicaeCore::Generator::get_instance().random_bytes(nonces.data(), nonces.size());
+
+        QLogicaeCore::CipherBatch ciphers =
+            crypto.transform_batch(texts, key, nonces);
+        ASSERT_EQ(ciphers.flags.count(), texts.size());
+
+        std::vector<std::string_view> cipher_views(texts.size());
+        for (std::size_t index = 0; index < texts.size(); ++index)
+        {
+            cipher_views[index] = ciphers.get_value(index);
+        }
+        EXPECT_EQ(
+            crypto.reverse(
+                std::string(cipher_views[42]), key, nonces.data() +
+                    42 * crypto_aead_xchacha20poly1305_ietf_NPUBBYTES),
+            fields[42]);
+
+        std::string tampered(cipher_views[7]);
+        tampered[0] = tampered[0] == 'A' ? 'B' : 'A';
+        cipher_views[7] = tampered;
+
+        QLogicaeCore::CipherBatch texts_batch =
+            crypto.reverse_batch(cipher_views, key, nonces);
+        EXPECT_FALSE(texts_batch.flags.test(7));
+        for (std::size_t index = 0; index < texts.size(); ++index)
+        {
+            if (index != 7)
+            {
+                ASSERT_TRUE(texts_batch.flags.test(index));
+                EXPECT_EQ(texts_batch.get_value(index), fields[index]);
+            }
+        }
+
+        QLogicaeCore::Result<QLogicaeCore::CipherBatch> mismatched_result;
+        crypto.transform_batch(mismatched_result, texts, key,
+            std::span<const unsigned char>(nonces).first(nonces.size() - 1));
+        EXPECT_FALSE(mismatched_result.is_status_safe());
+    }
 }